@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2022-2023 IRCAD France
+ * Copyright (C) 2022-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -23,11 +23,40 @@
 
 #include "config_manager.hpp"
 
+#include <core/exceptionmacros.hpp>
+
+#include <iomanip>
+
 namespace sight::app
 {
 
 //-----------------------------------------------------------------------------
 
+config_manager::config_manager()
+{
+    new_signal<signals::service_timing_t>(signals::SERVICE_TIMING);
+}
+
+//-----------------------------------------------------------------------------
+
+config_manager::start_policy config_manager::get_start_policy() const
+{
+    if(m_start_policy)
+    {
+        return *m_start_policy;
+    }
+
+    const auto policy = m_cfg_elem.get<std::string>("<xmlattr>.start_policy", "sequential");
+    SIGHT_THROW_IF(
+        "Unknown start policy " << std::quoted(policy) << ", expected \"sequential\" or \"parallel\".",
+        policy != "sequential" && policy != "parallel"
+    );
+
+    return policy == "parallel" ? start_policy::parallel : start_policy::sequential;
+}
+
+//-----------------------------------------------------------------------------
+
 SPTR(config_manager) config_manager::make()
 {
     return std::make_shared<app::detail::config_manager>();
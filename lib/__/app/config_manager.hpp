@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2015-2024 IRCAD France
+ * Copyright (C) 2015-2025 IRCAD France
  * Copyright (C) 2015-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -26,12 +26,17 @@
 
 #include "app/extension/config.hpp"
 
+#include <core/com/has_signals.hpp>
+#include <core/com/signal.hpp>
 #include <core/object.hpp>
 
 #include <data/map.hpp>
 
 #include <service/manager.hpp>
 
+#include <cstdint>
+#include <optional>
+
 namespace sight::app
 {
 
@@ -40,12 +45,38 @@ namespace sight::app
  * @deprecated This class is no longer supported, use app::config_manager.
  */
 class SIGHT_APP_CLASS_API config_manager : public core::object,
+                                           public core::com::has_signals,
                                            public service::manager
 {
 public:
 
     using config_t = boost::property_tree::ptree;
 
+    /**
+     * @brief Defines how the services listed in the <start> tags are started and stopped.
+     *
+     * It can be set with the "start_policy" attribute of the <config> tag, or with set_start_policy().
+     */
+    enum class start_policy : std::uint8_t
+    {
+        /// Services are started in the order of the <start> tags and stopped in the reverse order.
+        sequential,
+
+        /**
+         * Services are sorted in a dependency graph: a service depends on the previous ones sharing one of its objects
+         * or running on the same worker. Independent services are started concurrently on their workers, and stopped
+         * the same way in the reverse order of the graph.
+         */
+        parallel
+    };
+
+    struct signals
+    {
+        /// Emitted each time a service is started or stopped, with its uid, "start" or "stop" and the duration in ms
+        using service_timing_t = core::com::signal<void (std::string, std::string, double)>;
+        static inline const core::com::signals::key_t SERVICE_TIMING = "service_timing";
+    };
+
     SIGHT_DECLARE_CLASS(config_manager, core::object);
 
     /// Destructor. Do nothing.
@@ -65,6 +96,12 @@ public:
     /// Set configuration
     void set_config(const config_t& _cfg);
 
+    /// Sets the start policy, which overrides the one of the configuration. It must be set before start().
+    void set_start_policy(start_policy _policy);
+
+    /// Returns the start policy, given either by set_start_policy() or by the configuration
+    start_policy get_start_policy() const;
+
     /**
      * @brief Set configuration
      * @param _config_id the identifier of the requested config.
@@ -103,8 +140,8 @@ public:
 
 protected:
 
-    /// Constructor. Does nothing.
-    SIGHT_APP_API config_manager() = default;
+    /// Constructor. Creates the signals.
+    SIGHT_APP_API config_manager();
 
     enum config_state
     {
@@ -119,6 +156,9 @@ protected:
 
     /// Running state of the app config manager
     config_state m_state {state_destroyed};
+
+    /// Start policy set with set_start_policy(), if any
+    std::optional<start_policy> m_start_policy;
 };
 
 //------------------------------------------------------------------------------
@@ -158,4 +198,11 @@ inline void config_manager::set_config(const config_t& _cfg)
 
 //------------------------------------------------------------------------------
 
+inline void config_manager::set_start_policy(start_policy _policy)
+{
+    m_start_policy = _policy;
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace sight::app
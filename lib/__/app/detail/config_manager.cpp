@@ -32,9 +32,11 @@
 #include "service/registry.hpp"
 
 #include <core/com/proxy.hpp>
+#include <core/com/signal.hxx>
 #include <core/com/slots.hxx>
 #include <core/runtime/exit_exception.hpp>
 #include <core/runtime/runtime.hpp>
+#include <core/thread/worker_pool.hpp>
 
 #define FW_PROFILING_DISABLED
 #include <core/profiling.hpp>
@@ -43,6 +45,12 @@
 
 #include <boost/range/iterator_range_core.hpp>
 #include <boost/thread/futures/wait_for_all.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
 #include <ranges>
 
 namespace sight::app::detail
@@ -233,7 +241,7 @@ void config_manager::stop()
     m_add_object_connection.disconnect();
     m_remove_object_connection.disconnect();
 
-    std::vector<service::base::shared_future_t> futures;
+    std::vector<service::base::sptr> services;
     std::vector<core::com::connection::blocker> blockers;
     {
         core::mt::scoped_lock lock(m_mutex);
@@ -260,14 +268,16 @@ void config_manager::stop()
             {
                 auto sig = srv->signal(service::signals::STOPPED);
                 blockers.emplace_back(sig->get_connection(slot(REMOVE_STARTED_SRV_SLOT)));
-                futures.emplace_back(srv->stop());
+                services.push_back(srv);
             }
         }
 
         m_started_srv.clear();
         m_state = state_stopped;
     }
-    std::ranges::for_each(futures, std::mem_fn(&std::shared_future<void>::wait));
+
+    // Objects can no longer be added or removed once stopped, so the services can be stopped outside of the lock
+    this->run_services(services, service_action::stop);
 
     app::helper::config::clear_props();
 }
@@ -294,6 +304,7 @@ void config_manager::destroy()
     m_deferred_start_srv.clear();
     m_deferred_update_srv.clear();
     m_services_proxies.clear();
+    m_service_objects.clear();
 
     m_state = state_destroyed;
 }
@@ -416,13 +427,14 @@ void config_manager::destroy_created_services()
 
     std::ranges::for_each(m_created_workers, [](auto& _x){core::thread::remove_worker(_x);});
     m_created_workers.clear();
+    m_worker_lanes.clear();
 }
 
 // ------------------------------------------------------------------------
 
 void config_manager::process_start_items(const core::runtime::config_t& _element)
 {
-    std::vector<service::base::shared_future_t> futures;
+    std::vector<service::base::sptr> services;
     std::vector<core::com::connection::blocker> blockers;
 
     for(const auto& elem : _element)
@@ -453,13 +465,257 @@ void config_manager::process_start_items(const core::runtime::config_t& _element
 
                 auto sig = srv->signal(service::signals::STARTED);
                 blockers.emplace_back(sig->get_connection(slot(ADD_STARTED_SRV_SLOT)));
-                futures.emplace_back(srv->start());
+                services.push_back(srv);
                 m_started_srv.push_back(srv);
             }
         }
     }
 
-    std::ranges::for_each(futures, std::mem_fn(&std::shared_future<void>::wait));
+    this->run_services(services, service_action::start);
+}
+
+// ------------------------------------------------------------------------
+
+void config_manager::run_services(const std::vector<service::base::sptr>& _services, service_action _action)
+{
+    const auto policy       = this->get_start_policy();
+    const auto action_name  = std::string(_action == service_action::start ? "start" : "stop");
+    const auto start_time   = std::chrono::steady_clock::now();
+    const auto current_id   = core::thread::get_current_thread_id();
+    const std::size_t count = _services.size();
+
+    // Durations are written by the workers, but only read once every service is done
+    std::vector<double> durations(count, 0.);
+
+    std::mutex done_mutex;
+    std::condition_variable done_condition;
+    std::vector<std::size_t> done;
+
+    // First exception thrown by a service, rethrown once all the dispatched services are done
+    std::exception_ptr error;
+
+    const auto runs_here =
+        [current_id](const service::base::sptr& _srv)
+        {
+            const auto worker = _srv->worker();
+            return !worker || worker->get_thread_id() == current_id;
+        };
+
+    // Records that a service is done, whether it succeeded or not, so that no one waits for it forever
+    const auto finish =
+        [&done_mutex, &done_condition, &done, &error](std::size_t _index, std::exception_ptr _error)
+        {
+            std::unique_lock lock(done_mutex);
+            if(_error && !error)
+            {
+                error = std::move(_error);
+            }
+
+            done.push_back(_index);
+            done_condition.notify_one();
+        };
+
+    const auto failed =
+        [&done_mutex, &error]
+        {
+            std::unique_lock lock(done_mutex);
+            return error != nullptr;
+        };
+
+    // Starts or stops a service from its own thread, so the measure does not include the time spent in the queue
+    const auto run =
+        [&durations, &finish, _action](const service::base::sptr& _srv, std::size_t _index)
+        {
+            std::exception_ptr exception;
+            const auto begin = std::chrono::steady_clock::now();
+            try
+            {
+                (_action == service_action::start ? _srv->start() : _srv->stop()).wait();
+            }
+            catch(...)
+            {
+                exception = std::current_exception();
+            }
+
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - begin;
+            durations[_index] = elapsed.count();
+
+            finish(_index, std::move(exception));
+        };
+
+    // The dispatched services always call finish(), so this function never returns while they use its variables
+    const auto dispatch =
+        [&](std::size_t _index) -> std::shared_future<void>
+        {
+            const auto& srv = _services[_index];
+            if(runs_here(srv))
+            {
+                run(srv, _index);
+                return {};
+            }
+
+            try
+            {
+                return srv->worker()->post_task<void>([&run, srv, _index]{run(srv, _index);});
+            }
+            catch(...)
+            {
+                finish(_index, std::current_exception());
+                return {};
+            }
+        };
+
+    if(policy == start_policy::sequential)
+    {
+        // Once a service fails, the following ones are not dispatched
+        std::vector<std::shared_future<void> > futures;
+        for(std::size_t i = 0 ; i < count && !failed() ; ++i)
+        {
+            futures.emplace_back(dispatch(i));
+        }
+
+        for(const auto& future : futures)
+        {
+            if(future.valid())
+            {
+                future.wait();
+            }
+        }
+    }
+    else
+    {
+        // Build the dependency graph, a service only depends on the previous ones
+        std::vector<std::vector<std::size_t> > successors(count);
+        std::vector<std::size_t> pending(count, 0);
+        for(std::size_t i = 0 ; i < count ; ++i)
+        {
+            for(std::size_t j = 0 ; j < i ; ++j)
+            {
+                if(this->depends_on(_services[i], _services[j]))
+                {
+                    successors[j].push_back(i);
+                    ++pending[i];
+                }
+            }
+        }
+
+        std::deque<std::size_t> ready;
+        for(std::size_t i = 0 ; i < count ; ++i)
+        {
+            if(pending[i] == 0)
+            {
+                ready.push_back(i);
+            }
+        }
+
+        // Once a service fails, the ready ones are not dispatched anymore, but the dispatched ones are waited for
+        std::size_t in_flight = 0;
+        std::vector<std::shared_future<void> > futures;
+        while(true)
+        {
+            if(!failed())
+            {
+                // Services sharing a worker depend on each other, so at most one service of this thread can be ready
+                std::optional<std::size_t> local;
+                for(const auto index : ready)
+                {
+                    ++in_flight;
+                    if(runs_here(_services[index]))
+                    {
+                        local = index;
+                    }
+                    else
+                    {
+                        futures.emplace_back(dispatch(index));
+                    }
+                }
+
+                // Let the other workers progress while this thread runs its own service
+                if(local)
+                {
+                    dispatch(*local);
+                }
+            }
+
+            ready.clear();
+            if(in_flight == 0)
+            {
+                break;
+            }
+
+            std::vector<std::size_t> completed;
+            {
+                std::unique_lock lock(done_mutex);
+                done_condition.wait(lock, [&done]{return !done.empty();});
+                std::swap(completed, done);
+            }
+
+            for(const auto index : completed)
+            {
+                --in_flight;
+                for(const auto successor : successors[index])
+                {
+                    if(--pending[successor] == 0)
+                    {
+                        ready.push_back(successor);
+                    }
+                }
+            }
+        }
+
+        std::ranges::for_each(futures, std::mem_fn(&std::shared_future<void>::wait));
+    }
+
+    if(error)
+    {
+        std::rethrow_exception(error);
+    }
+
+    const std::chrono::duration<double, std::milli> wall_time = std::chrono::steady_clock::now() - start_time;
+
+    double total = 0.;
+    for(std::size_t i = 0 ; i < count ; ++i)
+    {
+        const auto& uid = _services[i]->get_id();
+        total += durations[i];
+
+        SIGHT_INFO(
+            this->msg_head() << "service_timing action=" << action_name << " uid=" << uid
+            << " duration_ms=" << durations[i]
+        );
+        this->async_emit(signals::SERVICE_TIMING, uid, action_name, durations[i]);
+    }
+
+    if(count > 0)
+    {
+        SIGHT_INFO(
+            this->msg_head() << "services_timing action=" << action_name << " policy="
+            << (policy == start_policy::parallel ? "parallel" : "sequential") << " services=" << count
+            << " total_ms=" << total << " wall_ms=" << wall_time.count()
+        );
+    }
+}
+
+// ------------------------------------------------------------------------
+
+bool config_manager::depends_on(const service::base::sptr& _second, const service::base::sptr& _first) const
+{
+    // Services of the same worker run one after the other anyway, keep the order of the configuration
+    if(_second->worker() == _first->worker())
+    {
+        return true;
+    }
+
+    const auto second_objects = m_service_objects.find(_second->get_id());
+    const auto first_objects  = m_service_objects.find(_first->get_id());
+    if(second_objects == m_service_objects.end() || first_objects == m_service_objects.end())
+    {
+        return false;
+    }
+
+    return std::ranges::any_of(
+        second_objects->second,
+        [&first_objects](const auto& _uid){return first_objects->second.contains(_uid);});
 }
 
 // ------------------------------------------------------------------------
@@ -648,19 +904,53 @@ service::base::sptr config_manager::create_service(const detail::service_config&
     service::register_service(srv);
     m_created_srv.push_back(srv);
 
-    if(!_srv_config.m_worker.empty())
+    auto& objects = m_service_objects[_srv_config.m_uid];
+    for(const auto& [key, object_cfg] : _srv_config.m_objects)
     {
+        objects.insert(object_cfg.m_uid);
+    }
+
+    if(!_srv_config.m_worker.empty() || !_srv_config.m_lane.empty())
+    {
+        // A lane without a worker name is private to the service
+        const auto& worker_name = _srv_config.m_worker.empty() ? _srv_config.m_uid : _srv_config.m_worker;
+
         // Make the worker name unique to prevent conflicts between configurations
-        const auto worker_registry_name   = core::id::join(m_config_uid, _srv_config.m_worker);
+        const auto worker_registry_name   = core::id::join(m_config_uid, worker_name);
         core::thread::worker::sptr worker = core::thread::get_worker(worker_registry_name);
         if(!worker)
         {
-            worker = core::thread::worker::make();
-            // We keep the original non-unique name for the name of the worker, which is only used for debugging
-            worker->set_thread_name(_srv_config.m_worker);
+            if(_srv_config.m_lane.empty())
+            {
+                worker = core::thread::worker::make();
+                // We keep the original non-unique name for the name of the worker, which is only used for debugging
+                worker->set_thread_name(worker_name);
+            }
+            else
+            {
+                // Lanes share the threads of the default pool, a slow service does not hold back real-time ones
+                worker = core::thread::get_default_worker_pool()->make_lane(
+                    core::thread::to_priority(_srv_config.m_lane)
+                );
+            }
 
             core::thread::add_worker(worker_registry_name, worker);
             m_created_workers.push_back(worker);
+            m_worker_lanes[worker_registry_name] = _srv_config.m_lane;
+        }
+        else if(const auto lane = m_worker_lanes.find(worker_registry_name); lane != m_worker_lanes.end())
+        {
+            // The services of a worker share its priority, the one of the first service is kept
+            const auto describe =
+                [](const std::string& _lane)
+                {
+                    return _lane.empty() ? std::string("a dedicated thread") : "the lane '" + _lane + "'";
+                };
+            SIGHT_ERROR_IF(
+                this->msg_head() + "Service '" + _srv_config.m_uid + "' requests " + describe(_srv_config.m_lane)
+                + " but shares the worker '" + worker_name + "', which runs on " + describe(lane->second) + ".",
+                lane->second != _srv_config.m_lane
+            );
         }
 
         srv->set_worker(worker);
@@ -37,6 +37,7 @@
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -142,6 +143,28 @@ private:
 
     void process_start_items(const core::runtime::config_t&);
 
+    /// Action performed on services by run_services()
+    enum class service_action : std::uint8_t
+    {
+        start,
+        stop
+    };
+
+    /**
+     * @brief Starts or stops services, waits for them and reports how long each one took.
+     *
+     * With the sequential policy, services are dispatched in the given order. With the parallel policy, a service is
+     * dispatched as soon as all the previous services it depends on are done, the services running on other workers
+     * being dispatched before the ones running on the current thread.
+     *
+     * @param _services services, in the order of the <start> tags for a start, in the reverse order for a stop.
+     * @param _action start or stop.
+     */
+    void run_services(const std::vector<service::base::sptr>& _services, service_action _action);
+
+    /// Returns true if the service _second must wait for the service _first with the parallel policy.
+    bool depends_on(const service::base::sptr& _second, const service::base::sptr& _first) const;
+
     void process_update_items();
 
     /// Parses objects section and create objects.
@@ -237,6 +260,9 @@ private:
     /// List of services started in this configuration.
     service_container m_started_srv;
 
+    /// Uids of the objects used by each service, indexed by service uid, used to build the parallel start graph.
+    std::unordered_map<std::string, std::unordered_set<std::string> > m_service_objects;
+
     /// Start ordered list of deferred services.
     std::vector<std::string> m_deferred_start_srv;
 
@@ -246,6 +272,9 @@ private:
     /// List of created workers
     std::vector<core::thread::worker::sptr> m_created_workers;
 
+    /// Lane of each created worker, indexed by worker registry name, empty for dedicated threads
+    std::unordered_map<std::string, std::string> m_worker_lanes;
+
     /// Counter used to generate a unique proxy name.
     unsigned int m_proxy_id {0};
 
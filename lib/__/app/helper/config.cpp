@@ -31,11 +31,14 @@
 #include <core/com/has_signals.hpp>
 #include <core/com/has_slots.hpp>
 #include <core/com/helper/sig_slot_connection.hpp>
+#include <core/memory/buffer_allocation_policy.hpp>
 #include <core/object.hpp>
 #include <core/ptree.hpp>
 #include <core/runtime/runtime.hpp>
 
+#include <data/array.hpp>
 #include <data/extension/config.hpp>
+#include <data/image.hpp>
 #include <data/object.hpp>
 
 #include <array>
@@ -229,6 +232,26 @@ void config::parse_object(
             {
                 obj_parser->parse(config, obj, _objects);
             }
+
+            if(const auto allocation = config.get_optional<std::string>("<xmlattr>.allocation"); allocation)
+            {
+                const auto policy = core::memory::buffer_allocation_policy::make(*allocation);
+                if(auto image = std::dynamic_pointer_cast<data::image>(obj); image)
+                {
+                    image->set_allocation_policy(policy);
+                }
+                else if(auto array = std::dynamic_pointer_cast<data::array>(obj); array)
+                {
+                    array->set_allocation_policy(policy);
+                }
+                else
+                {
+                    SIGHT_THROW(
+                        "\"allocation\" attribute is not supported by objects of type "
+                        << std::quoted(obj->get_classname()) << ", only by images and arrays."
+                    );
+                }
+            }
         }
 
         // If there is no uid defined in the config, we use the one generated from get_id()
@@ -332,6 +355,7 @@ app::detail::service_config config::parse_service(
 
     // Worker key
     srvconfig.m_worker = _srv_elem.get<std::string>("<xmlattr>.worker", "");
+    srvconfig.m_lane   = _srv_elem.get<std::string>("<xmlattr>.lane", "");
 
     // Get service configuration
     if(!config.empty())
@@ -92,6 +92,9 @@ struct service_config
     /// Service worker
     std::string m_worker;
 
+    /// Service lane: priority of the service worker in the shared worker pool ("real_time", "normal", "background")
+    std::string m_lane;
+
     /// list of required objects information (inputs, inouts and outputs), indexed by key name and index
     std::map<std::pair<std::string, std::optional<std::size_t> >, object_serviceconfig> m_objects;
 
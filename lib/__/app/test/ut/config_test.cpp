@@ -33,11 +33,14 @@
 
 #include <core/com/signal.hpp>
 #include <core/com/signal.hxx>
+#include <core/memory/buffer_allocation_policy.hpp>
 #include <core/runtime/helper.hpp>
 #include <core/runtime/path.hpp>
 #include <core/runtime/runtime.hpp>
+#include <core/thread/worker.hxx>
 #include <core/time_stamp.hpp>
 
+#include <data/array.hpp>
 #include <data/boolean.hpp>
 #include <data/dvec3.hpp>
 #include <data/extension/config.hpp>
@@ -50,7 +53,9 @@
 
 #include <utest/wait.hpp>
 
+#include <algorithm>
 #include <filesystem>
+#include <mutex>
 
 // Registers the fixture into the 'registry'
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::app::ut::config_test);
@@ -382,6 +387,166 @@ void config_test::start_stop_test()
 
 //------------------------------------------------------------------------------
 
+void config_test::start_policy_test()
+{
+    static const std::vector<std::string> s_SERVICES {
+        "TestService1Uid", "TestService2Uid", "TestService3Uid", "TestService4Uid"
+    };
+
+    m_app_config_mgr = app::config_manager::make();
+    m_app_config_mgr->set_config("startPolicyTest", app::field_adaptor_t(), false);
+
+    std::mutex mutex;
+    std::map<std::string, std::vector<std::string> > timings;
+    std::function fn = [&](std::string _uid, std::string _action, double /*_duration*/)
+                       {
+                           std::unique_lock lock(mutex);
+                           timings[_action].push_back(_uid);
+                       };
+    auto timing_slot = core::com::new_slot(fn);
+    timing_slot->set_worker(core::thread::get_default_worker());
+    core::com::connection connection = m_app_config_mgr->signal(app::config_manager::signals::SERVICE_TIMING)
+                                       ->connect(timing_slot);
+
+    const auto timings_count =
+        [&](const std::string& _action)
+        {
+            std::unique_lock lock(mutex);
+            return timings[_action].size();
+        };
+
+    m_app_config_mgr->launch();
+    CPPUNIT_ASSERT(m_app_config_mgr->get_start_policy() == app::config_manager::start_policy::parallel);
+
+    std::map<std::string, std::shared_ptr<app::ut::test_service> > services;
+    for(const auto& uid : s_SERVICES)
+    {
+        services[uid] = std::dynamic_pointer_cast<app::ut::test_service>(core::id::get_object(uid));
+        CPPUNIT_ASSERT(services[uid] != nullptr);
+        CPPUNIT_ASSERT(services[uid]->started());
+    }
+
+    // Services sharing an object or a worker keep the order of the configuration
+    CPPUNIT_ASSERT(services["TestService1Uid"]->get_start_order() < services["TestService2Uid"]->get_start_order());
+    CPPUNIT_ASSERT(services["TestService1Uid"]->get_start_order() < services["TestService4Uid"]->get_start_order());
+
+    SIGHT_TEST_WAIT(timings_count("start") == s_SERVICES.size());
+    CPPUNIT_ASSERT_EQUAL(s_SERVICES.size(), timings_count("start"));
+
+    m_app_config_mgr->stop();
+    for(const auto& uid : s_SERVICES)
+    {
+        CPPUNIT_ASSERT(services[uid]->stopped());
+    }
+
+    SIGHT_TEST_WAIT(timings_count("stop") == s_SERVICES.size());
+    CPPUNIT_ASSERT_EQUAL(s_SERVICES.size(), timings_count("stop"));
+
+    {
+        std::unique_lock lock(mutex);
+        std::ranges::sort(timings["start"]);
+        CPPUNIT_ASSERT(timings["start"] == s_SERVICES);
+    }
+
+    connection.disconnect();
+    services.clear();
+    m_app_config_mgr->destroy();
+    m_app_config_mgr = nullptr;
+
+    // The policy given by the code overrides the configuration
+    m_app_config_mgr = app::config_manager::make();
+    m_app_config_mgr->set_config("startPolicyTest", app::field_adaptor_t(), false);
+    m_app_config_mgr->set_start_policy(app::config_manager::start_policy::sequential);
+    m_app_config_mgr->launch();
+    CPPUNIT_ASSERT(m_app_config_mgr->get_start_policy() == app::config_manager::start_policy::sequential);
+    for(const auto& uid : s_SERVICES)
+    {
+        auto srv = std::dynamic_pointer_cast<service::base>(core::id::get_object(uid));
+        CPPUNIT_ASSERT(srv != nullptr);
+        CPPUNIT_ASSERT(srv->started());
+    }
+
+    m_app_config_mgr->stop_and_destroy();
+    m_app_config_mgr = nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+void config_test::lane_test()
+{
+    static const std::vector<std::string> s_SERVICES {
+        "TestService1Uid", "TestService2Uid", "TestService3Uid", "TestService4Uid"
+    };
+
+    m_app_config_mgr = app::config_manager::make();
+    m_app_config_mgr->set_config("laneTest", app::field_adaptor_t(), false);
+    m_app_config_mgr->launch();
+
+    std::map<std::string, service::base::sptr> services;
+    for(const auto& uid : s_SERVICES)
+    {
+        services[uid] = std::dynamic_pointer_cast<service::base>(core::id::get_object(uid));
+        CPPUNIT_ASSERT(services[uid] != nullptr);
+        CPPUNIT_ASSERT(services[uid]->started());
+        CPPUNIT_ASSERT(services[uid]->worker() != nullptr);
+        CPPUNIT_ASSERT(services[uid]->worker() != core::thread::get_default_worker());
+    }
+
+    // Services with the same worker name share the same lane, the others get their own
+    CPPUNIT_ASSERT(services["TestService2Uid"]->worker() == services["TestService3Uid"]->worker());
+    CPPUNIT_ASSERT(services["TestService1Uid"]->worker() != services["TestService2Uid"]->worker());
+    CPPUNIT_ASSERT(services["TestService1Uid"]->worker() != services["TestService4Uid"]->worker());
+
+    // Lanes run the tasks of their services
+    for(const auto& uid : s_SERVICES)
+    {
+        CPPUNIT_ASSERT_EQUAL(uid, services[uid]->worker()->post_task<std::string>([&uid]{return uid;}).get());
+    }
+
+    services.clear();
+    m_app_config_mgr->stop_and_destroy();
+    m_app_config_mgr = nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+void config_test::allocation_test()
+{
+    m_app_config_mgr = app::config_manager::make();
+    m_app_config_mgr->set_config("allocationTest", app::field_adaptor_t(), false);
+    m_app_config_mgr->launch();
+
+    auto array = std::dynamic_pointer_cast<data::array>(core::id::get_object("array1Id"));
+    CPPUNIT_ASSERT(array != nullptr);
+    CPPUNIT_ASSERT(array->get_allocation_policy() == core::memory::buffer_pool_policy::get_default());
+
+    auto image = std::dynamic_pointer_cast<data::image>(core::id::get_object("image1Id"));
+    CPPUNIT_ASSERT(image != nullptr);
+    CPPUNIT_ASSERT(
+        std::dynamic_pointer_cast<core::memory::buffer_aligned_policy>(image->get_allocation_policy()) != nullptr
+    );
+
+    // Buffers are allocated with the configured policy
+    image->resize({16, 16, 16}, core::type::UINT8, data::image::gray_scale);
+    {
+        const auto dump_lock = image->dump_lock();
+        CPPUNIT_ASSERT_EQUAL(
+            std::uintptr_t(0),
+            reinterpret_cast<std::uintptr_t>(image->buffer()) % core::memory::buffer_aligned_policy::PAGE_ALIGNMENT
+        );
+    }
+
+    // Objects without the attribute keep the default policy
+    auto default_image = std::dynamic_pointer_cast<data::image>(core::id::get_object("image2Id"));
+    CPPUNIT_ASSERT(default_image != nullptr);
+    CPPUNIT_ASSERT(default_image->get_allocation_policy() == core::memory::buffer_malloc_policy::get_default());
+
+    m_app_config_mgr->stop_and_destroy();
+    m_app_config_mgr = nullptr;
+}
+
+//------------------------------------------------------------------------------
+
 void config_test::auto_connect_test()
 {
     m_app_config_mgr = app::ut::launch_app_config_mgr("autoConnectTest");
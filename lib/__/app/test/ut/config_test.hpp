@@ -40,6 +40,9 @@ CPPUNIT_TEST_SUITE(config_test);
 CPPUNIT_TEST(add_config_test);
 CPPUNIT_TEST(parameters_config_test);
 CPPUNIT_TEST(start_stop_test);
+CPPUNIT_TEST(start_policy_test);
+CPPUNIT_TEST(lane_test);
+CPPUNIT_TEST(allocation_test);
 CPPUNIT_TEST(auto_connect_test);
 CPPUNIT_TEST(connection_test);
 CPPUNIT_TEST(start_stop_connection_test);
@@ -65,6 +68,9 @@ public:
     static void add_config_test();
     static void parameters_config_test();
     void start_stop_test();
+    void start_policy_test();
+    void lane_test();
+    void allocation_test();
     void auto_connect_test();
     void connection_test();
     void start_stop_connection_test();
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2018 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -51,8 +51,8 @@ SIGHT_REGISTER_SERVICE(sight::service::base, sight::app::ut::test_service_with_p
 namespace sight::app::ut
 {
 
-unsigned int test_service::s_start_counter  = 0;
-unsigned int test_service::s_update_counter = 0;
+std::atomic_uint test_service::s_start_counter = 0;
+unsigned int test_service::s_update_counter   = 0;
 
 const std::string test_service::OPTION_KEY   = "option";
 const std::string test_service::UNCONFIGURED = "UNCONFIGURED";
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -35,6 +35,8 @@
 
 #include <service/base.hpp>
 
+#include <atomic>
+
 namespace sight::app::ut
 {
 
@@ -45,7 +47,7 @@ class test_service : public service::base
 {
 public:
 
-    static unsigned int s_start_counter;
+    static std::atomic_uint s_start_counter;
     static unsigned int s_update_counter;
     static const std::string OPTION_KEY;
     static const std::string UNCONFIGURED;
@@ -21,6 +21,10 @@
 
 #include "update_parallel_test.hpp"
 
+#include <app/updater.hpp>
+
+#include <core/com/signal.hxx>
+#include <core/com/slot.hxx>
 #include <core/runtime/path.hpp>
 #include <core/runtime/runtime.hpp>
 
@@ -31,6 +35,7 @@
 #include <boost/property_tree/xml_parser.hpp>
 
 #include <ranges>
+#include <thread>
 
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::app::ut::update_parallel_test);
 
@@ -77,6 +82,44 @@ public:
 
 SIGHT_REGISTER_SERVICE(sight::service::base, sight::app::ut::test_update_srv);
 
+/**
+ * @brief Service taking some time to update
+ */
+class test_slow_srv final : public service::base
+{
+public:
+
+    SIGHT_DECLARE_SERVICE(test_slow_srv, service::base);
+    ~test_slow_srv() noexcept final = default;
+
+    //------------------------------------------------------------------------------
+
+    void configuring(const config_t& /*unused*/) final
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    void starting() final
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    void stopping() final
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    void updating() final
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+};
+
+SIGHT_REGISTER_SERVICE(sight::service::base, sight::app::ut::test_slow_srv);
+
 //------------------------------------------------------------------------------
 
 auto create_srv()
@@ -246,4 +289,95 @@ void update_parallel_test::parent_test()
     }
 }
 
+//------------------------------------------------------------------------------
+
+void update_parallel_test::deadline_test()
+{
+    std::array<sight::service::base::sptr, 2> slow;
+    std::array<core::thread::worker::sptr, 2> workers;
+    for(const auto i : std::views::iota(0U, 2U))
+    {
+        // Each slow service gets its own worker, otherwise they would be updated serially
+        workers[i] = core::thread::worker::make();
+        slow[i]    = service::add("sight::app::ut::test_slow_srv");
+        slow[i]->set_worker(workers[i]);
+        CPPUNIT_ASSERT_NO_THROW(slow[i]->configure());
+        CPPUNIT_ASSERT_NO_THROW(slow[i]->start().get());
+    }
+
+    auto fast = create_srv();
+
+    std::stringstream srv_config;
+    srv_config
+    << "<config deadline=\"10\">"
+    << "<service uid=" << std::quoted(slow[0]->get_id()) << "/>"
+    << "<service uid=" << std::quoted(fast->get_id()) << "/>"
+    << "<service uid=" << std::quoted(slow[1]->get_id()) << "/>"
+    << "</config>";
+    service::config_t config;
+    boost::property_tree::read_xml(srv_config, config);
+
+    auto update_srv = service::add("sight::app::update_parallel");
+    update_srv->set_config(config);
+    CPPUNIT_ASSERT_NO_THROW(update_srv->configure());
+    CPPUNIT_ASSERT_NO_THROW(update_srv->start().get());
+
+    std::atomic_int missed {0};
+    auto deadline_missed = sight::core::com::new_slot([&missed](int _elapsed){missed = _elapsed;});
+    deadline_missed->set_worker(sight::core::thread::get_default_worker());
+    update_srv->signal(app::updater::signals::DEADLINE_MISSED)->connect(deadline_missed);
+
+    std::string summary;
+    std::atomic_bool summarized {false};
+    auto statistics_computed = sight::core::com::new_slot(
+        [&summary, &summarized](std::string _summary)
+        {
+            if(!summarized)
+            {
+                summary    = _summary;
+                summarized = true;
+            }
+        });
+    statistics_computed->set_worker(sight::core::thread::get_default_worker());
+    update_srv->signal(app::updater::signals::STATISTICS_COMPUTED)->connect(statistics_computed);
+
+    for(int i = 0 ; i < 2 ; ++i)
+    {
+        CPPUNIT_ASSERT_NO_THROW(update_srv->update().get());
+    }
+
+    SIGHT_TEST_WAIT(missed != 0);
+    CPPUNIT_ASSERT(missed >= 50);
+    SIGHT_TEST_WAIT(summarized == true);
+    CPPUNIT_ASSERT(summary.find(slow[0]->get_id()) != std::string::npos);
+
+    const auto statistics = std::dynamic_pointer_cast<app::updater>(update_srv)->get_statistics();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(4), statistics.size());
+    CPPUNIT_ASSERT_EQUAL(slow[0]->get_id(), statistics[0].uid);
+    CPPUNIT_ASSERT_EQUAL(fast->get_id(), statistics[1].uid);
+    CPPUNIT_ASSERT_EQUAL(update_srv->get_id(), statistics[3].uid);
+    for(const auto& element : statistics)
+    {
+        CPPUNIT_ASSERT_EQUAL(std::uint64_t(2), element.count);
+        CPPUNIT_ASSERT(element.max >= element.mean);
+    }
+
+    CPPUNIT_ASSERT(statistics[0].last >= 50.);
+    CPPUNIT_ASSERT(statistics[2].last >= 50.);
+
+    // Both slow services are updated at the same time
+    CPPUNIT_ASSERT(statistics[3].max < 95.);
+
+    CPPUNIT_ASSERT_NO_THROW(update_srv->stop().get());
+    service::remove(update_srv);
+    CPPUNIT_ASSERT_NO_THROW(fast->stop().get());
+    service::remove(fast);
+    for(const auto i : std::views::iota(0U, 2U))
+    {
+        CPPUNIT_ASSERT_NO_THROW(slow[i]->stop().get());
+        service::remove(slow[i]);
+        workers[i]->stop();
+    }
+}
+
 } // namespace sight::app::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2024 IRCAD France
+ * Copyright (C) 2024-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -33,6 +33,7 @@ class update_parallel_test : public CPPUNIT_NS::TestFixture
 CPPUNIT_TEST_SUITE(update_parallel_test);
 CPPUNIT_TEST(basic_test);
 CPPUNIT_TEST(parent_test);
+CPPUNIT_TEST(deadline_test);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -42,6 +43,7 @@ public:
 
     static void basic_test();
     static void parent_test();
+    static void deadline_test();
 };
 
 } // namespace sight::app::ut
@@ -23,6 +23,9 @@
 
 #include "test_services.hpp"
 
+#include <app/updater.hpp>
+
+#include <core/clock.hpp>
 #include <core/runtime/path.hpp>
 #include <core/runtime/runtime.hpp>
 
@@ -33,12 +36,56 @@
 #include <boost/property_tree/xml_parser.hpp>
 
 #include <ranges>
+#include <thread>
 
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::app::ut::update_sequence_test);
 
 namespace sight::app::ut
 {
 
+/**
+ * @brief Service recording when it is updated
+ */
+class test_stage_srv final : public service::base
+{
+public:
+
+    SIGHT_DECLARE_SERVICE(test_stage_srv, service::base);
+    ~test_stage_srv() noexcept final = default;
+
+    //------------------------------------------------------------------------------
+
+    void configuring(const config_t& /*unused*/) final
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    void starting() final
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    void stopping() final
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    void updating() final
+    {
+        const auto start = core::clock::get_time_in_milli_sec();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        m_updates.emplace_back(start, core::clock::get_time_in_milli_sec());
+    }
+
+    /// Start and end time of each update
+    std::vector<std::pair<core::clock::type, core::clock::type> > m_updates;
+};
+
+SIGHT_REGISTER_SERVICE(sight::service::base, sight::app::ut::test_stage_srv);
+
 //------------------------------------------------------------------------------
 
 auto create_order_srv(bool _start = true)
@@ -558,4 +605,80 @@ void update_sequence_test::ignore_stopped()
     service::remove(srv0);
 }
 
+//------------------------------------------------------------------------------
+
+void update_sequence_test::pipeline()
+{
+    std::array<test_stage_srv::sptr, 3> stages;
+    std::array<core::thread::worker::sptr, 3> workers;
+    for(const auto i : std::views::iota(0U, 3U))
+    {
+        workers[i] = core::thread::worker::make();
+        stages[i]  = service::add<test_stage_srv>("sight::app::ut::test_stage_srv");
+        stages[i]->set_worker(workers[i]);
+        CPPUNIT_ASSERT_NO_THROW(stages[i]->configure());
+        CPPUNIT_ASSERT_NO_THROW(stages[i]->start().get());
+    }
+
+    std::stringstream srv_config;
+    srv_config
+    << "<config loop=\"true\" pipeline=\"true\">"
+    << "<service uid=" << std::quoted(stages[0]->get_id()) << "/>"
+    << "<service uid=" << std::quoted(stages[1]->get_id()) << "/>"
+    << "<service uid=" << std::quoted(stages[2]->get_id()) << "/>"
+    << "</config>"
+    ;
+    service::config_t config;
+    boost::property_tree::read_xml(srv_config, config);
+
+    auto update_srv = service::add("sight::app::update_sequence");
+    update_srv->set_config(config);
+    CPPUNIT_ASSERT_NO_THROW(update_srv->configure());
+    CPPUNIT_ASSERT_NO_THROW(update_srv->start().get());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    CPPUNIT_ASSERT_NO_THROW(update_srv->stop().get());
+
+    // Stopping the stages waits for the updates still in flight
+    for(const auto i : std::views::iota(0U, 3U))
+    {
+        CPPUNIT_ASSERT_NO_THROW(stages[i]->stop().get());
+    }
+
+    const auto& first = stages[0]->m_updates;
+    const auto& last  = stages[2]->m_updates;
+    CPPUNIT_ASSERT(first.size() >= stages[1]->m_updates.size());
+    CPPUNIT_ASSERT(stages[1]->m_updates.size() >= last.size());
+    CPPUNIT_ASSERT(last.size() >= 3);
+
+    // Each stage of a cycle runs after the previous stage of the same cycle
+    for(std::size_t cycle = 0 ; cycle < last.size() ; ++cycle)
+    {
+        CPPUNIT_ASSERT(stages[1]->m_updates[cycle].first >= first[cycle].second);
+        CPPUNIT_ASSERT(last[cycle].first >= stages[1]->m_updates[cycle].second);
+    }
+
+    // The next cycle starts while the last stage of the previous one is still running
+    bool overlap = false;
+    for(std::size_t cycle = 0 ; cycle + 1 < first.size() && cycle < last.size() ; ++cycle)
+    {
+        overlap = overlap || first[cycle + 1].first < last[cycle].second;
+    }
+
+    CPPUNIT_ASSERT(overlap);
+
+    const auto statistics = std::dynamic_pointer_cast<app::updater>(update_srv)->get_statistics();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(4), statistics.size());
+    CPPUNIT_ASSERT(statistics[0].count >= statistics[2].count);
+    CPPUNIT_ASSERT(statistics[3].count >= 3);
+    CPPUNIT_ASSERT(statistics[3].mean >= 60.);
+
+    service::remove(update_srv);
+    for(const auto i : std::views::iota(0U, 3U))
+    {
+        service::remove(stages[i]);
+        workers[i]->stop();
+    }
+}
+
 } // namespace sight::app::ut
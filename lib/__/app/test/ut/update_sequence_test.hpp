@@ -41,6 +41,7 @@ CPPUNIT_TEST(call_start_slot_stop);
 CPPUNIT_TEST(call_stop_slot_start);
 CPPUNIT_TEST(call_stop_start);
 CPPUNIT_TEST(ignore_stopped);
+CPPUNIT_TEST(pipeline);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -58,6 +59,7 @@ public:
     static void call_stop_slot_start();
     static void call_stop_start();
     static void ignore_stopped();
+    static void pipeline();
 };
 
 } // namespace sight::app::ut
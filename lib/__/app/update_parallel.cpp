@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2024 IRCAD France
+ * Copyright (C) 2024-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -23,9 +23,11 @@
 
 #include "detail/update_registry.hpp"
 
+#include <core/com/slot_base.hxx>
+
 #include <data/object.hpp>
 
-#include <boost/thread/futures/wait_for_all.hpp>
+#include <map>
 
 namespace sight::app
 {
@@ -54,24 +56,19 @@ void update_parallel::stopping()
 
 void update_parallel::updating()
 {
-    std::vector<std::pair<sight::service::base::sptr, std::string> > services;
-    for(const auto& element : m_elements)
+    const auto start = core::clock::get_time_in_milli_sec();
+
+    std::vector<std::pair<std::size_t, sight::service::base::sptr> > services;
+    for(std::size_t i = 0 ; i < m_elements.size() ; ++i)
     {
-        sight::service::base::sptr srv;
-        if(element.type == type_t::SERVICE)
-        {
-            srv = std::dynamic_pointer_cast<sight::service::base>(sight::core::id::get_object(element.uid));
-        }
-        else
-        {
-            srv = app::get_updater(element.uid);
-        }
+        const auto& element = m_elements[i];
+        const auto srv      = this->get_service(i);
 
         if(srv != nullptr)
         {
             if(srv->started())
             {
-                services.emplace_back(srv, element.slot);
+                services.emplace_back(i, srv);
                 if(srv->is_auto_connected())
                 {
                     SIGHT_ERROR(
@@ -101,9 +98,72 @@ void update_parallel::updating()
         }
     }
 
-    std::vector<service::base::shared_future_t> futures;
-    std::ranges::for_each(services, [&futures](const auto& _x){futures.push_back(_x.first->update());});
-    boost::wait_for_all(futures.begin(), futures.end());
+    // Elements sharing a worker cannot run in parallel, warn once since this is a configuration issue
+    std::map<core::thread::worker::sptr, std::string> workers;
+    for(const auto& [index, srv] : services)
+    {
+        const auto [it, inserted] = workers.emplace(srv->worker(), m_elements[index].uid);
+        if(!inserted && !m_serialized_reported)
+        {
+            SIGHT_WARN(
+                "[sight::app::update_parallel] Services " << std::quoted(it->second) << " and "
+                << std::quoted(m_elements[index].uid) << " share the same worker, they will be updated serially."
+            );
+            m_serialized_reported = true;
+        }
+    }
+
+    // Each task measures its own latency, so that a slow element does not hide behind another one
+    std::vector<std::pair<std::size_t, std::shared_future<core::clock::type> > > futures;
+    std::vector<std::pair<std::size_t, core::com::slot_base::sptr> > inline_slots;
+    for(const auto& [index, srv] : services)
+    {
+        auto slot   = srv->slot(m_elements[index].slot);
+        auto worker = slot->get_worker();
+        if(worker == nullptr || worker == this->worker())
+        {
+            // Called after the others are dispatched, otherwise they would wait for it
+            inline_slots.emplace_back(index, slot);
+        }
+        else
+        {
+            futures.emplace_back(
+                index,
+                worker->post_task<core::clock::type>(
+                    [slot, start]
+                {
+                    slot->run();
+                    return core::clock::get_time_in_milli_sec() - start;
+                })
+            );
+        }
+    }
+
+    for(const auto& [index, slot] : inline_slots)
+    {
+        slot->run();
+        this->record(index, core::clock::get_time_in_milli_sec() - start);
+    }
+
+    for(const auto& [index, future] : futures)
+    {
+        try
+        {
+            this->record(index, future.get());
+        }
+        catch(const std::exception& e)
+        {
+            SIGHT_ERROR(
+                "[sight::app::update_parallel] Update of " << std::quoted(m_elements[index].uid) << " failed: "
+                << e.what()
+            );
+        }
+    }
+
+    if(!services.empty())
+    {
+        this->record_cycle(core::clock::get_time_in_milli_sec() - start);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2024 IRCAD France
+ * Copyright (C) 2024-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -29,12 +29,13 @@ namespace sight::app
 /**
  * @brief   This service updates all configured elements in parallel.
  * The elements can be a service or another updater (inheriting from sight::app::updater).
+ * Each element is updated on its own worker, elements sharing the same worker are thus updated serially.
  *
  * @section XML XML Configuration
  *
  * @code{.xml}
         <service uid="..." type="sight::app::update_parallel">
-            <config loop="true">
+            <config loop="true" deadline="33">
                 <service uid="../" />
                 <service uid="..." />
                 <updater uid="..." />
@@ -43,6 +44,8 @@ namespace sight::app
    @endcode
  * @subsection Configuration Configuration
  *  - \b loop: call the update sequence in loop when the service starts and until it stops.
+ *  - \b deadline (optional, default="0"): maximum duration of a cycle in milliseconds, the signal
+ * deadline_missed is emitted when it is exceeded. 0 disables the check.
  *  - \b parent: uid of the parent updater slot, as specified by the parent service in an <updater> element.
  *  - \b service: uid of the service
  *  - \b updater: uid of another updater, identified by a registration id. In this case, the updater
@@ -67,6 +70,9 @@ private:
 
     /// Does nothing
     SIGHT_APP_API void updating() final;
+
+    /// True once the elements sharing a worker were reported
+    bool m_serialized_reported {false};
 };
 
 } // namespace sight::app
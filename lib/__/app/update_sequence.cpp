@@ -23,7 +23,10 @@
 
 #include "detail/update_registry.hpp"
 
+#include <core/com/slot_base.hxx>
+
 #include <future>
+#include <limits>
 
 namespace sight::app
 {
@@ -37,6 +40,23 @@ void update_sequence::starting()
         app::register_updater(m_parent, this->get_sptr());
     }
 
+    if(m_pipeline)
+    {
+        const auto is_start_stop = [](const auto& _x)
+                                   {
+                                       return _x.slot == service::base::slots::START
+                                              || _x.slot == service::base::slots::STOP;
+                                   };
+        if(std::ranges::any_of(m_elements, is_start_stop))
+        {
+            SIGHT_ERROR(
+                "[sight::app::update_sequence] Start and stop slots can not be pipelined, "
+                << "the sequence of " << std::quoted(this->get_id()) << " runs one cycle at a time."
+            );
+            m_pipeline = false;
+        }
+    }
+
     if(m_loop)
     {
         this->updating();
@@ -51,28 +71,73 @@ void update_sequence::stopping()
     {
         app::unregister_updater(m_parent);
     }
+
+    // Stages still running will find no cycle to report to
+    m_cycles.clear();
 }
 
 //-----------------------------------------------------------------------------
 
 void update_sequence::updating()
 {
-    std::vector<std::pair<sight::service::base::sptr, std::string> > services;
-
-    std::set<std::string> is_going_to_be_started;
-    std::set<std::string> is_going_to_be_stopped;
+    const auto stages = this->get_stages();
 
-    for(const auto& element : m_elements)
+    if(m_pipeline && !stages.empty())
     {
-        sight::service::base::sptr srv;
-        if(element.type == type_t::SERVICE)
+        // If a previous cycle still waits for the first stage, queuing another one would only add latency
+        if(std::ranges::none_of(m_cycles, [](const auto& _x){return _x.next == 0 && !_x.running;}))
         {
-            srv = std::dynamic_pointer_cast<sight::service::base>(sight::core::id::get_object(element.uid));
+            const auto start = core::clock::get_time_in_milli_sec();
+            m_cycles.push_back({.id = m_cycle_count++, .stages = stages, .start = start});
         }
-        else
+
+        this->advance();
+        return;
+    }
+
+    const auto start = core::clock::get_time_in_milli_sec();
+    std::ranges::for_each(
+        stages,
+        [this](const auto& _stage)
         {
-            srv = app::get_updater(element.uid);
-        }
+            const auto& [index, srv] = _stage;
+            const auto stage_start   = core::clock::get_time_in_milli_sec();
+            if(this->worker() == srv->worker())
+            {
+                srv->slot(m_elements[index].slot)->run();
+            }
+            else
+            {
+                srv->slot(m_elements[index].slot)->async_run().wait();
+            }
+
+            this->record(index, core::clock::get_time_in_milli_sec() - stage_start);
+        });
+
+    if(!stages.empty())
+    {
+        this->record_cycle(core::clock::get_time_in_milli_sec() - start);
+    }
+
+    if(m_loop)
+    {
+        this->slot(service::base::slots::UPDATE)->async_run();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+std::vector<update_sequence::stage_t> update_sequence::get_stages()
+{
+    std::vector<stage_t> services;
+
+    std::set<std::string> is_going_to_be_started;
+    std::set<std::string> is_going_to_be_stopped;
+
+    for(std::size_t i = 0 ; i < m_elements.size() ; ++i)
+    {
+        const auto& element = m_elements[i];
+        const auto srv      = this->get_service(i);
 
         if(srv != nullptr)
         {
@@ -98,7 +163,7 @@ void update_sequence::updating()
             // Service is started, or will be started and current slot is not start = OK we add the slot.
             if((is_started or will_be_started) and not is_slot_start)
             {
-                services.emplace_back(srv, element.slot);
+                services.emplace_back(i, srv);
                 if(srv->is_auto_connected())
                 {
                     SIGHT_ERROR(
@@ -123,7 +188,7 @@ void update_sequence::updating()
             // Service isn't stopped and slot isn't stop = OK we add slot
             else if(not (is_stopped or will_be_stopped) or not is_slot_stop)
             {
-                services.emplace_back(srv, element.slot);
+                services.emplace_back(i, srv);
                 if(srv->is_auto_connected())
                 {
                     SIGHT_ERROR(
@@ -135,23 +200,85 @@ void update_sequence::updating()
         }
     }
 
-    std::ranges::for_each(
-        services,
-        [this](const auto& _srv)
+    return services;
+}
+
+//-----------------------------------------------------------------------------
+
+void update_sequence::advance()
+{
+    // A cycle never overtakes the previous one, so a stage is only running for one cycle at a time
+    const update_sequence::wptr weak = std::dynamic_pointer_cast<update_sequence>(this->get_sptr());
+    std::size_t bound                = std::numeric_limits<std::size_t>::max();
+    for(auto& cycle : m_cycles)
+    {
+        const auto& [index, srv] = cycle.stages[cycle.next];
+        if(!cycle.running && index < bound)
         {
-            if(this->worker() == _srv.first->worker())
-            {
-                _srv.first->slot(_srv.second)->run();
-            }
-            else
-            {
-                _srv.first->slot(_srv.second)->async_run().wait();
-            }
-        });
+            cycle.running = true;
 
-    if(m_loop)
+            auto slot   = srv->slot(m_elements[index].slot);
+            auto worker = slot->get_worker() ? slot->get_worker() : this->worker();
+            worker->post(
+                [slot, weak, id = cycle.id, dispatched = core::clock::get_time_in_milli_sec()]
+                {
+                    try
+                    {
+                        slot->run();
+                    }
+                    catch(const std::exception& e)
+                    {
+                        SIGHT_ERROR("[sight::app::update_sequence] Stage failed: " << e.what());
+                    }
+
+                    const auto latency = core::clock::get_time_in_milli_sec() - dispatched;
+                    if(const auto self = weak.lock(); self != nullptr)
+                    {
+                        self->worker()->post(
+                            [weak, id, latency]
+                        {
+                            if(const auto self = weak.lock(); self != nullptr)
+                            {
+                                self->stage_done(id, latency);
+                            }
+                        });
+                    }
+                });
+        }
+
+        bound = index;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void update_sequence::stage_done(std::uint64_t _cycle, core::clock::type _latency)
+{
+    const auto cycle = std::ranges::find(m_cycles, _cycle, &cycle_t::id);
+    if(cycle == m_cycles.end())
     {
-        this->slot(service::base::slots::UPDATE)->async_run();
+        // The updater was stopped in the meantime
+        return;
+    }
+
+    this->record(cycle->stages[cycle->next].first, _latency);
+    cycle->running = false;
+
+    const bool first_stage_done = ++cycle->next == 1;
+    if(cycle->next == cycle->stages.size())
+    {
+        this->record_cycle(core::clock::get_time_in_milli_sec() - cycle->start);
+        m_cycles.erase(cycle);
+    }
+
+    if(m_loop && first_stage_done)
+    {
+        // The next cycle can start as soon as the first stage is free
+        this->updating();
+    }
+    else
+    {
+        this->advance();
     }
 }
 
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2024 IRCAD France
+ * Copyright (C) 2024-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -23,6 +23,8 @@
 
 #include "updater.hpp"
 
+#include <deque>
+
 namespace sight::app
 {
 
@@ -30,11 +32,17 @@ namespace sight::app
  * @brief   This service updates all configured elements in a strict sequential order.
  * The elements can be a service or another updater (inheriting from sight::app::updater).
  *
+ * In pipelined mode, each element is a stage: the next cycle may start the first stage while the previous cycle still
+ * runs the following ones, so the throughput is bound by the slowest stage instead of by the whole sequence. A cycle
+ * never overtakes the previous one. A new cycle is discarded while the previous one still waits for the first stage.
+ * The update() call then returns as soon as the cycle is queued, so a pipelined sequence can not be awaited by a
+ * parent updater.
+ *
  * @section XML XML Configuration
  *
  * @code{.xml}
         <service uid="..." type="sight::app::update_sequence">
-            <config loop="true">
+            <config loop="true" deadline="33" pipeline="false">
                 <service uid="..." />
                 <service uid="..." />
                 <updater uid="..." />
@@ -43,6 +51,10 @@ namespace sight::app
    @endcode
  * @subsection Configuration Configuration
  *  - \b loop: call the update sequence in loop when the service starts and until it stops.
+ *  - \b deadline (optional, default="0"): maximum duration of a cycle in milliseconds, the signal
+ * deadline_missed is emitted when it is exceeded. 0 disables the check.
+ *  - \b pipeline (optional, default="false"): overlap the stages of successive cycles. Not allowed with elements
+ * calling the start or stop slots.
  *  - \b parent: uid of the parent updater slot, as specified by the parent service in an <updater> element.
  *  - \b service: uid of the service
  *  - \b updater: uid of another updater, identified by a registration id. In this case, the updater
@@ -67,6 +79,31 @@ private:
 
     /// Does nothing
     SIGHT_APP_API void updating() final;
+
+    /// An element to update in a cycle: its index and its service
+    using stage_t = std::pair<std::size_t, service::base::sptr>;
+
+    /// A cycle in flight in pipelined mode
+    struct cycle_t
+    {
+        std::uint64_t id {0};
+        std::vector<stage_t> stages;
+        std::size_t next {0};
+        bool running {false};
+        core::clock::type start {0.};
+    };
+
+    /// Returns the elements to update in this cycle, empty if the cycle must be skipped
+    std::vector<stage_t> get_stages();
+
+    /// Runs the next stage of every cycle in flight, as long as the previous cycle is past this stage
+    void advance();
+
+    /// Called on the worker of the updater when a stage of a cycle is done
+    void stage_done(std::uint64_t _cycle, core::clock::type _latency);
+
+    std::deque<cycle_t> m_cycles;
+    std::uint64_t m_cycle_count {0};
 };
 
 } // namespace sight::app
@@ -21,16 +21,32 @@
 
 #include "updater.hpp"
 
+#include "detail/update_registry.hpp"
+
+#include <core/com/signal.hxx>
+
+#include <iomanip>
+
 namespace sight::app
 {
 
 //-----------------------------------------------------------------------------
 
+updater::updater()
+{
+    new_signal<signals::deadline_missed_t>(signals::DEADLINE_MISSED);
+    new_signal<signals::statistics_computed_t>(signals::STATISTICS_COMPUTED);
+}
+
+//-----------------------------------------------------------------------------
+
 void updater::configuring(const config_t& _config)
 {
     const auto config = _config.get_child("config");
-    m_loop   = config.get<bool>("<xmlattr>.loop", m_loop);
-    m_parent = config.get<std::string>("<xmlattr>.parent", "");
+    m_loop     = config.get<bool>("<xmlattr>.loop", m_loop);
+    m_parent   = config.get<std::string>("<xmlattr>.parent", "");
+    m_pipeline = config.get<bool>("<xmlattr>.pipeline", m_pipeline);
+    m_deadline = config.get<core::clock::type>("<xmlattr>.deadline", m_deadline);
     for(const auto& element : config)
     {
         if(element.first == "service")
@@ -46,6 +62,90 @@ void updater::configuring(const config_t& _config)
             m_elements.push_back({uid, "update", type_t::UPDATER});
         }
     }
+
+    m_cache.resize(m_elements.size());
+
+    std::lock_guard lock(m_statistics_mutex);
+    m_statistics.clear();
+    std::ranges::for_each(m_elements, [this](const auto& _x){m_statistics.push_back({.uid = _x.uid});});
+    m_statistics.push_back({.uid = this->get_id()});
+}
+
+//-----------------------------------------------------------------------------
+
+service::base::sptr updater::get_service(std::size_t _index)
+{
+    SIGHT_ASSERT("Element index out of range", _index < m_cache.size());
+
+    // A stopped service may have been replaced by another one with the same uid, so look it up again
+    if(auto srv = m_cache[_index].lock(); srv != nullptr && srv->started())
+    {
+        return srv;
+    }
+
+    const auto& element = m_elements[_index];
+    service::base::sptr srv;
+    if(element.type == type_t::SERVICE)
+    {
+        srv = std::dynamic_pointer_cast<sight::service::base>(sight::core::id::get_object(element.uid));
+    }
+    else
+    {
+        srv = app::get_updater(element.uid);
+    }
+
+    m_cache[_index] = srv;
+    return srv;
+}
+
+//-----------------------------------------------------------------------------
+
+void updater::record(std::size_t _index, core::clock::type _latency)
+{
+    std::lock_guard lock(m_statistics_mutex);
+    SIGHT_ASSERT("Element index out of range", _index < m_statistics.size());
+
+    auto& statistics = m_statistics[_index];
+    ++statistics.count;
+    statistics.last  = _latency;
+    statistics.mean += (_latency - statistics.mean) / static_cast<core::clock::type>(statistics.count);
+    statistics.max   = std::max(statistics.max, _latency);
+}
+
+//-----------------------------------------------------------------------------
+
+void updater::record_cycle(core::clock::type _latency)
+{
+    this->record(m_elements.size(), _latency);
+
+    if(m_deadline > 0. && _latency > m_deadline)
+    {
+        auto sig = this->signal<signals::deadline_missed_t>(signals::DEADLINE_MISSED);
+        sig->async_emit(static_cast<int>(_latency));
+    }
+
+    // Formatting the summary is only worth it if someone listens
+    if(auto sig = this->signal<signals::statistics_computed_t>(signals::STATISTICS_COMPUTED);
+       sig->num_connections() > 0)
+    {
+        std::stringstream summary;
+        summary << std::fixed << std::setprecision(2);
+        for(const auto& statistics : this->get_statistics())
+        {
+            summary << statistics.uid << ": " << statistics.last << " ms (mean " << statistics.mean << " ms, max "
+            << statistics.max << " ms)\n";
+        }
+
+        sig->async_emit(summary.str());
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+std::vector<updater::statistics_t> updater::get_statistics() const
+{
+    std::lock_guard lock(m_statistics_mutex);
+    return m_statistics;
 }
 
 //-----------------------------------------------------------------------------
@@ -25,12 +25,24 @@
 
 #include "service/base.hpp"
 
+#include <core/clock.hpp>
+#include <core/com/signal.hpp>
+
+#include <mutex>
+
 namespace sight::app
 {
 
 /**
  * @brief   This interface defines control service API.
  * Does nothing particularly, can be considered as a default service type to be implemented by unclassified services.
+ *
+ * The services of the elements are resolved once and cached until they are destroyed. The latency of each element
+ * and of the whole cycle is measured at every update.
+ *
+ * @section Signals Signals
+ * - \b deadline_missed(int): emitted with the duration of the cycle, in milliseconds, when it exceeds the deadline.
+ * - \b statistics_computed(std::string): emitted after each cycle with a summary of the latencies of the elements.
  */
 class SIGHT_APP_CLASS_API updater : public service::base
 {
@@ -38,6 +50,28 @@ public:
 
     SIGHT_DECLARE_CLASS(updater, service::base);
 
+    struct signals
+    {
+        using deadline_missed_t     = core::com::signal<void (int)>;
+        using statistics_computed_t = core::com::signal<void (std::string)>;
+
+        static inline const core::com::signals::key_t DEADLINE_MISSED     = "deadline_missed";
+        static inline const core::com::signals::key_t STATISTICS_COMPUTED = "statistics_computed";
+    };
+
+    /// Latency statistics of an element, in milliseconds
+    struct statistics_t
+    {
+        std::string uid;
+        core::clock::type last {0.};
+        core::clock::type mean {0.};
+        core::clock::type max {0.};
+        std::uint64_t count {0};
+    };
+
+    /// Returns the statistics of the elements in the configuration order, followed by those of the whole cycle
+    SIGHT_APP_API std::vector<statistics_t> get_statistics() const;
+
 protected:
 
     enum class type_t : std::uint8_t
@@ -54,11 +88,21 @@ protected:
         bool ignore_stopped {false};
     };
 
+    SIGHT_APP_API updater();
     SIGHT_APP_API ~updater() override = default;
 
     /// Does nothing
     SIGHT_APP_API void configuring(const config_t& _config) final;
 
+    /// Returns the service of an element, looked up only when the cached one is destroyed or no longer started
+    SIGHT_APP_API service::base::sptr get_service(std::size_t _index);
+
+    /// Records the latency of an element
+    SIGHT_APP_API void record(std::size_t _index, core::clock::type _latency);
+
+    /// Records the latency of a whole cycle, then checks the deadline and emits the statistics
+    SIGHT_APP_API void record_cycle(core::clock::type _latency);
+
     /// Keep track of received signals
     std::vector<update_element_t> m_elements;
     /// Keep track of received signals
@@ -67,6 +111,19 @@ protected:
 
     bool m_loop {false};
     bool m_run_loop {false};
+    bool m_pipeline {false};
+
+    /// Maximum duration of a cycle in milliseconds, 0 if disabled
+    core::clock::type m_deadline {0.};
+
+private:
+
+    /// Services of the elements
+    std::vector<service::base::wptr> m_cache;
+
+    /// Statistics of the elements, followed by those of the cycle
+    std::vector<statistics_t> m_statistics;
+    mutable std::mutex m_statistics_mutex;
 };
 
 } // namespace sight::app
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -27,9 +27,90 @@
 #include "core/memory/byte_size.hpp"
 #include "core/memory/exception/memory.hpp"
 
+#include <core/exceptionmacros.hpp>
+
+#include <bit>
+#include <cstring>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 namespace sight::core::memory
 {
 
+namespace
+{
+
+/// Stored just before each buffer allocated by buffer_aligned_policy
+struct aligned_header
+{
+    void* raw;
+    buffer_allocation_policy::size_type capacity;
+};
+
+//------------------------------------------------------------------------------
+
+inline aligned_header& header_of(buffer_allocation_policy::buffer_t _buffer)
+{
+    return *(static_cast<aligned_header*>(_buffer) - 1);
+}
+
+//------------------------------------------------------------------------------
+
+inline buffer_allocation_policy::size_type round_up(
+    buffer_allocation_policy::size_type _size,
+    buffer_allocation_policy::size_type _multiple
+)
+{
+    return (_size + _multiple - 1) / _multiple * _multiple;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+buffer_allocation_policy::sptr buffer_allocation_policy::make(std::string_view _name)
+{
+    if(_name == "malloc")
+    {
+        return buffer_malloc_policy::get_default();
+    }
+
+    if(_name == "aligned")
+    {
+        return std::make_shared<buffer_aligned_policy>();
+    }
+
+    if(_name == "page")
+    {
+        return std::make_shared<buffer_aligned_policy>(buffer_aligned_policy::PAGE_ALIGNMENT);
+    }
+
+    if(_name == "huge")
+    {
+        return std::make_shared<buffer_aligned_policy>(buffer_aligned_policy::SIMD_ALIGNMENT, true);
+    }
+
+    if(_name == "pool")
+    {
+        return buffer_pool_policy::get_default();
+    }
+
+    SIGHT_THROW(
+        "Unknown buffer allocation policy '" << _name
+        << "', expected 'malloc', 'aligned', 'page', 'huge' or 'pool'."
+    );
+}
+
+//------------------------------------------------------------------------------
+
+buffer_allocation_policy::sptr buffer_malloc_policy::get_default()
+{
+    static const auto s_policy = std::make_shared<buffer_malloc_policy>();
+    return s_policy;
+}
+
 //------------------------------------------------------------------------------
 
 void buffer_malloc_policy::allocate(
@@ -183,4 +264,298 @@ void buffer_no_alloc_policy::destroy(buffer_t& _buffer)
 
 //------------------------------------------------------------------------------
 
+buffer_aligned_policy::buffer_aligned_policy(size_type _alignment, bool _huge_pages) :
+    m_alignment(std::max(_alignment, alignof(std::max_align_t))),
+    m_huge_pages(_huge_pages)
+{
+    SIGHT_ASSERT("Alignment must be a power of two", std::has_single_bit(_alignment));
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_aligned_policy::allocate(
+    buffer_t& _buffer,
+    buffer_allocation_policy::size_type _size
+)
+{
+    if(_size > 0)
+    {
+        _buffer = this->allocate_aligned(_size);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_aligned_policy::reallocate(
+    buffer_t& _buffer,
+    buffer_allocation_policy::size_type _size
+)
+{
+    if(_buffer == nullptr)
+    {
+        this->allocate(_buffer, _size);
+        return;
+    }
+
+    if(_size == 0)
+    {
+        this->destroy(_buffer);
+        return;
+    }
+
+    // Keep the buffer unless it is too small, or much too large
+    const auto capacity = buffer_aligned_policy::capacity(_buffer);
+    if(_size <= capacity && _size >= capacity / 2)
+    {
+        return;
+    }
+
+    buffer_t new_buffer = this->allocate_aligned(_size);
+    std::memcpy(new_buffer, _buffer, std::min(capacity, _size));
+    free_aligned(_buffer);
+    _buffer = new_buffer;
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_aligned_policy::destroy(buffer_t& _buffer)
+{
+    free_aligned(_buffer);
+    _buffer = nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+buffer_aligned_policy::size_type buffer_aligned_policy::capacity(const buffer_t& _buffer)
+{
+    return _buffer == nullptr ? 0 : header_of(_buffer).capacity;
+}
+
+//------------------------------------------------------------------------------
+
+buffer_allocation_policy::buffer_t buffer_aligned_policy::allocate_aligned(size_type _capacity) const
+{
+    const bool huge_pages = m_huge_pages && _capacity >= HUGE_PAGE_SIZE;
+    const auto alignment  = huge_pages ? std::max(m_alignment, HUGE_PAGE_SIZE) : m_alignment;
+
+    // The header is stored in the padding in front of the aligned buffer
+    void* raw = nullptr;
+    if(_capacity <= std::numeric_limits<size_type>::max() - alignment - sizeof(aligned_header))
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+        raw = malloc(_capacity + alignment + sizeof(aligned_header));
+    }
+
+    if(raw == nullptr)
+    {
+        SIGHT_THROW_EXCEPTION_MSG(
+            core::memory::exception::memory,
+            "Cannot allocate memory ("
+            << core::memory::byte_size(core::memory::byte_size::size_t(_capacity)) << ")."
+        );
+    }
+
+    const auto address = round_up(reinterpret_cast<std::uintptr_t>(raw) + sizeof(aligned_header), alignment);
+    auto* buffer       = reinterpret_cast<void*>(address);
+    new(static_cast<aligned_header*>(buffer) - 1) aligned_header {.raw = raw, .capacity = _capacity};
+
+#ifdef __linux__
+    if(huge_pages)
+    {
+        // Only a hint, the buffer is still valid if the kernel declines it
+        madvise(buffer, _capacity / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE, MADV_HUGEPAGE);
+    }
+#endif
+
+    return buffer;
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_aligned_policy::free_aligned(buffer_t _buffer)
+{
+    if(_buffer != nullptr)
+    {
+        free(header_of(_buffer).raw); // NOLINT(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+    }
+}
+
+//------------------------------------------------------------------------------
+
+buffer_pool_policy::buffer_pool_policy(size_type _high_water_mark, size_type _alignment, bool _huge_pages) :
+    buffer_aligned_policy(_alignment, _huge_pages),
+    m_high_water_mark(_high_water_mark)
+{
+}
+
+//------------------------------------------------------------------------------
+
+buffer_pool_policy::~buffer_pool_policy()
+{
+    this->clear();
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_pool_policy::allocate(
+    buffer_t& _buffer,
+    buffer_allocation_policy::size_type _size
+)
+{
+    if(_size == 0)
+    {
+        return;
+    }
+
+    const auto capacity = size_class(_size);
+    {
+        std::lock_guard lock(m_mutex);
+        if(auto it = m_free.find(capacity); it != m_free.end() && !it->second.empty())
+        {
+            _buffer = it->second.back();
+            it->second.pop_back();
+            m_statistics.cached_bytes -= capacity;
+            ++m_statistics.hits;
+            return;
+        }
+
+        ++m_statistics.misses;
+    }
+
+    _buffer = this->allocate_aligned(capacity);
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_pool_policy::reallocate(
+    buffer_t& _buffer,
+    buffer_allocation_policy::size_type _size
+)
+{
+    if(_buffer == nullptr)
+    {
+        this->allocate(_buffer, _size);
+        return;
+    }
+
+    if(_size == 0)
+    {
+        this->destroy(_buffer);
+        return;
+    }
+
+    const auto capacity = buffer_aligned_policy::capacity(_buffer);
+    if(size_class(_size) == capacity)
+    {
+        return;
+    }
+
+    buffer_t new_buffer = nullptr;
+    this->allocate(new_buffer, _size);
+    std::memcpy(new_buffer, _buffer, std::min(capacity, _size));
+    this->destroy(_buffer);
+    _buffer = new_buffer;
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_pool_policy::destroy(buffer_t& _buffer)
+{
+    if(_buffer == nullptr)
+    {
+        return;
+    }
+
+    const auto capacity = buffer_aligned_policy::capacity(_buffer);
+    {
+        std::lock_guard lock(m_mutex);
+        if(m_statistics.cached_bytes + capacity <= m_high_water_mark)
+        {
+            m_free[capacity].push_back(_buffer);
+            m_statistics.cached_bytes += capacity;
+            ++m_statistics.recycled;
+            _buffer = nullptr;
+            return;
+        }
+
+        ++m_statistics.released;
+    }
+
+    free_aligned(_buffer);
+    _buffer = nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_pool_policy::set_high_water_mark(size_type _high_water_mark)
+{
+    std::lock_guard lock(m_mutex);
+    m_high_water_mark = _high_water_mark;
+    this->trim();
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_pool_policy::clear()
+{
+    std::lock_guard lock(m_mutex);
+    for(auto& [capacity, buffers] : m_free)
+    {
+        std::ranges::for_each(buffers, free_aligned);
+    }
+
+    m_free.clear();
+    m_statistics.cached_bytes = 0;
+}
+
+//------------------------------------------------------------------------------
+
+buffer_pool_policy::statistics buffer_pool_policy::get_statistics() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_statistics;
+}
+
+//------------------------------------------------------------------------------
+
+buffer_pool_policy::size_type buffer_pool_policy::size_class(size_type _size)
+{
+    // Small buffers are rounded to a cache line, larger ones to a quarter of their power of two
+    constexpr size_type small_size = 4096;
+    if(_size <= small_size)
+    {
+        return round_up(std::max(_size, size_type(1)), SIMD_ALIGNMENT);
+    }
+
+    return round_up(_size, std::bit_floor(_size) / 4);
+}
+
+//------------------------------------------------------------------------------
+
+buffer_pool_policy::sptr buffer_pool_policy::get_default()
+{
+    static const auto s_pool = std::make_shared<buffer_pool_policy>();
+    return s_pool;
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_pool_policy::trim()
+{
+    // Release the largest buffers first, they are the least likely to be reused
+    for(auto it = m_free.rbegin() ; it != m_free.rend() && m_statistics.cached_bytes > m_high_water_mark ; ++it)
+    {
+        auto& [capacity, buffers] = *it;
+        while(!buffers.empty() && m_statistics.cached_bytes > m_high_water_mark)
+        {
+            free_aligned(buffers.back());
+            buffers.pop_back();
+            m_statistics.cached_bytes -= capacity;
+            ++m_statistics.released;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
 } //namespace sight::core::memory
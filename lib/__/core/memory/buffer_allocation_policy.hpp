@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -28,6 +28,11 @@
 
 #include <core/base.hpp>
 
+#include <map>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
 namespace sight::core::memory
 {
 
@@ -45,12 +50,28 @@ public:
 
     SIGHT_CORE_API virtual ~buffer_allocation_policy()
     = default;
+
+    /**
+     * @brief Returns the policy matching a name, as given in the "allocation" attribute of a data object in XML.
+     *
+     * - \b malloc: buffer_malloc_policy
+     * - \b aligned: buffer_aligned_policy on 64 bytes, suitable for SIMD
+     * - \b page: buffer_aligned_policy on a page, suitable for O_DIRECT I/O
+     * - \b huge: buffer_aligned_policy backed by transparent huge pages for large buffers
+     * - \b pool: the shared buffer_pool_policy
+     *
+     * @throw core::exception if the name is unknown
+     */
+    SIGHT_CORE_API static sptr make(std::string_view _name);
 };
 
 class SIGHT_CORE_CLASS_API buffer_malloc_policy : public buffer_allocation_policy
 {
 public:
 
+    /// Returns a policy shared by the whole process, which spares an allocation to every owner of a buffer
+    SIGHT_CORE_API static sptr get_default();
+
     SIGHT_CORE_API void allocate(
         buffer_t& _buffer,
         buffer_allocation_policy::size_type _size
@@ -92,4 +113,126 @@ public:
     SIGHT_CORE_API void destroy(buffer_t& _buffer) override;
 };
 
+/**
+ * @brief Allocates buffers aligned on a given boundary.
+ *
+ * The allocated capacity is stored just before the buffer, so reallocating within the capacity costs nothing. If
+ * huge pages are requested, buffers of at least HUGE_PAGE_SIZE bytes are aligned on a huge page and the kernel is
+ * advised to back them with transparent huge pages, which lowers the number of page faults and TLB misses on large
+ * volumes. This advice is only supported on Linux and ignored elsewhere.
+ */
+class SIGHT_CORE_CLASS_API buffer_aligned_policy : public buffer_allocation_policy
+{
+public:
+
+    using sptr = std::shared_ptr<buffer_aligned_policy>;
+
+    static constexpr size_type SIMD_ALIGNMENT = 64;
+    static constexpr size_type PAGE_ALIGNMENT = 4096;
+    static constexpr size_type HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+    /// Alignment must be a power of two.
+    SIGHT_CORE_API explicit buffer_aligned_policy(size_type _alignment = SIMD_ALIGNMENT, bool _huge_pages = false);
+
+    SIGHT_CORE_API void allocate(
+        buffer_t& _buffer,
+        buffer_allocation_policy::size_type _size
+    ) override;
+    SIGHT_CORE_API void reallocate(
+        buffer_t& _buffer,
+        buffer_allocation_policy::size_type _size
+    ) override;
+    SIGHT_CORE_API void destroy(buffer_t& _buffer) override;
+
+    /// Returns the capacity of a buffer allocated by this policy
+    SIGHT_CORE_API static size_type capacity(const buffer_t& _buffer);
+
+protected:
+
+    /// Allocates exactly _capacity bytes with the alignment of this policy
+    SIGHT_CORE_API buffer_t allocate_aligned(size_type _capacity) const;
+
+    /// Releases a buffer allocated by allocate_aligned()
+    SIGHT_CORE_API static void free_aligned(buffer_t _buffer);
+
+private:
+
+    size_type m_alignment;
+    bool m_huge_pages;
+};
+
+/**
+ * @brief Recycles released buffers instead of freeing them.
+ *
+ * Buffers are rounded up to a size class, within 25% of the requested size, and are kept by class when destroyed, so
+ * that the next allocation of a close size reuses them without a system call nor page faults. Recycled buffers are
+ * freed once the cached memory would exceed the high-water mark.
+ *
+ * Buffers are allocated like buffer_aligned_policy, and the pool is thread-safe, so a single pool can be shared by
+ * many data objects.
+ */
+class SIGHT_CORE_CLASS_API buffer_pool_policy final : public buffer_aligned_policy
+{
+public:
+
+    using sptr = std::shared_ptr<buffer_pool_policy>;
+
+    static constexpr size_type DEFAULT_HIGH_WATER_MARK = size_type(512) * 1024 * 1024;
+
+    struct statistics
+    {
+        /// Allocations served by a recycled buffer
+        std::uint64_t hits {0};
+        /// Allocations that required a new buffer
+        std::uint64_t misses {0};
+        /// Destroyed buffers kept for later use
+        std::uint64_t recycled {0};
+        /// Destroyed buffers freed because of the high-water mark
+        std::uint64_t released {0};
+        /// Memory currently held by recycled buffers
+        size_type cached_bytes {0};
+    };
+
+    SIGHT_CORE_API explicit buffer_pool_policy(
+        size_type _high_water_mark = DEFAULT_HIGH_WATER_MARK,
+        size_type _alignment       = SIMD_ALIGNMENT,
+        bool _huge_pages           = false
+    );
+    SIGHT_CORE_API ~buffer_pool_policy() override;
+
+    SIGHT_CORE_API void allocate(
+        buffer_t& _buffer,
+        buffer_allocation_policy::size_type _size
+    ) override;
+    SIGHT_CORE_API void reallocate(
+        buffer_t& _buffer,
+        buffer_allocation_policy::size_type _size
+    ) override;
+    SIGHT_CORE_API void destroy(buffer_t& _buffer) override;
+
+    /// Sets the maximum memory held by recycled buffers, buffers above the mark are freed immediately
+    SIGHT_CORE_API void set_high_water_mark(size_type _high_water_mark);
+
+    /// Frees all recycled buffers
+    SIGHT_CORE_API void clear();
+
+    SIGHT_CORE_API statistics get_statistics() const;
+
+    /// Returns the size class of a requested size
+    SIGHT_CORE_API static size_type size_class(size_type _size);
+
+    /// Returns the pool shared by the data objects configured with allocation="pool"
+    SIGHT_CORE_API static sptr get_default();
+
+private:
+
+    /// Frees the recycled buffers until the cached memory fits under the high-water mark, the lock must be held
+    void trim();
+
+    std::map<size_type, std::vector<buffer_t> > m_free;
+    size_type m_high_water_mark;
+    statistics m_statistics;
+    mutable std::mutex m_mutex;
+};
+
 } // namespace sight::core::memory
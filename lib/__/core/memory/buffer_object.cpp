@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -22,9 +22,32 @@
 
 #include "core/memory/buffer_object.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
 namespace sight::core::memory
 {
 
+struct buffer_object::shared_storage
+{
+    explicit shared_storage(const buffer_object::sptr& _storage) :
+        storage(_storage),
+        lock(_storage)
+    {
+    }
+
+    /// Buffer object owning the allocation, locked to keep it loaded
+    buffer_object::sptr storage;
+    lock_t lock;
+
+    /// Number of buffer objects sharing the allocation, locks taken on them are not counted
+    std::size_t owners {0};
+    core::mt::mutex mutex;
+};
+
+//------------------------------------------------------------------------------
+
 buffer_object::buffer_object(bool _auto_delete) :
     m_buffer_manager(core::memory::buffer_manager::get()),
     m_alloc_policy(std::make_shared<core::memory::buffer_no_alloc_policy>()),
@@ -44,6 +67,8 @@ buffer_object::~buffer_object()
         m_buffer_manager->destroy_buffer(&m_buffer).get();
     }
 
+    this->release_shared();
+
     // In the past we asserted that m_count was expired, but it can not be ensured because the unlock is asynchronous
     // So we simply unregister the buffer and we will check the counter value on the buffer manager thread instead
     m_buffer_manager->unregister_buffer(&m_buffer).get();
@@ -51,8 +76,25 @@ buffer_object::~buffer_object()
 
 //------------------------------------------------------------------------------
 
+core::memory::buffer_manager::buffer_t buffer_object::buffer() const
+{
+    auto* const shared = m_shared_buffer.load(std::memory_order_acquire);
+    return shared != nullptr ? shared : m_buffer;
+}
+
+//------------------------------------------------------------------------------
+
+core::memory::buffer_manager::buffer_t buffer_object::buffer()
+{
+    this->detach();
+    return m_buffer;
+}
+
+//------------------------------------------------------------------------------
+
 void buffer_object::allocate(size_t _size, const core::memory::buffer_allocation_policy::sptr& _policy)
 {
+    this->release_shared();
     m_buffer_manager->allocate_buffer(&m_buffer, _size, _policy).get();
     m_alloc_policy = _policy;
     m_size         = _size;
@@ -62,7 +104,17 @@ void buffer_object::allocate(size_t _size, const core::memory::buffer_allocation
 
 void buffer_object::reallocate(size_t _size)
 {
-    m_buffer_manager->reallocate_buffer(&m_buffer, _size).get();
+    if(const auto shared = this->release_shared(); shared)
+    {
+        // Allocate the private buffer directly with the new size
+        m_buffer_manager->allocate_buffer(&m_buffer, _size, m_alloc_policy).get();
+        std::memcpy(m_buffer, shared->storage->m_buffer, std::min(_size, m_size));
+    }
+    else
+    {
+        m_buffer_manager->reallocate_buffer(&m_buffer, _size).get();
+    }
+
     m_size = _size;
 }
 
@@ -70,7 +122,11 @@ void buffer_object::reallocate(size_t _size)
 
 void buffer_object::destroy()
 {
-    m_buffer_manager->destroy_buffer(&m_buffer).get();
+    if(this->release_shared() == nullptr)
+    {
+        m_buffer_manager->destroy_buffer(&m_buffer).get();
+    }
+
     m_alloc_policy = std::make_shared<core::memory::buffer_no_alloc_policy>();
     m_size         = 0;
 }
@@ -84,6 +140,7 @@ void buffer_object::set_buffer(
     bool _auto_delete
 )
 {
+    this->release_shared();
     m_buffer_manager->set_buffer(&m_buffer, _buffer, _size, _policy).get();
     m_alloc_policy = _policy;
     m_size         = _size;
@@ -94,6 +151,7 @@ void buffer_object::set_buffer(
 
 buffer_object::lock_t buffer_object::lock()
 {
+    this->detach();
     return {this->get_sptr()};
 }
 
@@ -113,12 +171,153 @@ void buffer_object::swap(const buffer_object::sptr& _source) noexcept
     std::swap(m_size, _source->m_size);
     m_buffer_manager.swap(_source->m_buffer_manager);
     m_alloc_policy.swap(_source->m_alloc_policy);
+    m_shared.swap(_source->m_shared);
+    m_shared_buffer.store(_source->m_shared_buffer.exchange(m_shared_buffer.load()));
+}
+
+//------------------------------------------------------------------------------
+
+bool buffer_object::share(const buffer_object::sptr& _source)
+{
+    SIGHT_ASSERT("Source buffer object is null", _source);
+
+    if(_source.get() == this)
+    {
+        return true;
+    }
+
+    // Buffers that are not owned may be freed by their owner at any time, and locked buffers may be written through
+    // the pointers obtained from the locks
+    if(_source->is_empty() || _source->m_auto_delete || m_auto_delete
+       || std::dynamic_pointer_cast<core::memory::buffer_no_alloc_policy>(_source->m_alloc_policy)
+       || this->is_locked())
+    {
+        return false;
+    }
+
+    std::shared_ptr<shared_storage> shared;
+    {
+        // Serializes the conversion of a source into a shared buffer, when it is copied by several threads at once
+        static core::mt::mutex s_mutex;
+        core::mt::scoped_lock share_lock(s_mutex);
+
+        shared = _source->shared();
+        if(shared)
+        {
+            core::mt::scoped_lock lock(shared->mutex);
+            ++shared->owners;
+        }
+        else
+        {
+            if(_source->is_locked())
+            {
+                return false;
+            }
+
+            // Lock the source to restore it if it was dumped, then move its allocation in a new buffer object.
+            // The latter is locked before the swap, so that the allocation can not be dumped in the meantime.
+            const lock_t source_lock(_source);
+            shared         = std::make_shared<shared_storage>(std::make_shared<buffer_object>());
+            shared->owners = 2;
+            shared->storage->swap(_source);
+
+            core::mt::scoped_lock lock(_source->m_lock_dump_mutex);
+            _source->m_size         = shared->storage->m_size;
+            _source->m_alloc_policy = shared->storage->m_alloc_policy;
+            _source->m_shared       = shared;
+            _source->m_shared_buffer.store(shared->storage->m_buffer, std::memory_order_release);
+        }
+    }
+
+    if(!this->is_empty())
+    {
+        this->destroy();
+    }
+
+    core::mt::scoped_lock lock(m_lock_dump_mutex);
+    m_size         = shared->storage->m_size;
+    m_alloc_policy = shared->storage->m_alloc_policy;
+    m_shared_buffer.store(shared->storage->m_buffer, std::memory_order_release);
+    m_shared = std::move(shared);
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_object::detach()
+{
+    if(m_shared_buffer.load(std::memory_order_acquire) == nullptr)
+    {
+        return;
+    }
+
+    // Readers keep using the shared allocation until the private one is ready
+    core::mt::scoped_lock lock(m_lock_dump_mutex);
+    const auto shared = std::exchange(m_shared, nullptr);
+    if(!shared)
+    {
+        return;
+    }
+
+    core::mt::scoped_lock shared_lock(shared->mutex);
+
+    // Once no other buffer object shares the allocation, new references can only come from the locks of this one,
+    // which are blocked by m_lock_dump_mutex: the use count can only decrease and is reliable.
+    if(--shared->owners == 0 && shared.use_count() == 1)
+    {
+        m_buffer_manager->swap_buffer(&m_buffer, &(shared->storage->m_buffer)).get();
+        shared->storage->m_size = 0;
+    }
+    else
+    {
+        m_buffer_manager->allocate_buffer(&m_buffer, m_size, m_alloc_policy).get();
+        std::memcpy(m_buffer, shared->storage->m_buffer, m_size);
+    }
+
+    m_shared_buffer.store(nullptr, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+
+bool buffer_object::is_shared() const
+{
+    return m_shared_buffer.load(std::memory_order_acquire) != nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+std::shared_ptr<buffer_object::shared_storage> buffer_object::shared() const
+{
+    core::mt::scoped_lock lock(m_lock_dump_mutex);
+    return m_shared;
+}
+
+//------------------------------------------------------------------------------
+
+std::shared_ptr<buffer_object::shared_storage> buffer_object::release_shared()
+{
+    core::mt::scoped_lock lock(m_lock_dump_mutex);
+    auto shared = std::exchange(m_shared, nullptr);
+    m_shared_buffer.store(nullptr, std::memory_order_release);
+    if(shared)
+    {
+        core::mt::scoped_lock shared_lock(shared->mutex);
+        --shared->owners;
+    }
+
+    return shared;
 }
 
 //------------------------------------------------------------------------------
 
 buffer_manager::stream_info buffer_object::get_stream_info() const
 {
+    if(const auto shared = this->shared(); shared)
+    {
+        return shared->storage->get_stream_info();
+    }
+
     return m_buffer_manager->get_stream_info(&m_buffer).get();
 }
 
@@ -132,6 +331,7 @@ void buffer_object::set_istream_factory(
     const core::memory::buffer_allocation_policy::sptr& _policy
 )
 {
+    this->release_shared();
     m_size         = _size;
     m_alloc_policy = _policy;
     m_buffer_manager->set_istream_factory(&m_buffer, _factory, _size, _source_file, _format, _policy).get();
@@ -141,8 +341,10 @@ void buffer_object::set_istream_factory(
 
 bool buffer_object::operator==(const buffer_object& _other) const noexcept
 {
-    return m_buffer == _other.m_buffer
-           || (m_size == _other.m_size && std::memcmp(m_buffer, _other.m_buffer, m_size) == 0);
+    const auto* const buffer       = this->buffer();
+    const auto* const other_buffer = _other.buffer();
+    return buffer == other_buffer
+           || (m_size == _other.m_size && std::memcmp(buffer, other_buffer, m_size) == 0);
 }
 
 //------------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -27,6 +27,7 @@
 #include "core/memory/buffer_allocation_policy.hpp"
 #include "core/memory/buffer_manager.hpp"
 
+#include <atomic>
 #include <filesystem>
 #include <istream>
 #include <type_traits>
@@ -58,6 +59,10 @@ class factory;
  * will not be changed or modified by the BufferManager mechanism. A lock *DO
  * NOT ENSURE* that an other user of this buffer object are not
  * changing/modifying the buffer.
+ *
+ * A buffer_object can share the buffer of another one with share(), to implement copy-on-write deep copies. Both
+ * read the same allocation until one of them is detached, which is done by every access that may write: the non-const
+ * buffer() and lock(), and the buffer() of a lock_t.
  */
 class SIGHT_CORE_CLASS_API buffer_object : public sight::core::base_object
 {
@@ -77,12 +82,18 @@ public:
         return this->get_classname();
     }
 
-    //------------------------------------------------------------------------------
+    /// Returns the buffer, which may be shared with other buffer objects (see share()), to read it
+    SIGHT_CORE_API virtual core::memory::buffer_manager::buffer_t buffer() const;
 
-    virtual core::memory::buffer_manager::buffer_t buffer() const
-    {
-        return m_buffer;
-    }
+    /// Returns the buffer to write it, after detaching it if it was shared (see detach())
+    SIGHT_CORE_API core::memory::buffer_manager::buffer_t buffer();
+
+private:
+
+    /// Allocation shared by several buffer objects, see share()
+    struct shared_storage;
+
+public:
 
     /**
      * @brief base class for buffer_object Lock
@@ -97,6 +108,8 @@ public:
     template<typename T>
     class lock_base
     {
+    friend class buffer_object;
+
     public:
 
         using buffer_t = typename std::conditional_t<std::is_const_v<T>, const void*, void*>;
@@ -130,14 +143,19 @@ public:
                 m_count      = _bo->m_buffer_manager->lock_buffer(&(_bo->m_buffer)).get();
                 _bo->m_count = m_count;
             }
+
+            // Keep a shared buffer alive until the lock is released, even if the buffer object is detached meanwhile
+            m_shared = _bo->m_shared;
         }
 
         /**
          * @brief Returns buffer_object's buffer pointer
+         *
+         * A lock_t detaches a shared buffer before returning it, since the pointer may be used to write.
          */
         [[nodiscard]] typename lock_base<T>::buffer_t buffer() const
         {
-            return m_buffer_object->m_buffer;
+            return m_buffer_object->buffer();
         }
 
         /**
@@ -146,6 +164,7 @@ public:
         void reset()
         {
             m_count.reset();
+            m_shared.reset();
             m_buffer_object.reset();
         }
 
@@ -156,6 +175,9 @@ public:
         // otherwise we would raise the lock count assert in the destruction of the buffer,
         // in BufferManager::::unregisterBufferImpl()
         SPTR(T) m_buffer_object;
+
+        // Buffer shared by the buffer object when this lock was taken, if any
+        std::shared_ptr<shared_storage> m_shared;
     };
 
     /**
@@ -239,6 +261,9 @@ public:
     /**
      * @brief Return a lock on the buffer_object
      *
+     * The buffer is detached first if it was shared, since the lock gives a writable pointer. To only keep a shared
+     * buffer loaded, build a lock_t directly from the buffer object.
+     *
      * @return Lock on the buffer_object
      */
     SIGHT_CORE_API virtual lock_t lock();
@@ -300,6 +325,33 @@ public:
     /// Exchanges the content of the buffer_object with the content of _source.
     SIGHT_CORE_API void swap(const buffer_object::sptr& _source) noexcept;
 
+    /**
+     * @brief Shares the buffer of _source, as a deep copy whose allocation is deferred to the first write.
+     *
+     * The current buffer is released, then both buffer objects read the same allocation until one of them is
+     * detached, reallocated or given another buffer. The shared allocation stays loaded: it is not dumped by the
+     * buffer manager while it is shared.
+     *
+     * Pointers to a buffer are only valid while it is locked, so neither buffer object may be locked: no pointer
+     * obtained before can write in the shared allocation.
+     *
+     * @return false if the buffer can not be shared, because _source is empty, does not own its buffer, or one of the
+     * buffer objects is locked. The caller must then copy the buffer itself.
+     */
+    SIGHT_CORE_API bool share(const buffer_object::sptr& _source);
+
+    /**
+     * @brief Gives this buffer object its own buffer, if it was shared with share().
+     *
+     * Called by every access that may write in the buffer. The last buffer object sharing an allocation takes it
+     * back without any copy if no lock still refers to it, the others copy it. Pointers obtained before remain valid
+     * while the locks taken before are held.
+     */
+    SIGHT_CORE_API void detach();
+
+    /// Returns true if the buffer is shared with other buffer objects
+    [[nodiscard]] SIGHT_CORE_API bool is_shared() const;
+
     SIGHT_CORE_API buffer_manager::stream_info get_stream_info() const;
 
     /**
@@ -343,6 +395,20 @@ protected:
     core::memory::buffer_allocation_policy::sptr m_alloc_policy;
 
     bool m_auto_delete {false};
+
+    /// Buffer shared with other buffer objects, guarded by m_lock_dump_mutex. When set, m_buffer is empty.
+    std::shared_ptr<shared_storage> m_shared;
+
+    /// Shared allocation, read by buffer() without locking
+    std::atomic<core::memory::buffer_manager::buffer_t> m_shared_buffer {nullptr};
+
+private:
+
+    /// Returns the shared buffer, if any
+    std::shared_ptr<shared_storage> shared() const;
+
+    /// Stops sharing the buffer, without allocating a new one, and returns the shared buffer, if any
+    std::shared_ptr<shared_storage> release_shared();
 };
 
 } // namespace sight::core::memory
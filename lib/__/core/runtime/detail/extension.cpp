@@ -27,6 +27,8 @@
 #include "core/runtime/detail/runtime.hpp"
 #include "core/runtime/module.hpp"
 
+#include <libxml/parser.h>
+#include <libxml/tree.h>
 #include <libxml/xmlstring.h>
 
 namespace sight::core::runtime::detail
@@ -49,20 +51,73 @@ extension::extension(
 
 //------------------------------------------------------------------------------
 
+extension::extension(
+    std::shared_ptr<core::runtime::module> _module,
+    const std::string& _id,
+    const std::string& _point,
+    std::string _xml
+) :
+    sight::core::runtime::extension(_module, _id, _point),
+    m_xml(std::move(_xml))
+{
+}
+
+//------------------------------------------------------------------------------
+
 extension::~extension()
 {
-    xmlFreeDoc(m_xml_doc);
+    if(m_xml_doc != nullptr)
+    {
+        xmlFreeDoc(m_xml_doc);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void extension::parse_xml() const
+{
+    if(m_xml_doc != nullptr)
+    {
+        return;
+    }
+
+    m_xml_doc = xmlReadMemory(m_xml.data(), static_cast<int>(m_xml.size()), nullptr, nullptr, 0);
+    if(m_xml_doc == nullptr)
+    {
+        throw runtime_exception(identifier() + ": unable to parse the cached extension.");
+    }
+
+    m_xml_node = xmlDocGetRootElement(m_xml_doc);
+    m_xml.clear();
 }
 
 //------------------------------------------------------------------------------
 
 xmlNodePtr extension::get_xml_node() const
 {
+    parse_xml();
     return m_xml_node;
 }
 
 //------------------------------------------------------------------------------
 
+std::string extension::get_xml() const
+{
+    if(m_xml_doc == nullptr)
+    {
+        return m_xml;
+    }
+
+    xmlBufferPtr buffer = xmlBufferCreate();
+    xmlNodeDump(buffer, m_xml_doc, m_xml_node, 0, 0);
+    std::string xml(reinterpret_cast<const char*>(xmlBufferContent(buffer)), std::size_t(xmlBufferLength(buffer)));
+    xmlBufferFree(buffer);
+
+    return xml;
+}
+
+//------------------------------------------------------------------------------
+
 extension::validity extension::validate()
 {
     // Skips the validation if already done.
@@ -87,7 +142,7 @@ extension::validity extension::validate()
 
     // Check extension XML Node <extension id="xxx" implements="yyy" >...</extension>
     validator->clear_error_log();
-    if(validator->validate(m_xml_node))
+    if(validator->validate(get_xml_node()))
     {
         m_validity = valid;
     }
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -68,6 +68,23 @@ public:
         const std::string& _point,
         xmlNodePtr _xml_node
     );
+
+    /**
+     * @brief       Constructor from a serialized extension, used when the module descriptor comes from the registry
+     *              cache. The XML node is only parsed when it is needed, i.e. to validate the extension.
+     *
+     * @param[in]   _module  a pointer to the module the extension is attached to
+     * @param[in]   _id      a string containing the extension identifier
+     * @param[in]   _point   a string containing the extension point identifier
+     * @param[in]   _xml     the xml text of the node that represents the extension
+     */
+    extension(
+        std::shared_ptr<core::runtime::module> _module,
+        const std::string& _id,
+        const std::string& _point,
+        std::string _xml
+    );
+
     /**
      * @brief   Destructor
      */
@@ -83,6 +100,13 @@ public:
      */
     [[nodiscard]] xmlNodePtr get_xml_node() const;
 
+    /**
+     * @brief   Retrieves the xml text of the node that represents the extension
+     *
+     * @return  the serialized xml node
+     */
+    [[nodiscard]] std::string get_xml() const;
+
     /**
      * @brief   Validates the extension.
      *
@@ -101,11 +125,15 @@ public:
 
 private:
 
-    xmlDocPtr m_xml_doc;                    ///< A pointer to the xml document that contains the xml node representing
-                                            ///< the extension
-    xmlNodePtr m_xml_node;                  ///< A pointer to the xml node that represents the extension
-    validity m_validity {unknown_validity}; ///< The validity state of the extension
-    core::runtime::config_t m_config;       ///< Configuration of the extension
+    /// Parses the serialized xml node, if any
+    void parse_xml() const;
+
+    mutable xmlDocPtr m_xml_doc {nullptr};   ///< A pointer to the xml document that contains the xml node
+                                             ///< representing the extension
+    mutable xmlNodePtr m_xml_node {nullptr}; ///< A pointer to the xml node that represents the extension
+    mutable std::string m_xml;               ///< The serialized xml node, until it is parsed
+    validity m_validity {unknown_validity};  ///< The validity state of the extension
+    core::runtime::config_t m_config;        ///< Configuration of the extension
 };
 
 } // namespace sight::core::runtime::detail
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -55,6 +55,13 @@ const std::string& extension_point::identifier() const
 
 //------------------------------------------------------------------------------
 
+const std::filesystem::path& extension_point::schema() const
+{
+    return m_schema;
+}
+
+//------------------------------------------------------------------------------
+
 std::shared_ptr<io::validator> extension_point::get_extension_validator() const
 {
     if(!m_schema.empty() && !m_validator)
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -111,6 +111,13 @@ public:
      */
     const std::string& identifier() const;
 
+    /**
+     * @brief   Retrieves the path to the XML schema used to validate contributed extensions.
+     *
+     * @return  a path relative to the module resources, or empty when none
+     */
+    const std::filesystem::path& schema() const;
+
     /**
      * @brief   Retrieves the extension validator.
      *
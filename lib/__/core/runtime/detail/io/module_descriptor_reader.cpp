@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -61,7 +61,8 @@ static const std::string POINT("point");
 //------------------------------------------------------------------------------
 
 std::pair<std::filesystem::path, module_descriptor_reader::module_container> module_descriptor_reader::create_modules(
-    const std::filesystem::path& _location
+    const std::filesystem::path& _location,
+    const std::optional<std::filesystem::path>& _cache_file
 )
 {
     std::filesystem::path normalized_path(_location);
@@ -85,15 +86,64 @@ std::pair<std::filesystem::path, module_descriptor_reader::module_container> mod
     }
 
     module_container modules;
+
+    const auto cache_file = _cache_file.value_or(registry_cache::default_file(normalized_path));
+
+    // Fast path, rebuild the modules from the registry cache without parsing any XML file
+    if(!cache_file.empty())
+    {
+        if(const auto& directories = registry_cache::load(cache_file, normalized_path); directories)
+        {
+            for(const auto& directory : *directories)
+            {
+                if(directory.module)
+                {
+                    if(auto module = create_module(*directory.module); module)
+                    {
+                        modules.push_back(module);
+                    }
+                }
+            }
+
+            if(!modules.empty())
+            {
+                SIGHT_INFO(
+                    "Modules of '" << normalized_path.string() << "' read from '" << cache_file.string() << "'."
+                );
+                return {normalized_path, modules};
+            }
+        }
+    }
+
+    // The cache can only be written if every module was created, a module already registered can not be described
+    bool cacheable = !cache_file.empty();
+    registry_cache::directory_container directories;
+
     const auto load_module_fn =
         [&](const std::filesystem::path& _path)
         {
+            registry_cache::directory_entry entry;
+            if(cacheable)
+            {
+                entry.path   = _path;
+                entry.stamps = registry_cache::stamp(_path);
+            }
+
             try
             {
                 SPTR(module) module = module_descriptor_reader::create_module(_path);
                 if(module)
                 {
                     modules.push_back(module);
+
+                    if(cacheable)
+                    {
+                        entry.module = registry_cache::describe(*std::dynamic_pointer_cast<detail::module>(module));
+                    }
+                }
+                else
+                {
+                    cacheable = false;
                 }
             }
             catch(const runtime_exception& runtime_exception)
@@ -104,19 +154,17 @@ std::pair<std::filesystem::path, module_descriptor_reader::module_container> mod
             {
                 SIGHT_DEBUG("'" << _path.string() << "': skipped. " << exception.what());
             }
+
+            if(cacheable)
+            {
+                directories.push_back(std::move(entry));
+            }
         };
 
-    // Walk through the repository entries.
-    std::filesystem::directory_iterator current_entry(normalized_path);
-    std::filesystem::directory_iterator end_entry;
-    for( ; current_entry != end_entry ; ++current_entry)
+    // Walk through the repository entries, in the same order as the registry cache.
+    for(const auto& entry_path : registry_cache::directories(normalized_path))
     {
-        const std::filesystem::path entry_path = *current_entry;
-
-        if(std::filesystem::is_directory(entry_path))
-        {
-            load_module_fn(entry_path);
-        }
+        load_module_fn(entry_path);
     }
 
     // If nothing can be found in the subfolders, give a try with the current folder
@@ -125,6 +173,17 @@ std::pair<std::filesystem::path, module_descriptor_reader::module_container> mod
     {
         load_module_fn(normalized_path);
     }
+    else if(cacheable)
+    {
+        try
+        {
+            registry_cache::save(cache_file, normalized_path, directories);
+        }
+        catch(const std::exception& e)
+        {
+            SIGHT_WARN("Unable to write the registry cache: " << e.what());
+        }
+    }
 
     return {normalized_path, modules};
 }
@@ -194,6 +253,50 @@ std::shared_ptr<module> module_descriptor_reader::create_module(const std::files
     return module;
 }
 
+//------------------------------------------------------------------------------
+
+std::shared_ptr<module> module_descriptor_reader::create_module(
+    const registry_cache::module_descriptor& _descriptor
+)
+{
+    if(core::runtime::find_module(_descriptor.identifier))
+    {
+        return nullptr;
+    }
+
+    auto module = create_module_instance(
+        _descriptor.location,
+        _descriptor.identifier,
+        _descriptor.library,
+        _descriptor.priority
+    );
+
+    for(const auto& requirement : _descriptor.requirements)
+    {
+        module->add_requirement(requirement);
+    }
+
+    for(const auto& point : _descriptor.extension_points)
+    {
+        module->add_extension_point(std::make_shared<extension_point>(module, point.id, point.schema));
+    }
+
+    for(const auto& cached_extension : _descriptor.extensions)
+    {
+        // The XML node is parsed only if the extension is validated
+        auto ext = std::make_shared<extension>(
+            module,
+            cached_extension.id,
+            cached_extension.point,
+            cached_extension.xml
+        );
+        ext->set_config(cached_extension.config);
+        module->add_extension(ext);
+    }
+
+    return module;
+}
+
 //-----------------------------------------------------------------------------
 
 void module_descriptor_reader::process_configuration(xmlNodePtr _node, core::runtime::config_t& _parent_config)
@@ -435,27 +538,7 @@ std::shared_ptr<detail::module> module_descriptor_reader::process_plugin(
         }
     }
 
-    if(create_library)
-    {
-        // Deduce the library name from the plugin name
-        std::string libname = boost::algorithm::replace_all_copy(module_identifier, "::", "_");
-        boost::algorithm::trim_left_if(libname, [](auto _x){return _x == '_';});
-
-        SIGHT_INFO(std::string("plugin ") + module_identifier + " holds library " + libname);
-
-        // Creates the library
-        // If we have a library, deduce the plugin name
-        const std::string plugin_class = module_identifier + "::plugin";
-
-        module = std::make_shared<detail::module>(_location, module_identifier, plugin_class, priority);
-
-        auto library = std::make_shared<dl::library>(libname);
-        module->set_library(library);
-    }
-    else
-    {
-        module = std::make_shared<detail::module>(_location, module_identifier);
-    }
+    module = create_module_instance(_location, module_identifier, create_library, priority);
 
     // Processes all child nodes.
     xmlNodePtr cur_child = nullptr;
@@ -503,6 +586,38 @@ std::shared_ptr<detail::module> module_descriptor_reader::process_plugin(
 
 //------------------------------------------------------------------------------
 
+std::shared_ptr<detail::module> module_descriptor_reader::create_module_instance(
+    const std::filesystem::path& _location,
+    const std::string& _identifier,
+    bool _library,
+    int _priority
+)
+{
+    if(!_library)
+    {
+        return std::make_shared<detail::module>(_location, _identifier);
+    }
+
+    // Deduce the library name from the plugin name
+    std::string libname = boost::algorithm::replace_all_copy(_identifier, "::", "_");
+    boost::algorithm::trim_left_if(libname, [](auto _x){return _x == '_';});
+
+    SIGHT_INFO(std::string("plugin ") + _identifier + " holds library " + libname);
+
+    // Creates the library
+    // If we have a library, deduce the plugin name
+    const std::string plugin_class = _identifier + "::plugin";
+
+    auto module = std::make_shared<detail::module>(_location, _identifier, plugin_class, _priority);
+
+    auto library = std::make_shared<dl::library>(libname);
+    module->set_library(library);
+
+    return module;
+}
+
+//------------------------------------------------------------------------------
+
 std::string module_descriptor_reader::process_requirement(xmlNodePtr _node)
 {
     // Processes all requirement attributes.
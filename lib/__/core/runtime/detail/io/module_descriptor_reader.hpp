@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -24,11 +24,13 @@
 
 #include "core/runtime/detail/dl/library.hpp"
 #include "core/runtime/detail/extension_point.hpp"
+#include "core/runtime/detail/io/registry_cache.hpp"
 #include "core/runtime/runtime_exception.hpp"
 
 #include <libxml/parser.h>
 
 #include <filesystem>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -62,11 +64,19 @@ public:
     /**
      * @brief       Creates all modules that are found at the given location.
      *
+     * The module descriptors are read from the registry cache when it is up to date, otherwise the `plugin.xml` files
+     * are parsed and the cache is written for the next time.
+     *
      * @param[in]   _location    a relative or absolute path to a directory containing modules
+     * @param[in]   _cache_file  the registry cache file, registry_cache::default_file() if not set, an empty path
+     *                           disables the cache
      *
      * @return      path to the absolute location path and a vector of all created modules
      */
-    static std::pair<std::filesystem::path, module_container> create_modules(const std::filesystem::path& _location);
+    static std::pair<std::filesystem::path, module_container> create_modules(
+        const std::filesystem::path& _location,
+        const std::optional<std::filesystem::path>& _cache_file = std::nullopt
+    );
 
     /**
      * @brief       Look for a descriptor at the specified location,
@@ -78,6 +88,15 @@ public:
      */
     static std::shared_ptr<module> create_module(const std::filesystem::path& _location);
 
+    /**
+     * @brief       Creates a module from a descriptor read from the registry cache.
+     *
+     * @param[in]   _descriptor  the module descriptor
+     *
+     * @return      a shared pointer to the created module, or null if the module is already registered
+     */
+    static std::shared_ptr<module> create_module(const registry_cache::module_descriptor& _descriptor);
+
     /**
      * @brief   Processes a configuration element XML node.
      *
@@ -138,6 +157,25 @@ public:
      * @return  a string containing the requirement's value
      */
     static std::string process_requirement(xmlNodePtr _node);
+
+private:
+
+    /**
+     * Creates an empty module, with its library if any.
+     *
+     * @param   _location    a path to a directory containing the module
+     * @param   _identifier  the module identifier
+     * @param   _library     true if the module holds a library
+     * @param   _priority    start order, lower is more favorable
+     *
+     * @return  a pointer to the created module
+     */
+    static std::shared_ptr<detail::module> create_module_instance(
+        const std::filesystem::path& _location,
+        const std::string& _identifier,
+        bool _library,
+        int _priority
+    );
 };
 
 } // namespace io
@@ -0,0 +1,547 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "core/runtime/detail/io/registry_cache.hpp"
+
+#include "core/runtime/detail/extension.hpp"
+#include "core/runtime/detail/extension_point.hpp"
+#include "core/runtime/detail/module.hpp"
+
+#include <core/exception.hpp>
+#include <core/exceptionmacros.hpp>
+#include <core/spy_log.hpp>
+#include <core/tools/os.hpp>
+#include <core/tools/uuid.hpp>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <type_traits>
+
+namespace sight::core::runtime::detail::io
+{
+
+namespace
+{
+
+/// Magic bytes at the beginning of a cache file
+constexpr std::array<char, 8> MAGIC {'S', 'I', 'G', 'H', 'T', 'R', 'E', 'G'};
+
+/// Written in native byte order, to detect a cache copied from another architecture
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+//------------------------------------------------------------------------------
+
+/// Sequential writer of the binary format
+class writer
+{
+public:
+
+    explicit writer(std::ostream& _stream) :
+        m_stream(_stream)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    template<typename T>
+    void write(const T& _value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        m_stream.write(reinterpret_cast<const char*>(&_value), sizeof(T));
+    }
+
+    //------------------------------------------------------------------------------
+
+    void write(const std::string& _value)
+    {
+        write(std::uint64_t(_value.size()));
+        m_stream.write(_value.data(), std::streamsize(_value.size()));
+    }
+
+    //------------------------------------------------------------------------------
+
+    void write(const std::filesystem::path& _value)
+    {
+        write(_value.generic_string());
+    }
+
+    //------------------------------------------------------------------------------
+
+    void write(const core::runtime::config_t& _tree)
+    {
+        write(_tree.data());
+        write(std::uint64_t(_tree.size()));
+
+        for(const auto& [key, child] : _tree)
+        {
+            write(key);
+            write(child);
+        }
+    }
+
+private:
+
+    std::ostream& m_stream;
+};
+
+/// Sequential reader of the binary format, over the memory mapped file. Every read is bounds checked.
+class reader
+{
+public:
+
+    reader(const char* _data, std::size_t _size) :
+        m_cursor(_data),
+        m_end(_data + _size)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    template<typename T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        std::memcpy(&value, advance(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    //------------------------------------------------------------------------------
+
+    std::string read_string()
+    {
+        const auto size = read<std::uint64_t>();
+        return std::string(advance(size), std::size_t(size));
+    }
+
+    //------------------------------------------------------------------------------
+
+    std::filesystem::path read_path()
+    {
+        return {read_string()};
+    }
+
+    //------------------------------------------------------------------------------
+
+    void read_tree(core::runtime::config_t& _tree)
+    {
+        _tree.data() = read_string();
+
+        for(auto children = read<std::uint64_t>() ; children > 0 ; --children)
+        {
+            auto key = read_string();
+            read_tree(_tree.push_back({std::move(key), core::runtime::config_t()})->second);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    /// Reads a count, a corrupted count is detected before trying to allocate anything
+    std::size_t read_count(std::size_t _min_element_size)
+    {
+        const auto count = read<std::uint64_t>();
+        if(count > std::uint64_t(m_end - m_cursor) / std::max<std::size_t>(_min_element_size, 1))
+        {
+            throw core::exception("Truncated registry cache.");
+        }
+
+        return std::size_t(count);
+    }
+
+    //------------------------------------------------------------------------------
+
+    [[nodiscard]] bool at_end() const
+    {
+        return m_cursor == m_end;
+    }
+
+private:
+
+    //------------------------------------------------------------------------------
+
+    const char* advance(std::uint64_t _size)
+    {
+        if(_size > std::uint64_t(m_end - m_cursor))
+        {
+            throw core::exception("Truncated registry cache.");
+        }
+
+        const char* const current = m_cursor;
+        m_cursor += _size;
+        return current;
+    }
+
+    const char* m_cursor;
+    const char* const m_end;
+};
+
+//------------------------------------------------------------------------------
+
+void write_module(writer& _writer, const registry_cache::module_descriptor& _module)
+{
+    _writer.write(_module.location);
+    _writer.write(_module.identifier);
+    _writer.write(std::uint8_t(_module.library ? 1 : 0));
+    _writer.write(std::int32_t(_module.priority));
+
+    _writer.write(std::uint64_t(_module.requirements.size()));
+    for(const auto& requirement : _module.requirements)
+    {
+        _writer.write(requirement);
+    }
+
+    _writer.write(std::uint64_t(_module.extension_points.size()));
+    for(const auto& point : _module.extension_points)
+    {
+        _writer.write(point.id);
+        _writer.write(point.schema);
+    }
+
+    _writer.write(std::uint64_t(_module.extensions.size()));
+    for(const auto& extension : _module.extensions)
+    {
+        _writer.write(extension.id);
+        _writer.write(extension.point);
+        _writer.write(extension.xml);
+        _writer.write(extension.config);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+registry_cache::module_descriptor read_module(reader& _reader)
+{
+    registry_cache::module_descriptor module;
+    module.location   = _reader.read_path();
+    module.identifier = _reader.read_string();
+    module.library    = _reader.read<std::uint8_t>() != 0;
+    module.priority   = _reader.read<std::int32_t>();
+
+    // Each element holds at least one size, this is used to detect corrupted counts
+    constexpr auto min_size = sizeof(std::uint64_t);
+
+    for(auto count = _reader.read_count(min_size) ; count > 0 ; --count)
+    {
+        module.requirements.push_back(_reader.read_string());
+    }
+
+    for(auto count = _reader.read_count(min_size) ; count > 0 ; --count)
+    {
+        registry_cache::extension_point_descriptor point;
+        point.id     = _reader.read_string();
+        point.schema = _reader.read_path();
+        module.extension_points.push_back(std::move(point));
+    }
+
+    for(auto count = _reader.read_count(min_size) ; count > 0 ; --count)
+    {
+        registry_cache::extension_descriptor extension;
+        extension.id    = _reader.read_string();
+        extension.point = _reader.read_string();
+        extension.xml   = _reader.read_string();
+        _reader.read_tree(extension.config);
+        module.extensions.push_back(std::move(extension));
+    }
+
+    return module;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+std::filesystem::path registry_cache::default_file(const std::filesystem::path& _repository)
+{
+    bool defined      = false;
+    const auto& value = core::tools::os::get_env("SIGHT_REGISTRY_CACHE", &defined);
+
+    if(defined && (value == "off" || value == "0"))
+    {
+        return {};
+    }
+
+    const auto directory = defined && !value.empty()
+                           ? std::filesystem::path(value)
+                           : core::tools::os::get_user_cache_dir("registry", false);
+
+    // One cache per repository
+    std::stringstream name;
+    name << std::hex << std::hash<std::string> {}(_repository.generic_string()) << ".bin";
+
+    return directory / name.str();
+}
+
+//------------------------------------------------------------------------------
+
+std::optional<registry_cache::directory_container> registry_cache::load(
+    const std::filesystem::path& _file,
+    const std::filesystem::path& _repository
+)
+{
+    std::error_code error;
+    if(std::filesystem::file_size(_file, error) == 0 || error)
+    {
+        return std::nullopt;
+    }
+
+    try
+    {
+        const boost::iostreams::mapped_file_source mapped_file(_file.string());
+        reader reader(mapped_file.data(), mapped_file.size());
+
+        std::array<char, MAGIC.size()> magic {};
+        for(auto& c : magic)
+        {
+            c = reader.read<char>();
+        }
+
+        if(magic != MAGIC
+           || reader.read<std::uint32_t>() != BYTE_ORDER_MARK
+           || reader.read<std::uint32_t>() != VERSION
+           || reader.read_path() != _repository)
+        {
+            SIGHT_DEBUG("Registry cache '" << _file.string() << "' does not match, it will be rebuilt.");
+            return std::nullopt;
+        }
+
+        // Check the layout of the repository before anything else, this is the cheapest test
+        const auto current_directories = directories(_repository);
+        const auto count               = reader.read_count(sizeof(std::uint64_t));
+        if(count != current_directories.size())
+        {
+            SIGHT_DEBUG("Registry cache '" << _file.string() << "' is outdated, modules were added or removed.");
+            return std::nullopt;
+        }
+
+        directory_container result;
+        result.reserve(count);
+
+        for(const auto& current_directory : current_directories)
+        {
+            directory_entry entry;
+            entry.path = reader.read_path();
+
+            for(auto stamps = reader.read_count(sizeof(std::uint64_t)) ; stamps > 0 ; --stamps)
+            {
+                file_stamp stamp;
+                stamp.path = reader.read_path();
+                stamp.time = reader.read<std::int64_t>();
+                stamp.size = reader.read<std::uint64_t>();
+                entry.stamps.push_back(std::move(stamp));
+            }
+
+            if(entry.path != current_directory || entry.stamps != registry_cache::stamp(current_directory))
+            {
+                SIGHT_DEBUG(
+                    "Registry cache '" << _file.string() << "' is outdated, '" << current_directory.string()
+                    << "' was modified."
+                );
+                return std::nullopt;
+            }
+
+            if(reader.read<std::uint8_t>() != 0)
+            {
+                entry.module = read_module(reader);
+            }
+
+            result.push_back(std::move(entry));
+        }
+
+        if(!reader.at_end())
+        {
+            throw core::exception("Unexpected data at the end of the registry cache.");
+        }
+
+        return result;
+    }
+    catch(const std::exception& e)
+    {
+        SIGHT_WARN("Unable to read the registry cache '" << _file.string() << "': " << e.what());
+    }
+
+    return std::nullopt;
+}
+
+//------------------------------------------------------------------------------
+
+void registry_cache::save(
+    const std::filesystem::path& _file,
+    const std::filesystem::path& _repository,
+    const directory_container& _directories
+)
+{
+    std::error_code error;
+    std::filesystem::create_directories(_file.parent_path(), error);
+    SIGHT_THROW_IF(
+        "Unable to create the directory '" << _file.parent_path().string() << "': " << error.message(),
+        error
+    );
+
+    // Write in a temporary file, then move it, so a concurrent launch never reads a partial cache
+    auto temporary_file = _file;
+    temporary_file += "." + core::tools::uuid::generate();
+
+    {
+        std::ofstream stream(temporary_file, std::ios::binary | std::ios::trunc);
+        SIGHT_THROW_IF("Unable to open '" << temporary_file.string() << "'.", !stream);
+
+        writer writer(stream);
+
+        for(const char c : MAGIC)
+        {
+            writer.write(c);
+        }
+
+        writer.write(BYTE_ORDER_MARK);
+        writer.write(VERSION);
+        writer.write(_repository);
+
+        writer.write(std::uint64_t(_directories.size()));
+        for(const auto& entry : _directories)
+        {
+            writer.write(entry.path);
+
+            writer.write(std::uint64_t(entry.stamps.size()));
+            for(const auto& stamp : entry.stamps)
+            {
+                writer.write(stamp.path);
+                writer.write(stamp.time);
+                writer.write(stamp.size);
+            }
+
+            writer.write(std::uint8_t(entry.module ? 1 : 0));
+            if(entry.module)
+            {
+                write_module(writer, *entry.module);
+            }
+        }
+
+        stream.close();
+
+        if(!stream)
+        {
+            std::filesystem::remove(temporary_file, error);
+            SIGHT_THROW("Unable to write '" << temporary_file.string() << "'.");
+        }
+    }
+
+    std::filesystem::rename(temporary_file, _file, error);
+    if(error)
+    {
+        std::filesystem::remove(temporary_file, error);
+        SIGHT_THROW("Unable to write '" << _file.string() << "'.");
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<registry_cache::file_stamp> registry_cache::stamp(const std::filesystem::path& _directory)
+{
+    std::vector<file_stamp> stamps;
+
+    std::error_code error;
+    for(std::filesystem::recursive_directory_iterator it(
+            _directory,
+            std::filesystem::directory_options::skip_permission_denied,
+            error), end ; !error && it != end ; it.increment(error))
+    {
+        const auto& path = it->path();
+
+        if(path.extension() == ".xml" && it->is_regular_file(error))
+        {
+            file_stamp stamp;
+            stamp.path = path.lexically_relative(_directory);
+            stamp.time = std::int64_t(std::filesystem::last_write_time(path, error).time_since_epoch().count());
+            stamp.size = std::uint64_t(it->file_size(error));
+            stamps.push_back(std::move(stamp));
+        }
+    }
+
+    std::ranges::sort(stamps, [](const auto& _a, const auto& _b){return _a.path < _b.path;});
+
+    return stamps;
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<std::filesystem::path> registry_cache::directories(const std::filesystem::path& _repository)
+{
+    std::vector<std::filesystem::path> directories;
+
+    for(const auto& entry : std::filesystem::directory_iterator(_repository))
+    {
+        if(entry.is_directory())
+        {
+            directories.push_back(entry.path());
+        }
+    }
+
+    std::ranges::sort(directories);
+
+    return directories;
+}
+
+//------------------------------------------------------------------------------
+
+registry_cache::module_descriptor registry_cache::describe(const detail::module& _module)
+{
+    module_descriptor descriptor;
+    descriptor.location   = _module.get_resources_location();
+    descriptor.identifier = _module.identifier();
+    descriptor.library    = !_module.get_class().empty();
+    descriptor.priority   = _module.priority();
+
+    const auto& requirements = _module.requirements();
+    descriptor.requirements.assign(requirements.cbegin(), requirements.cend());
+
+    std::for_each(
+        _module.extension_points_begin(),
+        _module.extension_points_end(),
+        [&descriptor](const auto& _point)
+        {
+            descriptor.extension_points.push_back({_point->identifier(), _point->schema()});
+        });
+
+    std::for_each(
+        _module.extensions_begin(),
+        _module.extensions_end(),
+        [&descriptor](const auto& _extension)
+        {
+            descriptor.extensions.push_back(
+                {
+                    _extension->identifier(),
+                    _extension->point(),
+                    _extension->get_xml(),
+                    _extension->get_config()
+                });
+        });
+
+    return descriptor;
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::core::runtime::detail::io
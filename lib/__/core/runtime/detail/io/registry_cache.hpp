@@ -0,0 +1,183 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "core/runtime/types.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace sight::core::runtime::detail
+{
+
+class module;
+
+namespace io
+{
+
+/**
+ * @brief   Binary cache of the module descriptors of a repository.
+ *
+ * Reading the modules of a repository requires to validate and parse every `plugin.xml`, to resolve their XIncludes
+ * and to convert the extensions into configuration trees. The registry cache stores the result of this work, so the
+ * next launches only have to check that the XML files did not change and to read back the descriptors from a memory
+ * mapped file.
+ *
+ * The cache is validated against:
+ * - the format version and the absolute path of the repository,
+ * - the list of the sub-directories of the repository,
+ * - the path, the modification time and the size of every XML file found in each module directory, so modifying an
+ *   included configuration invalidates the cache as well as modifying the `plugin.xml`.
+ *
+ * Any mismatch or read error discards the whole cache, the caller then parses the XML files and writes a new cache.
+ *
+ * The default location of the cache is in the user cache directory. It can be changed with the SIGHT_REGISTRY_CACHE
+ * environment variable, which holds either a directory or `off` to disable the cache.
+ */
+class registry_cache final
+{
+public:
+
+    /// Version of the binary format, to increment each time the layout changes
+    static constexpr std::uint32_t VERSION = 1;
+
+    /// State of an XML file when the cache was written
+    struct file_stamp
+    {
+        std::filesystem::path path;
+        std::int64_t time {0};
+        std::uint64_t size {0};
+
+        bool operator==(const file_stamp&) const = default;
+    };
+
+    /// Extension, as read from the module descriptor
+    struct extension_descriptor
+    {
+        std::string id;
+        std::string point;
+        std::string xml;
+        core::runtime::config_t config;
+    };
+
+    /// Extension point, as read from the module descriptor
+    struct extension_point_descriptor
+    {
+        std::string id;
+        std::filesystem::path schema;
+    };
+
+    /// Content of a module descriptor, enough to rebuild the module without parsing its XML files
+    struct module_descriptor
+    {
+        std::filesystem::path location;
+        std::string identifier;
+        bool library {false};
+        int priority {0};
+        std::vector<std::string> requirements;
+        std::vector<extension_point_descriptor> extension_points;
+        std::vector<extension_descriptor> extensions;
+    };
+
+    /// A directory of the repository
+    struct directory_entry
+    {
+        std::filesystem::path path;
+        std::vector<file_stamp> stamps;
+
+        /// Empty if the directory does not hold a valid module
+        std::optional<module_descriptor> module;
+    };
+
+    using directory_container = std::vector<directory_entry>;
+
+    /**
+     * @brief   Returns the default cache file of a repository.
+     *
+     * @param   _repository  the absolute path of the repository
+     *
+     * @return  the cache file, or an empty path if the cache is disabled
+     */
+    static std::filesystem::path default_file(const std::filesystem::path& _repository);
+
+    /**
+     * @brief   Reads a cache file and checks it is still up to date.
+     *
+     * @param   _file        the cache file
+     * @param   _repository  the absolute path of the repository
+     *
+     * @return  the directories of the repository, or nothing if the cache is missing, corrupted or outdated
+     */
+    static std::optional<directory_container> load(
+        const std::filesystem::path& _file,
+        const std::filesystem::path& _repository
+    );
+
+    /**
+     * @brief   Writes a cache file. The file is replaced atomically, so concurrent launches are safe.
+     *
+     * @param   _file        the cache file
+     * @param   _repository  the absolute path of the repository
+     * @param   _directories the directories of the repository
+     *
+     * @throw   core::exception if the file cannot be written
+     */
+    static void save(
+        const std::filesystem::path& _file,
+        const std::filesystem::path& _repository,
+        const directory_container& _directories
+    );
+
+    /**
+     * @brief   Lists the XML files of a module directory, with their modification time and size.
+     *
+     * @param   _directory   the module directory
+     *
+     * @return  the stamps, sorted by path
+     */
+    static std::vector<file_stamp> stamp(const std::filesystem::path& _directory);
+
+    /**
+     * @brief   Lists the sub-directories of a repository.
+     *
+     * @param   _repository  the repository
+     *
+     * @return  the sub-directories, sorted by path
+     */
+    static std::vector<std::filesystem::path> directories(const std::filesystem::path& _repository);
+
+    /**
+     * @brief   Builds the descriptor of a module.
+     *
+     * @param   _module      a module created from its XML descriptor
+     *
+     * @return  the descriptor
+     */
+    static module_descriptor describe(const detail::module& _module);
+};
+
+} // namespace io
+
+} // namespace sight::core::runtime::detail
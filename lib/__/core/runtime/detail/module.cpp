@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -255,6 +255,13 @@ void module::add_requirement(const std::string& _requirement)
 
 //------------------------------------------------------------------------------
 
+const std::set<std::string>& module::requirements() const
+{
+    return m_requirements;
+}
+
+//------------------------------------------------------------------------------
+
 std::string module::get_class() const
 {
     return m_class;
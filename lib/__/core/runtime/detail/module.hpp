@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -337,6 +337,12 @@ public:
      * @param[in]   _requirement a string containing a module identifier that is required
      */
     void add_requirement(const std::string& _requirement);
+
+    /**
+     * @brief   Retrieves the identifiers of the modules required by the module.
+     * @return  a set of module identifiers
+     */
+    const std::set<std::string>& requirements() const;
     //@}
 
     /**
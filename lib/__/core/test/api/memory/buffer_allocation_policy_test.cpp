@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2022-2023 IRCAD France
+ * Copyright (C) 2022-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -22,8 +22,11 @@
 #include "buffer_allocation_policy_test.hpp"
 
 #include <core/memory/buffer_allocation_policy.hpp>
+#include <core/exception.hpp>
 #include <core/memory/exception/memory.hpp>
 
+#include <cstring>
+
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::core::memory::ut::buffer_allocation_policy_test);
 
 namespace sight::core::memory::ut
@@ -50,6 +53,109 @@ void buffer_allocation_policy_test::exception_test()
     core::memory::buffer_no_alloc_policy::sptr no_alloc_p = std::make_shared<core::memory::buffer_no_alloc_policy>();
     CPPUNIT_ASSERT_THROW(no_alloc_p->allocate(buffer, 1), core::memory::exception::memory);
     CPPUNIT_ASSERT_THROW(no_alloc_p->reallocate(buffer, 1), core::memory::exception::memory);
+
+    // Buffer Aligned Policy
+    auto aligned_p = std::make_shared<core::memory::buffer_aligned_policy>();
+    CPPUNIT_ASSERT_THROW(aligned_p->allocate(buffer, impossible_buffer_size), core::memory::exception::memory);
+
+    CPPUNIT_ASSERT_THROW(core::memory::buffer_allocation_policy::make("unknown"), core::exception);
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_allocation_policy_test::aligned_test()
+{
+    const auto is_aligned = [](const void* _buffer, std::size_t _alignment)
+                            {
+                                return reinterpret_cast<std::uintptr_t>(_buffer) % _alignment == 0;
+                            };
+
+    core::memory::buffer_allocation_policy::buffer_t buffer = nullptr;
+
+    auto simd = core::memory::buffer_allocation_policy::make("aligned");
+    simd->allocate(buffer, 1000);
+    CPPUNIT_ASSERT(is_aligned(buffer, core::memory::buffer_aligned_policy::SIMD_ALIGNMENT));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1000), core::memory::buffer_aligned_policy::capacity(buffer));
+
+    // The content is kept when the buffer grows
+    std::memset(buffer, 42, 1000);
+    simd->reallocate(buffer, 100000);
+    CPPUNIT_ASSERT(is_aligned(buffer, core::memory::buffer_aligned_policy::SIMD_ALIGNMENT));
+    CPPUNIT_ASSERT_EQUAL(std::uint8_t(42), static_cast<std::uint8_t*>(buffer)[999]);
+
+    // Shrinking a little keeps the same buffer
+    const auto* const previous = buffer;
+    simd->reallocate(buffer, 90000);
+    CPPUNIT_ASSERT(previous == buffer);
+
+    simd->reallocate(buffer, 0);
+    CPPUNIT_ASSERT(buffer == nullptr);
+
+    auto page = core::memory::buffer_allocation_policy::make("page");
+    page->allocate(buffer, 10);
+    CPPUNIT_ASSERT(is_aligned(buffer, core::memory::buffer_aligned_policy::PAGE_ALIGNMENT));
+    page->destroy(buffer);
+    CPPUNIT_ASSERT(buffer == nullptr);
+
+    // Large buffers are aligned on huge pages
+    auto huge = core::memory::buffer_allocation_policy::make("huge");
+    huge->allocate(buffer, 4 * core::memory::buffer_aligned_policy::HUGE_PAGE_SIZE);
+    CPPUNIT_ASSERT(is_aligned(buffer, core::memory::buffer_aligned_policy::HUGE_PAGE_SIZE));
+    std::memset(buffer, 0, 4 * core::memory::buffer_aligned_policy::HUGE_PAGE_SIZE);
+    huge->destroy(buffer);
+}
+
+//------------------------------------------------------------------------------
+
+void buffer_allocation_policy_test::pool_test()
+{
+    constexpr std::size_t frame_size = std::size_t(1920) * 1080 * 3;
+
+    auto pool = std::make_shared<core::memory::buffer_pool_policy>(4 * frame_size);
+
+    core::memory::buffer_allocation_policy::buffer_t buffer = nullptr;
+
+    // Only the first frame is really allocated, the next ones reuse it
+    for(int i = 0 ; i < 10 ; ++i)
+    {
+        pool->allocate(buffer, frame_size);
+        CPPUNIT_ASSERT(buffer != nullptr);
+        std::memset(buffer, i, frame_size);
+        pool->destroy(buffer);
+        CPPUNIT_ASSERT(buffer == nullptr);
+    }
+
+    auto statistics = pool->get_statistics();
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), statistics.misses);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(9), statistics.hits);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(10), statistics.recycled);
+    CPPUNIT_ASSERT_EQUAL(core::memory::buffer_pool_policy::size_class(frame_size), statistics.cached_bytes);
+
+    // Sizes of the same class share their buffers
+    CPPUNIT_ASSERT(core::memory::buffer_pool_policy::size_class(frame_size) >= frame_size);
+    CPPUNIT_ASSERT(core::memory::buffer_pool_policy::size_class(frame_size) <= frame_size + frame_size / 4);
+    pool->allocate(buffer, frame_size + 1);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(10), pool->get_statistics().hits);
+
+    // The content is kept when the buffer grows out of its class
+    static_cast<std::uint8_t*>(buffer)[frame_size - 1] = 42;
+    pool->reallocate(buffer, 2 * frame_size);
+    CPPUNIT_ASSERT_EQUAL(std::uint8_t(42), static_cast<std::uint8_t*>(buffer)[frame_size - 1]);
+    pool->destroy(buffer);
+
+    // Above the high-water mark, buffers are released
+    std::vector<core::memory::buffer_allocation_policy::buffer_t> buffers(8, nullptr);
+    std::ranges::for_each(buffers, [&pool](auto& _x){pool->allocate(_x, frame_size);});
+    std::ranges::for_each(buffers, [&pool](auto& _x){pool->destroy(_x);});
+    statistics = pool->get_statistics();
+    CPPUNIT_ASSERT(statistics.cached_bytes <= 4 * frame_size);
+    CPPUNIT_ASSERT(statistics.released > 0);
+
+    pool->set_high_water_mark(0);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), pool->get_statistics().cached_bytes);
+
+    const auto shared = core::memory::buffer_allocation_policy::make("pool");
+    CPPUNIT_ASSERT(shared == core::memory::buffer_pool_policy::get_default());
 }
 
 } // namespace sight::core::memory::ut
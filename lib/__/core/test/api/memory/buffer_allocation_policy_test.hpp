@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2022-2023 IRCAD France
+ * Copyright (C) 2022-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -30,11 +30,15 @@ class buffer_allocation_policy_test : public CPPUNIT_NS::TestFixture
 {
 CPPUNIT_TEST_SUITE(buffer_allocation_policy_test);
 CPPUNIT_TEST(exception_test);
+CPPUNIT_TEST(aligned_test);
+CPPUNIT_TEST(pool_test);
 CPPUNIT_TEST_SUITE_END();
 
 public:
 
     static void exception_test();
+    static void aligned_test();
+    static void pool_test();
 };
 
 } // namespace sight::core::memory::ut
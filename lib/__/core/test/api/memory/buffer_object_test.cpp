@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -30,11 +30,15 @@
 
 #include <boost/thread/thread.hpp>
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <thread>
 #include <type_traits>
+#include <utility>
 
 // Registers the fixture into the 'registry'
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::core::memory::ut::buffer_object_test);
@@ -268,4 +272,146 @@ void buffer_object_test::lock_threaded_stress_test()
     CPPUNIT_ASSERT_EQUAL(static_cast<std::int64_t>(0), bo->lock_count());
 }
 
+//------------------------------------------------------------------------------
+
+void buffer_object_test::copy_on_write_test()
+{
+    const std::size_t size = 1000;
+    const auto fill        =
+        [](const core::memory::buffer_object::sptr& _bo, char _value)
+        {
+            const auto lock = _bo->lock();
+            std::memset(lock.buffer(), _value, _bo->size());
+        };
+    const auto all_equal =
+        [](const core::memory::buffer_object::sptr& _bo, char _value)
+        {
+            const auto lock = std::as_const(*_bo).lock();
+            const auto* buf = static_cast<const char*>(lock.buffer());
+            return std::all_of(buf, buf + _bo->size(), [_value](char _c){return _c == _value;});
+        };
+
+    auto source = std::make_shared<core::memory::buffer_object>();
+    source->allocate(size);
+    fill(source, 1);
+
+    // Empty or not owned buffers can not be shared
+    auto copy = std::make_shared<core::memory::buffer_object>();
+    CPPUNIT_ASSERT(!copy->share(std::make_shared<core::memory::buffer_object>()));
+    {
+        std::array<char, 16> external {};
+        auto not_owned = std::make_shared<core::memory::buffer_object>();
+        not_owned->set_buffer(external.data(), external.size(), std::make_shared<buffer_no_alloc_policy>());
+        CPPUNIT_ASSERT(!copy->share(not_owned));
+    }
+
+    // A locked buffer may be written through the pointers obtained from its locks, so it is not shared
+    {
+        const auto source_lock = source->lock();
+        CPPUNIT_ASSERT(!copy->share(source));
+        CPPUNIT_ASSERT(!source->is_shared());
+    }
+
+    // A shared buffer is not copied
+    CPPUNIT_ASSERT(copy->share(source));
+    CPPUNIT_ASSERT(source->is_shared());
+    CPPUNIT_ASSERT(copy->is_shared());
+    CPPUNIT_ASSERT_EQUAL(size, copy->size());
+    CPPUNIT_ASSERT(std::as_const(*source).lock().buffer() == std::as_const(*copy).lock().buffer());
+    CPPUNIT_ASSERT(*source == *copy);
+
+    {
+        // The first writer gets its own buffer, pointers obtained before remain valid and unchanged
+        const auto source_lock     = std::as_const(*source).lock();
+        const auto* const original = static_cast<const char*>(source_lock.buffer());
+
+        copy->detach();
+        CPPUNIT_ASSERT(!copy->is_shared());
+        CPPUNIT_ASSERT(copy->lock().buffer() != original);
+        CPPUNIT_ASSERT(all_equal(copy, 1));
+
+        fill(copy, 2);
+        CPPUNIT_ASSERT(all_equal(source, 1));
+        CPPUNIT_ASSERT_EQUAL(char(1), original[size - 1]);
+
+        // The source is still locked, so it copies the buffer too
+        source->detach();
+        CPPUNIT_ASSERT(std::as_const(*source).lock().buffer() != original);
+        CPPUNIT_ASSERT(all_equal(source, 1));
+    }
+
+    // The last buffer object sharing an allocation takes it back
+    auto copy2 = std::make_shared<core::memory::buffer_object>();
+    CPPUNIT_ASSERT(copy2->share(source));
+    const void* const shared_buffer = std::as_const(*source).lock().buffer();
+    copy2.reset();
+    source->detach();
+    CPPUNIT_ASSERT(!source->is_shared());
+    CPPUNIT_ASSERT(std::as_const(*source).lock().buffer() == shared_buffer);
+    CPPUNIT_ASSERT(all_equal(source, 1));
+
+    // Every access that may write detaches the buffer, read accesses do not
+    {
+        auto copy5 = std::make_shared<core::memory::buffer_object>();
+        CPPUNIT_ASSERT(copy5->share(source));
+        CPPUNIT_ASSERT(std::as_const(*copy5).buffer() == std::as_const(*source).buffer());
+        CPPUNIT_ASSERT(copy5->is_shared());
+
+        {
+            // A lock built from the buffer object only keeps it loaded, until its pointer is requested
+            const core::memory::buffer_object::lock_t lock(copy5);
+            CPPUNIT_ASSERT(copy5->is_shared());
+            static_cast<char*>(lock.buffer())[0] = 5;
+            CPPUNIT_ASSERT(!copy5->is_shared());
+            CPPUNIT_ASSERT(all_equal(source, 1));
+        }
+
+        CPPUNIT_ASSERT(copy5->share(source));
+        static_cast<char*>(copy5->buffer())[0] = 5;
+        CPPUNIT_ASSERT(!copy5->is_shared());
+        CPPUNIT_ASSERT(all_equal(source, 1));
+
+        CPPUNIT_ASSERT(copy5->share(source));
+        static_cast<char*>(copy5->lock().buffer())[0] = 5;
+        CPPUNIT_ASSERT(!copy5->is_shared());
+        CPPUNIT_ASSERT(all_equal(source, 1));
+
+        // The source detaches on write the same way
+        CPPUNIT_ASSERT(copy5->share(source));
+        fill(source, 6);
+        CPPUNIT_ASSERT(!source->is_shared());
+        CPPUNIT_ASSERT(all_equal(copy5, 1));
+        fill(source, 1);
+    }
+
+    // Reallocating a shared buffer keeps its content
+    auto copy3 = std::make_shared<core::memory::buffer_object>();
+    CPPUNIT_ASSERT(copy3->share(source));
+    copy3->reallocate(2 * size);
+    CPPUNIT_ASSERT(!copy3->is_shared());
+    CPPUNIT_ASSERT_EQUAL(2 * size, copy3->size());
+    {
+        const auto lock = copy3->lock();
+        const auto* buf = static_cast<const char*>(lock.buffer());
+        CPPUNIT_ASSERT(std::all_of(buf, buf + size, [](char _c){return _c == 1;}));
+    }
+
+    // Destroying, swapping or reallocating one buffer object does not change the others
+    auto copy4 = std::make_shared<core::memory::buffer_object>();
+    CPPUNIT_ASSERT(copy4->share(source));
+    copy4->destroy();
+    CPPUNIT_ASSERT(copy4->is_empty());
+    CPPUNIT_ASSERT(!copy4->is_shared());
+    copy4->allocate(size);
+    fill(copy4, 4);
+    CPPUNIT_ASSERT(all_equal(source, 1));
+
+    CPPUNIT_ASSERT(copy->share(source));
+    copy->swap(copy4);
+    CPPUNIT_ASSERT(!copy->is_shared());
+    CPPUNIT_ASSERT(copy4->is_shared());
+    CPPUNIT_ASSERT(all_equal(copy, 4));
+    CPPUNIT_ASSERT(all_equal(copy4, 1));
+}
+
 } // namespace sight::core::memory::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -33,6 +33,7 @@ CPPUNIT_TEST_SUITE(buffer_object_test);
 CPPUNIT_TEST(allocate_test);
 CPPUNIT_TEST(allocate_zero_test);
 CPPUNIT_TEST(lock_threaded_stress_test);
+CPPUNIT_TEST(copy_on_write_test);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -44,6 +45,7 @@ public:
     static void allocate_test();
     static void allocate_zero_test();
     static void lock_threaded_stress_test();
+    static void copy_on_write_test();
 };
 
 } // namespace sight::core::memory::ut
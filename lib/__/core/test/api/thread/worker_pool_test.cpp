@@ -0,0 +1,350 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "worker_pool_test.hpp"
+
+#include <core/exception.hpp>
+#include <core/thread/timer.hpp>
+#include <core/thread/worker.hxx>
+#include <core/thread/worker_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::core::thread::ut::worker_pool_test);
+
+namespace sight::core::thread::ut
+{
+
+//------------------------------------------------------------------------------
+
+void worker_pool_test::setUp()
+{
+    // Set up context before running a test.
+}
+
+//------------------------------------------------------------------------------
+
+void worker_pool_test::tearDown()
+{
+    // Clean up after the test run.
+}
+
+//------------------------------------------------------------------------------
+
+void worker_pool_test::lane_test()
+{
+    auto pool = core::thread::worker_pool::make(4, "lanes");
+
+    constexpr int tasks = 200;
+    std::vector<core::thread::worker::sptr> lanes;
+    std::vector<std::vector<int> > orders(3);
+    std::atomic_int running {0};
+    std::atomic_bool overlap {false};
+    std::atomic_bool thread_check {true};
+
+    for(std::size_t i = 0 ; i < orders.size() ; ++i)
+    {
+        lanes.push_back(pool->make_lane());
+    }
+
+    for(int t = 0 ; t < tasks ; ++t)
+    {
+        for(std::size_t i = 0 ; i < lanes.size() ; ++i)
+        {
+            lanes[i]->post(
+                [&, i, t, lane = lanes[i].get()]
+                {
+                    // The tasks of a lane never run concurrently, and in the order they were posted
+                    overlap      = overlap || (i == 0 && running.fetch_add(1) != 0);
+                    thread_check = thread_check && lane->get_thread_id() == core::thread::get_current_thread_id();
+                    orders[i].push_back(t);
+                    std::this_thread::sleep_for(std::chrono::microseconds(50));
+                    if(i == 0)
+                    {
+                        running.fetch_sub(1);
+                    }
+                });
+        }
+    }
+
+    // A task posted from the lane itself is called immediately
+    std::atomic_bool inline_call {false};
+    std::atomic_bool called_inline {false};
+    lanes[1]->post(
+        [&inline_call, &called_inline, lane = lanes[1].get()]
+        {
+            lane->post_task<void>([&inline_call]{inline_call = true;});
+            called_inline = inline_call.load();
+        });
+
+    for(const auto& lane : lanes)
+    {
+        lane->stop();
+    }
+
+    CPPUNIT_ASSERT(!overlap);
+    CPPUNIT_ASSERT(thread_check);
+    CPPUNIT_ASSERT(called_inline);
+    for(const auto& order : orders)
+    {
+        CPPUNIT_ASSERT_EQUAL(std::size_t(tasks), order.size());
+        CPPUNIT_ASSERT(std::is_sorted(order.begin(), order.end()));
+    }
+
+    // Nothing is processed after the lane is stopped
+    bool processed = false;
+    lanes[0]->post([&processed]{processed = true;});
+    pool->stop();
+    CPPUNIT_ASSERT(!processed);
+}
+
+//------------------------------------------------------------------------------
+
+void worker_pool_test::priority_test()
+{
+    auto pool = core::thread::worker_pool::make(3, "priority");
+
+    auto slow       = pool->make_lane(core::thread::priority::normal);
+    auto slow2      = pool->make_lane(core::thread::priority::normal);
+    auto tracker    = pool->make_lane(core::thread::priority::real_time);
+    auto bookkeeper = pool->make_lane(core::thread::priority::background);
+
+    // Two slow updates hold the threads of the pool which are not reserved to real-time tasks
+    std::atomic_int slow_started {0};
+    for(const auto& lane : {slow, slow2})
+    {
+        lane->post(
+            [&slow_started]
+            {
+                ++slow_started;
+                std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            });
+    }
+
+    while(slow_started < 2)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // The real-time lane is not delayed by the slow update, the background one waits for it
+    const auto start = core::clock::get_time_in_milli_sec();
+    std::atomic<core::clock::type> tracked {0.};
+    std::atomic<core::clock::type> bookkept {0.};
+    bookkeeper->post([&]{bookkept = core::clock::get_time_in_milli_sec();});
+    tracker->post([&]{tracked = core::clock::get_time_in_milli_sec();});
+
+    tracker->stop();
+    CPPUNIT_ASSERT(tracked.load() - start < 250.);
+
+    bookkeeper->stop();
+    slow->stop();
+    slow2->stop();
+    CPPUNIT_ASSERT(bookkept.load() - start >= 250.);
+
+    // With two threads, none is reserved: a slow task would otherwise hold the only thread of the other tasks
+    auto small_pool = core::thread::worker_pool::make(2, "priority");
+    auto blocked    = small_pool->make_lane(core::thread::priority::normal);
+    auto unblocked  = small_pool->make_lane(core::thread::priority::background);
+    std::atomic_bool release {false};
+    blocked->post(
+        [&release]
+        {
+            while(!release)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+    auto done = unblocked->post_task<void>([]{});
+    CPPUNIT_ASSERT(done.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    release = true;
+    blocked->stop();
+    unblocked->stop();
+
+    CPPUNIT_ASSERT(core::thread::priority::real_time == core::thread::to_priority("real_time"));
+    CPPUNIT_ASSERT(core::thread::priority::background == core::thread::to_priority("background"));
+    CPPUNIT_ASSERT_THROW(core::thread::to_priority("urgent"), core::exception);
+}
+
+//------------------------------------------------------------------------------
+
+void worker_pool_test::timer_test()
+{
+    auto pool = core::thread::worker_pool::make(2, "timer");
+    auto lane = pool->make_lane(core::thread::priority::real_time);
+
+    std::atomic_int ticks {0};
+    std::atomic_bool thread_check {true};
+    auto timer = lane->create_timer();
+    timer->set_function(
+        [&, lane = lane.get()]
+        {
+            thread_check = thread_check && lane->get_thread_id() == core::thread::get_current_thread_id();
+            ++ticks;
+        });
+    timer->set_duration(std::chrono::milliseconds(10));
+    timer->start();
+    CPPUNIT_ASSERT(timer->is_running());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    timer->stop();
+    CPPUNIT_ASSERT(!timer->is_running());
+
+    lane->stop();
+    CPPUNIT_ASSERT(ticks > 5);
+    CPPUNIT_ASSERT(thread_check);
+
+    timer.reset();
+    pool->stop();
+}
+
+//------------------------------------------------------------------------------
+
+void worker_pool_test::metrics_test()
+{
+    core::thread::worker::set_latency_enabled(true);
+
+    auto pool = core::thread::worker_pool::make(2, "metrics");
+    auto lane = pool->make_lane(core::thread::priority::normal);
+
+    std::atomic_bool release {false};
+    lane->post(
+        [&release]
+        {
+            while(!release)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+    lane->post([]{});
+    lane->post([]{});
+
+    // The first task is running, the two others are waiting for it
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), lane->get_metrics().queue_depth);
+
+    release = true;
+    lane->stop();
+
+    const auto metrics = lane->get_metrics();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), metrics.queue_depth);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(3), metrics.processed);
+    CPPUNIT_ASSERT(metrics.max_latency >= 20.);
+    CPPUNIT_ASSERT(metrics.mean_latency > 0. && metrics.mean_latency <= metrics.max_latency);
+
+    // The lane is scheduled once per task on the pool
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(3), pool->get_metrics(core::thread::priority::normal).processed);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(0), pool->get_metrics(core::thread::priority::real_time).processed);
+
+    // Workers track their tasks too
+    auto worker = core::thread::worker::make();
+    worker->post([]{});
+    worker->post([]{});
+    worker->stop();
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(2), worker->get_metrics().processed);
+
+    // Without latencies, the tasks are still counted
+    core::thread::worker::set_latency_enabled(false);
+    auto unmeasured = core::thread::worker::make();
+    unmeasured->post([]{});
+    unmeasured->stop();
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), unmeasured->get_metrics().processed);
+    CPPUNIT_ASSERT_EQUAL(0., unmeasured->get_metrics().max_latency);
+
+    pool->stop();
+}
+
+//------------------------------------------------------------------------------
+
+void worker_pool_test::stop_from_lane_test()
+{
+    // With a single thread, the pool can not schedule the stopped lane while the task calling stop() holds the thread
+    auto pool     = core::thread::worker_pool::make(1, "stop");
+    auto stopping = pool->make_lane(core::thread::priority::normal);
+    auto stopped  = pool->make_lane(core::thread::priority::normal);
+
+    std::atomic_int count {0};
+    auto result = stopping->post_task<int>(
+        [&]
+        {
+            for(int i = 0 ; i < 3 ; ++i)
+            {
+                stopped->post([&count]{++count;});
+            }
+
+            // The pending tasks of the lane are processed by this thread
+            stopped->stop();
+            return count.load();
+        });
+
+    CPPUNIT_ASSERT(result.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    CPPUNIT_ASSERT_EQUAL(3, result.get());
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(3), stopped->get_metrics().processed);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), stopped->get_metrics().queue_depth);
+
+    stopping->stop();
+    pool->stop();
+}
+
+//------------------------------------------------------------------------------
+
+void worker_pool_test::post_after_stop_test()
+{
+    auto pool = core::thread::worker_pool::make(2, "post");
+    auto lane = pool->make_lane(core::thread::priority::normal);
+    lane->post([]{});
+    lane->stop();
+
+    // Tasks posted to a stopped lane are discarded and not counted as pending
+    std::atomic_bool run {false};
+    auto discarded = lane->post_task<void>([&run]{run = true;});
+    CPPUNIT_ASSERT_THROW(discarded.get(), std::future_error);
+    CPPUNIT_ASSERT(!run);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), lane->get_metrics().queue_depth);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), lane->get_metrics().processed);
+
+    // The same for the lanes of a stopped pool, and the pool itself
+    auto other_lane = pool->make_lane(core::thread::priority::background);
+    pool->stop();
+    discarded = other_lane->post_task<void>([&run]{run = true;});
+    CPPUNIT_ASSERT_THROW(discarded.get(), std::future_error);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), other_lane->get_metrics().queue_depth);
+
+    pool->post([&run]{run = true;}, core::thread::priority::real_time);
+    CPPUNIT_ASSERT(!run);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), pool->get_metrics(core::thread::priority::real_time).queue_depth);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), pool->get_metrics(core::thread::priority::background).queue_depth);
+
+    // Workers do not count the tasks posted after they are stopped either
+    auto worker = core::thread::worker::make();
+    worker->post([]{});
+    worker->stop();
+    discarded = worker->post_task<void>([&run]{run = true;});
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), worker->get_metrics().queue_depth);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), worker->get_metrics().processed);
+    CPPUNIT_ASSERT_THROW(discarded.get(), std::future_error);
+    CPPUNIT_ASSERT(!run);
+}
+
+} // namespace sight::core::thread::ut
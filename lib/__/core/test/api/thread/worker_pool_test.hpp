@@ -0,0 +1,54 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::core::thread::ut
+{
+
+class worker_pool_test : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(worker_pool_test);
+CPPUNIT_TEST(lane_test);
+CPPUNIT_TEST(priority_test);
+CPPUNIT_TEST(timer_test);
+CPPUNIT_TEST(metrics_test);
+CPPUNIT_TEST(stop_from_lane_test);
+CPPUNIT_TEST(post_after_stop_test);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // interface
+    void setUp() override;
+    void tearDown() override;
+
+    static void lane_test();
+    static void priority_test();
+    static void timer_test();
+    static void metrics_test();
+    static void stop_from_lane_test();
+    static void post_after_stop_test();
+};
+
+} // namespace sight::core::thread::ut
@@ -0,0 +1,277 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "registry_cache_test.hpp"
+
+#include <core/os/temp_path.hpp>
+#include <core/profiling.hpp>
+#include <core/runtime/detail/extension.hpp>
+#include <core/runtime/detail/extension_point.hpp>
+#include <core/runtime/detail/io/module_descriptor_reader.hpp>
+#include <core/runtime/detail/io/registry_cache.hpp>
+#include <core/runtime/detail/module.hpp>
+
+#include <libxml/tree.h>
+
+#include <fstream>
+#include <map>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::core::runtime::detail::ut::registry_cache_test);
+
+namespace sight::core::runtime::detail::ut
+{
+
+using module_descriptor_reader = core::runtime::detail::io::module_descriptor_reader;
+using registry_cache           = core::runtime::detail::io::registry_cache;
+
+//------------------------------------------------------------------------------
+
+static std::string module_id(const std::string& _prefix, std::size_t _index)
+{
+    return "sight::module::registry_cache_test::" + _prefix + std::to_string(_index);
+}
+
+//------------------------------------------------------------------------------
+
+/// Writes a module descriptor, with its extensions in an included file like most of our activities
+static void write_module(
+    const std::filesystem::path& _repository,
+    const std::string& _id,
+    std::size_t _extensions,
+    const std::string& _value = "value"
+)
+{
+    const auto folder = _repository / _id.substr(_id.rfind(':') + 1);
+    std::filesystem::create_directories(folder / "configurations");
+
+    std::ofstream(folder / "plugin.xml")
+    << "<plugin id=\"" << _id << "\">\n"
+    << "    <requirement id=\"sight::module::service\" />\n"
+    << "    <extension-point id=\"" << _id << "::point\" schema=\"point.xsd\" />\n"
+    << "    <xi:include href=\"configurations/extensions.xml\" xmlns:xi=\"http://www.w3.org/2003/XInclude\" />\n"
+    << "</plugin>\n";
+
+    std::ofstream extensions(folder / "configurations" / "extensions.xml");
+    extensions << "<extensions>\n";
+    for(std::size_t i = 0 ; i < _extensions ; ++i)
+    {
+        extensions
+        << "<extension implements=\"" << _id << "::point\">\n"
+        << "    <id>" << _id << "::config" << i << "</id>\n"
+        << "    <config>\n"
+        << "        <object uid=\"image\" type=\"sight::data::image\" />\n"
+        << "        <service uid=\"reader\" type=\"sight::module::io::reader\" auto_connect=\"true\">\n"
+        << "            <inout key=\"data\" uid=\"image\" />\n"
+        << "            <label>" << _value << "</label>\n"
+        << "        </service>\n"
+        << "    </config>\n"
+        << "</extension>\n";
+    }
+
+    extensions << "</extensions>\n";
+}
+
+//------------------------------------------------------------------------------
+
+static std::map<std::string, std::shared_ptr<detail::module> > create_modules(
+    const std::filesystem::path& _repository,
+    const std::filesystem::path& _cache_file
+)
+{
+    std::map<std::string, std::shared_ptr<detail::module> > result;
+
+    const auto& [path, modules] = module_descriptor_reader::create_modules(_repository, _cache_file);
+    for(const auto& module : modules)
+    {
+        result[module->identifier()] = module;
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+void registry_cache_test::setUp()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void registry_cache_test::tearDown()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void registry_cache_test::cache_test()
+{
+    core::os::temp_dir repository;
+    core::os::temp_dir cache_dir;
+    const auto cache_file = cache_dir / "registry.bin";
+
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        write_module(repository, module_id("cache", i), 2);
+    }
+
+    // A folder which is not a module
+    std::filesystem::create_directories(repository / "not_a_module");
+
+    // First time, the XML files are parsed and the cache is written
+    const auto parsed = create_modules(repository, cache_file);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), parsed.size());
+    CPPUNIT_ASSERT(std::filesystem::exists(cache_file));
+
+    const auto directories = registry_cache::load(cache_file, std::filesystem::weakly_canonical(repository));
+    CPPUNIT_ASSERT(directories);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(4), directories->size());
+
+    // Second time, the modules are rebuilt from the cache
+    const auto cached = create_modules(repository, cache_file);
+    CPPUNIT_ASSERT_EQUAL(parsed.size(), cached.size());
+
+    for(const auto& [id, parsed_module] : parsed)
+    {
+        const auto& cached_module = cached.at(id);
+
+        CPPUNIT_ASSERT(parsed_module != cached_module);
+        CPPUNIT_ASSERT_EQUAL(parsed_module->get_resources_location(), cached_module->get_resources_location());
+        CPPUNIT_ASSERT_EQUAL(parsed_module->get_class(), cached_module->get_class());
+        CPPUNIT_ASSERT(parsed_module->requirements() == cached_module->requirements());
+
+        const auto parsed_descriptor = registry_cache::describe(*parsed_module);
+        const auto cached_descriptor = registry_cache::describe(*cached_module);
+
+        CPPUNIT_ASSERT_EQUAL(std::size_t(1), cached_descriptor.extension_points.size());
+        CPPUNIT_ASSERT_EQUAL(id + "::point", cached_descriptor.extension_points[0].id);
+        CPPUNIT_ASSERT_EQUAL(std::string("point.xsd"), cached_descriptor.extension_points[0].schema.string());
+
+        CPPUNIT_ASSERT_EQUAL(std::size_t(2), cached_descriptor.extensions.size());
+
+        std::map<std::string, core::runtime::config_t> parsed_configs;
+        for(const auto& extension : parsed_descriptor.extensions)
+        {
+            parsed_configs[extension.config.get<std::string>("id")] = extension.config;
+        }
+
+        std::for_each(
+            cached_module->extensions_begin(),
+            cached_module->extensions_end(),
+            [&](const auto& _extension)
+            {
+                CPPUNIT_ASSERT_EQUAL(id + "::point", _extension->point());
+
+                const auto& config = _extension->get_config();
+                CPPUNIT_ASSERT(parsed_configs.at(config.template get<std::string>("id")) == config);
+                CPPUNIT_ASSERT_EQUAL(
+                    std::string("value"),
+                    config.template get<std::string>("config.service.label")
+                );
+
+                // The XML node is parsed on demand
+                const xmlNodePtr node = _extension->get_xml_node();
+                CPPUNIT_ASSERT(node != nullptr);
+                CPPUNIT_ASSERT_EQUAL(std::string("extension"), std::string(reinterpret_cast<const char*>(node->name)));
+            });
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void registry_cache_test::invalidation_test()
+{
+    core::os::temp_dir repository;
+    core::os::temp_dir cache_dir;
+    const auto cache_file = cache_dir / "registry.bin";
+
+    const auto id = module_id("invalidation", 0);
+    write_module(repository, id, 1);
+
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), create_modules(repository, cache_file).size());
+
+    // Modify the included file only, the cache must be discarded
+    write_module(repository, id, 1, "modified value");
+    {
+        const auto modules = create_modules(repository, cache_file);
+        CPPUNIT_ASSERT_EQUAL(std::size_t(1), modules.size());
+
+        const auto& extension = *modules.at(id)->extensions_begin();
+        CPPUNIT_ASSERT_EQUAL(
+            std::string("modified value"),
+            extension->get_config().get<std::string>("config.service.label")
+        );
+    }
+
+    // Add a module
+    write_module(repository, module_id("invalidation", 1), 1);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), create_modules(repository, cache_file).size());
+
+    // A corrupted cache is ignored and rewritten
+    std::filesystem::resize_file(cache_file, std::filesystem::file_size(cache_file) / 2);
+    CPPUNIT_ASSERT(!registry_cache::load(cache_file, std::filesystem::weakly_canonical(repository)));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), create_modules(repository, cache_file).size());
+    CPPUNIT_ASSERT(registry_cache::load(cache_file, std::filesystem::weakly_canonical(repository)));
+
+    // An empty path disables the cache
+    std::filesystem::remove(cache_file);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), create_modules(repository, std::filesystem::path()).size());
+    CPPUNIT_ASSERT(!std::filesystem::exists(cache_file));
+}
+
+//------------------------------------------------------------------------------
+
+void registry_cache_test::benchmark_startup()
+{
+    // Same order of magnitude as our larger applications
+    static constexpr std::size_t s_MODULES    = 120;
+    static constexpr std::size_t s_EXTENSIONS = 20;
+
+    core::os::temp_dir repository;
+    core::os::temp_dir cache_dir;
+    const auto cache_file = cache_dir / "registry.bin";
+
+    for(std::size_t i = 0 ; i < s_MODULES ; ++i)
+    {
+        write_module(repository, module_id("benchmark", i), s_EXTENSIONS);
+    }
+
+    // Time to get the configuration of the first extension, as the application does during its start
+    const auto first_config =
+        [&](const std::filesystem::path& _cache_file, const char* _label)
+        {
+            FW_PROFILE(_label);
+
+            const auto modules = create_modules(repository, _cache_file);
+            CPPUNIT_ASSERT_EQUAL(s_MODULES, modules.size());
+
+            const auto& extension = *modules.begin()->second->extensions_begin();
+            CPPUNIT_ASSERT(!extension->get_config().empty());
+        };
+
+    first_config(std::filesystem::path(), "Time to first config, without cache");
+    first_config(cache_file, "Time to first config, writing the cache");
+    first_config(cache_file, "Time to first config, from the cache");
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::core::runtime::detail::ut
@@ -0,0 +1,111 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "core/clock.hpp"
+#include "core/thread/worker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace sight::core::thread::detail
+{
+
+/// Counts the pending tasks of a queue and, if enabled, measures the time they wait before being processed.
+class task_counter final
+{
+public:
+
+    /// Enables the measure of the latencies of all the queues, see worker::set_latency_enabled().
+    static void set_latency_enabled(bool _enabled)
+    {
+        s_latency_enabled.store(_enabled, std::memory_order_relaxed);
+    }
+
+    /// Records the posting of a task and returns the posting time, or 0 if the latencies are not measured, to be
+    /// given back to started().
+    core::clock::type posted()
+    {
+        m_pending.fetch_add(1, std::memory_order_relaxed);
+        return s_latency_enabled.load(std::memory_order_relaxed) ? core::clock::get_time_in_micro_sec() : 0.;
+    }
+
+    /// Records that a posted task will never be processed.
+    void discarded()
+    {
+        m_pending.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /// Records the start of a task posted at the given time.
+    void started(core::clock::type _posted)
+    {
+        m_pending.fetch_sub(1, std::memory_order_relaxed);
+        m_processed.fetch_add(1, std::memory_order_relaxed);
+
+        if(_posted <= 0.)
+        {
+            return;
+        }
+
+        const auto latency = static_cast<std::uint64_t>(std::max(core::clock::get_time_in_micro_sec() - _posted, 0.));
+        m_measured.fetch_add(1, std::memory_order_relaxed);
+        m_total_latency.fetch_add(latency, std::memory_order_relaxed);
+
+        std::uint64_t max = m_max_latency.load(std::memory_order_relaxed);
+        while(latency > max && !m_max_latency.compare_exchange_weak(max, latency, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /// Returns the statistics of the tasks.
+    [[nodiscard]] worker::metrics get() const
+    {
+        worker::metrics metrics;
+        metrics.queue_depth = m_pending.load(std::memory_order_relaxed);
+        metrics.processed   = m_processed.load(std::memory_order_relaxed);
+        if(const auto measured = m_measured.load(std::memory_order_relaxed); measured > 0)
+        {
+            metrics.mean_latency = static_cast<core::clock::type>(m_total_latency.load(std::memory_order_relaxed))
+                                   / static_cast<core::clock::type>(measured) / 1000.;
+        }
+
+        metrics.max_latency = static_cast<core::clock::type>(m_max_latency.load(std::memory_order_relaxed)) / 1000.;
+        return metrics;
+    }
+
+private:
+
+    static inline std::atomic_bool s_latency_enabled {false};
+
+    std::atomic<std::size_t> m_pending {0};
+    std::atomic<std::uint64_t> m_processed {0};
+
+    /// Number of tasks whose latency was measured
+    std::atomic<std::uint64_t> m_measured {0};
+
+    /// Latencies in microseconds
+    std::atomic<std::uint64_t> m_total_latency {0};
+    std::atomic<std::uint64_t> m_max_latency {0};
+};
+
+} // namespace sight::core::thread::detail
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2017 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -25,6 +25,7 @@
 #include "core/thread/worker.hpp"
 
 #include "core/lazy_instantiator.hpp"
+#include "core/thread/detail/task_counter.hpp"
 #include "core/mt/types.hpp"
 
 #ifdef _WIN32
@@ -147,6 +148,13 @@ std::string get_thread_name(std::optional<std::thread::native_handle_type> _thre
 
 //------------------------------------------------------------------------------
 
+void worker::set_latency_enabled(bool _enabled)
+{
+    detail::task_counter::set_latency_enabled(_enabled);
+}
+
+//------------------------------------------------------------------------------
+
 /**
  * @brief This internal class registers worker threads in the system. It creates a default worker.
  * The life cycle of registered workers should be handled by the creator of the workers, but to avoid unneeded crashes,
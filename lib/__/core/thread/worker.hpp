@@ -112,6 +112,21 @@ public:
     using future_t = std::shared_future<exit_return_type>;
     using sptr     = std::shared_ptr<worker>;
 
+    /// Statistics of the tasks posted to a worker.
+    struct metrics
+    {
+        /// Number of tasks waiting to be processed.
+        std::size_t queue_depth {0};
+
+        /// Number of tasks processed.
+        std::uint64_t processed {0};
+
+        /// Average and maximum time, in milliseconds, between the posting of a task and the start of its processing.
+        /// They are only measured once set_latency_enabled() is called.
+        core::clock::type mean_latency {0.};
+        core::clock::type max_latency {0.};
+    };
+
     worker()          = default;
     virtual ~worker() = default;
 
@@ -144,6 +159,18 @@ public:
     /// Creates and returns a core::thread::timer running in this Worker
     SIGHT_CORE_API virtual SPTR(core::thread::timer) create_timer() = 0;
 
+    /// Returns the statistics of the posted tasks, the implementations which do not track them return empty ones.
+    virtual metrics get_metrics() const
+    {
+        return {};
+    }
+
+    /**
+     * @brief Enables the measure of the latencies returned by get_metrics(), for all the workers and worker pools.
+     * It is disabled by default, since it reads the clock twice per task. The tasks are always counted.
+     */
+    SIGHT_CORE_API static void set_latency_enabled(bool _enabled);
+
     /**
      * @brief Returns a std::shared_future associated with the execution of Worker's loop
      * @warning Calling get_future() may be blocking if it is required by a specific implementation (for example, the Qt
@@ -20,6 +20,7 @@
  *
  ***********************************************************************/
 
+#include "core/thread/detail/task_counter.hpp"
 #include "core/thread/timer.hpp"
 #include "core/thread/worker.hpp"
 
@@ -31,6 +32,7 @@
 #include <boost/asio/placeholders.hpp>
 #include <boost/bind.hpp>
 
+#include <atomic>
 #include <thread>
 
 namespace sight::core::thread
@@ -57,6 +59,8 @@ public:
 
     SPTR(core::thread::timer) create_timer() final;
 
+    [[nodiscard]] metrics get_metrics() const final;
+
     void process_tasks() final;
 
     void process_tasks(period_t _maxtime) final;
@@ -83,6 +87,12 @@ private:
 
         /// Thread created and managed by the worker.
         std::thread m_thread;
+
+        /// Statistics of the posted tasks.
+        detail::task_counter m_counter;
+
+        /// Set by stop(), the tasks posted afterwards are never run, so they are not counted.
+        std::atomic_bool m_stopped {false};
     };
 
     std::shared_ptr<context> m_context {std::make_shared<context>()};
@@ -205,6 +215,7 @@ void worker_asio::stop()
         m_context->m_thread.get_id() != core::thread::get_current_thread_id()
     );
 
+    m_context->m_stopped.store(true, std::memory_order_release);
     m_context->m_work_guard.reset();
     m_context->m_thread.join();
 }
@@ -220,7 +231,28 @@ SPTR(core::thread::timer) worker_asio::create_timer()
 
 void worker_asio::post(task_t _handler)
 {
-    boost::asio::post(m_context->m_io_context, _handler);
+    // The tasks posted before stop() are run before the thread ends. A task posted while stop() is running may
+    // never run, it is then still counted as pending.
+    if(m_context->m_stopped.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    const auto posted = m_context->m_counter.posted();
+    boost::asio::post(
+        m_context->m_io_context,
+        [counter = &m_context->m_counter, posted, handler = std::move(_handler)]
+        {
+            counter->started(posted);
+            handler();
+        });
+}
+
+//------------------------------------------------------------------------------
+
+worker::metrics worker_asio::get_metrics() const
+{
+    return m_context->m_counter.get();
 }
 
 //------------------------------------------------------------------------------
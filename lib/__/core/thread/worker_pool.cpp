@@ -0,0 +1,626 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "core/thread/worker_pool.hpp"
+
+#include "core/exceptionmacros.hpp"
+#include "core/spy_log.hpp"
+#include "core/thread/detail/task_counter.hpp"
+#include "core/thread/timer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <mutex>
+
+namespace sight::core::thread
+{
+
+//------------------------------------------------------------------------------
+
+priority to_priority(std::string_view _name)
+{
+    if(_name == "real_time")
+    {
+        return priority::real_time;
+    }
+
+    if(_name == "normal")
+    {
+        return priority::normal;
+    }
+
+    if(_name == "background")
+    {
+        return priority::background;
+    }
+
+    SIGHT_THROW("Unknown priority '" << _name << "', expected 'real_time', 'normal' or 'background'.");
+}
+
+//------------------------------------------------------------------------------
+
+namespace
+{
+
+/// Context of the pool running on the current thread, if any
+thread_local const void* s_current_context = nullptr;
+
+//------------------------------------------------------------------------------
+
+void run_task(const worker::task_t& _task)
+{
+    // An exception must not stop a thread of the pool, the other lanes depend on it
+    try
+    {
+        _task();
+    }
+    catch(const std::exception& e)
+    {
+        SIGHT_ERROR("A task of a worker pool has thrown an exception: " << e.what());
+    }
+    catch(...)
+    {
+        SIGHT_ERROR("A task of a worker pool has thrown an unknown exception.");
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Worker processing its tasks one after the other on the threads of a worker_pool.
+ *
+ * The lane is posted to the pool as long as it has pending tasks, one task at a time, so that the tasks of higher
+ * priority of the pool can be processed in between.
+ */
+class lane final : public worker,
+                   public std::enable_shared_from_this<lane>
+{
+public:
+
+    lane(worker_pool::sptr _pool, priority _priority) :
+        m_pool(std::move(_pool)),
+        m_priority(_priority)
+    {
+    }
+
+    ~lane() final = default;
+
+    lane(const lane&)            = delete;
+    lane& operator=(const lane&) = delete;
+
+    //------------------------------------------------------------------------------
+
+    void stop() final
+    {
+        SIGHT_ASSERT(
+            "Can not stop a lane from one of its tasks. Try to call stop() from another thread.",
+            m_thread_id.load() != core::thread::get_current_thread_id()
+        );
+
+        std::unique_lock lock(m_mutex);
+        m_stopped = true;
+
+        if(!m_pool->is_current_thread())
+        {
+            m_idle.wait(lock, [this]{return !m_scheduled;});
+            return;
+        }
+
+        // Waiting for the pool to schedule the lane would never end if all the threads of the pool were waiting as
+        // well, so the pending tasks are processed on this thread once the current one is done
+        m_idle.wait(lock, [this]{return !m_running;});
+        m_running = true;
+        lock.unlock();
+
+        const auto previous_id = m_thread_id.exchange(core::thread::get_current_thread_id());
+        while(this->run_one())
+        {
+        }
+
+        m_thread_id.store(previous_id);
+
+        lock.lock();
+        m_running = false;
+        m_idle.notify_all();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void post(task_t _handler) final
+    {
+        std::unique_lock lock(m_mutex);
+        if(m_stopped)
+        {
+            SIGHT_WARN("A task was posted to a stopped lane of a worker pool, it is discarded.");
+            return;
+        }
+
+        m_tasks.push_back({std::move(_handler), m_counter.posted()});
+        if(!m_scheduled)
+        {
+            m_scheduled = this->schedule();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    [[nodiscard]] thread_id_t get_thread_id() const final
+    {
+        // A lane has no thread of its own, only the thread running its current task is considered as its thread
+        return m_thread_id.load();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void set_thread_name(const std::string& /*_thread_name*/) final
+    {
+        // The threads are shared with the other lanes of the pool, they keep the name of the pool
+    }
+
+    //------------------------------------------------------------------------------
+
+    SPTR(core::thread::timer) create_timer() final;
+
+    //------------------------------------------------------------------------------
+
+    [[nodiscard]] metrics get_metrics() const final
+    {
+        return m_counter.get();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void process_tasks() final
+    {
+        this->process_tasks(std::numeric_limits<period_t>::max());
+    }
+
+    //------------------------------------------------------------------------------
+
+    void process_tasks(period_t _maxtime) final
+    {
+        // Processing the pending tasks from another thread would break their order
+        if(m_thread_id.load() != core::thread::get_current_thread_id())
+        {
+            return;
+        }
+
+        const auto end = core::clock::get_time_in_milli_sec() + _maxtime;
+        while(core::clock::get_time_in_milli_sec() < end)
+        {
+            if(!this->run_one())
+            {
+                return;
+            }
+        }
+    }
+
+private:
+
+    struct pending_task
+    {
+        task_t task;
+        core::clock::type posted;
+    };
+
+    //------------------------------------------------------------------------------
+
+    /// Runs the next task on the calling thread, returns false if there is no pending task
+    bool run_one()
+    {
+        pending_task next;
+        {
+            std::unique_lock lock(m_mutex);
+            if(m_tasks.empty())
+            {
+                return false;
+            }
+
+            next = std::move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+
+        m_counter.started(next.posted);
+        run_task(next.task);
+        return true;
+    }
+
+    //------------------------------------------------------------------------------
+
+    /// Posts the lane to the pool, or discards the pending tasks if the pool is stopped. Called with m_mutex locked.
+    bool schedule()
+    {
+        if(m_pool->enqueue([self = this->shared_from_this()]{self->run_next();}, m_priority))
+        {
+            return true;
+        }
+
+        SIGHT_WARN("A task was posted to a lane of a stopped worker pool, it is discarded.");
+        for(std::size_t i = 0 ; i < m_tasks.size() ; ++i)
+        {
+            m_counter.discarded();
+        }
+
+        m_tasks.clear();
+        m_idle.notify_all();
+        return false;
+    }
+
+    //------------------------------------------------------------------------------
+
+    /// Runs the next task on a thread of the pool and posts the lane again if it has pending tasks
+    void run_next()
+    {
+        {
+            std::unique_lock lock(m_mutex);
+
+            // stop() is processing the pending tasks itself
+            if(m_running)
+            {
+                m_scheduled = false;
+                m_idle.notify_all();
+                return;
+            }
+
+            m_running = true;
+        }
+
+        const auto previous_id = m_thread_id.exchange(core::thread::get_current_thread_id());
+        this->run_one();
+        m_thread_id.store(previous_id);
+
+        std::unique_lock lock(m_mutex);
+        m_running   = false;
+        m_scheduled = !m_tasks.empty() && this->schedule();
+        m_idle.notify_all();
+    }
+
+    const worker_pool::sptr m_pool;
+    const priority m_priority;
+
+    std::deque<pending_task> m_tasks;
+
+    /// True while the lane is posted to the pool, at most once at a time
+    bool m_scheduled {false};
+
+    /// True while a thread processes the tasks of the lane
+    bool m_running {false};
+
+    bool m_stopped {false};
+
+    /// Thread running the current task of the lane
+    std::atomic<thread_id_t> m_thread_id;
+
+    detail::task_counter m_counter;
+
+    std::mutex m_mutex;
+    std::condition_variable m_idle;
+};
+
+/**
+ * @brief Timer of a lane.
+ *
+ * The timer runs on the timer thread of the pool, and posts its function to the lane when it expires.
+ */
+class lane_timer final : public timer
+{
+public:
+
+    lane_timer(timer::sptr _timer, std::weak_ptr<lane> _lane) :
+        m_timer(std::move(_timer)),
+        m_lane(std::move(_lane))
+    {
+    }
+
+    ~lane_timer() final
+    {
+        m_timer->stop();
+    }
+
+    lane_timer(const lane_timer&)            = delete;
+    lane_timer& operator=(const lane_timer&) = delete;
+
+    //------------------------------------------------------------------------------
+
+    void start() final
+    {
+        m_timer->start();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void stop() final
+    {
+        m_timer->stop();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void set_duration(time_duration_t _duration) final
+    {
+        m_timer->set_duration(_duration);
+    }
+
+    //------------------------------------------------------------------------------
+
+    [[nodiscard]] bool is_one_shot() const final
+    {
+        return m_timer->is_one_shot();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void set_one_shot(bool _one_shot) final
+    {
+        m_timer->set_one_shot(_one_shot);
+    }
+
+    //------------------------------------------------------------------------------
+
+    [[nodiscard]] bool is_running() const final
+    {
+        return m_timer->is_running();
+    }
+
+protected:
+
+    //------------------------------------------------------------------------------
+
+    void updated_function() final
+    {
+        // Called with m_mutex locked
+        m_timer->set_function(
+            [function = m_function, weak_lane = m_lane]
+            {
+                if(auto lane = weak_lane.lock(); lane)
+                {
+                    lane->post(function);
+                }
+            });
+    }
+
+private:
+
+    const timer::sptr m_timer;
+    const std::weak_ptr<lane> m_lane;
+};
+
+//------------------------------------------------------------------------------
+
+SPTR(core::thread::timer) lane::create_timer()
+{
+    return std::make_shared<lane_timer>(m_pool->m_timer_worker->create_timer(), this->weak_from_this());
+}
+
+struct worker_pool::context
+{
+    struct pending_task
+    {
+        task_t task;
+        core::clock::type posted;
+    };
+
+    static constexpr std::size_t PRIORITY_COUNT = 3;
+
+    //------------------------------------------------------------------------------
+
+    /// Loop of the threads, processes the pending tasks of the highest priority first
+    void run(bool _real_time_only)
+    {
+        const auto end = queues.begin() + (_real_time_only ? 1 : static_cast<std::ptrdiff_t>(PRIORITY_COUNT));
+
+        s_current_context = this;
+
+        std::unique_lock lock(mutex);
+        while(true)
+        {
+            const auto queue = std::find_if(queues.begin(), end, [](const auto& _queue){return !_queue.empty();});
+
+            if(queue != end)
+            {
+                pending_task next = std::move(queue->front());
+                queue->pop_front();
+                lock.unlock();
+
+                counters[static_cast<std::size_t>(queue - queues.begin())].started(next.posted);
+                run_task(next.task);
+
+                // Release what the task holds before locking, it may be the last reference to a lane
+                next = {};
+                lock.lock();
+            }
+            else if(stopping)
+            {
+                --running_threads;
+                return;
+            }
+            else
+            {
+                task_posted.wait(lock);
+            }
+        }
+    }
+
+    /// Pending tasks by priority
+    std::array<std::deque<pending_task>, PRIORITY_COUNT> queues;
+
+    /// Statistics of the tasks by priority
+    std::array<detail::task_counter, PRIORITY_COUNT> counters;
+
+    bool stopping {false};
+
+    /// Threads which have not returned yet, tasks are discarded once they all have
+    std::size_t running_threads {0};
+
+    std::mutex mutex;
+    std::condition_variable task_posted;
+};
+
+//------------------------------------------------------------------------------
+
+worker_pool::worker_pool(std::size_t _threads, const std::string& _name) :
+    m_context(std::make_shared<context>()),
+    m_timer_worker(worker::make())
+{
+    m_timer_worker->set_thread_name(_name + "_timer");
+
+    const std::size_t threads = std::max<std::size_t>(_threads, 1);
+    m_context->running_threads = threads;
+    for(std::size_t i = 0 ; i < threads ; ++i)
+    {
+        // The first thread only processes real-time tasks, so that they never wait for a slow task, as long as the
+        // other tasks keep two threads: a single one would be held by any slow or waiting task
+        const bool real_time_only = i == 0 && threads > 2;
+        m_threads.emplace_back([context = m_context, real_time_only]{context->run(real_time_only);});
+        core::thread::set_thread_name(_name + "_" + std::to_string(i), m_threads.back().native_handle());
+    }
+}
+
+//------------------------------------------------------------------------------
+
+worker_pool::sptr worker_pool::make(std::size_t _threads, const std::string& _name)
+{
+    return sptr(new worker_pool(_threads, _name));
+}
+
+//------------------------------------------------------------------------------
+
+worker_pool::~worker_pool()
+{
+    this->stop();
+}
+
+//------------------------------------------------------------------------------
+
+worker::sptr worker_pool::make_lane(priority _priority)
+{
+    return std::make_shared<lane>(this->shared_from_this(), _priority);
+}
+
+//------------------------------------------------------------------------------
+
+void worker_pool::post(task_t _task, priority _priority)
+{
+    if(!this->enqueue(std::move(_task), _priority))
+    {
+        SIGHT_WARN("A task was posted to a stopped worker pool, it is discarded.");
+    }
+}
+
+//------------------------------------------------------------------------------
+
+bool worker_pool::enqueue(task_t _task, priority _priority)
+{
+    const auto index = static_cast<std::size_t>(_priority);
+    {
+        std::unique_lock lock(m_context->mutex);
+        if(m_context->running_threads == 0)
+        {
+            return false;
+        }
+
+        m_context->queues[index].push_back({std::move(_task), m_context->counters[index].posted()});
+    }
+
+    // Any thread can process a real-time task, but the first one may not process the others
+    if(_priority == priority::real_time)
+    {
+        m_context->task_posted.notify_one();
+    }
+    else
+    {
+        m_context->task_posted.notify_all();
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+bool worker_pool::is_current_thread() const
+{
+    return s_current_context == m_context.get();
+}
+
+//------------------------------------------------------------------------------
+
+worker::metrics worker_pool::get_metrics(priority _priority) const
+{
+    return m_context->counters[static_cast<std::size_t>(_priority)].get();
+}
+
+//------------------------------------------------------------------------------
+
+void worker_pool::stop()
+{
+    if(m_threads.empty())
+    {
+        return;
+    }
+
+    {
+        std::unique_lock lock(m_context->mutex);
+        m_context->stopping = true;
+    }
+
+    m_context->task_posted.notify_all();
+
+    for(auto& thread : m_threads)
+    {
+        // The pool may be released by one of its own tasks, this thread then ends once the remaining tasks are done
+        if(thread.get_id() == core::thread::get_current_thread_id())
+        {
+            thread.detach();
+        }
+        else
+        {
+            thread.join();
+        }
+    }
+
+    m_threads.clear();
+    m_timer_worker->stop();
+}
+
+//------------------------------------------------------------------------------
+
+worker_pool::sptr get_default_worker_pool()
+{
+    static std::mutex s_mutex;
+    static worker_pool::sptr s_pool;
+
+    std::unique_lock lock(s_mutex);
+    if(!s_pool)
+    {
+        // One thread is kept for real-time tasks, the others need at least two threads
+        s_pool = worker_pool::make(std::max(std::thread::hardware_concurrency(), 3U), "pool");
+    }
+
+    return s_pool;
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::core::thread
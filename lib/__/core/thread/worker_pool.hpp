@@ -0,0 +1,139 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/core/config.hpp>
+
+#include "core/thread/worker.hpp"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace sight::core::thread
+{
+
+/// Priority of the tasks of a worker_pool, the tasks of higher priority are always processed first.
+enum class priority : std::uint8_t
+{
+    real_time = 0,
+    normal,
+    background
+};
+
+/**
+ * @brief Returns the priority matching the given name: "real_time", "normal" or "background".
+ * @throw core::exception if the name is unknown
+ */
+SIGHT_CORE_API priority to_priority(std::string_view _name);
+
+/**
+ * @brief Several threads processing prioritized tasks.
+ *
+ * A core::thread::worker processes its tasks one after the other on a single thread, so a long task delays all the
+ * following ones. The threads of a pool process the pending tasks of the highest priority first, and several tasks
+ * at once.
+ *
+ * Services can not run their slots concurrently, so they do not post to the pool directly but to a lane, created with
+ * make_lane(). A lane is a worker which processes its tasks one after the other, like a single thread, but on any
+ * thread of the pool and with the priority of the lane. Thus a slow service only holds one thread of the pool and
+ * does not delay the services of other lanes.
+ *
+ * When the pool has at least three threads, its first thread only processes real-time tasks, so that they are never
+ * delayed by slow tasks of lower priority, while the other tasks keep at least two threads.
+ *
+ * A task waiting for another task of the pool holds a thread meanwhile, so the tasks should not wait for each other.
+ * Stopping a lane from a thread of the pool does not wait for the pool: the pending tasks of the lane are processed
+ * by the calling thread. Tasks posted to a stopped pool or lane are discarded, the futures of post_task() then report
+ * a broken promise.
+ */
+class SIGHT_CORE_CLASS_API worker_pool final : public std::enable_shared_from_this<worker_pool>
+{
+public:
+
+    using sptr   = std::shared_ptr<worker_pool>;
+    using task_t = worker::task_t;
+
+    /**
+     * @brief Creates a pool and starts its threads.
+     * @param _threads number of threads, at least one
+     * @param _name name of the threads, suffixed by their index, useful for debugging
+     */
+    SIGHT_CORE_API static sptr make(std::size_t _threads, const std::string& _name = "pool");
+
+    /// Waits for the pending tasks and stops the threads if stop() was not called.
+    SIGHT_CORE_API ~worker_pool();
+
+    worker_pool(const worker_pool&)            = delete;
+    worker_pool& operator=(const worker_pool&) = delete;
+
+    /// Creates a worker which processes its tasks one after the other on the threads of the pool.
+    SIGHT_CORE_API worker::sptr make_lane(priority _priority = priority::normal);
+
+    /// Requests the invocation of the given task on any thread of the pool and returns immediately.
+    SIGHT_CORE_API void post(task_t _task, priority _priority = priority::normal);
+
+    /// Returns the statistics of the tasks of the given priority, posted directly or through lanes.
+    [[nodiscard]] SIGHT_CORE_API worker::metrics get_metrics(priority _priority) const;
+
+    /// Returns the number of threads.
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_threads.size();
+    }
+
+    /// Waits for the pending tasks and stops the threads. It must not be called from a thread of the pool.
+    SIGHT_CORE_API void stop();
+
+private:
+
+    /// Queues a task, returns false if the threads are stopped
+    bool enqueue(task_t _task, priority _priority);
+
+    /// Returns true if the calling thread is one of the threads of the pool
+    [[nodiscard]] bool is_current_thread() const;
+
+    /// Queues shared with the threads, which keep them alive if the pool is destroyed by one of its own tasks
+    struct context;
+
+    worker_pool(std::size_t _threads, const std::string& _name);
+
+    std::shared_ptr<context> m_context;
+
+    std::vector<std::thread> m_threads;
+
+    /// Thread running the timers of the lanes, which post their function to their lane when they expire
+    worker::sptr m_timer_worker;
+
+    friend class lane;
+};
+
+/**
+ * @brief Returns the pool shared by the application, created on first use with one thread per core, and at least
+ * three threads.
+ * @note This method is thread safe.
+ */
+SIGHT_CORE_API worker_pool::sptr get_default_worker_pool();
+
+} // namespace sight::core::thread
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -29,6 +29,7 @@
 #include <cstdlib>
 #include <functional>
 #include <numeric>
+#include <utility>
 
 namespace sight::data
 {
@@ -125,8 +126,22 @@ void array::deep_copy(const object::csptr& _source, const std::unique_ptr<deep_c
 
     if(!other->m_buffer_object->is_empty())
     {
-        resize(other->m_size, other->m_type, true);
-        std::memcpy(m_buffer_object->buffer(), other->m_buffer_object->buffer(), other->size_in_bytes());
+        // An owned buffer is shared, it is only copied on the first write in either array
+        if(other->m_is_buffer_owner && (m_is_buffer_owner || m_buffer_object->is_empty())
+           && m_buffer_object->share(other->m_buffer_object))
+        {
+            m_is_buffer_owner = true;
+            resize(other->m_size, other->m_type, false);
+        }
+        else
+        {
+            resize(other->m_size, other->m_type, true);
+            std::memcpy(
+                m_buffer_object->buffer(),
+                std::as_const(*other->m_buffer_object).buffer(),
+                other->size_in_bytes()
+            );
+        }
     }
     else
     {
@@ -155,7 +170,7 @@ std::size_t array::resize(
         if(m_buffer_object->is_empty())
         {
             m_is_buffer_owner = true;
-            m_buffer_object->allocate(buf_size);
+            m_buffer_object->allocate(buf_size, m_allocation_policy);
         }
         else if(m_is_buffer_owner)
         {
@@ -186,6 +201,21 @@ std::size_t array::resize(const size_t& _size, bool _reallocate)
 
 //------------------------------------------------------------------------------
 
+void array::set_allocation_policy(core::memory::buffer_allocation_policy::sptr _policy)
+{
+    SIGHT_ASSERT("Allocation policy must not be null", _policy);
+    m_allocation_policy = std::move(_policy);
+}
+
+//------------------------------------------------------------------------------
+
+core::memory::buffer_allocation_policy::sptr array::get_allocation_policy() const
+{
+    return m_allocation_policy;
+}
+
+//------------------------------------------------------------------------------
+
 void array::clear()
 {
     if(!this->m_buffer_object->is_empty())
@@ -309,6 +339,8 @@ void* array::buffer()
         ),
         !m_buffer_object->is_locked()
     );
+
+    // The buffer may be written, so the buffer object detaches it if it is shared
     return m_buffer_object->buffer();
 }
 
@@ -320,7 +352,7 @@ const void* array::buffer() const
         data::exception("The buffer cannot be accessed if the array is not locked"),
         !m_buffer_object->is_locked()
     );
-    return m_buffer_object->buffer();
+    return std::as_const(*m_buffer_object).buffer();
 }
 
 //------------------------------------------------------------------------------
@@ -380,7 +412,8 @@ const char* array::get_buffer_ptr(const data::array::index_t& _id) const
 
 void array::dump_lock_impl(std::vector<core::memory::buffer_object::lock_t>& _locks) const
 {
-    _locks.push_back(m_buffer_object->lock());
+    // Only keep the buffer loaded, a shared buffer is detached when it is accessed for writing
+    _locks.emplace_back(m_buffer_object);
 }
 
 //------------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -219,6 +219,16 @@ public:
      */
     SIGHT_DATA_API std::size_t resize(const size_t& _size, bool _reallocate = true);
 
+    /**
+     * @brief Sets the policy used the next time the array allocates its buffer, buffer_malloc_policy by default.
+     *
+     * A buffer already allocated keeps the policy it was allocated with until it is released.
+     */
+    SIGHT_DATA_API void set_allocation_policy(core::memory::buffer_allocation_policy::sptr _policy);
+
+    /// Returns the policy used when the array allocates its buffer.
+    SIGHT_DATA_API core::memory::buffer_allocation_policy::sptr get_allocation_policy() const;
+
     /**
      * @brief Clear this array.
      * Size and type are reset, buffer is released.
@@ -555,6 +565,9 @@ private:
     core::memory::buffer_object::sptr m_buffer_object;
     size_t m_size;
     bool m_is_buffer_owner {true};
+    core::memory::buffer_allocation_policy::sptr m_allocation_policy {
+        core::memory::buffer_malloc_policy::get_default()
+    };
 };
 
 //-----------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -24,6 +24,7 @@
 #include "data/series.hpp"
 
 #include "series_impl.hpp"
+#include <any>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -32,6 +33,8 @@
 #include <gdcmDataElement.h>
 #include <gdcmSequenceOfItems.h>
 #include <gdcmSmartPointer.h>
+#include <map>
+#include <typeindex>
 #include <utility>
 #include <mutex>
 
@@ -309,6 +312,9 @@ public:
             m_frame_datasets.resize(_instance + 1);
         }
 
+        // The data set may be modified through the returned reference
+        invalidate_cache(_instance);
+
         return m_frame_datasets[_instance];
     }
 
@@ -591,6 +597,99 @@ public:
         return element.GetValueAsSQ();
     }
 
+    /// Retrieve a DICOM tag value like get_value(), but parse it only once. The value is kept in a cache until the
+    /// data set of the instance is accessed for modification.
+    template<typename A>
+    [[nodiscard]] inline auto get_cached_value(std::size_t _instance = 0) const
+    {
+        return get_cached<A, decltype(get_value<A>(_instance))>(
+            _instance,
+            [this](std::size_t _i){return get_value<A>(_i);});
+    }
+
+    /// Retrieve a multi-value DICOM tag like get_values(), but parse it only once. The values are kept in a cache until
+    /// the data set of the instance is accessed for modification.
+    template<typename A>
+    [[nodiscard]] inline auto get_cached_values(std::size_t _instance = 0) const
+    {
+        return get_cached<A, decltype(get_values<A>(_instance))>(
+            _instance,
+            [this](std::size_t _i){return get_values<A>(_i);});
+    }
+
+    /// Retrieve a multi-value DICOM tag of all instances at once, using the cache.
+    template<typename A>
+    [[nodiscard]] inline auto get_all_cached_values() const
+    {
+        std::unique_lock lock(m_mutex);
+
+        std::vector<decltype(get_values<A>(std::size_t(0)))> values;
+        values.reserve(m_frame_datasets.size());
+
+        for(std::size_t instance = 0, end = m_frame_datasets.size() ; instance < end ; ++instance)
+        {
+            values.push_back(get_cached_values<A>(instance));
+        }
+
+        return values;
+    }
+
+    /// Retrieve a DICOM tag value of all instances at once, using the cache.
+    template<typename A>
+    [[nodiscard]] inline auto get_all_cached_value() const
+    {
+        std::unique_lock lock(m_mutex);
+
+        std::vector<decltype(get_value<A>(std::size_t(0)))> values;
+        values.reserve(m_frame_datasets.size());
+
+        for(std::size_t instance = 0, end = m_frame_datasets.size() ; instance < end ; ++instance)
+        {
+            values.push_back(get_cached_value<A>(instance));
+        }
+
+        return values;
+    }
+
+    /// Clear the cached values of an instance, or of all instances
+    inline void invalidate_cache(std::optional<std::size_t> _instance = std::nullopt) const
+    {
+        std::unique_lock lock(m_mutex);
+
+        if(!_instance)
+        {
+            m_cache.clear();
+        }
+        else if(*_instance < m_cache.size())
+        {
+            m_cache[*_instance].clear();
+        }
+    }
+
+    /// Reorder the instances and their cached values, keeping only the given instances.
+    /// @param _sorted the indices of the kept instances, in their new order
+    inline void reorder(const std::vector<std::size_t>& _sorted)
+    {
+        std::unique_lock lock(m_mutex);
+
+        m_cache.resize(m_frame_datasets.size());
+
+        frame_datasets sorted_frame_datasets;
+        sorted_frame_datasets.reserve(_sorted.size());
+
+        std::vector<attribute_cache> sorted_cache;
+        sorted_cache.reserve(_sorted.size());
+
+        for(const auto& from : _sorted)
+        {
+            sorted_frame_datasets.push_back(std::move(m_frame_datasets[from]));
+            sorted_cache.push_back(std::move(m_cache[from]));
+        }
+
+        m_frame_datasets = std::move(sorted_frame_datasets);
+        m_cache          = std::move(sorted_cache);
+    }
+
     /// Set a DICOM tag value. If the value is null, the tag is replaced by an empty element.
     template<typename A>
     inline void set_value(const std::optional<typename A::ArrayType>& _value, std::size_t _instance = 0)
@@ -1723,6 +1822,7 @@ public:
         std::unique_lock lock(m_mutex);
 
         m_frame_datasets = _source;
+        m_cache.clear();
 
         for(auto& series_dataset : m_frame_datasets)
         {
@@ -1765,12 +1865,50 @@ public:
         }
     }
 
+    /// Return the cached value of an attribute, or parse it with the given function and cache it.
+    /// The type of the value is part of the key, so the same attribute can be cached in several forms.
+    template<typename A, typename R, typename F>
+    [[nodiscard]] inline R get_cached(std::size_t _instance, F _parse) const
+    {
+        std::unique_lock lock(m_mutex);
+
+        // Nothing to cache, the instance does not exist yet
+        if(_instance >= m_frame_datasets.size())
+        {
+            return _parse(_instance);
+        }
+
+        if(m_cache.size() < m_frame_datasets.size())
+        {
+            m_cache.resize(m_frame_datasets.size());
+        }
+
+        auto& cache     = m_cache[_instance];
+        const auto& key = std::make_pair(A::GetTag(), std::type_index(typeid(R)));
+
+        if(const auto& it = cache.find(key); it != cache.cend())
+        {
+            return std::any_cast<const R&>(it->second);
+        }
+
+        R value = _parse(_instance);
+        cache.emplace(key, value);
+
+        return value;
+    }
+
     /// Pointer to the public class
     sight::data::series* const m_series {nullptr};
 
     /// Dicom data set instances specific to a frame
     frame_datasets m_frame_datasets;
 
+    /// Parsed values of an instance, by tag and type
+    using attribute_cache = std::map<std::pair<gdcm::Tag, std::type_index>, std::any>;
+
+    /// Parsed values of each instance, filled lazily
+    mutable std::vector<attribute_cache> m_cache;
+
     /// GDCM is not really thread safe, especially everything that returns a "SharedPointer".
     /// We need to protect it from concurrent access.
     mutable std::recursive_mutex m_mutex;
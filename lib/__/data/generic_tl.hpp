@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -59,6 +59,21 @@ public:
     /// Returns the buffer matching the specified timestamp, returns NULL if object is not found
     CSPTR(buffer_t) get_buffer(core::clock::type _timestamp) const;
 
+    /**
+     * @brief Returns a buffer interpolated at the given timestamp, from the two samples surrounding it.
+     *
+     * The samples are found in O(log n). Elements present in both samples are interpolated with interpolate(),
+     * elements present in only one of them are copied from the closest sample. Before the first or after the last
+     * sample, the buffer is extrapolated from the two first or last samples, up to _extrapolation milliseconds away
+     * from the timeline.
+     * @warning Each element must be a single BUFFER_TYPE, this can not be used with a frame_tl.
+     * @param _timestamp timestamp of the interpolated buffer
+     * @param _extrapolation maximum distance in milliseconds between the timestamp and the timeline
+     * @return a buffer which does not belong to the timeline, or nullptr if the timeline is empty or the timestamp is
+     * too far from it
+     */
+    SPTR(buffer_t) get_interpolated_buffer(core::clock::type _timestamp, core::clock::type _extrapolation = 0.) const;
+
     /// Initializes the size of the pool buffer.
     virtual void init_pool_size(unsigned int _max_element_num);
 
@@ -104,6 +119,17 @@ public:
 
 protected:
 
+    /**
+     * @brief Interpolates two elements, used by get_interpolated_buffer().
+     *
+     * Arithmetic types and arrays of arithmetic types are interpolated linearly, other types are not interpolated and
+     * the closest element is returned.
+     * @param _first element at the first sample
+     * @param _second element at the second sample
+     * @param _alpha interpolation factor, 0 at the first sample and 1 at the second, outside [0, 1] to extrapolate
+     */
+    virtual BUFFER_TYPE interpolate(const BUFFER_TYPE& _first, const BUFFER_TYPE& _second, double _alpha) const;
+
     /// maximum number of elements inside a single buffer
     unsigned int m_max_element_num;
 }; // class generic_tl
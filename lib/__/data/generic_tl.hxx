@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -24,9 +24,25 @@
 
 #include <data/exception.hpp>
 
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <type_traits>
+
 namespace sight::data
 {
 
+namespace detail
+{
+
+template<typename T>
+struct is_arithmetic_array : std::false_type {};
+
+template<typename T, std::size_t N>
+struct is_arithmetic_array<std::array<T, N> >: std::is_arithmetic<T> {};
+
+} // namespace detail
+
 //------------------------------------------------------------------------------
 
 template<class BUFFER_TYPE>
@@ -97,6 +113,110 @@ generic_tl<BUFFER_TYPE>::get_buffer(core::clock::type _timestamp) const
 
 //------------------------------------------------------------------------------
 
+template<class BUFFER_TYPE>
+SPTR(typename generic_tl<BUFFER_TYPE>::buffer_t)
+generic_tl<BUFFER_TYPE>::get_interpolated_buffer(
+    core::clock::type _timestamp,
+    core::clock::type _extrapolation
+) const
+{
+    if(m_timeline.empty())
+    {
+        return nullptr;
+    }
+
+    // Find the two samples surrounding the timestamp, or the two closest ones outside of the timeline
+    auto first  = m_timeline.cbegin();
+    auto second = m_timeline.upper_bound(_timestamp);
+    if(second == m_timeline.cend())
+    {
+        second = std::prev(second);
+        first  = second == m_timeline.cbegin() ? second : std::prev(second);
+        if(_timestamp - second->first > _extrapolation)
+        {
+            return nullptr;
+        }
+    }
+    else if(second == m_timeline.cbegin())
+    {
+        second = std::next(first) == m_timeline.cend() ? first : std::next(first);
+        if(first->first - _timestamp > _extrapolation)
+        {
+            return nullptr;
+        }
+    }
+    else
+    {
+        first = std::prev(second);
+    }
+
+    const auto& first_buffer  = static_cast<const buffer_t&>(*first->second);
+    const auto& second_buffer = static_cast<const buffer_t&>(*second->second);
+    SIGHT_ASSERT(
+        "Elements of " << this->get_classname() << " can not be interpolated",
+        first_buffer.get_element_size() == sizeof(BUFFER_TYPE)
+    );
+
+    const core::clock::type duration = second->first - first->first;
+    const double alpha               = duration > 0. ? (_timestamp - first->first) / duration : 0.;
+    const auto& closest_buffer       = alpha < 0.5 ? first_buffer : second_buffer;
+
+    const std::size_t size = first_buffer.size();
+    auto buffer            = std::make_shared<buffer_t>(
+        m_max_element_num,
+        _timestamp,
+        new std::uint8_t[size],
+        size,
+        [](void* _buffer){delete[] static_cast<std::uint8_t*>(_buffer);});
+
+    for(unsigned int i = 0 ; i < m_max_element_num ; ++i)
+    {
+        if(first_buffer.is_present(i) && second_buffer.is_present(i))
+        {
+            buffer->set_element(this->interpolate(first_buffer.get_element(i), second_buffer.get_element(i), alpha), i);
+        }
+        else if(closest_buffer.is_present(i))
+        {
+            buffer->set_element(closest_buffer.get_element(i), i);
+        }
+    }
+
+    return buffer;
+}
+
+//------------------------------------------------------------------------------
+
+template<class BUFFER_TYPE>
+BUFFER_TYPE generic_tl<BUFFER_TYPE>::interpolate(
+    const BUFFER_TYPE& _first,
+    const BUFFER_TYPE& _second,
+    double _alpha
+) const
+{
+    if constexpr(std::is_arithmetic_v<BUFFER_TYPE>)
+    {
+        return static_cast<BUFFER_TYPE>(std::lerp(double(_first), double(_second), _alpha));
+    }
+    else if constexpr(detail::is_arithmetic_array<BUFFER_TYPE>::value)
+    {
+        using value_t = typename BUFFER_TYPE::value_type;
+
+        BUFFER_TYPE result {};
+        for(std::size_t i = 0 ; i < result.size() ; ++i)
+        {
+            result[i] = static_cast<value_t>(std::lerp(double(_first[i]), double(_second[i]), _alpha));
+        }
+
+        return result;
+    }
+    else
+    {
+        return _alpha < 0.5 ? _first : _second;
+    }
+}
+
+//------------------------------------------------------------------------------
+
 template<class BUFFER_TYPE>
 void generic_tl<BUFFER_TYPE>::init_pool_size(unsigned int _max_element_num)
 {
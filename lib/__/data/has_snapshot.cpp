@@ -0,0 +1,95 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "data/has_snapshot.hpp"
+
+#include "data/object.hpp"
+
+#include <utility>
+
+namespace sight::data
+{
+
+//-----------------------------------------------------------------------------
+
+has_snapshot::~has_snapshot() = default;
+
+//-----------------------------------------------------------------------------
+
+std::shared_ptr<const object> has_snapshot::snapshot() const
+{
+    {
+        core::mt::scoped_lock snapshot_lock(m_snapshot_mutex);
+        if(m_snapshot)
+        {
+            return m_snapshot;
+        }
+    }
+
+    const auto& self = dynamic_cast<const object&>(*this);
+
+    core::mt::read_lock lock(self.get_mutex());
+    m_snapshots_enabled = true;
+
+    std::shared_ptr<const object> current = object::copy(self.get_const_sptr());
+
+    // Another reader may have published the first copy in the meantime
+    core::mt::scoped_lock snapshot_lock(m_snapshot_mutex);
+    if(!m_snapshot)
+    {
+        m_snapshot = current;
+    }
+
+    return m_snapshot;
+}
+
+//-----------------------------------------------------------------------------
+
+void has_snapshot::publish_snapshot()
+{
+    if(!m_snapshots_enabled)
+    {
+        return;
+    }
+
+    const auto& self = dynamic_cast<const object&>(*this);
+
+    // Reuse the previous copy if no reader still holds it, this avoids creating a new object for each write
+    auto next = std::exchange(m_spare_snapshot, nullptr);
+    if(next && next.use_count() == 1)
+    {
+        // Synchronizes with the release of the last reader
+        std::atomic_thread_fence(std::memory_order_acquire);
+        next->deep_copy(self.get_const_sptr());
+    }
+    else
+    {
+        next = object::copy(self.get_const_sptr());
+    }
+
+    // The copy is done before, so readers only wait for the pointers to be swapped
+    core::mt::scoped_lock snapshot_lock(m_snapshot_mutex);
+    m_spare_snapshot = std::const_pointer_cast<object>(std::exchange(m_snapshot, next));
+}
+
+//-----------------------------------------------------------------------------
+
+} // namespace sight::data
@@ -0,0 +1,129 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/data/config.hpp>
+
+#include <core/mt/types.hpp>
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+namespace sight::data
+{
+
+class object;
+class string_serializable;
+
+namespace mt
+{
+
+template<class DATATYPE>
+class locked_ptr;
+
+} // namespace mt
+
+/**
+ * @brief Interface of the small and frequently updated objects, like matrices, points or scalars, that readers can
+ * copy without locking them.
+ *
+ * Only the types deriving from this class hold the snapshot state, and only their write accesses publish copies.
+ */
+class SIGHT_DATA_CLASS_API has_snapshot
+{
+public:
+
+    /**
+     * @brief Returns a copy of the object, as it was when the last write access through a locked_ptr was released.
+     *
+     * The snapshot is read without locking the object, so readers never wait for a writer and writers never wait
+     * for readers. The first call takes a read lock to copy the object and enables the snapshots for this object;
+     * from then on, every write access publishes a new copy when it releases its lock. This costs a deep copy per
+     * write.
+     *
+     * @warning Modifications that do not go through a locked_ptr are not visible until the next write access.
+     */
+    SIGHT_DATA_API std::shared_ptr<const object> snapshot() const;
+
+protected:
+
+    SIGHT_DATA_API has_snapshot() = default;
+    SIGHT_DATA_API virtual ~has_snapshot();
+
+    /// Copies do not share the published copies of the original object
+    has_snapshot(const has_snapshot& /*_other*/) noexcept
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    has_snapshot& operator=(const has_snapshot& /*_other*/) noexcept
+    {
+        return *this;
+    }
+
+private:
+
+    template<class T>
+    friend class sight::data::mt::locked_ptr;
+
+    /// Publishes a copy of the data if its type has snapshots, does nothing for the other types
+    template<class T>
+    static void publish(T& _data);
+
+    /// Publishes a copy of the object for snapshot() readers, must be called with the write lock held
+    SIGHT_DATA_API void publish_snapshot();
+
+    /// Protects the published copy, it is only held to copy or swap the pointer
+    mutable core::mt::mutex m_snapshot_mutex;
+
+    /// Last published copy, returned by snapshot()
+    mutable std::shared_ptr<const object> m_snapshot;
+
+    /// Previously published copy, overwritten by the next publication when no reader holds it anymore
+    std::shared_ptr<object> m_spare_snapshot;
+
+    /// Set by the first call to snapshot()
+    mutable std::atomic_bool m_snapshots_enabled {false};
+};
+
+//------------------------------------------------------------------------------
+
+template<class T>
+inline void has_snapshot::publish(T& _data)
+{
+    if constexpr(std::is_base_of_v<has_snapshot, T>)
+    {
+        static_cast<has_snapshot&>(_data).publish_snapshot();
+    }
+    else if constexpr(std::is_same_v<T, object> || std::is_same_v<T, string_serializable>)
+    {
+        // Generic accesses, the type of the data is only known at runtime
+        if(auto* const data = dynamic_cast<has_snapshot*>(&_data); data != nullptr)
+        {
+            data->publish_snapshot();
+        }
+    }
+}
+
+} // namespace sight::data
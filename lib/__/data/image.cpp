@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -234,6 +234,20 @@ std::size_t image::size_in_bytes() const
 
 //------------------------------------------------------------------------------
 
+void image::set_allocation_policy(core::memory::buffer_allocation_policy::sptr _policy)
+{
+    m_data_array->set_allocation_policy(std::move(_policy));
+}
+
+//------------------------------------------------------------------------------
+
+core::memory::buffer_allocation_policy::sptr image::get_allocation_policy() const
+{
+    return m_data_array->get_allocation_policy();
+}
+
+//------------------------------------------------------------------------------
+
 std::size_t image::allocated_size_in_bytes() const
 {
     std::size_t size = 0;
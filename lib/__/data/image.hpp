@@ -284,6 +284,12 @@ public:
     );
     /// @}
 
+    /// Sets the policy used the next time the image allocates its buffer, see array::set_allocation_policy()
+    SIGHT_DATA_API void set_allocation_policy(core::memory::buffer_allocation_policy::sptr _policy);
+
+    /// Returns the policy used when the image allocates its buffer
+    SIGHT_DATA_API core::memory::buffer_allocation_policy::sptr get_allocation_policy() const;
+
     /// @brief return image size in bytes
     SIGHT_DATA_API std::size_t size_in_bytes() const;
     /// @brief return allocated image size in bytes
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "container.hpp"
+#include "has_snapshot.hpp"
 
 #include <core/compare.hpp>
 
@@ -37,8 +38,8 @@ namespace sight::data
  *
  * Our convention is a row-major representation.
  */
-class SIGHT_DATA_CLASS_API matrix4 final : public container<std::array<double,
-                                                                       16> >
+class SIGHT_DATA_CLASS_API matrix4 final : public container<std::array<double, 16> >,
+                                           public has_snapshot
 {
 public:
 
@@ -50,7 +51,7 @@ public:
 
     /// Constructors
     /// @{
-    constexpr matrix4() noexcept;
+    matrix4() noexcept;
     inline matrix4(std::initializer_list<value_type> _init_list);
 
     template<typename T>
@@ -156,7 +157,7 @@ protected:
     };
 };
 
-constexpr matrix4::matrix4() noexcept
+inline matrix4::matrix4() noexcept
 {
     *this = IDENTITY;
 }
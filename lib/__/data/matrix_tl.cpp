@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2016 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -24,9 +24,88 @@
 
 #include <data/registry/macros.hpp>
 
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <optional>
+
 namespace sight::data
 {
 
 SIGHT_REGISTER_DATA(sight::data::matrix_tl)
 
+//------------------------------------------------------------------------------
+
+std::array<float, 16> matrix_tl::interpolate(
+    const std::array<float, 16>& _first,
+    const std::array<float, 16>& _second,
+    double _alpha
+) const
+{
+    // Splits a row-major affine matrix into a rotation, a scale and a translation
+    struct pose
+    {
+        glm::dquat rotation {1., 0., 0., 0.};
+        glm::dvec3 scale {1.};
+        glm::dvec3 translation {0.};
+    };
+
+    const auto decompose =
+        [](const std::array<float, 16>& _matrix) -> std::optional<pose>
+        {
+            glm::dmat3 basis(1.);
+            pose result;
+            for(glm::length_t c = 0 ; c < 3 ; ++c)
+            {
+                for(glm::length_t r = 0 ; r < 3 ; ++r)
+                {
+                    basis[c][r] = _matrix[std::size_t(r * 4 + c)];
+                }
+
+                result.scale[c] = glm::length(basis[c]);
+                if(result.scale[c] < 1e-9)
+                {
+                    return std::nullopt;
+                }
+
+                basis[c] /= result.scale[c];
+            }
+
+            // Reflections can not be represented by a quaternion
+            if(glm::determinant(basis) < 0.)
+            {
+                return std::nullopt;
+            }
+
+            result.rotation    = glm::quat_cast(basis);
+            result.translation = {_matrix[3], _matrix[7], _matrix[11]};
+            return result;
+        };
+
+    const auto first  = decompose(_first);
+    const auto second = decompose(_second);
+    if(!first || !second)
+    {
+        return generic_tl<std::array<float, 16> >::interpolate(_first, _second, _alpha);
+    }
+
+    const glm::dmat3 rotation = glm::mat3_cast(glm::slerp(first->rotation, second->rotation, _alpha));
+    const glm::dvec3 scale    = glm::mix(first->scale, second->scale, _alpha);
+    const glm::dvec3 position = glm::mix(first->translation, second->translation, _alpha);
+
+    std::array<float, 16> result {};
+    for(glm::length_t r = 0 ; r < 3 ; ++r)
+    {
+        for(glm::length_t c = 0 ; c < 3 ; ++c)
+        {
+            result[std::size_t(r * 4 + c)] = static_cast<float>(rotation[c][r] * scale[c]);
+        }
+
+        result[std::size_t(r * 4 + 3)] = static_cast<float>(position[r]);
+    }
+
+    result[15] = 1.F;
+    return result;
+}
+
 } // namespace sight::data
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -34,6 +34,9 @@ namespace sight::data
 
 /**
  * @brief   This class defines a timeline that stores groups of matrices.
+ *
+ * Matrices are stored in row-major order. get_interpolated_buffer() interpolates their rotation spherically and their
+ * translation and scale linearly.
  */
 class SIGHT_DATA_CLASS_API matrix_tl final : public generic_tl<std::array<float,
                                                                           16> >
@@ -49,6 +52,15 @@ public:
         generic_tl<std::array<float, 16> >()
     {
     }
+
+private:
+
+    /// Interpolates the rotations with a SLERP, and the translations and scales linearly
+    SIGHT_DATA_API std::array<float, 16> interpolate(
+        const std::array<float, 16>& _first,
+        const std::array<float, 16>& _second,
+        double _alpha
+    ) const override;
 };
 
 } // namespace sight::data
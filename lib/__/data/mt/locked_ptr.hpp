@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2020-2023 IRCAD France
+ * Copyright (C) 2020-2025 IRCAD France
  * Copyright (C) 2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -24,6 +24,8 @@
 
 #include "weak_ptr.hpp"
 
+#include "data/has_snapshot.hpp"
+
 #include <core/memory/buffer_object.hpp>
 #include <core/memory/buffered.hpp>
 #include <core/mt/types.hpp>
@@ -137,7 +139,18 @@ public:
     constexpr locked_ptr(locked_ptr&&)                 = default;
     constexpr locked_ptr& operator=(const locked_ptr&) = default;
     constexpr locked_ptr& operator=(locked_ptr&&)      = default;
-    inline ~locked_ptr()                               = default;
+
+    /// Destructor, publishes a snapshot of the data if it was written, see data::has_snapshot::snapshot()
+    inline ~locked_ptr()
+    {
+        if constexpr(!std::is_const_v<DATATYPE>)
+        {
+            if(m_data && m_locker.owns_lock())
+            {
+                has_snapshot::publish(*m_data);
+            }
+        }
+    }
 
     /// Returns the internal shared pointer
     [[nodiscard]] constexpr std::shared_ptr<DATATYPE> get_shared() const noexcept
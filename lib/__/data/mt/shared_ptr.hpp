@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2021-2024 IRCAD France
+ * Copyright (C) 2021-2025 IRCAD France
  * Copyright (C) 2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -97,6 +97,9 @@ public:
     [[nodiscard]] locked_ptr<DATATYPE> lock() const noexcept;
     [[nodiscard]] locked_ptr<std::add_const_t<DATATYPE> > const_lock() const noexcept;
 
+    /// Returns a copy of the data without locking it, see data::has_snapshot::snapshot()
+    [[nodiscard]] std::shared_ptr<std::add_const_t<DATATYPE> > snapshot() const;
+
     /// Resets the pointer to null
     inline void reset() noexcept
     {
@@ -144,4 +147,12 @@ inline locked_ptr<std::add_const_t<DATATYPE> > shared_ptr<DATATYPE>::const_lock(
     return locked_ptr<std::add_const_t<DATATYPE> >(std::dynamic_pointer_cast<std::add_const_t<DATATYPE> >(m_data));
 }
 
+//-----------------------------------------------------------------------------
+
+template<class DATATYPE>
+inline std::shared_ptr<std::add_const_t<DATATYPE> > shared_ptr<DATATYPE>::snapshot() const
+{
+    return m_data ? std::dynamic_pointer_cast<std::add_const_t<DATATYPE> >(m_data->snapshot()) : nullptr;
+}
+
 } // namespace sight::data::mt
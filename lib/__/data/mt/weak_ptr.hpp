@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2021-2024 IRCAD France
+ * Copyright (C) 2021-2025 IRCAD France
  * Copyright (C) 2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -103,6 +103,9 @@ public:
     [[nodiscard]] locked_ptr<DATATYPE> lock() const noexcept;
     [[nodiscard]] locked_ptr<std::add_const_t<DATATYPE> > const_lock() const noexcept;
 
+    /// Returns a copy of the data without locking it, see data::has_snapshot::snapshot()
+    [[nodiscard]] std::shared_ptr<std::add_const_t<DATATYPE> > snapshot() const;
+
     /// Returns true if the weak pointer has expired
     [[nodiscard]] inline bool expired() const noexcept
     {
@@ -165,4 +168,17 @@ inline locked_ptr<std::add_const_t<DATATYPE> > weak_ptr<DATATYPE>::const_lock()
 
 //-----------------------------------------------------------------------------
 
+template<class DATATYPE>
+inline std::shared_ptr<std::add_const_t<DATATYPE> > weak_ptr<DATATYPE>::snapshot() const
+{
+    if(const auto data = m_data.lock(); data)
+    {
+        return std::dynamic_pointer_cast<std::add_const_t<DATATYPE> >(data->snapshot());
+    }
+
+    return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
 } // namespace sight::data::mt
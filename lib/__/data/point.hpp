@@ -25,6 +25,7 @@
 #include <sight/data/config.hpp>
 
 #include "container.hpp"
+#include "has_snapshot.hpp"
 
 #include <array>
 
@@ -34,8 +35,8 @@ namespace sight::data
 /**
  * @brief   This class define a 3D point.
  */
-class SIGHT_DATA_CLASS_API point final : public container<std::array<double,
-                                                                     3> >
+class SIGHT_DATA_CLASS_API point final : public container<std::array<double, 3> >,
+                                         public has_snapshot
 {
 public:
 
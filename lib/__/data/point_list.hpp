@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -25,6 +25,7 @@
 #include <sight/data/config.hpp>
 
 #include "data/factory/new.hpp"
+#include "data/has_snapshot.hpp"
 #include "data/object.hpp"
 #include "data/point.hpp"
 
@@ -40,7 +41,8 @@ namespace sight::data
  * @brief   This class defines a list of points.
  * @see     Point
  */
-class SIGHT_DATA_CLASS_API point_list final : public object
+class SIGHT_DATA_CLASS_API point_list final : public object,
+                                              public has_snapshot
 {
 public:
 
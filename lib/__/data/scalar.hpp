@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2024 IRCAD France
+ * Copyright (C) 2024-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -24,6 +24,7 @@
 #include <sight/data/config.hpp>
 
 #include "data/generic.hpp"
+#include "data/has_snapshot.hpp"
 
 #include <core/compound_types.hpp>
 
@@ -36,7 +37,8 @@ namespace sight::data
  * double object is essentially used as a field in other objects.
  */
 template<typename T>
-class SIGHT_DATA_CLASS_API scalar : public generic<T>
+class SIGHT_DATA_CLASS_API scalar : public generic<T>,
+                                   public has_snapshot
 {
 public:
 
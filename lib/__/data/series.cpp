@@ -586,7 +586,11 @@ void series::shallow_copy(const object::csptr& _source)
         !bool(other)
     );
 
-    m_pimpl->m_frame_datasets = other->m_pimpl->m_frame_datasets;
+    {
+        std::unique_lock lock(m_pimpl->m_mutex);
+        m_pimpl->m_frame_datasets = other->m_pimpl->m_frame_datasets;
+        m_pimpl->invalidate_cache();
+    }
 
     base_class_t::shallow_copy(_source);
 }
@@ -1418,6 +1422,7 @@ void series::shrink_frames(std::size_t _size)
     }
 
     m_pimpl->shrink_multi_frame(_size);
+    m_pimpl->invalidate_cache();
 }
 
 //------------------------------------------------------------------------------
@@ -1436,15 +1441,8 @@ bool series::sort(const std::vector<std::size_t>& _sorted)
         _sorted.size() != m_pimpl->m_frame_datasets.size()
     );
 
-    // Finally, we can sort the frames in the series
-    detail::frame_datasets sorted_frame_datasets;
-
-    for(const auto& from : _sorted)
-    {
-        sorted_frame_datasets.push_back(std::move(m_pimpl->m_frame_datasets[from]));
-    }
-
-    m_pimpl->m_frame_datasets = std::move(sorted_frame_datasets);
+    // Finally, we can sort the frames in the series, the cached attributes follow their frame
+    m_pimpl->reorder(_sorted);
 
     return true;
 }
@@ -1453,27 +1451,26 @@ bool series::sort(const std::vector<std::size_t>& _sorted)
 
 dicom::sop::Keyword series::get_sop_keyword() const noexcept
 {
-    if(const auto& sop_class_uid = get_sop_class_uid(); !sop_class_uid.empty())
-    {
-        try
-        {
-            const auto sop_class = dicom::sop::get(sop_class_uid);
-            return sop_class.m_keyword;
-        }
-        catch(...)
+    // The keyword is looked up once, it is queried by is_multi_frame() for almost every attribute access
+    return m_pimpl->get_cached<gdcm::Keywords::SOPClassUID, dicom::sop::Keyword>(
+        0,
+        [this](std::size_t)
         {
-            if(!sop_class_uid.empty())
+            if(const auto& sop_class_uid = get_sop_class_uid(); !sop_class_uid.empty())
             {
-                SIGHT_ERROR("Unable to find SOP class name for SOP class UID '" << sop_class_uid << "'.");
-            }
-            else
-            {
-                SIGHT_ERROR("SOP class UID is not set.");
+                try
+                {
+                    const auto sop_class = dicom::sop::get(sop_class_uid);
+                    return sop_class.m_keyword;
+                }
+                catch(...)
+                {
+                    SIGHT_ERROR("Unable to find SOP class name for SOP class UID '" << sop_class_uid << "'.");
+                }
             }
-        }
-    }
 
-    return dicom::sop::Keyword::INVALID;
+            return dicom::sop::Keyword::INVALID;
+        });
 }
 
 //------------------------------------------------------------------------------
@@ -2910,7 +2907,7 @@ void series::set_content_time(const std::string& _content_time, std::size_t _ins
 
 std::optional<std::int32_t> series::get_instance_number(std::size_t _instance) const
 {
-    return m_pimpl->get_value<gdcm::Keywords::InstanceNumber>(_instance);
+    return m_pimpl->get_cached_value<gdcm::Keywords::InstanceNumber>(_instance);
 }
 
 //------------------------------------------------------------------------------
@@ -3122,7 +3119,7 @@ void series::set_contrast_bolus_ingredient_concentration(
 
 std::vector<double> series::window_center() const noexcept
 {
-    return m_pimpl->get_values<gdcm::Keywords::WindowCenter>().value_or(std::vector<double> {});
+    return m_pimpl->get_cached_values<gdcm::Keywords::WindowCenter>().value_or(std::vector<double> {});
 }
 
 //------------------------------------------------------------------------------
@@ -3136,7 +3133,7 @@ void series::set_window_center(const std::vector<double>& _window_centers)
 
 std::vector<double> series::window_width() const noexcept
 {
-    return m_pimpl->get_values<gdcm::Keywords::WindowWidth>().value_or(std::vector<double> {});
+    return m_pimpl->get_cached_values<gdcm::Keywords::WindowWidth>().value_or(std::vector<double> {});
 }
 
 //------------------------------------------------------------------------------
@@ -3150,7 +3147,7 @@ void series::set_window_width(const std::vector<double>& _window_widths)
 
 std::optional<double> series::get_rescale_intercept(std::size_t _instance) const noexcept
 {
-    return m_pimpl->get_value<gdcm::Keywords::RescaleIntercept>(_instance);
+    return m_pimpl->get_cached_value<gdcm::Keywords::RescaleIntercept>(_instance);
 }
 
 //------------------------------------------------------------------------------
@@ -3164,7 +3161,7 @@ void series::set_rescale_intercept(const std::optional<double>& _rescale_interce
 
 std::optional<double> series::get_rescale_slope(std::size_t _instance) const noexcept
 {
-    return m_pimpl->get_value<gdcm::Keywords::RescaleSlope>(_instance);
+    return m_pimpl->get_cached_value<gdcm::Keywords::RescaleSlope>(_instance);
 }
 
 //------------------------------------------------------------------------------
@@ -3184,7 +3181,9 @@ std::vector<double> series::get_image_position_patient(const std::optional<std::
         get_sop_keyword() != dicom::sop::Keyword::INVALID
     );
 
-    if(is_multi_frame())
+    const bool multi_frame = is_multi_frame();
+
+    if(multi_frame)
     {
         // If we deal with Enhanced US Volume, we need to look in:
         // {Multi-frame Functional Groups Module}
@@ -3212,9 +3211,10 @@ std::vector<double> series::get_image_position_patient(const std::optional<std::
     }
 
     // Default case use simple ImagePositionPatient tag values.
-    if(!_frame_index || !is_multi_frame())
+    if(!_frame_index || !multi_frame)
     {
-        if(const auto& result = m_pimpl->get_values<gdcm::Keywords::ImagePositionPatient>(_frame_index.value_or(0));
+        if(const auto& result =
+               m_pimpl->get_cached_values<gdcm::Keywords::ImagePositionPatient>(_frame_index.value_or(0));
            result)
         {
             return *result;
@@ -3274,7 +3274,9 @@ std::vector<double> series::get_image_orientation_patient(const std::optional<st
         get_sop_keyword() != dicom::sop::Keyword::INVALID
     );
 
-    if(is_multi_frame())
+    const bool multi_frame = is_multi_frame();
+
+    if(multi_frame)
     {
         // If we deal with Enhanced US Volume, we need to look in:
         // {Multi-frame Functional Groups Module}
@@ -3300,9 +3302,10 @@ std::vector<double> series::get_image_orientation_patient(const std::optional<st
         }
     }
 
-    if(!_frame_index || !is_multi_frame())
+    if(!_frame_index || !multi_frame)
     {
-        if(const auto& result = m_pimpl->get_values<gdcm::Keywords::ImageOrientationPatient>(_frame_index.value_or(0));
+        if(const auto& result =
+               m_pimpl->get_cached_values<gdcm::Keywords::ImageOrientationPatient>(_frame_index.value_or(0));
            result)
         {
             return *result;
@@ -3723,6 +3726,62 @@ SIGHT_DATA_API void series::set_spacing_between_slices(
 
 //------------------------------------------------------------------------------
 
+template<typename A, typename F>
+static std::vector<std::vector<double> > get_all_frames_values(
+    const series& _series,
+    const detail::series_impl& _pimpl,
+    F _get_frame_values
+)
+{
+    std::vector<std::vector<double> > result;
+
+    if(_series.is_multi_frame())
+    {
+        // Values are stored in functional groups sequences, use the regular per-frame path
+        const auto frames = _series.num_frames();
+        result.reserve(frames);
+
+        for(std::size_t frame = 0 ; frame < frames ; ++frame)
+        {
+            result.push_back(_get_frame_values(frame));
+        }
+    }
+    else
+    {
+        const auto& values = _pimpl.get_all_cached_values<A>();
+        result.reserve(values.size());
+
+        for(const auto& value : values)
+        {
+            result.push_back(value.value_or(std::vector<double> {}));
+        }
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<std::vector<double> > series::get_image_positions_patient() const
+{
+    return get_all_frames_values<gdcm::Keywords::ImagePositionPatient>(
+        *this,
+        *m_pimpl,
+        [this](std::size_t _frame){return get_image_position_patient(_frame);});
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<std::vector<double> > series::get_image_orientations_patient() const
+{
+    return get_all_frames_values<gdcm::Keywords::ImageOrientationPatient>(
+        *this,
+        *m_pimpl,
+        [this](std::size_t _frame){return get_image_orientation_patient(_frame);});
+}
+
+//------------------------------------------------------------------------------
+
 std::optional<matrix4> series::get_image_transform_patient(const std::optional<std::size_t>& _frame_index) const
 {
     const auto position    = this->get_image_position_patient(_frame_index);
@@ -3772,7 +3831,7 @@ void series::set_image_transform_patient(
 
 std::optional<double> series::get_slice_thickness() const noexcept
 {
-    return m_pimpl->get_value<gdcm::Keywords::SliceThickness>();
+    return m_pimpl->get_cached_value<gdcm::Keywords::SliceThickness>();
 }
 
 //------------------------------------------------------------------------------
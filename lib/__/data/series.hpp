@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -408,6 +408,12 @@ public:
         const std::optional<std::size_t>& _frame_index = std::nullopt
     );
 
+    /// Return the Image Position (Patient) / Image Orientation (Patient) of all frames at once, in frame order.
+    /// Values are parsed once and cached until the frame is modified, which makes sorting or spacing computation on
+    /// large series much cheaper than calling the per-frame getters. Missing values are returned as empty vectors.
+    SIGHT_DATA_API std::vector<std::vector<double> > get_image_positions_patient() const;
+    SIGHT_DATA_API std::vector<std::vector<double> > get_image_orientations_patient() const;
+
     SIGHT_DATA_API std::optional<matrix4> get_image_transform_patient(
         const std::optional<std::size_t>& _frame_index = std::nullopt
     ) const;
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -27,6 +27,9 @@
 #include <data/array.hpp>
 #include <data/exception.hpp>
 
+#include <array>
+#include <utility>
+
 // Registers the fixture into the 'registry'
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::data::ut::array_test);
 
@@ -726,4 +729,126 @@ void array_test::at_test()
 
 //-----------------------------------------------------------------------------
 
+void array_test::allocation_policy_test()
+{
+    auto pool  = std::make_shared<core::memory::buffer_pool_policy>();
+    auto array = std::make_shared<data::array>();
+    array->set_allocation_policy(pool);
+    CPPUNIT_ASSERT(array->get_allocation_policy() == pool);
+
+    // Recreating an array of the same size reuses the buffer released by the previous one
+    for(int i = 0 ; i < 3 ; ++i)
+    {
+        auto frame = std::make_shared<data::array>();
+        frame->set_allocation_policy(pool);
+        frame->resize({640, 480}, core::type::UINT8);
+
+        const auto lock = frame->dump_lock();
+        CPPUNIT_ASSERT(reinterpret_cast<std::uintptr_t>(frame->buffer()) % 64 == 0);
+    }
+
+    const auto statistics = pool->get_statistics();
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), statistics.misses);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(2), statistics.hits);
+
+    // A resize within the same size class does not need a new buffer
+    array->resize({640, 480}, core::type::UINT8);
+    array->resize({640, 481}, core::type::UINT8);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(3), pool->get_statistics().hits);
+    CPPUNIT_ASSERT_EQUAL(std::uint64_t(1), pool->get_statistics().misses);
+}
+
+//-----------------------------------------------------------------------------
+
+void array_test::copy_on_write_test()
+{
+    auto source = std::make_shared<data::array>();
+    source->resize({256, 256}, core::type::UINT16);
+    {
+        const auto lock     = source->dump_lock();
+        std::uint16_t value = 0;
+        for(auto& v : source->range<std::uint16_t>())
+        {
+            v = value++;
+        }
+    }
+
+    // A deep copy does not copy the buffer until one of the arrays is written
+    auto copy = std::make_shared<data::array>();
+    copy->deep_copy(source);
+    CPPUNIT_ASSERT(*source == *copy);
+    CPPUNIT_ASSERT(copy->get_buffer_object()->is_shared());
+    CPPUNIT_ASSERT(source->get_buffer_object()->is_shared());
+    {
+        const auto source_lock          = source->dump_lock();
+        const auto copy_lock            = copy->dump_lock();
+        const data::array& const_source = *source;
+        const data::array& const_copy   = *copy;
+        CPPUNIT_ASSERT(const_source.buffer() == const_copy.buffer());
+        CPPUNIT_ASSERT(copy->get_buffer_object()->is_shared());
+
+        // Writing the copy gives it its own buffer, the source keeps its values
+        copy->at<std::uint16_t>(0) = 42;
+        CPPUNIT_ASSERT(!copy->get_buffer_object()->is_shared());
+        CPPUNIT_ASSERT(const_source.buffer() != const_copy.buffer());
+        CPPUNIT_ASSERT_EQUAL(std::uint16_t(0), const_source.at<std::uint16_t>(0));
+        CPPUNIT_ASSERT_EQUAL(std::uint16_t(42), const_copy.at<std::uint16_t>(0));
+        CPPUNIT_ASSERT_EQUAL(std::uint16_t(1), const_copy.at<std::uint16_t>(1));
+    }
+
+    // The other way round, writing the source leaves the copy untouched
+    auto copy2 = std::make_shared<data::array>();
+    copy2->deep_copy(source);
+    CPPUNIT_ASSERT(copy2->get_buffer_object()->is_shared());
+    {
+        const auto source_lock = source->dump_lock();
+        const auto copy_lock   = copy2->dump_lock();
+        source->at<std::uint16_t>(1) = 43;
+        CPPUNIT_ASSERT_EQUAL(std::uint16_t(1), std::as_const(*copy2).at<std::uint16_t>(1));
+        CPPUNIT_ASSERT_EQUAL(std::uint16_t(43), std::as_const(*source).at<std::uint16_t>(1));
+    }
+
+    // Resizing a shared array keeps its values
+    auto copy3 = std::make_shared<data::array>();
+    copy3->deep_copy(copy2);
+    copy3->resize({256, 512}, core::type::UINT16);
+    CPPUNIT_ASSERT(!copy3->get_buffer_object()->is_shared());
+    {
+        const auto lock = copy3->dump_lock();
+        CPPUNIT_ASSERT_EQUAL(std::uint16_t(255), std::as_const(*copy3).at<std::uint16_t>(255));
+    }
+
+    // Writing through the buffer object detaches the buffer as well
+    auto copy5 = std::make_shared<data::array>();
+    copy5->deep_copy(source);
+    CPPUNIT_ASSERT(copy5->get_buffer_object()->is_shared());
+    {
+        const auto lock = copy5->dump_lock();
+        static_cast<std::uint16_t*>(copy5->get_buffer_object()->buffer())[0] = 44;
+        CPPUNIT_ASSERT(!copy5->get_buffer_object()->is_shared());
+        CPPUNIT_ASSERT_EQUAL(std::uint16_t(44), std::as_const(*copy5).at<std::uint16_t>(0));
+    }
+    {
+        const auto lock = source->dump_lock();
+        CPPUNIT_ASSERT_EQUAL(std::uint16_t(0), std::as_const(*source).at<std::uint16_t>(0));
+
+        // A locked array may be written through the pointers obtained meanwhile, so it is copied
+        auto copy6 = std::make_shared<data::array>();
+        copy6->deep_copy(source);
+        CPPUNIT_ASSERT(!copy6->get_buffer_object()->is_shared());
+        CPPUNIT_ASSERT(*copy6 == *source);
+    }
+
+    // An array that does not own its buffer is copied
+    std::array<std::uint8_t, 16> external {};
+    auto not_owner = std::make_shared<data::array>();
+    not_owner->set_buffer(external.data(), false, {external.size()}, core::type::UINT8);
+    auto copy4 = std::make_shared<data::array>();
+    copy4->deep_copy(not_owner);
+    CPPUNIT_ASSERT(!copy4->get_buffer_object()->is_shared());
+    CPPUNIT_ASSERT(*copy4 == *not_owner);
+}
+
+//-----------------------------------------------------------------------------
+
 } // namespace sight::data::ut
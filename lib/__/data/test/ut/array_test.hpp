@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -44,6 +44,8 @@ private:
     CPPUNIT_TEST(swap_test);
     CPPUNIT_TEST(resize_non_owner_test);
     CPPUNIT_TEST(set_buffer_object_null_then_resize_test);
+    CPPUNIT_TEST(allocation_policy_test);
+    CPPUNIT_TEST(copy_on_write_test);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -64,6 +66,8 @@ public:
     static void swap_test();
     static void resize_non_owner_test();
     static void set_buffer_object_null_then_resize_test();
+    static void allocation_policy_test();
+    static void copy_on_write_test();
     static void at_test();
 };
 
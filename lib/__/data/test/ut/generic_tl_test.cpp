@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -24,6 +24,7 @@
 
 #include <data/generic_tl.hpp>
 #include <data/generic_tl.hxx>
+#include <data/matrix_tl.hpp>
 #include <data/registry/macros.hpp>
 #include <data/timeline/generic_object.hpp>
 #include <data/timeline/generic_object.hxx>
@@ -31,6 +32,8 @@
 #include <utest/exception.hpp>
 
 #include <array>
+#include <cmath>
+#include <numbers>
 
 // Registers the fixture into the 'registry'
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::data::ut::generic_tl_test);
@@ -694,6 +697,124 @@ void generic_tl_test::equality_test()
     #undef TEST
 }
 
+//------------------------------------------------------------------------------
+
+void generic_tl_test::interpolation_test()
+{
+    auto timeline = std::make_shared<data::float4_tl>();
+    timeline->init_pool_size(3);
+
+    // An empty timeline can not be interpolated
+    CPPUNIT_ASSERT(timeline->get_interpolated_buffer(0., 1000.) == nullptr);
+
+    const float4 values1 = {1.F, 2.F, 3.F, 4.F};
+    const float4 values2 = {3.F, 2.F, 1.F, 0.F};
+    const float4 values3 = {5.F, 6.F, 7.F, 8.F};
+
+    auto data1 = timeline->create_buffer(100.);
+    data1->set_element(values1, 0);
+    data1->set_element(values1, 1);
+    timeline->push_object(data1);
+
+    // A single sample is returned as is
+    {
+        const auto buffer = timeline->get_interpolated_buffer(100.);
+        CPPUNIT_ASSERT(buffer != nullptr);
+        CPPUNIT_ASSERT(buffer->get_element(0) == values1);
+        CPPUNIT_ASSERT(timeline->get_interpolated_buffer(110.) == nullptr);
+        CPPUNIT_ASSERT(timeline->get_interpolated_buffer(110., 10.)->get_element(1) == values1);
+    }
+
+    auto data2 = timeline->create_buffer(200.);
+    data2->set_element(values2, 0);
+    data2->set_element(values3, 2);
+    timeline->push_object(data2);
+
+    // Elements present in both samples are interpolated, the others are copied from the closest sample
+    {
+        const auto buffer = timeline->get_interpolated_buffer(125.);
+        CPPUNIT_ASSERT(buffer != nullptr);
+        CPPUNIT_ASSERT_EQUAL(125., buffer->get_timestamp());
+        CPPUNIT_ASSERT(buffer->get_element(0) == float4({1.5F, 2.F, 2.5F, 3.F}));
+        CPPUNIT_ASSERT(buffer->is_present(1));
+        CPPUNIT_ASSERT(buffer->get_element(1) == values1);
+        CPPUNIT_ASSERT(!buffer->is_present(2));
+        CPPUNIT_ASSERT_EQUAL(2U, buffer->get_present_element_num());
+    }
+    {
+        const auto buffer = timeline->get_interpolated_buffer(175.);
+        CPPUNIT_ASSERT(buffer->get_element(0) == float4({2.5F, 2.F, 1.5F, 1.F}));
+        CPPUNIT_ASSERT(!buffer->is_present(1));
+        CPPUNIT_ASSERT(buffer->get_element(2) == values3);
+    }
+
+    // Samples themselves are returned unchanged
+    CPPUNIT_ASSERT(timeline->get_interpolated_buffer(200.)->get_element(0) == values2);
+    CPPUNIT_ASSERT(timeline->get_interpolated_buffer(100.)->get_element(0) == values1);
+
+    // Extrapolation is limited to the given horizon
+    CPPUNIT_ASSERT(timeline->get_interpolated_buffer(210.) == nullptr);
+    CPPUNIT_ASSERT(timeline->get_interpolated_buffer(250., 20.) == nullptr);
+    CPPUNIT_ASSERT(timeline->get_interpolated_buffer(50., 20.) == nullptr);
+    const auto check_extrapolation =
+        [&timeline](core::clock::type _timestamp, const float4& _expected)
+        {
+            const auto buffer = timeline->get_interpolated_buffer(_timestamp, 20.);
+            CPPUNIT_ASSERT(buffer != nullptr);
+            for(std::size_t i = 0 ; i < _expected.size() ; ++i)
+            {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(_expected[i], buffer->get_element(0)[i], 1e-5);
+            }
+        };
+    check_extrapolation(220., {3.4F, 2.F, 0.6F, -0.8F});
+    check_extrapolation(90., {0.8F, 2.F, 3.2F, 4.4F});
+
+    // The interpolated buffer does not belong to the timeline
+    CPPUNIT_ASSERT(timeline->get_object(125.) == nullptr);
+}
+
+//------------------------------------------------------------------------------
+
+void generic_tl_test::matrix_interpolation_test()
+{
+    auto timeline = std::make_shared<data::matrix_tl>();
+    timeline->init_pool_size(1);
+
+    // Rotations of 0 and 90 degrees around Z, with a translation
+    auto data1 = timeline->create_buffer(0.);
+    data1->set_element({1.F, 0.F, 0.F, 10.F, 0.F, 1.F, 0.F, 0.F, 0.F, 0.F, 1.F, 0.F, 0.F, 0.F, 0.F, 1.F}, 0);
+    timeline->push_object(data1);
+    auto data2 = timeline->create_buffer(10.);
+    data2->set_element({0.F, -1.F, 0.F, 20.F, 1.F, 0.F, 0.F, 4.F, 0.F, 0.F, 1.F, 0.F, 0.F, 0.F, 0.F, 1.F}, 0);
+    timeline->push_object(data2);
+
+    const auto check =
+        [&timeline](core::clock::type _timestamp, double _angle, const std::array<float, 3>& _translation)
+        {
+            const auto buffer = timeline->get_interpolated_buffer(_timestamp, 10.);
+            CPPUNIT_ASSERT(buffer != nullptr);
+
+            const auto& matrix = buffer->get_element(0);
+            const std::array<double, 16> expected {
+                std::cos(_angle), -std::sin(_angle), 0., _translation[0],
+                std::sin(_angle), std::cos(_angle), 0., _translation[1],
+                0., 0., 1., _translation[2],
+                0., 0., 0., 1.
+            };
+            for(std::size_t i = 0 ; i < expected.size() ; ++i)
+            {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[i], double(matrix[i]), 1e-5);
+            }
+        };
+
+    // The rotation is interpolated spherically, the rotation matrix stays orthonormal
+    check(5., std::numbers::pi / 4., {15.F, 2.F, 0.F});
+    check(2.5, std::numbers::pi / 8., {12.5F, 1.F, 0.F});
+
+    // And extrapolated
+    check(15., 3. * std::numbers::pi / 4., {25.F, 6.F, 0.F});
+}
+
 } //namespace ut
 
 } //namespace sight::data
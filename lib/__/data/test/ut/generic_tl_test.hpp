@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2016 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -38,6 +38,8 @@ public:
     CPPUNIT_TEST(iterator_test);
     CPPUNIT_TEST(object_valid);
     CPPUNIT_TEST(equality_test);
+    CPPUNIT_TEST(interpolation_test);
+    CPPUNIT_TEST(matrix_interpolation_test);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -52,6 +54,8 @@ public:
     static void iterator_test();
     static void object_valid();
     static void equality_test();
+    static void interpolation_test();
+    static void matrix_interpolation_test();
 };
 
 } // namespace sight::data::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -22,9 +22,21 @@
 
 #include "object_test.hpp"
 
+#include <core/profiling.hpp>
+#include <core/spy_log.hpp>
+
+#include <data/image.hpp>
+#include <data/matrix4.hpp>
 #include <data/mt/locked_ptr.hpp>
+#include <data/mt/weak_ptr.hpp>
+#include <data/point_list.hpp>
 #include <data/real.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
 // Registers the fixture into the 'registry'
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::data::ut::object_test);
 
@@ -148,4 +160,194 @@ void object_test::equality_test()
 
 //------------------------------------------------------------------------------
 
+void object_test::snapshot_test()
+{
+    auto matrix = std::make_shared<data::matrix4>();
+    const data::mt::weak_ptr<data::matrix4> weak(matrix);
+
+    // The first snapshot is a copy of the current state
+    const auto identity = weak.snapshot();
+    CPPUNIT_ASSERT(identity);
+    CPPUNIT_ASSERT(identity != matrix);
+    CPPUNIT_ASSERT(*identity == *matrix);
+
+    // Snapshots are immutable, each write access publishes a new one
+    {
+        auto lock = weak.lock();
+        std::fill(lock->begin(), lock->end(), 2.);
+    }
+    const auto twos = weak.snapshot();
+    CPPUNIT_ASSERT(*twos == *matrix);
+    CPPUNIT_ASSERT(*identity == data::matrix4());
+
+    for(int i = 3 ; i < 10 ; ++i)
+    {
+        auto lock = weak.lock();
+        std::fill(lock->begin(), lock->end(), double(i));
+    }
+
+    CPPUNIT_ASSERT(std::ranges::all_of(*twos, [](double _v){return _v == 2.;}));
+    CPPUNIT_ASSERT(std::ranges::all_of(*weak.snapshot(), [](double _v){return _v == 9.;}));
+
+    // A reader never sees a partially written matrix
+    static constexpr int s_WRITES = 10000;
+    std::atomic_bool done {false};
+    std::atomic_bool consistent {true};
+    std::vector<std::thread> readers;
+    for(int i = 0 ; i < 2 ; ++i)
+    {
+        readers.emplace_back(
+            [&]
+            {
+                double last = 0.;
+                while(!done)
+                {
+                    const auto snapshot = weak.snapshot();
+                    const double first  = (*snapshot)[0];
+                    if(first < last || !std::ranges::all_of(*snapshot, [first](double _v){return _v == first;}))
+                    {
+                        consistent = false;
+                    }
+
+                    last = first;
+                }
+            });
+    }
+
+    for(int i = 10 ; i < s_WRITES ; ++i)
+    {
+        auto lock = weak.lock();
+        std::fill(lock->begin(), lock->end(), double(i));
+    }
+
+    done = true;
+    std::ranges::for_each(readers, [](auto& _t){_t.join();});
+
+    CPPUNIT_ASSERT(consistent);
+    CPPUNIT_ASSERT_EQUAL(double(s_WRITES - 1), (*weak.snapshot())[15]);
+}
+
+//------------------------------------------------------------------------------
+
+void object_test::snapshot_types_test()
+{
+    // Only the small types hold a snapshot, large data are never copied on write
+    static_assert(std::is_base_of_v<data::has_snapshot, data::real>);
+    static_assert(std::is_base_of_v<data::has_snapshot, data::point_list>);
+    static_assert(!std::is_base_of_v<data::has_snapshot, data::image>);
+
+    {
+        auto real = std::make_shared<data::real>(1.);
+        const data::mt::weak_ptr<data::real> weak(real);
+        const auto one = weak.snapshot();
+        CPPUNIT_ASSERT_EQUAL(1., one->get_value());
+
+        weak.lock()->set_value(2.);
+        CPPUNIT_ASSERT_EQUAL(2., weak.snapshot()->get_value());
+        CPPUNIT_ASSERT_EQUAL(1., one->get_value());
+    }
+
+    {
+        auto point_list = std::make_shared<data::point_list>();
+        const data::mt::weak_ptr<data::point_list> weak(point_list);
+        CPPUNIT_ASSERT(weak.snapshot()->get_points().empty());
+
+        weak.lock()->push_back(std::make_shared<data::point>(1., 2., 3.));
+        const auto points = weak.snapshot();
+        CPPUNIT_ASSERT_EQUAL(std::size_t(1), points->get_points().size());
+        CPPUNIT_ASSERT(points->get_points()[0] != point_list->get_points()[0]);
+        CPPUNIT_ASSERT(*points->get_points()[0] == *point_list->get_points()[0]);
+    }
+
+    {
+        // A write through a generic pointer also publishes a new snapshot
+        auto matrix = std::make_shared<data::matrix4>();
+        const auto identity = matrix->snapshot();
+
+        const data::object::sptr object = matrix;
+        {
+            data::mt::locked_ptr<data::object> lock(object);
+            (*std::dynamic_pointer_cast<data::matrix4>(lock.get_shared()))[3] = 4.;
+        }
+
+        const auto translated = std::dynamic_pointer_cast<const data::matrix4>(matrix->snapshot());
+        CPPUNIT_ASSERT(translated);
+        CPPUNIT_ASSERT_EQUAL(4., (*translated)[3]);
+        CPPUNIT_ASSERT(*std::dynamic_pointer_cast<const data::matrix4>(identity) == data::matrix4());
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void object_test::benchmark_snapshot_contention()
+{
+    static constexpr std::size_t s_READERS = 4;
+    static constexpr std::size_t s_WRITES  = 20000;
+
+    // A tracker writes a matrix as fast as possible while renderers and editors read it
+    const auto run =
+        [](bool _snapshot)
+        {
+            auto matrix = std::make_shared<data::matrix4>();
+            const data::mt::weak_ptr<data::matrix4> weak(matrix);
+            if(_snapshot)
+            {
+                [[maybe_unused]] const auto initial = weak.snapshot();
+            }
+
+            std::atomic_bool done {false};
+            std::atomic<std::size_t> reads {0};
+            std::vector<std::thread> readers;
+            for(std::size_t i = 0 ; i < s_READERS ; ++i)
+            {
+                readers.emplace_back(
+                    [&]
+                    {
+                        std::size_t count = 0;
+                        double sum        = 0.;
+                        while(!done)
+                        {
+                            if(_snapshot)
+                            {
+                                sum += (*weak.snapshot())[3];
+                            }
+                            else
+                            {
+                                sum += (*weak.const_lock())[3];
+                            }
+
+                            ++count;
+                        }
+
+                        reads += count + (sum < 0. ? 1 : 0);
+                    });
+            }
+
+            {
+                FW_PROFILE(_snapshot ? "Matrix writes, readers with snapshots" : "Matrix writes, readers with locks");
+                for(std::size_t i = 0 ; i < s_WRITES ; ++i)
+                {
+                    auto lock = weak.lock();
+                    std::fill(lock->begin(), lock->end(), double(i));
+                }
+            }
+
+            done = true;
+            std::ranges::for_each(readers, [](auto& _t){_t.join();});
+
+            CPPUNIT_ASSERT_EQUAL(double(s_WRITES - 1), (*matrix)[15]);
+            return std::size_t(reads);
+        };
+
+    const auto locked_reads   = run(false);
+    const auto snapshot_reads = run(true);
+
+    SIGHT_INFO(
+        "Matrix written " << s_WRITES << " times with " << s_READERS << " readers: " << locked_reads
+        << " reads with read locks, " << snapshot_reads << " reads with snapshots."
+    );
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace sight::data::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -35,6 +35,9 @@ private:
     CPPUNIT_TEST(field_test);
     CPPUNIT_TEST(last_modify_test);
     CPPUNIT_TEST(equality_test);
+    CPPUNIT_TEST(snapshot_test);
+    CPPUNIT_TEST(snapshot_types_test);
+    CPPUNIT_TEST(benchmark_snapshot_contention);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -46,6 +49,9 @@ public:
     static void field_test();
     static void last_modify_test();
     static void equality_test();
+    static void snapshot_test();
+    static void snapshot_types_test();
+    static void benchmark_snapshot_contention();
 };
 
 } // namespace sight::data::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2022-2023 IRCAD France
+ * Copyright (C) 2022-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -21,10 +21,14 @@
 
 #include "series_set_test.hpp"
 
+#include <core/profiling.hpp>
 #include <core/tools/uuid.hpp>
 
+#include <data/image_series.hpp>
 #include <data/series_set.hpp>
 
+#include <cstring>
+
 // Registers the fixture into the 'registry'
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::data::ut::series_set_test);
 
@@ -152,4 +156,63 @@ void series_set_test::copy_test()
     CPPUNIT_ASSERT(is_equal((*deep_series_set)[2], series3));
 }
 
+//------------------------------------------------------------------------------
+
+void series_set_test::benchmark_deep_copy()
+{
+    static constexpr std::size_t s_SERIES = 4;
+    static constexpr std::size_t s_COPIES = 5;
+
+    auto original_series_set = std::make_shared<series_set>();
+    for(std::size_t i = 0 ; i < s_SERIES ; ++i)
+    {
+        auto series = std::make_shared<image_series>();
+        series->resize({256, 256, 128}, core::type::INT16, image::pixel_format_t::gray_scale);
+        const auto lock = series->dump_lock();
+        std::memset(series->buffer(), int(i), series->size_in_bytes());
+        original_series_set->push_back(series);
+    }
+
+    const auto copy_all =
+        [&original_series_set](bool _write)
+        {
+            for(std::size_t i = 0 ; i < s_COPIES ; ++i)
+            {
+                auto copy = std::make_shared<series_set>();
+                copy->deep_copy(original_series_set);
+
+                // Writing every image of the copy forces the same copies as an eager deep copy
+                if(_write)
+                {
+                    for(const auto& series : *copy)
+                    {
+                        auto image      = std::dynamic_pointer_cast<image_series>(series);
+                        const auto lock = image->dump_lock();
+                        static_cast<char*>(image->buffer())[0] = 1;
+                    }
+                }
+
+                CPPUNIT_ASSERT_EQUAL(s_SERIES, copy->size());
+            }
+        };
+
+    {
+        FW_PROFILE("Deep copies of image series, buffers shared");
+        copy_all(false);
+    }
+
+    {
+        FW_PROFILE("Deep copies of image series, all copies written");
+        copy_all(true);
+    }
+
+    // The source is never modified by the writes on its copies
+    for(std::size_t i = 0 ; i < s_SERIES ; ++i)
+    {
+        const auto image = std::dynamic_pointer_cast<const image_series>((*original_series_set)[i]);
+        const auto lock  = image->dump_lock();
+        CPPUNIT_ASSERT_EQUAL(char(i), static_cast<const char*>(image->buffer())[0]);
+    }
+}
+
 } // namespace sight::data::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2022-2023 IRCAD France
+ * Copyright (C) 2022-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -31,6 +31,7 @@ class series_set_test : public CPPUNIT_NS::TestFixture
 CPPUNIT_TEST_SUITE(series_set_test);
 CPPUNIT_TEST(nominal_test);
 CPPUNIT_TEST(copy_test);
+CPPUNIT_TEST(benchmark_deep_copy);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -41,6 +42,7 @@ public:
 
     static void nominal_test();
     static void copy_test();
+    static void benchmark_deep_copy();
 };
 
 } // namespace sight::data::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2022-2024 IRCAD France
+ * Copyright (C) 2022-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -22,6 +22,7 @@
 #include "series_test.hpp"
 
 #include <core/compare.hpp>
+#include <core/profiling.hpp>
 #include <core/tools/uuid.hpp>
 
 #include <data/dicom/attribute.hpp>
@@ -31,6 +32,7 @@
 #include <boost/algorithm/string/split.hpp>
 
 #include <algorithm>
+#include <numeric>
 
 using uuid = sight::core::tools::uuid;
 
@@ -3095,4 +3097,121 @@ void series_test::path_test()
     );
 }
 
+//------------------------------------------------------------------------------
+
+void series_test::attribute_cache_test()
+{
+    static constexpr std::size_t s_INSTANCES = 16;
+
+    auto series = std::make_shared<data::image_series>();
+    series->set_sop_keyword(data::dicom::sop::Keyword::CTImageStorage);
+
+    std::vector<std::vector<double> > expected;
+    for(std::size_t i = 0 ; i < s_INSTANCES ; ++i)
+    {
+        expected.push_back({1., 2., double(s_INSTANCES - i)});
+        series->set_image_position_patient(expected.back(), i);
+        series->set_image_orientation_patient({1., 0., 0., 0., 1., 0.}, i);
+        series->set_instance_number(std::int32_t(i), i);
+    }
+
+    // Values are parsed on first access, then read from the cache
+    CPPUNIT_ASSERT(expected == series->get_image_positions_patient());
+    CPPUNIT_ASSERT(expected == series->get_image_positions_patient());
+    CPPUNIT_ASSERT(expected[3] == series->get_image_position_patient(3));
+    CPPUNIT_ASSERT_EQUAL(std::int32_t(3), series->get_instance_number(3).value_or(-1));
+    CPPUNIT_ASSERT_EQUAL(s_INSTANCES, series->get_image_orientations_patient().size());
+
+    // A setter invalidates the cache of its instance only
+    expected[3] = {4., 5., 6.};
+    series->set_image_position_patient(expected[3], 3);
+    series->set_instance_number(42, 3);
+    CPPUNIT_ASSERT(expected[3] == series->get_image_position_patient(3));
+    CPPUNIT_ASSERT(expected == series->get_image_positions_patient());
+    CPPUNIT_ASSERT_EQUAL(std::int32_t(42), series->get_instance_number(3).value_or(-1));
+    CPPUNIT_ASSERT_EQUAL(std::int32_t(4), series->get_instance_number(4).value_or(-1));
+
+    // So does a raw modification of the data set
+    series->set_byte_values(data::dicom::attribute::Keyword::ImagePositionPatient, {"7", "8", "9"}, 5);
+    expected[5] = {7., 8., 9.};
+    CPPUNIT_ASSERT(expected[5] == series->get_image_position_patient(5));
+
+    // Cached values follow their frame when sorting
+    std::vector<std::size_t> reversed(s_INSTANCES);
+    std::iota(reversed.rbegin(), reversed.rend(), std::size_t(0));
+    CPPUNIT_ASSERT(series->sort(reversed));
+    std::reverse(expected.begin(), expected.end());
+    CPPUNIT_ASSERT(expected == series->get_image_positions_patient());
+    CPPUNIT_ASSERT_EQUAL(std::int32_t(42), series->get_instance_number(s_INSTANCES - 4).value_or(-1));
+
+    // Shrinking drops the values of the removed frames
+    series->shrink_frames(4);
+    expected.resize(4);
+    CPPUNIT_ASSERT(expected == series->get_image_positions_patient());
+
+    // Copies do not keep stale values
+    auto copy = std::make_shared<data::image_series>();
+    copy->set_sop_keyword(data::dicom::sop::Keyword::CTImageStorage);
+    copy->set_image_position_patient({0., 0., 0.}, 0);
+    CPPUNIT_ASSERT(std::vector<double>({0., 0., 0.}) == copy->get_image_position_patient(0));
+    copy->shallow_copy(series);
+    CPPUNIT_ASSERT(expected == copy->get_image_positions_patient());
+    copy->deep_copy(series);
+    CPPUNIT_ASSERT(expected == copy->get_image_positions_patient());
+
+    // The SOP class is also cached, changing it must switch to the multi-frame attributes
+    CPPUNIT_ASSERT(!series->is_multi_frame());
+    series->set_sop_keyword(data::dicom::sop::Keyword::EnhancedUSVolumeStorage);
+    CPPUNIT_ASSERT(series->is_multi_frame());
+}
+
+//------------------------------------------------------------------------------
+
+void series_test::benchmark_attribute_cache()
+{
+    static constexpr std::size_t s_INSTANCES = 512;
+    static constexpr std::size_t s_PASSES    = 10;
+
+    auto series = std::make_shared<data::image_series>();
+    series->set_sop_keyword(data::dicom::sop::Keyword::CTImageStorage);
+
+    for(std::size_t i = 0 ; i < s_INSTANCES ; ++i)
+    {
+        series->set_image_position_patient({-125.5, -130.25, double(i) * 0.625}, i);
+        series->set_image_orientation_patient({1., 0., 0., 0., 1., 0.}, i);
+    }
+
+    // Same access pattern as the DICOM reader: spacing computation and sorting query all positions several times
+    std::vector<std::vector<double> > first;
+    {
+        FW_PROFILE("Image position, first access");
+        first = series->get_image_positions_patient();
+    }
+
+    std::vector<std::vector<double> > cached;
+    {
+        FW_PROFILE("Image position, per-frame cached access");
+        for(std::size_t pass = 0 ; pass < s_PASSES ; ++pass)
+        {
+            cached.clear();
+            for(std::size_t i = 0 ; i < s_INSTANCES ; ++i)
+            {
+                cached.push_back(series->get_image_position_patient(i));
+            }
+        }
+    }
+
+    std::vector<std::vector<double> > bulk;
+    {
+        FW_PROFILE("Image position, bulk cached access");
+        for(std::size_t pass = 0 ; pass < s_PASSES ; ++pass)
+        {
+            bulk = series->get_image_positions_patient();
+        }
+    }
+
+    CPPUNIT_ASSERT(first == cached);
+    CPPUNIT_ASSERT(first == bulk);
+}
+
 } //namespace sight::data::ut
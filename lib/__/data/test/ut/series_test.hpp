@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2022-2024 IRCAD France
+ * Copyright (C) 2022-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -128,6 +128,8 @@ CPPUNIT_TEST(get_patient_position_string_test);
 CPPUNIT_TEST(new_instances_test);
 CPPUNIT_TEST(iso_date_time_test);
 CPPUNIT_TEST(path_test);
+CPPUNIT_TEST(attribute_cache_test);
+CPPUNIT_TEST(benchmark_attribute_cache);
 
 CPPUNIT_TEST_SUITE_END();
 
@@ -234,6 +236,8 @@ public:
     static void new_instances_test();
     static void iso_date_time_test();
     static void path_test();
+    static void attribute_cache_test();
+    static void benchmark_attribute_cache();
 
 protected:
 
@@ -0,0 +1,277 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "pixelwise.hpp"
+
+#include <core/tools/dispatcher.hpp>
+
+namespace sight::filter::image::pixelwise
+{
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+
+/// Copies the information of the input image into the output one and allocates its buffer with the given type.
+void prepare_output(const data::image::csptr& _in, const data::image::sptr& _out, core::type _type)
+{
+    SIGHT_ASSERT("Null image pointer", _in && _out);
+
+    if(_in != _out)
+    {
+        _out->copy_information(_in);
+    }
+
+    _out->resize(_in->size(), _type, _in->pixel_format());
+}
+
+//------------------------------------------------------------------------------
+
+struct unary_param
+{
+    data::image::csptr in;
+    data::image::sptr out;
+    double a {0.};
+    double b {0.};
+};
+
+//------------------------------------------------------------------------------
+
+struct threshold_functor
+{
+    //------------------------------------------------------------------------------
+
+    template<class PIXEL_TYPE>
+    void operator()(unary_param& _param)
+    {
+        const auto threshold = static_cast<PIXEL_TYPE>(_param.a);
+        const auto max_value = std::numeric_limits<PIXEL_TYPE>::max();
+
+        assign<PIXEL_TYPE>(*_param.out, select(view<PIXEL_TYPE>(*_param.in) < threshold, PIXEL_TYPE(0), max_value));
+    }
+};
+
+//------------------------------------------------------------------------------
+
+struct clamp_functor
+{
+    //------------------------------------------------------------------------------
+
+    template<class PIXEL_TYPE>
+    void operator()(unary_param& _param)
+    {
+        const auto min = detail::saturate<PIXEL_TYPE> {}(_param.a);
+        const auto max = detail::saturate<PIXEL_TYPE> {}(_param.b);
+
+        assign<PIXEL_TYPE>(*_param.out, pixelwise::clamp(view<PIXEL_TYPE>(*_param.in), min, max));
+    }
+};
+
+//------------------------------------------------------------------------------
+
+template<class IN_TYPE>
+struct cast_functor
+{
+    //------------------------------------------------------------------------------
+
+    template<class OUT_TYPE>
+    void operator()(unary_param& _param)
+    {
+        assign<OUT_TYPE>(*_param.out, pixelwise::cast<OUT_TYPE>(view<IN_TYPE>(*_param.in)));
+    }
+};
+
+//------------------------------------------------------------------------------
+
+struct cast_caller
+{
+    //------------------------------------------------------------------------------
+
+    template<class IN_TYPE>
+    void operator()(unary_param& _param)
+    {
+        core::tools::dispatcher<core::tools::supported_dispatcher_types, cast_functor<IN_TYPE> >::invoke(
+            _param.out->type(),
+            _param
+        );
+    }
+};
+
+//------------------------------------------------------------------------------
+
+struct binary_param
+{
+    data::image::csptr lhs;
+    data::image::csptr rhs;
+    data::image::sptr out;
+};
+
+//------------------------------------------------------------------------------
+
+struct subtract_functor
+{
+    //------------------------------------------------------------------------------
+
+    template<class PIXEL_TYPE>
+    void operator()(binary_param& _param)
+    {
+        assign<PIXEL_TYPE>(*_param.out, view<PIXEL_TYPE>(*_param.lhs) - view<PIXEL_TYPE>(*_param.rhs));
+    }
+};
+
+//------------------------------------------------------------------------------
+
+template<class PIXEL_TYPE>
+struct mask_functor
+{
+    //------------------------------------------------------------------------------
+
+    template<class MASK_TYPE>
+    void operator()(binary_param& _param)
+    {
+        assign<PIXEL_TYPE>(
+            *_param.out,
+            select(view<MASK_TYPE>(*_param.rhs) != MASK_TYPE(0), view<PIXEL_TYPE>(*_param.lhs), PIXEL_TYPE(0))
+        );
+    }
+};
+
+//------------------------------------------------------------------------------
+
+struct mask_caller
+{
+    //------------------------------------------------------------------------------
+
+    template<class PIXEL_TYPE>
+    void operator()(binary_param& _param)
+    {
+        core::tools::dispatcher<core::tools::integer_types, mask_functor<PIXEL_TYPE> >::invoke(
+            _param.rhs->type(),
+            _param
+        );
+    }
+};
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+void threshold(const data::image::csptr& _in, const data::image::sptr& _out, double _threshold)
+{
+    prepare_output(_in, _out, _in->type());
+
+    const auto in_lock  = _in->dump_lock();
+    const auto out_lock = _out->dump_lock();
+
+    unary_param param {.in = _in, .out = _out, .a = _threshold};
+    core::tools::dispatcher<core::tools::supported_dispatcher_types, threshold_functor>::invoke(_in->type(), param);
+}
+
+//------------------------------------------------------------------------------
+
+void subtract(const data::image::csptr& _a, const data::image::csptr& _b, const data::image::sptr& _out)
+{
+    SIGHT_ASSERT("Both images must have the same type.", _a->type() == _b->type());
+    SIGHT_ASSERT("Both images must have the same number of elements.", _a->num_elements() == _b->num_elements());
+
+    prepare_output(_a, _out, _a->type());
+
+    const auto a_lock   = _a->dump_lock();
+    const auto b_lock   = _b->dump_lock();
+    const auto out_lock = _out->dump_lock();
+
+    binary_param param {.lhs = _a, .rhs = _b, .out = _out};
+    core::tools::dispatcher<core::tools::supported_dispatcher_types, subtract_functor>::invoke(_a->type(), param);
+}
+
+//------------------------------------------------------------------------------
+
+void mask(const data::image::csptr& _in, const data::image::csptr& _mask, const data::image::sptr& _out)
+{
+    SIGHT_ASSERT("Both images must have the same number of elements.", _in->num_elements() == _mask->num_elements());
+
+    prepare_output(_in, _out, _in->type());
+
+    const auto in_lock   = _in->dump_lock();
+    const auto mask_lock = _mask->dump_lock();
+    const auto out_lock  = _out->dump_lock();
+
+    binary_param param {.lhs = _in, .rhs = _mask, .out = _out};
+    core::tools::dispatcher<core::tools::supported_dispatcher_types, mask_caller>::invoke(_in->type(), param);
+}
+
+//------------------------------------------------------------------------------
+
+void clamp(const data::image::csptr& _in, const data::image::sptr& _out, double _min, double _max)
+{
+    SIGHT_ASSERT("The minimum must be lower than the maximum.", _min <= _max);
+
+    prepare_output(_in, _out, _in->type());
+
+    const auto in_lock  = _in->dump_lock();
+    const auto out_lock = _out->dump_lock();
+
+    unary_param param {.in = _in, .out = _out, .a = _min, .b = _max};
+    core::tools::dispatcher<core::tools::supported_dispatcher_types, clamp_functor>::invoke(_in->type(), param);
+}
+
+//------------------------------------------------------------------------------
+
+void cast(const data::image::csptr& _in, const data::image::sptr& _out, core::type _type)
+{
+    SIGHT_ASSERT("Cannot cast an image into itself.", _in != _out);
+
+    prepare_output(_in, _out, _type);
+
+    const auto in_lock  = _in->dump_lock();
+    const auto out_lock = _out->dump_lock();
+
+    unary_param param {.in = _in, .out = _out};
+    core::tools::dispatcher<core::tools::supported_dispatcher_types, cast_caller>::invoke(_in->type(), param);
+}
+
+//------------------------------------------------------------------------------
+
+void labels_to_mask(const data::image::csptr& _labels, const data::image::sptr& _out, const std::bitset<256>& _label_set)
+{
+    SIGHT_ASSERT(
+        "The label image must be a greyscale image with uint8 values.",
+        _labels->type() == core::type::UINT8 && _labels->num_components() == 1
+    );
+
+    std::array<std::uint8_t, 256> table {};
+    for(std::size_t i = 0 ; i < table.size() ; ++i)
+    {
+        table[i] = _label_set[i] ? std::numeric_limits<std::uint8_t>::max() : 0;
+    }
+
+    prepare_output(_labels, _out, core::type::UINT8);
+
+    const auto in_lock  = _labels->dump_lock();
+    const auto out_lock = _out->dump_lock();
+
+    assign<std::uint8_t>(*_out, lookup(view<std::uint8_t>(*_labels), table));
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::filter::image::pixelwise
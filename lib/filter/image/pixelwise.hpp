@@ -0,0 +1,448 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/filter/image/config.hpp>
+
+#include <core/type.hpp>
+
+#include <data/image.hpp>
+
+#include <array>
+#include <bitset>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Element-wise image kernels.
+ *
+ * Expressions are built lazily from image views and scalars with the usual C++ operators and are only computed when
+ * they are assigned to an output buffer. A whole pipeline is thus computed in a single pass over the memory, with one
+ * loop vectorised by the compiler and split across the OpenMP thread pool:
+ *
+ * @code{.cpp}
+    namespace pw = sight::filter::image::pixelwise;
+
+    const auto a_lock = a->dump_lock();
+    ...
+    // (a - b) > t & mask, written as 0/255 in a uint8 image, in one pass
+    pw::assign<std::uint8_t>(*out, pw::select((pw::view<std::int16_t>(*a) - pw::view<std::int16_t>(*b)) > t
+                                              & pw::view<std::uint8_t>(*mask), 255, 0));
+   @endcode
+ *
+ * The images must be dump-locked by the caller while the expression is evaluated. The functions at the end of the
+ * file wrap the most common operations and dispatch them over the pixel type with core::tools::dispatcher.
+ */
+namespace sight::filter::image::pixelwise
+{
+
+/// Below this number of elements, expressions are evaluated on the calling thread only.
+static constexpr std::int64_t PARALLEL_THRESHOLD = 1 << 16;
+
+/// Tag inherited by all the nodes of an expression.
+struct expression_tag
+{
+};
+
+template<typename T>
+concept expression = std::derived_from<std::remove_cvref_t<T>, expression_tag>;
+
+template<typename T>
+concept operand = expression<T> || std::is_arithmetic_v<std::remove_cvref_t<T> >;
+
+/// Leaf reading the elements of a buffer.
+template<typename T>
+struct view : expression_tag
+{
+    using value_t = T;
+
+    explicit view(const T* _data) :
+        m_data(_data)
+    {
+    }
+
+    /// Views the buffer of an image, which must be dump-locked.
+    explicit view(const data::image& _image) :
+        m_data(static_cast<const T*>(_image.buffer()))
+    {
+        SIGHT_ASSERT(
+            "The image type '" << _image.type().name() << "' does not match the view type '"
+            << core::type::get<T>().name() << "'",
+            _image.type() == core::type::get<T>()
+        );
+    }
+
+    //------------------------------------------------------------------------------
+
+    constexpr T operator[](std::size_t _i) const
+    {
+        return m_data[_i];
+    }
+
+    const T* m_data;
+};
+
+/// Leaf holding a scalar value, broadcast over all elements.
+template<typename T>
+struct constant : expression_tag
+{
+    using value_t = T;
+
+    explicit constexpr constant(T _value) :
+        m_value(_value)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    constexpr T operator[](std::size_t /*_i*/) const
+    {
+        return m_value;
+    }
+
+    T m_value;
+};
+
+/// Node applying a unary operator on an expression.
+template<typename E, typename OP>
+struct unary_expr : expression_tag
+{
+    using value_t = decltype(std::declval<OP>()(std::declval<typename E::value_t>()));
+
+    constexpr unary_expr(E _expr, OP _op) :
+        m_expr(std::move(_expr)),
+        m_op(std::move(_op))
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    constexpr value_t operator[](std::size_t _i) const
+    {
+        return m_op(m_expr[_i]);
+    }
+
+    E m_expr;
+    OP m_op;
+};
+
+/// Node applying a binary operator on two expressions.
+template<typename L, typename R, typename OP>
+struct binary_expr : expression_tag
+{
+    using value_t = decltype(OP {}(std::declval<typename L::value_t>(), std::declval<typename R::value_t>()));
+
+    constexpr binary_expr(L _lhs, R _rhs) :
+        m_lhs(std::move(_lhs)),
+        m_rhs(std::move(_rhs))
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    constexpr value_t operator[](std::size_t _i) const
+    {
+        return OP {}(m_lhs[_i], m_rhs[_i]);
+    }
+
+    L m_lhs;
+    R m_rhs;
+};
+
+/// Node choosing between two expressions according to a condition, without branching.
+template<typename C, typename T, typename F>
+struct select_expr : expression_tag
+{
+    using value_t = std::common_type_t<typename T::value_t, typename F::value_t>;
+
+    constexpr select_expr(C _cond, T _true, F _false) :
+        m_cond(std::move(_cond)),
+        m_true(std::move(_true)),
+        m_false(std::move(_false))
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    constexpr value_t operator[](std::size_t _i) const
+    {
+        // Both branches are evaluated unconditionally so that the compiler can turn the choice into a blend.
+        const auto on_true  = static_cast<value_t>(m_true[_i]);
+        const auto on_false = static_cast<value_t>(m_false[_i]);
+        return static_cast<bool>(m_cond[_i]) ? on_true : on_false;
+    }
+
+    C m_cond;
+    T m_true;
+    F m_false;
+};
+
+namespace detail
+{
+
+//------------------------------------------------------------------------------
+
+template<operand T>
+constexpr auto as_expression(T&& _value)
+{
+    if constexpr(expression<T>)
+    {
+        return std::remove_cvref_t<T>(std::forward<T>(_value));
+    }
+    else
+    {
+        return constant<std::remove_cvref_t<T> >(_value);
+    }
+}
+
+template<typename T>
+using expression_t = decltype(as_expression(std::declval<T>()));
+
+/// Combines two values with '&', as a logical 'and' as soon as one of them is a boolean (i.e. a mask).
+struct bit_and
+{
+    //------------------------------------------------------------------------------
+
+    template<typename A, typename B>
+    constexpr auto operator()(A _a, B _b) const
+    {
+        if constexpr(std::is_same_v<A, bool> || std::is_same_v<B, bool>)
+        {
+            return static_cast<bool>((_a != A(0)) & (_b != B(0)));
+        }
+        else
+        {
+            return _a & _b;
+        }
+    }
+};
+
+/// Combines two values with '|', as a logical 'or' as soon as one of them is a boolean (i.e. a mask).
+struct bit_or
+{
+    //------------------------------------------------------------------------------
+
+    template<typename A, typename B>
+    constexpr auto operator()(A _a, B _b) const
+    {
+        if constexpr(std::is_same_v<A, bool> || std::is_same_v<B, bool>)
+        {
+            return static_cast<bool>((_a != A(0)) | (_b != B(0)));
+        }
+        else
+        {
+            return _a | _b;
+        }
+    }
+};
+
+/// Converts a value to T, saturating it to the range of T.
+template<typename T>
+struct saturate
+{
+    //------------------------------------------------------------------------------
+
+    template<typename V>
+    constexpr T operator()(V _value) const
+    {
+        if constexpr(std::is_floating_point_v<T> || std::is_same_v<V, bool>)
+        {
+            return static_cast<T>(_value);
+        }
+        else if constexpr(std::is_floating_point_v<V>)
+        {
+            constexpr auto lowest = static_cast<V>(std::numeric_limits<T>::lowest());
+            constexpr auto max    = static_cast<V>(std::numeric_limits<T>::max());
+            return _value <= lowest ? std::numeric_limits<T>::lowest()
+                                    : (_value >= max ? std::numeric_limits<T>::max() : static_cast<T>(_value));
+        }
+        else
+        {
+            return std::cmp_less(_value, std::numeric_limits<T>::lowest()) ? std::numeric_limits<T>::lowest()
+                                                                           : (std::cmp_greater(
+                                                                                  _value,
+                                                                                  std::numeric_limits<T>::max()
+                                                                              ) ? std::numeric_limits<T>::max()
+                                                                                : static_cast<T>(_value));
+        }
+    }
+};
+
+/// Reads a value in a 256 entries table, used to remap 8 bits images.
+struct lookup
+{
+    //------------------------------------------------------------------------------
+
+    constexpr std::uint8_t operator()(std::uint8_t _value) const
+    {
+        return (*m_table)[_value];
+    }
+
+    const std::array<std::uint8_t, 256>* m_table;
+};
+
+} // namespace detail
+
+// Operators are only enabled when at least one of the operands is an expression, so they never hijack the arithmetic
+// on plain values.
+#define SIGHT_PIXELWISE_BINARY_OPERATOR(op, functor) \
+        template<operand L, operand R> \
+        requires(expression<L>|| expression<R>) \
+        constexpr auto operator op(L && _lhs, R && _rhs) \
+        { \
+            return binary_expr<detail::expression_t<L>, detail::expression_t<R>, functor>( \
+                detail::as_expression(std::forward<L>(_lhs)), \
+                detail::as_expression(std::forward<R>(_rhs)) \
+            ); \
+        }
+
+SIGHT_PIXELWISE_BINARY_OPERATOR(+, std::plus<>)
+SIGHT_PIXELWISE_BINARY_OPERATOR(-, std::minus<>)
+SIGHT_PIXELWISE_BINARY_OPERATOR(*, std::multiplies<>)
+SIGHT_PIXELWISE_BINARY_OPERATOR(/, std::divides<>)
+SIGHT_PIXELWISE_BINARY_OPERATOR(<, std::less<>)
+SIGHT_PIXELWISE_BINARY_OPERATOR(<=, std::less_equal<>)
+SIGHT_PIXELWISE_BINARY_OPERATOR(>, std::greater<>)
+SIGHT_PIXELWISE_BINARY_OPERATOR(>=, std::greater_equal<>)
+SIGHT_PIXELWISE_BINARY_OPERATOR(==, std::equal_to<>)
+SIGHT_PIXELWISE_BINARY_OPERATOR(!=, std::not_equal_to<>)
+SIGHT_PIXELWISE_BINARY_OPERATOR(&, detail::bit_and)
+SIGHT_PIXELWISE_BINARY_OPERATOR(|, detail::bit_or)
+
+#undef SIGHT_PIXELWISE_BINARY_OPERATOR
+
+/// Returns _true where _cond is non-zero, _false elsewhere.
+template<operand C, operand T, operand F>
+constexpr auto select(C&& _cond, T&& _true, F&& _false)
+{
+    return select_expr<detail::expression_t<C>, detail::expression_t<T>, detail::expression_t<F> >(
+        detail::as_expression(std::forward<C>(_cond)),
+        detail::as_expression(std::forward<T>(_true)),
+        detail::as_expression(std::forward<F>(_false))
+    );
+}
+
+/// Converts an expression to T, saturating the values that do not fit into T.
+template<typename T, operand E>
+constexpr auto cast(E&& _expr)
+{
+    return unary_expr<detail::expression_t<E>, detail::saturate<T> >(
+        detail::as_expression(std::forward<E>(_expr)),
+        detail::saturate<T> {});
+}
+
+/// Clamps an expression in [_min, _max].
+template<operand E, typename T>
+constexpr auto clamp(E&& _expr, T _min, T _max)
+{
+    auto expr = detail::as_expression(std::forward<E>(_expr));
+    return select(expr < _min, _min, select(expr > _max, _max, expr));
+}
+
+/// Remaps an 8 bits expression through a table. The table must outlive the expression.
+template<operand E>
+constexpr auto lookup(E&& _expr, const std::array<std::uint8_t, 256>& _table)
+{
+    return unary_expr<detail::expression_t<E>, detail::lookup>(
+        detail::as_expression(std::forward<E>(_expr)),
+        detail::lookup {&_table});
+}
+
+/**
+ * @brief Evaluates an expression on _size elements and writes the result into _out.
+ *
+ * The loop is vectorised and, above PARALLEL_THRESHOLD elements, split across the OpenMP threads.
+ */
+template<typename OUT, expression E>
+void evaluate(const E& _expr, OUT* _out, std::size_t _size)
+{
+    const auto size = static_cast<std::int64_t>(_size);
+
+    // Each thread works on its own copy of the expression, otherwise the compiler must assume that writing into a byte
+    // buffer may modify the pointers held by the views, which prevents the vectorisation.
+    const E expr = _expr;
+
+    // NOLINTNEXTLINE(clang-diagnostic-unknown-pragmas)
+    #pragma omp parallel for simd schedule(static) firstprivate(expr) if(size > PARALLEL_THRESHOLD)
+    for(std::int64_t i = 0 ; i < size ; ++i)
+    {
+        _out[i] = static_cast<OUT>(expr[static_cast<std::size_t>(i)]);
+    }
+}
+
+/// Evaluates an expression into the buffer of an image, which must be allocated and dump-locked.
+template<typename OUT, expression E>
+void assign(data::image& _out, const E& _expr)
+{
+    SIGHT_ASSERT(
+        "The image type '" << _out.type().name() << "' does not match the output type '"
+        << core::type::get<OUT>().name() << "'",
+        _out.type() == core::type::get<OUT>()
+    );
+    evaluate(_expr, static_cast<OUT*>(_out.buffer()), _out.num_elements());
+}
+
+/**
+ * @name Image level operations.
+ *
+ * These functions copy the information of the first input into the output (size, spacing, origin, ...), allocate the
+ * output buffer and compute the result in a single pass. The inputs must have the same number of elements.
+ * @{
+ */
+
+/// Sets the pixels lower than _threshold to 0, and the others to the maximum value of the image type.
+SIGHT_FILTER_IMAGE_API void threshold(const data::image::csptr& _in, const data::image::sptr& _out, double _threshold);
+
+/// Computes _a - _b. The result keeps the type of _a, wrapping around like in a C++ cast.
+SIGHT_FILTER_IMAGE_API void subtract(
+    const data::image::csptr& _a,
+    const data::image::csptr& _b,
+    const data::image::sptr& _out
+);
+
+/// Keeps the pixels of _in where _mask is non-zero and sets the others to 0. _mask must be of an integer type.
+SIGHT_FILTER_IMAGE_API void mask(
+    const data::image::csptr& _in,
+    const data::image::csptr& _mask,
+    const data::image::sptr& _out
+);
+
+/// Clamps the pixels of _in between _min and _max.
+SIGHT_FILTER_IMAGE_API void clamp(const data::image::csptr& _in, const data::image::sptr& _out, double _min, double _max);
+
+/// Converts _in to the given type, saturating the values out of the range of the new type.
+SIGHT_FILTER_IMAGE_API void cast(const data::image::csptr& _in, const data::image::sptr& _out, core::type _type);
+
+/// Converts an 8 bits label image into a binary mask: 255 where the label belongs to _labels, 0 elsewhere.
+SIGHT_FILTER_IMAGE_API void labels_to_mask(
+    const data::image::csptr& _labels,
+    const data::image::sptr& _out,
+    const std::bitset<256>& _label_set
+);
+
+/// @}
+
+} // namespace sight::filter::image::pixelwise
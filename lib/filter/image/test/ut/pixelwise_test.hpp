@@ -0,0 +1,63 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::filter::image::ut
+{
+
+/**
+ * @brief Tests the element-wise image kernels.
+ */
+class pixelwise_test : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(pixelwise_test);
+CPPUNIT_TEST(expression_test);
+CPPUNIT_TEST(threshold_test);
+CPPUNIT_TEST(subtract_test);
+CPPUNIT_TEST(mask_test);
+CPPUNIT_TEST(clamp_test);
+CPPUNIT_TEST(cast_test);
+CPPUNIT_TEST(labels_to_mask_test);
+CPPUNIT_TEST(benchmark_threshold);
+CPPUNIT_TEST(benchmark_fused_expression);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // interface
+    void setUp() override;
+    void tearDown() override;
+
+    static void expression_test();
+    static void threshold_test();
+    static void subtract_test();
+    static void mask_test();
+    static void clamp_test();
+    static void cast_test();
+    static void labels_to_mask_test();
+    static void benchmark_threshold();
+    static void benchmark_fused_expression();
+};
+
+} // namespace sight::filter::image::ut
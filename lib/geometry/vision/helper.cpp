@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2017-2023 IRCAD France
+ * Copyright (C) 2017-2025 IRCAD France
  * Copyright (C) 2017-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -297,15 +297,9 @@ void calibrate_pointing_tool(
 
 //-----------------------------------------------------------------------------
 
-data::point_list::sptr detect_chessboard(
-    const cv::Mat& _img,
-    std::size_t _x_dim,
-    std::size_t _y_dim,
-    float _scale
-)
+/// Converts an 8bit RGB, RGBA or grayscale image to grayscale
+static cv::Mat to_gray(const cv::Mat& _img)
 {
-    data::point_list::sptr pointlist;
-
     SIGHT_ASSERT("Expected 8bit pixel components, this image has: " << 8 * _img.elemSize1(), _img.elemSize1() == 1);
 
     // Ensure that we have a true depth-less 2D image.
@@ -323,8 +317,21 @@ data::point_list::sptr detect_chessboard(
         cv::cvtColor(img2d, gray_img, cvt_method);
     }
 
+    return gray_img;
+}
+
+//-----------------------------------------------------------------------------
+
+/// Searches the chessboard corners in a downscaled image, returns them in the coordinates of the given image
+static bool find_corners(
+    const cv::Mat& _gray_img,
+    std::size_t _x_dim,
+    std::size_t _y_dim,
+    float _scale,
+    std::vector<cv::Point2f>& _corners
+)
+{
     const cv::Size board_size(static_cast<int>(_x_dim) - 1, static_cast<int>(_y_dim) - 1);
-    std::vector<cv::Point2f> corners;
 
     const int flags = cv::CALIB_CB_ADAPTIVE_THRESH | cv::CALIB_CB_NORMALIZE_IMAGE | cv::CALIB_CB_FILTER_QUADS
                       | cv::CALIB_CB_FAST_CHECK;
@@ -333,36 +340,122 @@ data::point_list::sptr detect_chessboard(
 
     if(_scale < 1.F)
     {
-        cv::resize(gray_img, detection_image, cv::Size(), _scale, _scale);
+        cv::resize(_gray_img, detection_image, cv::Size(), _scale, _scale);
     }
     else
     {
-        detection_image = gray_img;
+        detection_image = _gray_img;
     }
 
-    const bool pattern_was_found = cv::findChessboardCorners(detection_image, board_size, corners, flags);
+    const bool pattern_was_found = cv::findChessboardCorners(detection_image, board_size, _corners, flags);
 
     if(pattern_was_found)
     {
         // Rescale points to get their coordinates in the full scale image.
         const auto rescale = [_scale](cv::Point2f& _pt){_pt = _pt / _scale;};
-        std::ranges::for_each(corners, rescale);
+        std::ranges::for_each(_corners, rescale);
+    }
 
-        // Refine points coordinates in the full scale image.
-        cv::TermCriteria term(cv::TermCriteria::MAX_ITER + cv::TermCriteria::EPS, 30, 0.1);
-        cv::cornerSubPix(gray_img, corners, cv::Size(5, 5), cv::Size(-1, -1), term);
+    return pattern_was_found;
+}
 
-        pointlist = std::make_shared<data::point_list>();
-        data::point_list::container_t& points = pointlist->get_points();
-        points.reserve(corners.size());
+//-----------------------------------------------------------------------------
 
-        const auto cv2_sight_pt = [](const cv::Point2f& _p){return std::make_shared<data::point>(_p.x, _p.y);};
-        std::ranges::transform(corners, std::back_inserter(points), cv2_sight_pt);
-    }
+/// Refines the corners coordinates in the full scale image and converts them to a point list
+static data::point_list::sptr refine_corners(const cv::Mat& _gray_img, std::vector<cv::Point2f>& _corners)
+{
+    cv::TermCriteria term(cv::TermCriteria::MAX_ITER + cv::TermCriteria::EPS, 30, 0.1);
+    cv::cornerSubPix(_gray_img, _corners, cv::Size(5, 5), cv::Size(-1, -1), term);
+
+    auto pointlist = std::make_shared<data::point_list>();
+    data::point_list::container_t& points = pointlist->get_points();
+    points.reserve(_corners.size());
+
+    const auto cv2_sight_pt = [](const cv::Point2f& _p){return std::make_shared<data::point>(_p.x, _p.y);};
+    std::ranges::transform(_corners, std::back_inserter(points), cv2_sight_pt);
 
     return pointlist;
 }
 
+//-----------------------------------------------------------------------------
+
+data::point_list::sptr detect_chessboard(
+    const cv::Mat& _img,
+    std::size_t _x_dim,
+    std::size_t _y_dim,
+    float _scale
+)
+{
+    const cv::Mat gray_img = to_gray(_img);
+
+    std::vector<cv::Point2f> corners;
+    if(find_corners(gray_img, _x_dim, _y_dim, _scale, corners))
+    {
+        return refine_corners(gray_img, corners);
+    }
+
+    return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+data::point_list::sptr detect_chessboard(
+    const cv::Mat& _img,
+    std::size_t _x_dim,
+    std::size_t _y_dim,
+    cv::Rect& _roi,
+    int _coarse_size
+)
+{
+    SIGHT_ASSERT("The coarse search size must be positive.", _coarse_size > 0);
+
+    const cv::Mat gray_img = to_gray(_img);
+    const cv::Rect image_rect(0, 0, gray_img.cols, gray_img.rows);
+
+    // Scale which brings the largest side of an area to the coarse search size, without upscaling
+    const auto coarse_scale =
+        [_coarse_size](const cv::Size& _size)
+        {
+            const auto largest_side = static_cast<float>(std::max(_size.width, _size.height));
+            return std::min(1.F, static_cast<float>(_coarse_size) / largest_side);
+        };
+
+    std::vector<cv::Point2f> corners;
+    bool found = false;
+
+    // Look first around the last known location, which is much smaller than the whole image
+    const cv::Rect search = _roi & image_rect;
+    if(!search.empty())
+    {
+        found = find_corners(gray_img(search), _x_dim, _y_dim, coarse_scale(search.size()), corners);
+        if(found)
+        {
+            const cv::Point2f offset(search.tl());
+            std::ranges::for_each(corners, [&offset](cv::Point2f& _pt){_pt += offset;});
+        }
+    }
+
+    // Fall back to the whole image if the chessboard left the area
+    if(!found && search != image_rect)
+    {
+        found = find_corners(gray_img, _x_dim, _y_dim, coarse_scale(image_rect.size()), corners);
+    }
+
+    if(!found)
+    {
+        _roi = cv::Rect();
+        return nullptr;
+    }
+
+    // Next search area: bounding box of the corners, enlarged to include the board border and its motion
+    const cv::Rect bounds = cv::boundingRect(corners);
+    const int margin      = std::max(bounds.width, bounds.height) / 2;
+    _roi = cv::Rect(bounds.x - margin, bounds.y - margin, bounds.width + 2 * margin, bounds.height + 2 * margin)
+           & image_rect;
+
+    return refine_corners(gray_img, corners);
+}
+
 // ----------------------------------------------------------------------------
 
 } // namespace sight::geometry::vision::helper
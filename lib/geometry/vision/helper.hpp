@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2017-2024 IRCAD France
+ * Copyright (C) 2017-2025 IRCAD France
  * Copyright (C) 2017-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -133,4 +133,29 @@ SIGHT_GEOMETRY_VISION_API sight::data::point_list::sptr detect_chessboard(
     float _scale
 );
 
+/**
+ * @brief Tries to detect a chessboard around its last known location, for the successive frames of a video.
+ *
+ * The search is first run in the given area, then in the whole image if the chessboard is not found there. In both
+ * cases, the corners are searched in an image downscaled to the coarse size, then refined in the full scale image.
+ *
+ * @param[in] _img image in which to search for a chessboard.
+ * @param[in] _x_dim Width of the chessboard in number of tiles.
+ * @param[in] _y_dim Height of the chessboard in number of tiles.
+ * @param[in,out] _roi last known area of the chessboard, empty if unknown. Updated with the area to search in the
+ * next frame, or emptied if the detection failed.
+ * @param[in] _coarse_size largest side, in pixels, of the downscaled image used for the coarse search.
+ *
+ * @pre _img must have 8bit RGB, RGBA or grayscale pixels.
+ *
+ * @return List of detected chessboard points. nullptr if detection failed.
+ */
+SIGHT_GEOMETRY_VISION_API sight::data::point_list::sptr detect_chessboard(
+    const cv::Mat& _img,
+    std::size_t _x_dim,
+    std::size_t _y_dim,
+    cv::Rect& _roi,
+    int _coarse_size = 640
+);
+
 } // namespace sight::geometry::vision::helper
@@ -0,0 +1,682 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "incremental_calibration.hpp"
+
+#include "geometry/vision/helper.hpp"
+
+#include <core/exceptionmacros.hpp>
+#include <core/spy_log.hpp>
+
+#include <opencv2/calib3d.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+namespace sight::geometry::vision
+{
+
+/// Minimum number of views kept by the outlier rejection
+static constexpr std::size_t MIN_VIEWS = 3;
+
+/// Views with an error below this value, in pixels, are never rejected
+static constexpr double MIN_OUTLIER_ERROR = 0.5;
+
+//------------------------------------------------------------------------------
+
+/// Returns the error above which a view is rejected, given the errors of the inlier views
+static double outlier_threshold(std::vector<double> _errors, double _factor)
+{
+    if(_factor <= 0. || _errors.size() < MIN_VIEWS)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const auto median = _errors.begin() + static_cast<std::ptrdiff_t>(_errors.size() / 2);
+    std::nth_element(_errors.begin(), median, _errors.end());
+
+    return std::max(_factor * *median, MIN_OUTLIER_ERROR);
+}
+
+//------------------------------------------------------------------------------
+
+/// Rejects the candidates above the threshold, the worst first, as long as enough inliers remain
+template<typename ERROR_FUNC, typename REJECT_FUNC>
+static std::size_t reject_outliers(
+    std::vector<std::size_t> _candidates,
+    std::size_t _inliers,
+    double _threshold,
+    ERROR_FUNC _error,
+    REJECT_FUNC _reject
+)
+{
+    std::ranges::sort(_candidates, [&_error](std::size_t _a, std::size_t _b){return _error(_a) > _error(_b);});
+
+    std::size_t rejected = 0;
+    for(const std::size_t candidate : _candidates)
+    {
+        if(_error(candidate) <= _threshold || _inliers - rejected <= MIN_VIEWS)
+        {
+            break;
+        }
+
+        _reject(candidate);
+        ++rejected;
+    }
+
+    return rejected;
+}
+
+//------------------------------------------------------------------------------
+
+/// Converts a point list to OpenCV points
+static std::vector<cv::Point2f> to_cv(const data::point_list& _point_list)
+{
+    std::vector<cv::Point2f> result;
+    result.reserve(_point_list.get_points().size());
+
+    for(const auto& point : _point_list.get_points())
+    {
+        SIGHT_ASSERT("point is null", point);
+        result.emplace_back(static_cast<float>((*point)[0]), static_cast<float>((*point)[1]));
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration::set_board(std::size_t _width, std::size_t _height, double _square_size)
+{
+    SIGHT_THROW_IF("The chessboard must have at least 2 squares in each dimension.", _width < 2 || _height < 2);
+
+    std::vector<cv::Point3f> points;
+    points.reserve((_width - 1) * (_height - 1));
+
+    for(std::size_t y = 0 ; y < _height - 1 ; ++y)
+    {
+        for(std::size_t x = 0 ; x < _width - 1 ; ++x)
+        {
+            points.emplace_back(
+                static_cast<float>(static_cast<double>(x) * _square_size),
+                static_cast<float>(static_cast<double>(y) * _square_size),
+                0.F
+            );
+        }
+    }
+
+    if(points != m_object_points)
+    {
+        m_object_points = std::move(points);
+        m_solution.reset();
+        this->restore_views();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration::set_outlier_factor(double _factor)
+{
+    if(_factor != m_outlier_factor)
+    {
+        m_outlier_factor = _factor;
+        m_solution.reset();
+        this->restore_views();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t incremental_calibration::update_views(const std::list<data::point_list::csptr>& _point_lists)
+{
+    std::vector<view_t> views;
+    views.reserve(_point_lists.size());
+
+    std::size_t added = 0;
+    for(const auto& point_list : _point_lists)
+    {
+        SIGHT_ASSERT("point list is null", point_list);
+
+        const auto it = std::ranges::find_if(
+            m_views,
+            [&point_list](const view_t& _view)
+            {
+                return _view.source == point_list && _view.source_modified == point_list->last_modified();
+            });
+
+        if(it != m_views.end())
+        {
+            views.push_back(std::move(*it));
+        }
+        else
+        {
+            view_t view {
+                .source          = point_list,
+                .source_modified = point_list->last_modified(),
+                .image_points    = to_cv(*point_list)
+            };
+            view.inlier = view.image_points.size() == m_object_points.size();
+            views.push_back(std::move(view));
+            ++added;
+        }
+    }
+
+    m_views = std::move(views);
+    return added;
+}
+
+//------------------------------------------------------------------------------
+
+incremental_calibration::intrinsic_t incremental_calibration::calibrate(const cv::Size& _image_size)
+{
+    if(_image_size != m_image_size)
+    {
+        m_image_size = _image_size;
+        m_solution.reset();
+        this->restore_views();
+    }
+
+    const bool warm_start = m_solution.has_value();
+    const auto error      = [this](std::size_t _i){return m_views[_i].error;};
+    const auto reject     = [this](std::size_t _i){m_views[_i].inlier = false;};
+
+    if(warm_start)
+    {
+        // New views are checked against the previous solution, so that an outlier does not disturb the calibration
+        std::vector<std::size_t> new_views;
+        std::vector<double> known_errors;
+        for(const std::size_t i : this->inliers())
+        {
+            if(m_views[i].rvec.empty())
+            {
+                new_views.push_back(i);
+            }
+            else
+            {
+                known_errors.push_back(m_views[i].error);
+            }
+        }
+
+        if(!new_views.empty())
+        {
+            this->evaluate(new_views);
+
+            const double threshold = outlier_threshold(known_errors, m_outlier_factor);
+            reject_outliers(new_views, this->inliers().size(), threshold, error, reject);
+        }
+    }
+
+    this->solve();
+
+    const auto indices = this->inliers();
+    this->evaluate(indices);
+
+    std::vector<double> errors;
+    std::ranges::transform(indices, std::back_inserter(errors), error);
+
+    if(reject_outliers(indices, indices.size(), outlier_threshold(errors, m_outlier_factor), error, reject) > 0)
+    {
+        this->solve();
+        this->evaluate(this->inliers());
+    }
+
+    intrinsic_t result = *m_solution;
+    result.rejected   = static_cast<std::size_t>(std::ranges::count(m_views, false, &view_t::inlier));
+    result.warm_start = warm_start;
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration::reset()
+{
+    m_views.clear();
+    m_solution.reset();
+    m_image_size = cv::Size();
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration::solve()
+{
+    const auto indices = this->inliers();
+    SIGHT_THROW_IF("No view can be used to calibrate the camera.", indices.empty());
+
+    // Headers on the cached points, nothing is copied
+    const std::vector<cv::Mat> object_points(indices.size(), cv::Mat(m_object_points));
+    std::vector<cv::Mat> image_points;
+    image_points.reserve(indices.size());
+    for(const std::size_t i : indices)
+    {
+        image_points.emplace_back(m_views[i].image_points);
+    }
+
+    cv::Mat camera_matrix;
+    cv::Mat dist_coeffs;
+    int flags = 0;
+
+    if(m_solution)
+    {
+        camera_matrix = m_solution->camera_matrix.clone();
+        dist_coeffs   = m_solution->dist_coeffs.clone();
+        flags         = cv::CALIB_USE_INTRINSIC_GUESS;
+    }
+
+    std::vector<cv::Mat> rvecs;
+    std::vector<cv::Mat> tvecs;
+    const double error = cv::calibrateCamera(
+        object_points,
+        image_points,
+        m_image_size,
+        camera_matrix,
+        dist_coeffs,
+        rvecs,
+        tvecs,
+        flags
+    );
+
+    for(std::size_t k = 0 ; k < indices.size() ; ++k)
+    {
+        m_views[indices[k]].rvec = rvecs[k];
+        m_views[indices[k]].tvec = tvecs[k];
+    }
+
+    m_solution = intrinsic_t {.camera_matrix = camera_matrix, .dist_coeffs = dist_coeffs, .error = error};
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration::evaluate(const std::vector<std::size_t>& _indices)
+{
+    SIGHT_ASSERT("The camera is not calibrated.", m_solution);
+
+    const cv::Mat& camera_matrix = m_solution->camera_matrix;
+    const cv::Mat& dist_coeffs   = m_solution->dist_coeffs;
+
+    cv::parallel_for_(
+        cv::Range(0, static_cast<int>(_indices.size())),
+        [&](const cv::Range& _range)
+        {
+            for(int r = _range.start ; r < _range.end ; ++r)
+            {
+                view_t& view = m_views[_indices[static_cast<std::size_t>(r)]];
+
+                if(view.rvec.empty())
+                {
+                    cv::solvePnP(m_object_points, view.image_points, camera_matrix, dist_coeffs, view.rvec, view.tvec);
+                }
+
+                view.error = helper::compute_reprojection_error(
+                    m_object_points,
+                    view.image_points,
+                    view.rvec,
+                    view.tvec,
+                    camera_matrix,
+                    dist_coeffs
+                ).first;
+            }
+        });
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<std::size_t> incremental_calibration::inliers() const
+{
+    std::vector<std::size_t> result;
+    for(std::size_t i = 0 ; i < m_views.size() ; ++i)
+    {
+        if(m_views[i].inlier)
+        {
+            result.push_back(i);
+        }
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration::restore_views()
+{
+    for(auto& view : m_views)
+    {
+        view.inlier = view.image_points.size() == m_object_points.size();
+        view.rvec.release();
+        view.tvec.release();
+        view.error = 0.;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_stereo_calibration::set_board(std::size_t _width, std::size_t _height, double _square_size)
+{
+    const auto previous = m_first.m_object_points;
+
+    m_first.set_board(_width, _height, _square_size);
+    m_second.set_board(_width, _height, _square_size);
+
+    if(previous != m_first.m_object_points)
+    {
+        m_solution.reset();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_stereo_calibration::set_outlier_factor(double _factor)
+{
+    if(_factor != m_first.m_outlier_factor)
+    {
+        m_first.set_outlier_factor(_factor);
+        m_second.set_outlier_factor(_factor);
+        m_solution.reset();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t incremental_stereo_calibration::update_views(
+    const std::list<data::point_list::csptr>& _first,
+    const std::list<data::point_list::csptr>& _second
+)
+{
+    SIGHT_ERROR_IF("The two cameras do not have the same number of views.", _first.size() != _second.size());
+
+    const std::size_t added_first  = m_first.update_views(_first);
+    const std::size_t added_second = m_second.update_views(_second);
+
+    return std::max(added_first, added_second);
+}
+
+//------------------------------------------------------------------------------
+
+incremental_stereo_calibration::extrinsic_t incremental_stereo_calibration::calibrate(
+    const cv::Mat& _camera_matrix1,
+    const cv::Mat& _dist_coeffs1,
+    const cv::Mat& _camera_matrix2,
+    const cv::Mat& _dist_coeffs2,
+    const cv::Size& _image_size
+)
+{
+    std::vector<cv::Mat> intrinsics(4);
+    _camera_matrix1.convertTo(intrinsics[0], CV_64F);
+    _dist_coeffs1.reshape(1, 1).convertTo(intrinsics[1], CV_64F);
+    _camera_matrix2.convertTo(intrinsics[2], CV_64F);
+    _dist_coeffs2.reshape(1, 1).convertTo(intrinsics[3], CV_64F);
+
+    const bool same_intrinsics = m_intrinsics.size() == intrinsics.size()
+                                 && std::ranges::equal(
+        m_intrinsics,
+        intrinsics,
+        [](const cv::Mat& _a, const cv::Mat& _b)
+        {
+            return _a.size() == _b.size() && cv::norm(_a, _b, cv::NORM_INF) == 0.;
+        });
+
+    if(_image_size != m_image_size || !same_intrinsics)
+    {
+        m_image_size = _image_size;
+        m_intrinsics = std::move(intrinsics);
+        m_solution.reset();
+        m_first.restore_views();
+        m_second.restore_views();
+    }
+
+    const bool warm_start = m_solution.has_value();
+    const auto error      = [this](std::size_t _i){return this->pair_error(_i);};
+    const auto reject     = [this](std::size_t _i){this->reject(_i);};
+
+    if(warm_start)
+    {
+        // New pairs are checked against the previous solution, so that an outlier does not disturb the calibration
+        std::vector<std::size_t> new_pairs;
+        std::vector<double> known_errors;
+        for(const std::size_t i : this->inliers())
+        {
+            if(m_first.m_views[i].rvec.empty())
+            {
+                new_pairs.push_back(i);
+            }
+            else
+            {
+                known_errors.push_back(this->pair_error(i));
+            }
+        }
+
+        if(!new_pairs.empty())
+        {
+            this->evaluate(new_pairs);
+
+            const double threshold = outlier_threshold(known_errors, m_first.m_outlier_factor);
+            reject_outliers(new_pairs, this->inliers().size(), threshold, error, reject);
+        }
+    }
+
+    this->solve();
+
+    const auto indices = this->inliers();
+    this->evaluate(indices);
+
+    std::vector<double> errors;
+    std::ranges::transform(indices, std::back_inserter(errors), error);
+
+    const double threshold = outlier_threshold(errors, m_first.m_outlier_factor);
+    if(reject_outliers(indices, indices.size(), threshold, error, reject) > 0)
+    {
+        this->solve();
+        this->evaluate(this->inliers());
+    }
+
+    const std::size_t pairs = std::min(m_first.m_views.size(), m_second.m_views.size());
+
+    extrinsic_t result = *m_solution;
+    result.rejected   = pairs - this->inliers().size();
+    result.warm_start = warm_start;
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_stereo_calibration::reset()
+{
+    m_first.reset();
+    m_second.reset();
+    m_intrinsics.clear();
+    m_solution.reset();
+    m_image_size = cv::Size();
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_stereo_calibration::solve()
+{
+    const auto indices = this->inliers();
+    SIGHT_THROW_IF("No pair of views can be used to calibrate the cameras.", indices.empty());
+
+    // Headers on the cached points, nothing is copied
+    const std::vector<cv::Mat> object_points(indices.size(), cv::Mat(m_first.m_object_points));
+    std::vector<cv::Mat> image_points1;
+    std::vector<cv::Mat> image_points2;
+    image_points1.reserve(indices.size());
+    image_points2.reserve(indices.size());
+    for(const std::size_t i : indices)
+    {
+        image_points1.emplace_back(m_first.m_views[i].image_points);
+        image_points2.emplace_back(m_second.m_views[i].image_points);
+    }
+
+    // The intrinsic parameters are fixed, but OpenCV expects them as input-output arrays
+    cv::Mat camera_matrix1 = m_intrinsics[0].clone();
+    cv::Mat dist_coeffs1   = m_intrinsics[1].clone();
+    cv::Mat camera_matrix2 = m_intrinsics[2].clone();
+    cv::Mat dist_coeffs2   = m_intrinsics[3].clone();
+
+    cv::Mat rotation;
+    cv::Mat translation;
+    cv::Mat essential_matrix;
+    cv::Mat fundamental_matrix;
+    int flags = cv::CALIB_FIX_INTRINSIC;
+
+    if(m_solution)
+    {
+        rotation    = m_solution->rotation.clone();
+        translation = m_solution->translation.clone();
+        flags      |= cv::CALIB_USE_EXTRINSIC_GUESS;
+    }
+
+    const double error = cv::stereoCalibrate(
+        object_points,
+        image_points1,
+        image_points2,
+        camera_matrix1,
+        dist_coeffs1,
+        camera_matrix2,
+        dist_coeffs2,
+        m_image_size,
+        rotation,
+        translation,
+        essential_matrix,
+        fundamental_matrix,
+        flags,
+        cv::TermCriteria(
+            cv::TermCriteria::MAX_ITER + cv::TermCriteria::EPS,
+            100,
+            1e-5
+        )
+    );
+
+    m_solution = extrinsic_t {.rotation = rotation, .translation = translation, .error = error};
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_stereo_calibration::evaluate(const std::vector<std::size_t>& _indices)
+{
+    SIGHT_ASSERT("The cameras are not calibrated.", m_solution);
+
+    const auto& object_points = m_first.m_object_points;
+
+    cv::Mat extrinsic = cv::Mat::eye(4, 4, CV_64F);
+    m_solution->rotation.copyTo(extrinsic(cv::Range(0, 3), cv::Range(0, 3)));
+    m_solution->translation.reshape(1, 3).copyTo(extrinsic(cv::Range(0, 3), cv::Range(3, 4)));
+
+    const auto set_pose =
+        [](incremental_calibration::view_t& _view, const cv::Mat& _pose)
+        {
+            cv::Rodrigues(_pose(cv::Range(0, 3), cv::Range(0, 3)), _view.rvec);
+            _view.tvec = _pose(cv::Range(0, 3), cv::Range(3, 4)).clone();
+        };
+
+    cv::parallel_for_(
+        cv::Range(0, static_cast<int>(_indices.size())),
+        [&](const cv::Range& _range)
+        {
+            for(int r = _range.start ; r < _range.end ; ++r)
+            {
+                const std::size_t i = _indices[static_cast<std::size_t>(r)];
+                auto& first         = m_first.m_views[i];
+                auto& second        = m_second.m_views[i];
+
+                // The pose of the chessboard is refined with its reprojection error in both cameras
+                const cv::Matx44f pose = helper::camera_pose_stereo(
+                    object_points,
+                    m_intrinsics[0],
+                    m_intrinsics[1],
+                    m_intrinsics[2],
+                    m_intrinsics[3],
+                    first.image_points,
+                    second.image_points,
+                    m_solution->rotation,
+                    m_solution->translation
+                );
+
+                cv::Mat pose1;
+                cv::Mat(pose).convertTo(pose1, CV_64F);
+                const cv::Mat pose2 = extrinsic * pose1;
+
+                set_pose(first, pose1);
+                set_pose(second, pose2);
+
+                first.error = helper::compute_reprojection_error(
+                    object_points,
+                    first.image_points,
+                    first.rvec,
+                    first.tvec,
+                    m_intrinsics[0],
+                    m_intrinsics[1]
+                ).first;
+
+                second.error = helper::compute_reprojection_error(
+                    object_points,
+                    second.image_points,
+                    second.rvec,
+                    second.tvec,
+                    m_intrinsics[2],
+                    m_intrinsics[3]
+                ).first;
+            }
+        });
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<std::size_t> incremental_stereo_calibration::inliers() const
+{
+    const std::size_t pairs = std::min(m_first.m_views.size(), m_second.m_views.size());
+
+    std::vector<std::size_t> result;
+    for(std::size_t i = 0 ; i < pairs ; ++i)
+    {
+        if(m_first.m_views[i].inlier && m_second.m_views[i].inlier)
+        {
+            result.push_back(i);
+        }
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+double incremental_stereo_calibration::pair_error(std::size_t _index) const
+{
+    const double first  = m_first.m_views[_index].error;
+    const double second = m_second.m_views[_index].error;
+
+    return std::sqrt((first * first + second * second) / 2.);
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_stereo_calibration::reject(std::size_t _index)
+{
+    m_first.m_views[_index].inlier  = false;
+    m_second.m_views[_index].inlier = false;
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::geometry::vision
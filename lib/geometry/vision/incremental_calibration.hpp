@@ -0,0 +1,268 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/geometry/vision/config.hpp>
+
+#include <data/point_list.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <vector>
+
+namespace sight::geometry::vision
+{
+
+class incremental_stereo_calibration;
+
+/**
+ * @brief Intrinsic calibration of a camera, which reuses its previous results when views are added.
+ *
+ * The calibration is meant to be computed again each time a view is recorded:
+ * - the image points of a view are read once from its point list, and kept as long as the point list is given to
+ *   update_views(),
+ * - once a solution is known, it is used as the initial guess of the next calibration, which converges in much fewer
+ *   iterations,
+ * - the reprojection error of each view is computed in parallel after each calibration,
+ * - if enabled with set_outlier_factor(), views whose error is far above the median error are rejected as outliers,
+ *   and the camera is calibrated again without them. New views are also checked against the previous solution before
+ *   being used.
+ *
+ * A rejected view remains rejected until the board, the image size or the outlier factor changes, or reset() is called.
+ */
+class SIGHT_GEOMETRY_VISION_CLASS_API incremental_calibration final
+{
+public:
+
+    /// View of the chessboard
+    struct view_t
+    {
+        /// Point list the image points were read from
+        data::point_list::csptr source;
+
+        /// Modification counter of the point list when it was read
+        std::uint64_t source_modified {0};
+
+        /// Detected chessboard corners
+        std::vector<cv::Point2f> image_points;
+
+        /// Pose of the chessboard in the camera, empty until the view is evaluated
+        cv::Mat rvec;
+        cv::Mat tvec;
+
+        /// Root mean square reprojection error, in pixels
+        double error {0.};
+
+        /// False if the view was rejected, or if it does not have one point per chessboard corner
+        bool inlier {true};
+    };
+
+    /// Result of the intrinsic calibration
+    struct intrinsic_t
+    {
+        /// Camera matrix (CV_64F, 3x3)
+        cv::Mat camera_matrix;
+
+        /// Distortion coefficients (CV_64F, k1, k2, p1, p2, k3)
+        cv::Mat dist_coeffs;
+
+        /// Root mean square reprojection error of the inlier views, in pixels
+        double error {0.};
+
+        /// Number of views not used in the calibration
+        std::size_t rejected {0};
+
+        /// True if the previous solution was used as initial guess
+        bool warm_start {false};
+    };
+
+    /// Sets the number of squares and the size of a square of the chessboard, resets the calibration if they changed
+    SIGHT_GEOMETRY_VISION_API void set_board(std::size_t _width, std::size_t _height, double _square_size);
+
+    /**
+     * @brief Sets the outlier rejection factor, resets the calibration if it changed.
+     *
+     * A view is rejected when its error is above the median error multiplied by this factor. 0, the default, disables
+     * the rejection.
+     */
+    SIGHT_GEOMETRY_VISION_API void set_outlier_factor(double _factor);
+
+    /**
+     * @brief Synchronizes the views with the given point lists, in the same order.
+     *
+     * Only the point lists not already known, or modified since they were read, are converted.
+     * @return the number of new views
+     */
+    SIGHT_GEOMETRY_VISION_API std::size_t update_views(const std::list<data::point_list::csptr>& _point_lists);
+
+    /**
+     * @brief Calibrates the camera with the current views.
+     *
+     * @param _image_size size of the images the views were detected in
+     * @throw core::exception if there is no usable view
+     */
+    SIGHT_GEOMETRY_VISION_API intrinsic_t calibrate(const cv::Size& _image_size);
+
+    /// Forgets the views and the previous solution
+    SIGHT_GEOMETRY_VISION_API void reset();
+
+    /// Returns the views, with their pose and error after a calibration
+    [[nodiscard]] const std::vector<view_t>& views() const
+    {
+        return m_views;
+    }
+
+    /// Returns the chessboard corners in the board frame
+    [[nodiscard]] const std::vector<cv::Point3f>& object_points() const
+    {
+        return m_object_points;
+    }
+
+private:
+
+    friend class incremental_stereo_calibration;
+
+    /// Runs cv::calibrateCamera() on the inlier views, with the previous solution as guess if there is one
+    void solve();
+
+    /// Computes the pose and the error of the given views with the current solution, in parallel
+    void evaluate(const std::vector<std::size_t>& _indices);
+
+    /// Returns the indices of the inlier views
+    [[nodiscard]] std::vector<std::size_t> inliers() const;
+
+    /// Marks all the views with a point per chessboard corner as inliers
+    void restore_views();
+
+    std::vector<cv::Point3f> m_object_points;
+    std::vector<view_t> m_views;
+    double m_outlier_factor {0.};
+
+    cv::Size m_image_size;
+    std::optional<intrinsic_t> m_solution;
+};
+
+/**
+ * @brief Extrinsic calibration of a stereo rig, which reuses its previous results when views are added.
+ *
+ * Views are cached and rejected like in incremental_calibration, a pair of views being rejected as a whole. The pose
+ * of the chessboard in each pair is refined on both cameras at once, with helper::camera_pose_stereo(). The
+ * intrinsic parameters of both cameras are fixed.
+ */
+class SIGHT_GEOMETRY_VISION_CLASS_API incremental_stereo_calibration final
+{
+public:
+
+    /// Result of the extrinsic calibration
+    struct extrinsic_t
+    {
+        /// Rotation (CV_64F, 3x3) and translation (CV_64F, 3x1) from the first camera to the second one
+        cv::Mat rotation;
+        cv::Mat translation;
+
+        /// Root mean square reprojection error of the inlier views in both cameras, in pixels
+        double error {0.};
+
+        /// Number of pairs of views not used in the calibration
+        std::size_t rejected {0};
+
+        /// True if the previous solution was used as initial guess
+        bool warm_start {false};
+    };
+
+    /// @copydoc incremental_calibration::set_board()
+    SIGHT_GEOMETRY_VISION_API void set_board(std::size_t _width, std::size_t _height, double _square_size);
+
+    /// @copydoc incremental_calibration::set_outlier_factor()
+    SIGHT_GEOMETRY_VISION_API void set_outlier_factor(double _factor);
+
+    /**
+     * @brief Synchronizes the views with the given point lists, the i-th views of both cameras form a pair.
+     * @return the number of new pairs
+     */
+    SIGHT_GEOMETRY_VISION_API std::size_t update_views(
+        const std::list<data::point_list::csptr>& _first,
+        const std::list<data::point_list::csptr>& _second
+    );
+
+    /**
+     * @brief Computes the transform between both cameras with the current views.
+     *
+     * @param _camera_matrix1, _dist_coeffs1 intrinsic parameters of the first camera
+     * @param _camera_matrix2, _dist_coeffs2 intrinsic parameters of the second camera
+     * @param _image_size size of the images the views were detected in
+     * @throw core::exception if there is no usable pair of views
+     */
+    SIGHT_GEOMETRY_VISION_API extrinsic_t calibrate(
+        const cv::Mat& _camera_matrix1,
+        const cv::Mat& _dist_coeffs1,
+        const cv::Mat& _camera_matrix2,
+        const cv::Mat& _dist_coeffs2,
+        const cv::Size& _image_size
+    );
+
+    /// Forgets the views and the previous solution
+    SIGHT_GEOMETRY_VISION_API void reset();
+
+    /// Returns the views of the first camera
+    [[nodiscard]] const std::vector<incremental_calibration::view_t>& first_views() const
+    {
+        return m_first.m_views;
+    }
+
+    /// Returns the views of the second camera
+    [[nodiscard]] const std::vector<incremental_calibration::view_t>& second_views() const
+    {
+        return m_second.m_views;
+    }
+
+private:
+
+    /// Runs cv::stereoCalibrate() on the inlier pairs, with the previous solution as guess if there is one
+    void solve();
+
+    /// Computes the pose and the errors of the given pairs with the current solution, in parallel
+    void evaluate(const std::vector<std::size_t>& _indices);
+
+    /// Returns the indices of the inlier pairs
+    [[nodiscard]] std::vector<std::size_t> inliers() const;
+
+    /// Returns the error of a pair of views
+    [[nodiscard]] double pair_error(std::size_t _index) const;
+
+    /// Rejects a pair of views
+    void reject(std::size_t _index);
+
+    incremental_calibration m_first;
+    incremental_calibration m_second;
+
+    /// Intrinsic parameters used for the previous solution
+    std::vector<cv::Mat> m_intrinsics;
+
+    cv::Size m_image_size;
+    std::optional<extrinsic_t> m_solution;
+};
+
+} // namespace sight::geometry::vision
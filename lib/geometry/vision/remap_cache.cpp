@@ -0,0 +1,251 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "remap_cache.hpp"
+
+#include <core/exceptionmacros.hpp>
+#include <core/spy_log.hpp>
+
+#include <opencv2/calib3d.hpp>
+
+#include <algorithm>
+
+namespace sight::geometry::vision
+{
+
+//------------------------------------------------------------------------------
+
+remap_cache& remap_cache::get()
+{
+    static remap_cache s_cache;
+    return s_cache;
+}
+
+//------------------------------------------------------------------------------
+
+remap_cache::remap_cache(std::size_t _capacity) :
+    m_capacity(std::max(_capacity, std::size_t(1)))
+{
+}
+
+//------------------------------------------------------------------------------
+
+remap_cache::maps_csptr remap_cache::get_maps(const data::camera& _camera, direction _direction)
+{
+    const auto key       = make_key(_camera, _direction);
+    const auto camera_id = _camera.get_id();
+
+    const auto find =
+        [&]() -> maps_csptr
+        {
+            const auto it = std::ranges::find_if(m_entries, [&key](const auto& _e){return _e.key == key;});
+            if(it == m_entries.end())
+            {
+                return nullptr;
+            }
+
+            if(std::ranges::find(it->cameras, camera_id) == it->cameras.end())
+            {
+                it->cameras.push_back(camera_id);
+            }
+
+            // Move the entry in front, it is the most recently used
+            m_entries.splice(m_entries.begin(), m_entries, it);
+            return m_entries.front().tables;
+        };
+
+    {
+        std::unique_lock lock(m_mutex);
+        if(auto cached = find(); cached)
+        {
+            return cached;
+        }
+    }
+
+    // Several threads may compute the same tables at the same time, but this does not block the other cameras
+    auto computed = std::make_shared<const maps>(compute(_camera, _direction));
+
+    std::unique_lock lock(m_mutex);
+    if(auto cached = find(); cached)
+    {
+        return cached;
+    }
+
+    m_entries.push_front({.key = key, .tables = computed, .cameras = {camera_id}});
+    if(m_entries.size() > m_capacity)
+    {
+        m_entries.pop_back();
+    }
+
+    return computed;
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache::invalidate(const data::camera& _camera)
+{
+    const auto camera_id = _camera.get_id();
+
+    std::unique_lock lock(m_mutex);
+    for(auto& entry : m_entries)
+    {
+        // The tables still match the camera, keep them
+        if(entry.key == make_key(_camera, entry.key.dir))
+        {
+            continue;
+        }
+
+        std::erase(entry.cameras, camera_id);
+    }
+
+    // Release the tables no longer used by any camera
+    std::erase_if(m_entries, [](const auto& _e){return _e.cameras.empty();});
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache::clear()
+{
+    std::unique_lock lock(m_mutex);
+    m_entries.clear();
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t remap_cache::size() const
+{
+    std::unique_lock lock(m_mutex);
+    return m_entries.size();
+}
+
+//------------------------------------------------------------------------------
+
+remap_cache::maps remap_cache::compute(const data::camera& _camera, direction _direction)
+{
+    const cv::Size size(static_cast<int>(_camera.get_width()), static_cast<int>(_camera.get_height()));
+    SIGHT_THROW_IF(
+        "Can not compute the remap tables of camera '" << _camera.get_id() << "', its resolution is empty.",
+        size.area() == 0
+    );
+
+    cv::Mat intrinsics = cv::Mat::eye(3, 3, CV_64F);
+    intrinsics.at<double>(0, 0) = _camera.get_fx();
+    intrinsics.at<double>(1, 1) = _camera.get_fy();
+    intrinsics.at<double>(0, 2) = _camera.get_cx();
+    intrinsics.at<double>(1, 2) = _camera.get_cy();
+
+    cv::Mat dist_coefs = cv::Mat::zeros(5, 1, CV_64F);
+    for(std::size_t i = 0 ; i < 5 ; ++i)
+    {
+        dist_coefs.at<double>(static_cast<int>(i)) = _camera.get_distortion_coefficient()[i];
+    }
+
+    maps result;
+
+    if(_direction == direction::distort)
+    {
+        // For each pixel of the distorted image, look for its location in the undistorted one
+        cv::Mat pixel_locations_src = cv::Mat(size, CV_32FC2);
+        for(int i = 0 ; i < size.height ; i++)
+        {
+            for(int j = 0 ; j < size.width ; j++)
+            {
+                pixel_locations_src.at<cv::Point2f>(i, j) = cv::Point2f(float(j), float(i));
+            }
+        }
+
+        // Points are undistorted all at once, the output is in normalized coordinates
+        cv::Mat normalized_locations;
+        cv::undistortPoints(pixel_locations_src.reshape(2, 1), normalized_locations, intrinsics, dist_coefs);
+        normalized_locations = normalized_locations.reshape(2, size.height);
+
+        const auto fx = static_cast<float>(intrinsics.at<double>(0, 0));
+        const auto fy = static_cast<float>(intrinsics.at<double>(1, 1));
+        const auto cx = static_cast<float>(intrinsics.at<double>(0, 2));
+        const auto cy = static_cast<float>(intrinsics.at<double>(1, 2));
+
+        result.x = cv::Mat(size, CV_32FC1);
+        result.y = cv::Mat(size, CV_32FC1);
+        for(int i = 0 ; i < size.height ; i++)
+        {
+            const auto* const src = normalized_locations.ptr<cv::Point2f>(i);
+            auto* const x         = result.x.ptr<float>(i);
+            auto* const y         = result.y.ptr<float>(i);
+            for(int j = 0 ; j < size.width ; j++)
+            {
+                x[j] = src[j].x * fx + cx;
+                y[j] = src[j].y * fy + cy;
+            }
+        }
+    }
+    else
+    {
+        cv::initUndistortRectifyMap(
+            intrinsics,
+            dist_coefs,
+            cv::Mat(),
+            intrinsics,
+            size,
+            CV_32FC1,
+            result.x,
+            result.y
+        );
+    }
+
+    cv::convertMaps(result.x, result.y, result.xy, result.fraction, CV_16SC2);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache::remap(const cv::Mat& _src, cv::Mat& _dst, const maps& _maps, int _interpolation)
+{
+    SIGHT_ASSERT("Image and remap tables sizes mismatch.", _src.size() == _maps.size());
+    SIGHT_ASSERT("Input and output images must not share their buffer.", _src.empty() || _src.data != _dst.data);
+
+    if(_interpolation == cv::INTER_NEAREST)
+    {
+        // The integer part of the fixed-point tables is enough
+        cv::remap(_src, _dst, _maps.xy, cv::noArray(), cv::INTER_NEAREST, cv::BORDER_CONSTANT);
+    }
+    else
+    {
+        cv::remap(_src, _dst, _maps.xy, _maps.fraction, _interpolation, cv::BORDER_CONSTANT);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+remap_cache::key_t remap_cache::make_key(const data::camera& _camera, direction _direction)
+{
+    return {
+        .intrinsic  = {_camera.get_fx(), _camera.get_fy(), _camera.get_cx(), _camera.get_cy()},
+        .distortion = _camera.get_distortion_coefficient(),
+        .width      = _camera.get_width(),
+        .height     = _camera.get_height(),
+        .dir        = _direction
+    };
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::geometry::vision
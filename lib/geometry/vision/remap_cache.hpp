@@ -0,0 +1,174 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/geometry/vision/config.hpp>
+
+#include <data/camera.hpp>
+
+#include <opencv2/core/mat.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sight::geometry::vision
+{
+
+/**
+ * @brief Shared cache of the remap tables used to distort or undistort the images of a camera.
+ *
+ * Computing the tables of a camera costs far more than applying them, especially for the distortion which requires to
+ * undistort every pixel location. The tables are thus computed once and shared by all the services working on the
+ * same camera calibration, whatever the service which asked them first.
+ *
+ * Tables are indexed by the intrinsic parameters, the distortion coefficients and the resolution of the camera, so a
+ * modified calibration never gets the tables of the former one. Services should still call invalidate() when they
+ * receive the modification signals of their camera, so the outdated tables are released at once. Since only outdated
+ * tables are released, several services connected to the same camera do not compute the new tables several times.
+ *
+ * Each entry holds the floating-point tables, required by the GPU or to export them as an image, and the fixed-point
+ * tables used by remap(), which are about twice faster to apply.
+ */
+class SIGHT_GEOMETRY_VISION_CLASS_API remap_cache final
+{
+public:
+
+    /// Transformation described by the tables
+    enum class direction : std::uint8_t
+    {
+        /// Removes the distortion of an image acquired by the camera, like cv::undistort()
+        undistort,
+        /// Applies the distortion of the camera to an ideal pinhole image
+        distort
+    };
+
+    /// Remap tables of a camera
+    struct maps
+    {
+        /// Floating-point tables (CV_32FC1), as given by cv::initUndistortRectifyMap()
+        cv::Mat x;
+        cv::Mat y;
+
+        /// Fixed-point tables (CV_16SC2 and CV_16UC1), as given by cv::convertMaps()
+        cv::Mat xy;
+        cv::Mat fraction;
+
+        /// Returns the resolution of the tables
+        [[nodiscard]] cv::Size size() const
+        {
+            return x.size();
+        }
+    };
+
+    using maps_csptr = std::shared_ptr<const maps>;
+
+    /// Returns the cache shared by the whole application
+    SIGHT_GEOMETRY_VISION_API static remap_cache& get();
+
+    /// Creates an empty cache, holding at most _capacity entries
+    SIGHT_GEOMETRY_VISION_API explicit remap_cache(std::size_t _capacity = 8);
+
+    /**
+     * @brief Returns the tables of a camera, computing them if they are not in the cache yet.
+     *
+     * Concurrent calls are allowed, the computation itself is done outside of the lock.
+     *
+     * @param _camera calibrated camera, with its resolution
+     * @param _direction undistort or distort
+     * @throw core::exception if the resolution of the camera is empty
+     */
+    SIGHT_GEOMETRY_VISION_API maps_csptr get_maps(const data::camera& _camera, direction _direction);
+
+    /// Releases the tables requested for a former calibration of a camera, to be called when the camera is modified
+    SIGHT_GEOMETRY_VISION_API void invalidate(const data::camera& _camera);
+
+    /// Releases all the tables
+    SIGHT_GEOMETRY_VISION_API void clear();
+
+    /// Returns the number of entries in the cache
+    [[nodiscard]] SIGHT_GEOMETRY_VISION_API std::size_t size() const;
+
+    /**
+     * @brief Computes the tables of a camera, without caching them.
+     *
+     * @param _camera calibrated camera, with its resolution
+     * @param _direction undistort or distort
+     * @throw core::exception if the resolution of the camera is empty
+     */
+    SIGHT_GEOMETRY_VISION_API static maps compute(const data::camera& _camera, direction _direction);
+
+    /**
+     * @brief Applies remap tables on an image, with the fixed-point tables.
+     *
+     * @param _src input image, with the resolution of the tables
+     * @param _dst output image, allocated if needed, it must not share its buffer with _src
+     * @param _maps remap tables
+     * @param _interpolation cv::INTER_LINEAR, or cv::INTER_NEAREST which only reads the integer part of the tables
+     */
+    SIGHT_GEOMETRY_VISION_API static void remap(
+        const cv::Mat& _src,
+        cv::Mat& _dst,
+        const maps& _maps,
+        int _interpolation = cv::INTER_LINEAR
+    );
+
+private:
+
+    /// Values of a camera which define its tables
+    struct key_t
+    {
+        std::array<double, 4> intrinsic {};
+        data::camera::dist_array_t distortion {};
+        std::size_t width {0};
+        std::size_t height {0};
+        direction dir {direction::undistort};
+
+        bool operator==(const key_t&) const = default;
+    };
+
+    struct entry_t
+    {
+        key_t key;
+        maps_csptr tables;
+
+        /// Identifiers of the cameras which requested these tables
+        std::vector<std::string> cameras;
+    };
+
+    static key_t make_key(const data::camera& _camera, direction _direction);
+
+    /// Maximum number of entries
+    const std::size_t m_capacity;
+
+    /// Entries, the most recently used first
+    std::list<entry_t> m_entries;
+
+    mutable std::mutex m_mutex;
+};
+
+} // namespace sight::geometry::vision
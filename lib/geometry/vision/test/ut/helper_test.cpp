@@ -22,6 +22,7 @@
 
 #include "helper_test.hpp"
 
+#include <core/profiling.hpp>
 #include <core/tools/random/generator.hpp>
 
 #include <data/point.hpp>
@@ -728,4 +729,88 @@ void helper_test::chessboard_detection_scale_test()
     }
 }
 
+//------------------------------------------------------------------------------
+
+void helper_test::chessboard_tracking_test()
+{
+    const auto calib_data_dir = utest_data::dir() / "sight" / "calibration";
+
+    const cv::Mat chess_rgb0 = read_rgb_image((calib_data_dir / "chessboardRGB0.tiff").string());
+    const cv::Mat chess_rgb1 = read_rgb_image((calib_data_dir / "chessboardRGB1.tiff").string());
+
+    const sight::data::point_list::csptr expected = geometry::vision::helper::detect_chessboard(chess_rgb0, 9, 6, 1.F);
+    CPPUNIT_ASSERT(expected);
+
+    const auto compare_points =
+        [&expected](const sight::data::point_list::csptr& _detected)
+        {
+            CPPUNIT_ASSERT(_detected);
+            CPPUNIT_ASSERT_EQUAL(expected->get_points().size(), _detected->get_points().size());
+
+            for(std::size_t i = 0 ; i < expected->get_points().size() ; ++i)
+            {
+                const auto& expected_coords = (*expected->get_points()[i]);
+                const auto& detected_coords = (*_detected->get_points()[i]);
+
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(expected_coords[0], detected_coords[0], 0.5);
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(expected_coords[1], detected_coords[1], 0.5);
+            }
+        };
+
+    // Unknown location, the coarse search runs on the whole image
+    cv::Rect roi;
+    compare_points(geometry::vision::helper::detect_chessboard(chess_rgb0, 9, 6, roi));
+    CPPUNIT_ASSERT(!roi.empty());
+
+    for(const auto& point : expected->get_points())
+    {
+        CPPUNIT_ASSERT(roi.contains(cv::Point(static_cast<int>((*point)[0]), static_cast<int>((*point)[1]))));
+    }
+
+    // Known location, the coarse search only runs around it
+    compare_points(geometry::vision::helper::detect_chessboard(chess_rgb0, 9, 6, roi));
+    CPPUNIT_ASSERT(!roi.empty());
+
+    // Wrong location, the whole image is searched again
+    roi = cv::Rect(0, 0, 50, 50);
+    compare_points(geometry::vision::helper::detect_chessboard(chess_rgb0, 9, 6, roi));
+    CPPUNIT_ASSERT(roi.width > 50);
+
+    // The chessboard moved
+    CPPUNIT_ASSERT(geometry::vision::helper::detect_chessboard(chess_rgb1, 9, 6, roi));
+    CPPUNIT_ASSERT(!roi.empty());
+
+    // No chessboard, the location is lost
+    const cv::Mat black = cv::Mat::zeros(chess_rgb0.size(), chess_rgb0.type());
+    CPPUNIT_ASSERT(!geometry::vision::helper::detect_chessboard(black, 9, 6, roi));
+    CPPUNIT_ASSERT(roi.empty());
+}
+
+//------------------------------------------------------------------------------
+
+void helper_test::benchmark_chessboard_tracking()
+{
+    static constexpr int s_FRAMES = 30;
+
+    const auto calib_data_dir = utest_data::dir() / "sight" / "calibration";
+    const cv::Mat chess_rgb0  = read_rgb_image((calib_data_dir / "chessboardRGB0.tiff").string());
+
+    {
+        FW_PROFILE("Chessboard detection, full scale");
+        for(int i = 0 ; i < s_FRAMES ; ++i)
+        {
+            CPPUNIT_ASSERT(geometry::vision::helper::detect_chessboard(chess_rgb0, 9, 6, 1.F));
+        }
+    }
+
+    cv::Rect roi;
+    {
+        FW_PROFILE("Chessboard detection, coarse-to-fine tracking");
+        for(int i = 0 ; i < s_FRAMES ; ++i)
+        {
+            CPPUNIT_ASSERT(geometry::vision::helper::detect_chessboard(chess_rgb0, 9, 6, roi));
+        }
+    }
+}
+
 } // namespace sight::geometry::vision::ut
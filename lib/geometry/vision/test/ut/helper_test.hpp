@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2017-2023 IRCAD France
+ * Copyright (C) 2017-2025 IRCAD France
  * Copyright (C) 2017-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -37,6 +37,8 @@ CPPUNIT_TEST(tool_calibration_basic);
 CPPUNIT_TEST(tool_calibration);
 CPPUNIT_TEST(chessboard_detection_test);
 CPPUNIT_TEST(chessboard_detection_scale_test);
+CPPUNIT_TEST(chessboard_tracking_test);
+CPPUNIT_TEST(benchmark_chessboard_tracking);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -52,6 +54,8 @@ public:
     static void tool_calibration();
     static void chessboard_detection_test();
     static void chessboard_detection_scale_test();
+    static void chessboard_tracking_test();
+    static void benchmark_chessboard_tracking();
 };
 
 } // namespace sight::geometry::vision::ut
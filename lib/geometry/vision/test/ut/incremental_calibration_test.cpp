@@ -0,0 +1,398 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "incremental_calibration_test.hpp"
+
+#include <core/exception.hpp>
+#include <core/profiling.hpp>
+
+#include <data/mt/locked_ptr.hpp>
+
+#include <geometry/vision/incremental_calibration.hpp>
+
+#include <opencv2/calib3d.hpp>
+#include <opencv2/core.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <list>
+#include <vector>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::geometry::vision::ut::incremental_calibration_test);
+
+namespace sight::geometry::vision::ut
+{
+
+static constexpr std::size_t BOARD_WIDTH  = 10;
+static constexpr std::size_t BOARD_HEIGHT = 8;
+static constexpr double SQUARE_SIZE       = 20.;
+
+static const cv::Size IMAGE_SIZE(640, 480);
+
+//------------------------------------------------------------------------------
+
+static cv::Mat camera_matrix(double _fx)
+{
+    return (cv::Mat_<double>(3, 3) << _fx, 0., 322., 0., _fx, 238., 0., 0., 1.);
+}
+
+//------------------------------------------------------------------------------
+
+static cv::Mat dist_coeffs()
+{
+    return (cv::Mat_<double>(1, 5) << -0.1, 0.05, 0.001, -0.001, 0.);
+}
+
+//------------------------------------------------------------------------------
+
+static std::vector<cv::Point3f> object_points()
+{
+    std::vector<cv::Point3f> points;
+    for(std::size_t y = 0 ; y < BOARD_HEIGHT - 1 ; ++y)
+    {
+        for(std::size_t x = 0 ; x < BOARD_WIDTH - 1 ; ++x)
+        {
+            points.emplace_back(static_cast<float>(x * SQUARE_SIZE), static_cast<float>(y * SQUARE_SIZE), 0.F);
+        }
+    }
+
+    return points;
+}
+
+//------------------------------------------------------------------------------
+
+/// Pose of the chessboard in the first camera for the given view
+static std::pair<cv::Mat, cv::Mat> board_pose(std::size_t _index)
+{
+    const auto i = static_cast<double>(_index);
+
+    cv::Mat rvec = (cv::Mat_<double>(3, 1) << 0.3 * std::sin(i), 0.3 * std::cos(0.7 * i), 0.1 * std::sin(1.3 * i));
+    cv::Mat tvec = (cv::Mat_<double>(3, 1) << -90. + 30. * std::sin(0.5 * i), -70. + 20. * std::cos(0.9 * i),
+                    450. + 5. * i);
+
+    return {rvec, tvec};
+}
+
+//------------------------------------------------------------------------------
+
+/// Projects the chessboard in a camera, with a small detection noise
+static data::point_list::csptr project(
+    const cv::Mat& _rvec,
+    const cv::Mat& _tvec,
+    const cv::Mat& _camera_matrix,
+    cv::RNG& _rng,
+    double _noise = 0.1
+)
+{
+    std::vector<cv::Point2f> corners;
+    cv::projectPoints(object_points(), _rvec, _tvec, _camera_matrix, dist_coeffs(), corners);
+
+    auto point_list = std::make_shared<data::point_list>();
+    for(const auto& corner : corners)
+    {
+        point_list->push_back(
+            std::make_shared<data::point>(
+                corner.x + _rng.gaussian(_noise),
+                corner.y + _rng.gaussian(_noise)
+            )
+        );
+    }
+
+    return point_list;
+}
+
+//------------------------------------------------------------------------------
+
+static std::list<data::point_list::csptr> create_views(std::size_t _count, cv::RNG& _rng, std::size_t _first = 0)
+{
+    std::list<data::point_list::csptr> views;
+    for(std::size_t i = _first ; i < _first + _count ; ++i)
+    {
+        const auto& [rvec, tvec] = board_pose(i);
+        views.push_back(project(rvec, tvec, camera_matrix(800.), _rng));
+    }
+
+    return views;
+}
+
+//------------------------------------------------------------------------------
+
+static void check_intrinsics(const incremental_calibration::intrinsic_t& _result)
+{
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(800., _result.camera_matrix.at<double>(0, 0), 8.);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(800., _result.camera_matrix.at<double>(1, 1), 8.);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(322., _result.camera_matrix.at<double>(0, 2), 5.);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(238., _result.camera_matrix.at<double>(1, 2), 5.);
+    CPPUNIT_ASSERT_EQUAL(5, static_cast<int>(_result.dist_coeffs.total()));
+    CPPUNIT_ASSERT(_result.error < 0.5);
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration_test::setUp()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration_test::tearDown()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration_test::calibrate_test()
+{
+    cv::RNG rng(42);
+    const auto views = create_views(15, rng);
+
+    incremental_calibration calibration;
+    calibration.set_board(BOARD_WIDTH, BOARD_HEIGHT, SQUARE_SIZE);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(15), calibration.update_views(views));
+
+    const auto result = calibration.calibrate(IMAGE_SIZE);
+    check_intrinsics(result);
+    CPPUNIT_ASSERT(!result.warm_start);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), result.rejected);
+
+    // Each view has its pose and its error
+    CPPUNIT_ASSERT_EQUAL(std::size_t(15), calibration.views().size());
+    for(std::size_t i = 0 ; const auto& view : calibration.views())
+    {
+        CPPUNIT_ASSERT(view.inlier);
+        CPPUNIT_ASSERT(view.error < 0.5);
+
+        const auto& [rvec, tvec] = board_pose(i++);
+        CPPUNIT_ASSERT(cv::norm(rvec, view.rvec) < 1e-2);
+        CPPUNIT_ASSERT(cv::norm(tvec, view.tvec) < 5.);
+    }
+
+    // No usable view
+    incremental_calibration empty;
+    empty.set_board(BOARD_WIDTH, BOARD_HEIGHT, SQUARE_SIZE);
+    CPPUNIT_ASSERT_THROW(empty.calibrate(IMAGE_SIZE), core::exception);
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration_test::warm_start_test()
+{
+    cv::RNG rng(42);
+    auto views = create_views(10, rng);
+
+    incremental_calibration calibration;
+    calibration.set_board(BOARD_WIDTH, BOARD_HEIGHT, SQUARE_SIZE);
+    calibration.update_views(views);
+    CPPUNIT_ASSERT(!calibration.calibrate(IMAGE_SIZE).warm_start);
+
+    // Only the new views are read
+    views.splice(views.end(), create_views(5, rng, 10));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(5), calibration.update_views(views));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), calibration.update_views(views));
+
+    const auto result = calibration.calibrate(IMAGE_SIZE);
+    check_intrinsics(result);
+    CPPUNIT_ASSERT(result.warm_start);
+
+    // A modified point list is read again
+    {
+        data::mt::locked_ptr lock(std::const_pointer_cast<data::point_list>(views.front()));
+    }
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), calibration.update_views(views));
+
+    // Removed views are forgotten
+    views.pop_back();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), calibration.update_views(views));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(14), calibration.views().size());
+    CPPUNIT_ASSERT(calibration.calibrate(IMAGE_SIZE).warm_start);
+
+    // Another board requires a full calibration
+    calibration.set_board(BOARD_WIDTH, BOARD_HEIGHT, SQUARE_SIZE * 2);
+    CPPUNIT_ASSERT(!calibration.calibrate(IMAGE_SIZE).warm_start);
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration_test::outlier_test()
+{
+    cv::RNG rng(42);
+    auto views = create_views(15, rng);
+
+    // A wrong detection
+    {
+        const auto& [rvec, tvec] = board_pose(15);
+        views.push_back(project(rvec, tvec, camera_matrix(800.), rng, 15.));
+    }
+
+    // A view without all the corners
+    views.push_back(std::make_shared<data::point_list>());
+
+    incremental_calibration calibration;
+    calibration.set_board(BOARD_WIDTH, BOARD_HEIGHT, SQUARE_SIZE);
+    calibration.set_outlier_factor(3.);
+    calibration.update_views(views);
+
+    const auto result = calibration.calibrate(IMAGE_SIZE);
+    check_intrinsics(result);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), result.rejected);
+    CPPUNIT_ASSERT(!calibration.views()[15].inlier);
+    CPPUNIT_ASSERT(!calibration.views()[16].inlier);
+
+    // A new wrong detection is rejected before the calibration
+    {
+        const auto& [rvec, tvec] = board_pose(16);
+        views.push_back(project(rvec, tvec, camera_matrix(800.), rng, 15.));
+    }
+
+    calibration.update_views(views);
+    const auto warm_result = calibration.calibrate(IMAGE_SIZE);
+    check_intrinsics(warm_result);
+    CPPUNIT_ASSERT(warm_result.warm_start);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), warm_result.rejected);
+
+    // Without rejection, all the views with the right number of points are used
+    calibration.set_outlier_factor(0.);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), calibration.calibrate(IMAGE_SIZE).rejected);
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration_test::stereo_test()
+{
+    cv::RNG rng(42);
+
+    const cv::Mat rotation_vector = (cv::Mat_<double>(3, 1) << 0., 0.1, 0.);
+    const cv::Mat translation     = (cv::Mat_<double>(3, 1) << -60., 0., 0.);
+    cv::Mat rotation;
+    cv::Rodrigues(rotation_vector, rotation);
+
+    std::list<data::point_list::csptr> first;
+    std::list<data::point_list::csptr> second;
+    for(std::size_t i = 0 ; i < 12 ; ++i)
+    {
+        const auto& [rvec, tvec] = board_pose(i);
+        first.push_back(project(rvec, tvec, camera_matrix(800.), rng));
+
+        // Pose of the chessboard in the second camera
+        cv::Mat board_rotation;
+        cv::Rodrigues(rvec, board_rotation);
+
+        cv::Mat rvec2;
+        cv::Rodrigues(rotation * board_rotation, rvec2);
+        const cv::Mat tvec2 = rotation * tvec + translation;
+
+        second.push_back(project(rvec2, tvec2, camera_matrix(750.), rng));
+    }
+
+    incremental_stereo_calibration calibration;
+    calibration.set_board(BOARD_WIDTH, BOARD_HEIGHT, SQUARE_SIZE);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(12), calibration.update_views(first, second));
+
+    const auto result = calibration.calibrate(
+        camera_matrix(800.),
+        dist_coeffs(),
+        camera_matrix(750.),
+        dist_coeffs(),
+        IMAGE_SIZE
+    );
+
+    CPPUNIT_ASSERT(!result.warm_start);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), result.rejected);
+    CPPUNIT_ASSERT(cv::norm(rotation, result.rotation, cv::NORM_INF) < 1e-3);
+    CPPUNIT_ASSERT(cv::norm(translation, result.translation, cv::NORM_INF) < 1.);
+    CPPUNIT_ASSERT(result.error < 0.5);
+
+    for(const auto& view : calibration.second_views())
+    {
+        CPPUNIT_ASSERT(view.error < 0.5);
+    }
+
+    // Same cameras, the previous solution is reused
+    CPPUNIT_ASSERT(
+        calibration.calibrate(
+            camera_matrix(800.),
+            dist_coeffs(),
+            camera_matrix(750.),
+            dist_coeffs(),
+            IMAGE_SIZE
+        ).warm_start
+    );
+
+    // Another camera requires a full calibration
+    CPPUNIT_ASSERT(
+        !calibration.calibrate(
+            camera_matrix(800.),
+            dist_coeffs(),
+            camera_matrix(760.),
+            dist_coeffs(),
+            IMAGE_SIZE
+        ).warm_start
+    );
+}
+
+//------------------------------------------------------------------------------
+
+void incremental_calibration_test::benchmark_incremental()
+{
+    // Views recorded during a long calibration session, the calibration is computed after each batch
+    static constexpr std::size_t s_VIEWS = 120;
+    static constexpr std::size_t s_BATCH = 10;
+
+    cv::RNG rng(42);
+    const auto all_views = create_views(s_VIEWS, rng);
+
+    // The views known after each batch
+    std::vector<std::list<data::point_list::csptr> > batches;
+    for(std::size_t end = s_BATCH ; end < s_VIEWS + s_BATCH ; end += s_BATCH)
+    {
+        const auto last = std::next(all_views.begin(), std::ptrdiff_t(std::min(end, s_VIEWS)));
+        batches.emplace_back(all_views.begin(), last);
+    }
+
+    // What the services did before: everything is computed again
+    {
+        FW_PROFILE("Calibration by batches, from scratch");
+        for(const auto& views : batches)
+        {
+            incremental_calibration full;
+            full.set_board(BOARD_WIDTH, BOARD_HEIGHT, SQUARE_SIZE);
+            full.update_views(views);
+            check_intrinsics(full.calibrate(IMAGE_SIZE));
+        }
+    }
+
+    {
+        FW_PROFILE("Calibration by batches, incrementally");
+        incremental_calibration incremental;
+        incremental.set_board(BOARD_WIDTH, BOARD_HEIGHT, SQUARE_SIZE);
+        for(const auto& views : batches)
+        {
+            incremental.update_views(views);
+            check_intrinsics(incremental.calibrate(IMAGE_SIZE));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::geometry::vision::ut
@@ -0,0 +1,317 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "remap_cache_test.hpp"
+
+#include <core/exception.hpp>
+#include <core/profiling.hpp>
+
+#include <geometry/vision/remap_cache.hpp>
+
+#include <opencv2/calib3d.hpp>
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include <cmath>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::geometry::vision::ut::remap_cache_test);
+
+namespace sight::geometry::vision::ut
+{
+
+//------------------------------------------------------------------------------
+
+static data::camera::sptr create_camera(std::size_t _width = 1280, std::size_t _height = 720, double _k1 = -0.25)
+{
+    auto camera = std::make_shared<data::camera>();
+    camera->set_width(_width);
+    camera->set_height(_height);
+    camera->set_fx(0.8 * static_cast<double>(_width));
+    camera->set_fy(0.8 * static_cast<double>(_width));
+    camera->set_cx(0.5 * static_cast<double>(_width) + 3.);
+    camera->set_cy(0.5 * static_cast<double>(_height) - 2.);
+    camera->set_distortion_coefficient(_k1, 0.08, 0.001, -0.0005, 0.);
+    camera->set_is_calibrated(true);
+
+    return camera;
+}
+
+//------------------------------------------------------------------------------
+
+static cv::Mat create_image(const cv::Size& _size)
+{
+    // Smooth pattern, so the interpolation differences remain small
+    cv::Mat image(_size, CV_8UC1);
+    for(int i = 0 ; i < _size.height ; ++i)
+    {
+        auto* const row = image.ptr<std::uint8_t>(i);
+        for(int j = 0 ; j < _size.width ; ++j)
+        {
+            row[j] = static_cast<std::uint8_t>(127.5 + 127.5 * std::sin(j * 0.05) * std::cos(i * 0.03));
+        }
+    }
+
+    return image;
+}
+
+//------------------------------------------------------------------------------
+
+static cv::Mat intrinsics(const data::camera& _camera)
+{
+    cv::Mat result = cv::Mat::eye(3, 3, CV_64F);
+    result.at<double>(0, 0) = _camera.get_fx();
+    result.at<double>(1, 1) = _camera.get_fy();
+    result.at<double>(0, 2) = _camera.get_cx();
+    result.at<double>(1, 2) = _camera.get_cy();
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+static cv::Mat distortion(const data::camera& _camera)
+{
+    const auto& coefficients = _camera.get_distortion_coefficient();
+    return cv::Mat(coefficients.size(), 1, CV_64F, const_cast<double*>(coefficients.data())).clone();
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache_test::setUp()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache_test::tearDown()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache_test::tables_test()
+{
+    const auto camera = create_camera();
+    const auto maps   = remap_cache::compute(*camera, remap_cache::direction::undistort);
+
+    const cv::Size size(1280, 720);
+    CPPUNIT_ASSERT(maps.size() == size);
+    CPPUNIT_ASSERT_EQUAL(CV_32FC1, maps.x.type());
+    CPPUNIT_ASSERT_EQUAL(CV_32FC1, maps.y.type());
+    CPPUNIT_ASSERT_EQUAL(CV_16SC2, maps.xy.type());
+    CPPUNIT_ASSERT_EQUAL(CV_16UC1, maps.fraction.type());
+
+    cv::Mat expected_x;
+    cv::Mat expected_y;
+    cv::initUndistortRectifyMap(
+        intrinsics(*camera),
+        distortion(*camera),
+        cv::Mat(),
+        intrinsics(*camera),
+        size,
+        CV_32FC1,
+        expected_x,
+        expected_y
+    );
+
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0., cv::norm(maps.x, expected_x, cv::NORM_INF), 1e-6);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(0., cv::norm(maps.y, expected_y, cv::NORM_INF), 1e-6);
+
+    // An empty resolution can not be handled
+    CPPUNIT_ASSERT_THROW(
+        remap_cache::compute(*create_camera(0, 0), remap_cache::direction::undistort),
+        core::exception
+    );
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache_test::remap_test()
+{
+    const auto camera = create_camera();
+    const auto maps   = remap_cache::compute(*camera, remap_cache::direction::undistort);
+    const auto image  = create_image(maps.size());
+
+    cv::Mat expected;
+    cv::undistort(image, expected, intrinsics(*camera), distortion(*camera));
+
+    cv::Mat undistorted;
+    remap_cache::remap(image, undistorted, maps);
+    CPPUNIT_ASSERT(undistorted.size() == image.size());
+    CPPUNIT_ASSERT_EQUAL(image.type(), undistorted.type());
+
+    // The fixed-point tables only have a 1/32 pixel precision
+    cv::Mat difference;
+    cv::absdiff(expected, undistorted, difference);
+    CPPUNIT_ASSERT_LESSEQUAL(1., cv::mean(difference)[0]);
+
+    // The nearest interpolation only reads the integer tables
+    cv::Mat nearest;
+    remap_cache::remap(image, nearest, maps, cv::INTER_NEAREST);
+    CPPUNIT_ASSERT(nearest.size() == image.size());
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache_test::distort_test()
+{
+    const auto camera    = create_camera(640, 480);
+    const auto undistort = remap_cache::compute(*camera, remap_cache::direction::undistort);
+    const auto distort   = remap_cache::compute(*camera, remap_cache::direction::distort);
+    CPPUNIT_ASSERT(distort.size() == undistort.size());
+
+    // Distorting an undistorted image gives back the original one, except on the borders
+    const auto image = create_image(undistort.size());
+    cv::Mat undistorted;
+    cv::Mat distorted;
+    remap_cache::remap(image, undistorted, undistort);
+    remap_cache::remap(undistorted, distorted, distort);
+
+    const cv::Rect center(160, 120, 320, 240);
+    cv::Mat difference;
+    cv::absdiff(image(center), distorted(center), difference);
+    CPPUNIT_ASSERT_LESSEQUAL(2., cv::mean(difference)[0]);
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache_test::cache_test()
+{
+    remap_cache cache;
+
+    const auto camera = create_camera();
+    const auto first  = cache.get_maps(*camera, remap_cache::direction::undistort);
+    const auto second = cache.get_maps(*camera, remap_cache::direction::undistort);
+    CPPUNIT_ASSERT(first);
+    CPPUNIT_ASSERT(first == second);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), cache.size());
+
+    // Another camera with the same calibration shares the tables
+    const auto same_calibration = create_camera();
+    CPPUNIT_ASSERT(first == cache.get_maps(*same_calibration, remap_cache::direction::undistort));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), cache.size());
+
+    // The direction and the resolution are part of the key
+    const auto distort = cache.get_maps(*camera, remap_cache::direction::distort);
+    CPPUNIT_ASSERT(first != distort);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), cache.size());
+
+    const auto other_resolution = create_camera(640, 480);
+    const auto small            = cache.get_maps(*other_resolution, remap_cache::direction::undistort);
+    CPPUNIT_ASSERT(small->size() == cv::Size(640, 480));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), cache.size());
+
+    cache.clear();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), cache.size());
+
+    // The tables remain valid as long as they are used
+    CPPUNIT_ASSERT(first->size() == cv::Size(1280, 720));
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache_test::invalidate_test()
+{
+    remap_cache cache;
+
+    const auto camera = create_camera();
+    const auto shared = create_camera();
+    const auto first  = cache.get_maps(*camera, remap_cache::direction::undistort);
+    CPPUNIT_ASSERT(first == cache.get_maps(*shared, remap_cache::direction::undistort));
+
+    // Unmodified camera, nothing is released
+    cache.invalidate(*camera);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), cache.size());
+    CPPUNIT_ASSERT(first == cache.get_maps(*camera, remap_cache::direction::undistort));
+
+    // The entry is still used by the other camera
+    camera->set_distortion_coefficient(-0.1, 0.02, 0., 0., 0.);
+    cache.invalidate(*camera);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), cache.size());
+
+    const auto modified = cache.get_maps(*camera, remap_cache::direction::undistort);
+    CPPUNIT_ASSERT(first != modified);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), cache.size());
+
+    // The last user of the former calibration is modified too, its tables are released
+    shared->set_distortion_coefficient(-0.1, 0.02, 0., 0., 0.);
+    cache.invalidate(*shared);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), cache.size());
+    CPPUNIT_ASSERT(modified == cache.get_maps(*shared, remap_cache::direction::undistort));
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache_test::capacity_test()
+{
+    remap_cache cache(2);
+
+    const auto first  = create_camera(320, 240);
+    const auto second = create_camera(640, 480);
+    const auto third  = create_camera(800, 600);
+
+    const auto first_maps = cache.get_maps(*first, remap_cache::direction::undistort);
+    cache.get_maps(*second, remap_cache::direction::undistort);
+
+    // Use the first one again, so the second one is the least recently used
+    CPPUNIT_ASSERT(first_maps == cache.get_maps(*first, remap_cache::direction::undistort));
+
+    cache.get_maps(*third, remap_cache::direction::undistort);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), cache.size());
+    CPPUNIT_ASSERT(first_maps == cache.get_maps(*first, remap_cache::direction::undistort));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), cache.size());
+}
+
+//------------------------------------------------------------------------------
+
+void remap_cache_test::benchmark_frame_rate()
+{
+    static constexpr int s_FRAMES = 100;
+
+    const auto camera       = create_camera();
+    const cv::Mat image     = create_image(cv::Size(1280, 720));
+    const cv::Mat intrinsic = intrinsics(*camera);
+    const cv::Mat dist      = distortion(*camera);
+
+    cv::Mat undistorted;
+
+    // What the services did before, the tables were computed again for each frame
+    {
+        FW_PROFILE("Undistortion of 1280x720 frames, cv::undistort");
+        for(int i = 0 ; i < s_FRAMES ; ++i)
+        {
+            cv::undistort(image, undistorted, intrinsic, dist);
+        }
+    }
+
+    remap_cache cache;
+    {
+        FW_PROFILE("Undistortion of 1280x720 frames, cached fixed-point tables");
+        for(int i = 0 ; i < s_FRAMES ; ++i)
+        {
+            remap_cache::remap(image, undistorted, *cache.get_maps(*camera, remap_cache::direction::undistort));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::geometry::vision::ut
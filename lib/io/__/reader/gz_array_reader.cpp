@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -22,9 +22,7 @@
 
 #include "io/__/reader/gz_array_reader.hpp"
 
-#include <zlib.h>
-
-#include <iostream>
+#include "io/__/reader/parallel_gz_reader.hpp"
 
 namespace sight::io::reader
 {
@@ -41,25 +39,9 @@ void gz_array_reader::read()
     std::size_t array_size_in_bytes = array->resize(array->size());
     const auto dump_lock            = array->dump_lock();
 
-    void* buff = array->buffer();
-
-    gzFile raw_file = gzopen(file.string().c_str(), "rb");
-    if(raw_file == nullptr)
-    {
-        gzclose(raw_file);
-        std::string str = "Unable to open ";
-        str += file.string();
-        throw std::ios_base::failure(str);
-    }
-
-    const int un_compressed_bytes_read = gzread(raw_file, buff, static_cast<unsigned int>(array_size_in_bytes));
-    gzclose(raw_file);
-    if(un_compressed_bytes_read != static_cast<int>(array_size_in_bytes))
-    {
-        std::string str = "Unable to read ";
-        str += file.string();
-        throw std::ios_base::failure(str);
-    }
+    // Decompressed in parallel if the file was written by gz_array_writer, sequentially otherwise
+    const io::reader::parallel_gz_reader reader(file);
+    reader.read(0, array->buffer(), array_size_in_bytes);
 }
 
 //------------------------------------------------------------------------------
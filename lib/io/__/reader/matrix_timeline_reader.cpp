@@ -0,0 +1,352 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/__/reader/matrix_timeline_reader.hpp"
+
+#include "io/__/writer/matrix_timeline_writer.hpp"
+
+#include <core/exceptionmacros.hpp>
+#include <core/spy_log.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <future>
+#include <thread>
+
+namespace sight::io::reader
+{
+
+using binary_format = io::writer::matrix_timeline_writer;
+
+/// Files smaller than this are indexed by a single thread
+static constexpr std::size_t PARALLEL_INDEX_THRESHOLD = std::size_t(4) << 20;
+
+//------------------------------------------------------------------------------
+
+static constexpr bool is_separator(char _c)
+{
+    return _c == ',' || _c == ';' || _c == ' ' || _c == '\t' || _c == '\r';
+}
+
+//------------------------------------------------------------------------------
+
+/// Parses the next value of a line, returns the position after the value or nullptr if there is no valid value
+template<typename T>
+static const char* parse_value(const char* _first, const char* _last, T& _value)
+{
+    while(_first != _last && is_separator(*_first))
+    {
+        ++_first;
+    }
+
+    if(_first != _last && *_first == '+')
+    {
+        ++_first;
+    }
+
+    if(_first == _last)
+    {
+        return nullptr;
+    }
+
+    // std::from_chars neither allocates nor depends on the locale, contrary to std::stof
+    const auto [ptr, ec] = std::from_chars(_first, _last, _value);
+    return ec == std::errc() ? ptr : nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+/// Returns the end of the line starting at _first, excluding the new line character
+static const char* line_end(const char* _first, const char* _last)
+{
+    // memchr is vectorized by the C library, it is much faster than a loop over the characters
+    const auto* const eol = static_cast<const char*>(std::memchr(_first, '\n', std::size_t(_last - _first)));
+    return eol == nullptr ? _last : eol;
+}
+
+//------------------------------------------------------------------------------
+
+namespace
+{
+
+struct csv_index
+{
+    std::vector<double> timestamps;
+    std::vector<std::uint64_t> offsets;
+    std::size_t matrix_count {0};
+    std::size_t skipped {0};
+};
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+/// Indexes the lines between two offsets, _begin being at the start of a line
+static csv_index index_lines(const char* _data, std::size_t _begin, std::size_t _end)
+{
+    csv_index result;
+
+    const char* const last = _data + _end;
+    for(const char* line = _data + _begin ; line < last ; )
+    {
+        const char* const eol = line_end(line, last);
+
+        double timestamp      = 0.;
+        const char* values    = parse_value(line, eol, timestamp);
+        std::size_t nb_values = 0;
+        if(values != nullptr)
+        {
+            // Count the values without parsing them, they are parsed on demand
+            bool in_value = false;
+            for( ; values != eol ; ++values)
+            {
+                const bool separator = is_separator(*values);
+                nb_values += (!separator && !in_value) ? 1 : 0;
+                in_value   = !separator;
+            }
+        }
+
+        if(nb_values >= 16)
+        {
+            result.timestamps.push_back(timestamp);
+            result.offsets.push_back(std::uint64_t(line - _data));
+            result.matrix_count = std::max(result.matrix_count, nb_values / 16);
+        }
+        else if(std::any_of(line, eol, [](char _c){return !is_separator(_c);}))
+        {
+            ++result.skipped;
+        }
+
+        line = eol + 1;
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+matrix_timeline_reader::matrix_timeline_reader(const std::filesystem::path& _path)
+{
+    SIGHT_THROW_IF("The file '" << _path.string() << "' does not exist.", !std::filesystem::is_regular_file(_path));
+
+    // An empty file can not be mapped
+    if(std::filesystem::file_size(_path) == 0)
+    {
+        return;
+    }
+
+    m_file.open(_path.string());
+    SIGHT_THROW_IF("The file '" << _path.string() << "' can not be opened.", !m_file.is_open());
+
+    const char* const data = m_file.data();
+    const std::size_t size = m_file.size();
+
+    if(size >= binary_format::MAGIC.size()
+       && std::string_view(data, binary_format::MAGIC.size()) == binary_format::MAGIC)
+    {
+        SIGHT_THROW_IF(
+            "The header of the file '" << _path.string() << "' is truncated.",
+            size < binary_format::HEADER_SIZE
+        );
+
+        std::uint32_t version      = 0;
+        std::uint32_t matrix_count = 0;
+        std::memcpy(&version, data + binary_format::MAGIC.size(), sizeof(version));
+        std::memcpy(&matrix_count, data + binary_format::MAGIC.size() + sizeof(version), sizeof(matrix_count));
+
+        SIGHT_THROW_IF(
+            "The version " << version << " of the file '" << _path.string() << "' is not supported.",
+            version != binary_format::VERSION
+        );
+        SIGHT_THROW_IF("The file '" << _path.string() << "' holds no matrix.", matrix_count == 0);
+
+        m_format       = format_t::binary;
+        m_matrix_count = matrix_count;
+
+        // An incomplete last row, from an interrupted recording, is ignored
+        m_size = (size - binary_format::HEADER_SIZE) / binary_format::row_size(m_matrix_count);
+    }
+    else
+    {
+        this->index_csv();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+matrix_timeline_reader::~matrix_timeline_reader()
+= default;
+
+//------------------------------------------------------------------------------
+
+void matrix_timeline_reader::index_csv()
+{
+    const char* const data = m_file.data();
+    const std::size_t size = m_file.size();
+
+    // Split the file in chunks starting at the beginning of a line, and index them in parallel
+    const std::size_t nb_chunks =
+        size < PARALLEL_INDEX_THRESHOLD ? 1 : std::max(1U, std::thread::hardware_concurrency());
+
+    std::vector<std::size_t> bounds {0};
+    for(std::size_t i = 1 ; i < nb_chunks ; ++i)
+    {
+        const std::size_t begin = std::max(bounds.back(), size * i / nb_chunks);
+        const char* const eol   = line_end(data + begin, data + size);
+        bounds.push_back(std::min(size, std::size_t(eol - data) + 1));
+    }
+
+    bounds.push_back(size);
+
+    std::vector<std::future<csv_index> > futures;
+    for(std::size_t i = 1 ; i < bounds.size() ; ++i)
+    {
+        futures.push_back(std::async(std::launch::async, index_lines, data, bounds[i - 1], bounds[i]));
+    }
+
+    std::vector<csv_index> chunks;
+    std::size_t nb_lines = 0;
+    for(auto& future : futures)
+    {
+        chunks.push_back(future.get());
+        nb_lines += chunks.back().timestamps.size();
+    }
+
+    m_timestamps.reserve(nb_lines);
+    m_offsets.reserve(nb_lines);
+
+    std::size_t skipped = 0;
+    for(const auto& chunk : chunks)
+    {
+        m_timestamps.insert(m_timestamps.end(), chunk.timestamps.begin(), chunk.timestamps.end());
+        m_offsets.insert(m_offsets.end(), chunk.offsets.begin(), chunk.offsets.end());
+        m_matrix_count = std::max(m_matrix_count, chunk.matrix_count);
+        skipped       += chunk.skipped;
+    }
+
+    m_size = m_timestamps.size();
+
+    SIGHT_WARN_IF(
+        skipped << " lines have too few elements to be converted into matrices, they are ignored.",
+        skipped > 0
+    );
+}
+
+//------------------------------------------------------------------------------
+
+double matrix_timeline_reader::timestamp(std::size_t _index) const
+{
+    SIGHT_ASSERT("Index " << _index << " is out of range.", _index < m_size);
+
+    if(m_format == format_t::csv)
+    {
+        return m_timestamps[_index];
+    }
+
+    double result = 0.;
+    std::memcpy(
+        &result,
+        m_file.data() + binary_format::HEADER_SIZE + (_index * binary_format::row_size(m_matrix_count)),
+        sizeof(result)
+    );
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t matrix_timeline_reader::lower_bound(double _timestamp) const
+{
+    if(m_format == format_t::csv)
+    {
+        return std::size_t(std::ranges::lower_bound(m_timestamps, _timestamp) - m_timestamps.begin());
+    }
+
+    // The binary rows are searched in place, the timestamps are strided in the file
+    std::size_t first = 0;
+    std::size_t count = m_size;
+    while(count > 0)
+    {
+        const std::size_t step = count / 2;
+        if(this->timestamp(first + step) < _timestamp)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return first;
+}
+
+//------------------------------------------------------------------------------
+
+double matrix_timeline_reader::read(std::size_t _index, std::vector<matrix_t>& _matrices) const
+{
+    SIGHT_ASSERT("Index " << _index << " is out of range.", _index < m_size);
+
+    if(m_format == format_t::binary)
+    {
+        const char* const row =
+            m_file.data() + binary_format::HEADER_SIZE + (_index * binary_format::row_size(m_matrix_count));
+
+        double result = 0.;
+        std::memcpy(&result, row, sizeof(result));
+
+        _matrices.resize(m_matrix_count);
+        std::memcpy(_matrices.data(), row + sizeof(result), m_matrix_count * sizeof(matrix_t));
+        return result;
+    }
+
+    const char* const last = m_file.data() + m_file.size();
+    const char* const line = m_file.data() + m_offsets[_index];
+    const char* const eol  = line_end(line, last);
+
+    double result      = 0.;
+    const char* cursor = parse_value(line, eol, result);
+
+    _matrices.resize(m_matrix_count);
+    std::size_t nb_matrices = 0;
+    for( ; nb_matrices < m_matrix_count ; ++nb_matrices)
+    {
+        auto& matrix = _matrices[nb_matrices];
+        for(float& value : matrix)
+        {
+            cursor = cursor == nullptr ? nullptr : parse_value(cursor, eol, value);
+        }
+
+        if(cursor == nullptr)
+        {
+            break;
+        }
+    }
+
+    // Only keep complete matrices, like the former tokenizer-based reader
+    _matrices.resize(nb_matrices);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::io::reader
@@ -0,0 +1,126 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/__/config.hpp>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace sight::io::reader
+{
+
+/**
+ * @brief Random access reader of a matrix timeline recording, either a csv file or a binary file.
+ *
+ * The file is memory-mapped and never copied. When opening a csv file, a single pass indexes the timestamp and the
+ * offset of each line, which costs 16 bytes per line whatever the number of matrices. The matrices themselves are only
+ * parsed when read(), so a player can stream them into a timeline without loading the whole recording. A binary file,
+ * as written by io::writer::matrix_timeline_writer, does not even need this pass since its rows have a fixed size.
+ *
+ * Each csv line is written like:
+ * timestamp;matrix1-value1;...;matrix1-value16;...;matrixN-value1;...;matrixN-value16;
+ * Values may be separated by ',', ';' or spaces. Lines with less than 17 values are ignored.
+ *
+ * The timestamps are expected to be in ascending order, as they are in a recording, for lower_bound() to work.
+ */
+class SIGHT_IO_CLASS_API matrix_timeline_reader final
+{
+public:
+
+    /// Values of a 4x4 matrix, in row-major order
+    using matrix_t = std::array<float, 16>;
+
+    /// Format of the file, detected when opening it
+    enum class format_t : std::uint8_t
+    {
+        csv,
+        binary
+    };
+
+    /**
+     * @brief Opens and indexes a file.
+     *
+     * @param _path path of a csv or a binary file
+     * @throw core::exception if the file does not exist or if the binary header is invalid
+     */
+    SIGHT_IO_API explicit matrix_timeline_reader(const std::filesystem::path& _path);
+
+    /// Destructor
+    SIGHT_IO_API ~matrix_timeline_reader();
+
+    /// Returns the format of the file
+    [[nodiscard]] format_t format() const
+    {
+        return m_format;
+    }
+
+    /// Returns the number of rows, each row being a timestamp and its matrices
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_size;
+    }
+
+    /// Returns the largest number of matrices in a row
+    [[nodiscard]] std::size_t matrix_count() const
+    {
+        return m_matrix_count;
+    }
+
+    /// Returns the timestamp of a row
+    [[nodiscard]] SIGHT_IO_API double timestamp(std::size_t _index) const;
+
+    /// Returns the index of the first row which timestamp is not before _timestamp, or size() if there is none
+    [[nodiscard]] SIGHT_IO_API std::size_t lower_bound(double _timestamp) const;
+
+    /**
+     * @brief Parses the matrices of a row.
+     *
+     * @param _index index of the row, lower than size()
+     * @param _matrices output matrices, resized to the number of matrices of the row
+     * @return the timestamp of the row
+     */
+    SIGHT_IO_API double read(std::size_t _index, std::vector<matrix_t>& _matrices) const;
+
+private:
+
+    /// Builds the index of a csv file
+    void index_csv();
+
+    /// Memory-mapped file, not opened if the file is empty
+    boost::iostreams::mapped_file_source m_file;
+
+    format_t m_format {format_t::csv};
+
+    std::size_t m_size {0};
+    std::size_t m_matrix_count {0};
+
+    /// Csv index, the timestamp and the offset of each valid line
+    std::vector<double> m_timestamps;
+    std::vector<std::uint64_t> m_offsets;
+};
+
+} // namespace sight::io::reader
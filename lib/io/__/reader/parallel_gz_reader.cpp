@@ -0,0 +1,360 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/__/reader/parallel_gz_reader.hpp"
+
+#include "io/__/writer/parallel_gz_writer.hpp"
+
+#include <core/exceptionmacros.hpp>
+
+#include <zlib.h>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <memory>
+
+namespace sight::io::reader
+{
+
+using io::writer::parallel_gz_writer;
+
+//------------------------------------------------------------------------------
+
+static std::uint32_t read_le32(const std::uint8_t* _source)
+{
+    return std::uint32_t(_source[0]) | (std::uint32_t(_source[1]) << 8) | (std::uint32_t(_source[2]) << 16)
+           | (std::uint32_t(_source[3]) << 24);
+}
+
+//------------------------------------------------------------------------------
+
+parallel_gz_reader::parallel_gz_reader(const std::filesystem::path& _path, options _options) :
+    m_path(_path),
+    m_options(_options)
+{
+    SIGHT_THROW_IF("The file '" << _path.string() << "' does not exist.", !std::filesystem::is_regular_file(_path));
+
+    if(!build_index())
+    {
+        m_members.clear();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+parallel_gz_reader::parallel_gz_reader(const std::filesystem::path& _path) :
+    parallel_gz_reader(_path, options {})
+{
+}
+
+//------------------------------------------------------------------------------
+
+bool parallel_gz_reader::build_index()
+{
+    std::ifstream stream(m_path, std::ios::binary | std::ios::in);
+    SIGHT_THROW_IF("The file '" << m_path.string() << "' can not be opened.", !stream.is_open());
+
+    const auto file_size = std::uint64_t(std::filesystem::file_size(m_path));
+
+    std::uint64_t offset              = 0;
+    std::uint64_t uncompressed_offset = 0;
+
+    std::array<std::uint8_t, parallel_gz_writer::MEMBER_HEADER_SIZE> header {};
+    std::array<std::uint8_t, parallel_gz_writer::MEMBER_TRAILER_SIZE> trailer {};
+
+    while(offset < file_size)
+    {
+        if(offset + header.size() + trailer.size() > file_size)
+        {
+            return false;
+        }
+
+        stream.seekg(std::streamoff(offset));
+        stream.read(reinterpret_cast<char*>(header.data()), std::streamsize(header.size()));
+
+        // Only the members written by parallel_gz_writer are accepted: deflate, only the extra field flag, and an
+        // extra field made of the size sub-field only
+        if(!stream.good()
+           || header[0] != 0x1f || header[1] != 0x8b || header[2] != Z_DEFLATED || header[3] != 0x04
+           || header[10] != 8 || header[11] != 0
+           || header[12] != std::uint8_t(parallel_gz_writer::EXTRA_ID[0])
+           || header[13] != std::uint8_t(parallel_gz_writer::EXTRA_ID[1])
+           || header[14] != 4 || header[15] != 0)
+        {
+            return false;
+        }
+
+        const std::uint32_t size = read_le32(header.data() + 16);
+        if(size < header.size() + trailer.size() || offset + size > file_size)
+        {
+            return false;
+        }
+
+        stream.seekg(std::streamoff(offset + size - trailer.size()));
+        stream.read(reinterpret_cast<char*>(trailer.data()), std::streamsize(trailer.size()));
+        if(!stream.good())
+        {
+            return false;
+        }
+
+        const std::uint32_t uncompressed_size = read_le32(trailer.data() + 4);
+        m_members.push_back(
+            {
+                .offset              = offset,
+                .size                = size,
+                .uncompressed_offset = uncompressed_offset,
+                .uncompressed_size   = uncompressed_size
+            });
+
+        offset              += size;
+        uncompressed_offset += uncompressed_size;
+    }
+
+    return !m_members.empty();
+}
+
+//------------------------------------------------------------------------------
+
+bool parallel_gz_reader::indexed() const
+{
+    return !m_members.empty();
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t parallel_gz_reader::size() const
+{
+    SIGHT_THROW_IF("The size of the file '" << m_path.string() << "' is unknown.", m_members.empty());
+
+    return std::size_t(m_members.back().uncompressed_offset + m_members.back().uncompressed_size);
+}
+
+//------------------------------------------------------------------------------
+
+void parallel_gz_reader::read(
+    std::size_t _offset,
+    void* _buffer,
+    std::size_t _size,
+    const progress_callback_t& _progress
+) const
+{
+    if(indexed())
+    {
+        read_indexed(_offset, _buffer, _size, _progress);
+    }
+    else
+    {
+        read_sequential(_offset, _buffer, _size, _progress);
+    }
+
+    if(_progress)
+    {
+        _progress(1.0);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void parallel_gz_reader::read_indexed(
+    std::size_t _offset,
+    void* _buffer,
+    std::size_t _size,
+    const progress_callback_t& _progress
+) const
+{
+    SIGHT_THROW_IF(
+        "The file '" << m_path.string() << "' is truncated: " << size() << " bytes instead of at least "
+        << _offset + _size << ".",
+        _offset + _size > size()
+    );
+
+    // Members overlapping the range
+    const auto first = std::upper_bound(
+        m_members.begin(),
+        m_members.end(),
+        _offset,
+        [](std::size_t _value, const member& _member)
+        {
+            return _value < _member.uncompressed_offset + _member.uncompressed_size;
+        });
+    const auto last = std::lower_bound(
+        first,
+        m_members.end(),
+        _offset + _size,
+        [](const member& _member, std::size_t _value)
+        {
+            return _member.uncompressed_offset < _value;
+        });
+
+    const auto begin       = std::size_t(first - m_members.begin());
+    const auto end         = std::size_t(last - m_members.begin());
+    const int threads      = m_options.threads == 0 ? omp_get_max_threads() : static_cast<int>(m_options.threads);
+    const auto batch_size  = std::size_t(threads) * 4;
+    auto* const buffer     = static_cast<std::uint8_t*>(_buffer);
+    const std::size_t tail = _offset + _size;
+
+    // Members are decompressed by batches, to report the progress
+    for(std::size_t batch = begin ; batch < end ; batch += batch_size)
+    {
+        const std::size_t batch_end = std::min(batch + batch_size, end);
+        std::exception_ptr error;
+
+        #pragma omp parallel num_threads(static_cast<int>(std::min(std::size_t(threads), batch_end - batch)))
+        {
+            std::ifstream stream(m_path, std::ios::binary | std::ios::in);
+            std::vector<std::uint8_t> compressed;
+            std::vector<std::uint8_t> partial;
+
+            z_stream inflater {};
+            const bool initialized = inflateInit2(&inflater, -MAX_WBITS) == Z_OK;
+
+            #pragma omp for schedule(dynamic)
+            for(std::int64_t i = std::int64_t(batch) ; i < std::int64_t(batch_end) ; ++i)
+            {
+                try
+                {
+                    SIGHT_THROW_IF("inflateInit2() failed.", !initialized);
+                    SIGHT_THROW_IF("The file '" << m_path.string() << "' can not be opened.", !stream.is_open());
+
+                    const member& m = m_members[std::size_t(i)];
+
+                    // Read the deflate data and the trailer
+                    compressed.resize(m.size - parallel_gz_writer::MEMBER_HEADER_SIZE);
+                    stream.seekg(std::streamoff(m.offset + parallel_gz_writer::MEMBER_HEADER_SIZE));
+                    stream.read(reinterpret_cast<char*>(compressed.data()), std::streamsize(compressed.size()));
+                    SIGHT_THROW_IF("The file '" << m_path.string() << "' can not be read.", !stream.good());
+
+                    const std::uint8_t* const trailer = compressed.data() + compressed.size()
+                                                        - parallel_gz_writer::MEMBER_TRAILER_SIZE;
+
+                    // Members entirely in the range are decompressed in place, the others in a temporary buffer
+                    const std::size_t range_begin = std::max(std::size_t(m.uncompressed_offset), _offset);
+                    const std::size_t range_end   =
+                        std::min(std::size_t(m.uncompressed_offset + m.uncompressed_size), tail);
+                    const bool in_place = range_begin == m.uncompressed_offset
+                                          && range_end == m.uncompressed_offset + m.uncompressed_size;
+
+                    if(!in_place)
+                    {
+                        partial.resize(m.uncompressed_size);
+                    }
+
+                    std::uint8_t* const destination = in_place
+                                                      ? buffer + (range_begin - _offset)
+                                                      : partial.data();
+
+                    SIGHT_THROW_IF("inflateReset() failed.", inflateReset(&inflater) != Z_OK);
+                    inflater.next_in   = compressed.data();
+                    inflater.avail_in  = uInt(compressed.size() - parallel_gz_writer::MEMBER_TRAILER_SIZE);
+                    inflater.next_out  = destination;
+                    inflater.avail_out = uInt(m.uncompressed_size);
+
+                    const int result = inflate(&inflater, Z_FINISH);
+                    SIGHT_THROW_IF(
+                        "The file '" << m_path.string() << "' is corrupted: member at " << m.offset
+                        << " can not be decompressed.",
+                        result != Z_STREAM_END || inflater.total_out != m.uncompressed_size
+                    );
+
+                    SIGHT_THROW_IF(
+                        "The file '" << m_path.string() << "' is corrupted: wrong checksum of member at "
+                        << m.offset << ".",
+                        crc32(0L, destination, uInt(m.uncompressed_size)) != read_le32(trailer)
+                    );
+
+                    if(!in_place)
+                    {
+                        std::memcpy(
+                            buffer + (range_begin - _offset),
+                            partial.data() + (range_begin - m.uncompressed_offset),
+                            range_end - range_begin
+                        );
+                    }
+                }
+                catch(...)
+                {
+                    #pragma omp critical
+                    error = std::current_exception();
+                }
+            }
+
+            if(initialized)
+            {
+                inflateEnd(&inflater);
+            }
+        }
+
+        if(error)
+        {
+            std::rethrow_exception(error);
+        }
+
+        if(_progress)
+        {
+            _progress(double(batch_end - begin) / double(end - begin));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void parallel_gz_reader::read_sequential(
+    std::size_t _offset,
+    void* _buffer,
+    std::size_t _size,
+    const progress_callback_t& _progress
+) const
+{
+    std::unique_ptr<gzFile_s, decltype(&gzclose)> file(gzopen(m_path.string().c_str(), "rb"), &gzclose);
+    SIGHT_THROW_IF("The file '" << m_path.string() << "' can not be opened.", file == nullptr);
+
+    SIGHT_THROW_IF(
+        "The file '" << m_path.string() << "' is truncated.",
+        _offset > 0 && gzseek(file.get(), z_off_t(_offset), SEEK_SET) != z_off_t(_offset)
+    );
+
+    // Read by steps of a tenth of the data, to report the progress
+    constexpr std::size_t max_step = std::size_t(1) << 30;
+    const std::size_t step         = std::min(_size / 10 + 1, max_step);
+    auto* const buffer             = static_cast<std::uint8_t*>(_buffer);
+
+    for(std::size_t done = 0 ; done < _size ; )
+    {
+        const int result = gzread(file.get(), buffer + done, unsigned(std::min(step, _size - done)));
+        SIGHT_THROW_IF("The file '" << m_path.string() << "' is truncated or corrupted.", result <= 0);
+
+        done += std::size_t(result);
+
+        if(_progress)
+        {
+            _progress(double(done) / double(_size));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::io::reader
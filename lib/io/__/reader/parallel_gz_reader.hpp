@@ -0,0 +1,132 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/__/config.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <vector>
+
+namespace sight::io::reader
+{
+
+/**
+ * @brief Decompresses gzip files directly into a caller buffer, in parallel for files written by
+ * io::writer::parallel_gz_writer.
+ *
+ * The constructor builds the index of the members from their headers, without decompressing anything. If every member
+ * holds the size extra field written by io::writer::parallel_gz_writer, the members overlapping the requested range
+ * are decompressed concurrently, each one straight into its place in the destination buffer. Otherwise, the file is
+ * decompressed sequentially with zlib gzread(), which also handles files that are not compressed at all.
+ */
+class SIGHT_IO_CLASS_API parallel_gz_reader final
+{
+public:
+
+    /// Options of the reader
+    struct options
+    {
+        /// Number of decompression threads, 0 uses all the cores
+        std::size_t threads {0};
+    };
+
+    /// Called between batches of members with the ratio of data read, may throw to cancel the reading
+    using progress_callback_t = std::function<void (double)>;
+
+    /**
+     * @brief Opens the file and builds the index of its members.
+     *
+     * @throw core::exception if the file does not exist
+     */
+    SIGHT_IO_API explicit parallel_gz_reader(const std::filesystem::path& _path, options _options);
+
+    /// @copydoc parallel_gz_reader(const std::filesystem::path&, options)
+    SIGHT_IO_API explicit parallel_gz_reader(const std::filesystem::path& _path);
+
+    /// Returns true if the file was written by io::writer::parallel_gz_writer and can be decompressed in parallel
+    [[nodiscard]] SIGHT_IO_API bool indexed() const;
+
+    /// Returns the uncompressed size of the file, only known if the file is indexed
+    [[nodiscard]] SIGHT_IO_API std::size_t size() const;
+
+    /**
+     * @brief Decompresses a range of the uncompressed data.
+     *
+     * @param _offset position of the range in the uncompressed data
+     * @param _buffer destination, at least _size bytes
+     * @param _size size of the range
+     * @param _progress called with the ratio of data read
+     * @throw core::exception if the file is truncated or corrupted
+     */
+    SIGHT_IO_API void read(
+        std::size_t _offset,
+        void* _buffer,
+        std::size_t _size,
+        const progress_callback_t& _progress = nullptr
+    ) const;
+
+private:
+
+    /// A gzip member of the file
+    struct member
+    {
+        /// Position and size of the member in the file
+        std::uint64_t offset {0};
+        std::uint32_t size {0};
+
+        /// Position and size of the data of the member in the uncompressed data
+        std::uint64_t uncompressed_offset {0};
+        std::uint32_t uncompressed_size {0};
+    };
+
+    /// Builds the index, returns false if a member does not hold its size
+    bool build_index();
+
+    /// Decompresses the members overlapping the range in parallel
+    void read_indexed(
+        std::size_t _offset,
+        void* _buffer,
+        std::size_t _size,
+        const progress_callback_t& _progress
+    ) const;
+
+    /// Decompresses the range sequentially with gzread()
+    void read_sequential(
+        std::size_t _offset,
+        void* _buffer,
+        std::size_t _size,
+        const progress_callback_t& _progress
+    ) const;
+
+    /// Path of the file
+    const std::filesystem::path m_path;
+
+    /// Options of the reader
+    const options m_options;
+
+    /// Members of the file, empty if the file is not indexed
+    std::vector<member> m_members;
+};
+
+} // namespace sight::io::reader
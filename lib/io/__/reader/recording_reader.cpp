@@ -0,0 +1,280 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/__/reader/recording_reader.hpp"
+
+#include "io/__/writer/recording_writer.hpp"
+
+#include <core/exceptionmacros.hpp>
+#include <core/spy_log.hpp>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace sight::io::reader
+{
+
+using format = io::writer::recording_writer;
+
+//------------------------------------------------------------------------------
+
+template<typename T>
+static T read_value(const char* _data)
+{
+    T value {};
+    std::memcpy(&value, _data, sizeof(T));
+    return value;
+}
+
+//------------------------------------------------------------------------------
+
+recording_reader::recording_reader(const std::filesystem::path& _path)
+{
+    SIGHT_THROW_IF("The file '" << _path.string() << "' does not exist.", !std::filesystem::is_regular_file(_path));
+    SIGHT_THROW_IF(
+        "The file '" << _path.string() << "' is not a recording.",
+        std::filesystem::file_size(_path) < format::HEADER_SIZE
+    );
+
+    m_file.open(_path.string());
+    SIGHT_THROW_IF("The file '" << _path.string() << "' can not be opened.", !m_file.is_open());
+
+    const char* const data = m_file.data();
+    const std::size_t size = m_file.size();
+
+    SIGHT_THROW_IF(
+        "The file '" << _path.string() << "' is not a recording.",
+        std::string_view(data, format::MAGIC.size()) != format::MAGIC
+    );
+
+    const auto version = read_value<std::uint32_t>(data + format::MAGIC.size());
+    SIGHT_THROW_IF(
+        "The version " << version << " of the recording '" << _path.string() << "' is not supported.",
+        version != format::VERSION
+    );
+
+    // Only the block headers are read, the pages of the data are never touched
+    std::size_t offset = format::HEADER_SIZE;
+    while(size - offset >= format::BLOCK_HEADER_SIZE)
+    {
+        const char* const block = data + offset;
+        const auto type         = static_cast<format::block_t>(read_value<std::uint32_t>(block));
+        const auto stream       = read_value<std::uint32_t>(block + sizeof(std::uint32_t));
+        const auto block_size   = read_value<std::uint64_t>(block + (2 * sizeof(std::uint32_t)));
+        const char* const body  = block + format::BLOCK_HEADER_SIZE;
+
+        // The last block of an interrupted recording may be incomplete
+        if(block_size > size - offset - format::BLOCK_HEADER_SIZE)
+        {
+            SIGHT_WARN("The recording '" << _path.string() << "' is truncated, its last block is ignored.");
+            break;
+        }
+
+        offset += format::BLOCK_HEADER_SIZE + block_size;
+
+        if(type == format::block_t::stream)
+        {
+            SIGHT_THROW_IF("Corrupted stream declaration in '" << _path.string() << "'.", stream != m_streams.size());
+
+            stream_t declaration;
+            std::size_t position = 0;
+            for(auto* const text : {&declaration.name, &declaration.metadata})
+            {
+                SIGHT_THROW_IF(
+                    "Corrupted stream declaration in '" << _path.string() << "'.",
+                    position + sizeof(std::uint32_t) > block_size
+                );
+                const auto length = read_value<std::uint32_t>(body + position);
+                position += sizeof(std::uint32_t);
+
+                SIGHT_THROW_IF(
+                    "Corrupted stream declaration in '" << _path.string() << "'.",
+                    position + length > block_size
+                );
+                text->assign(body + position, length);
+                position += length;
+            }
+
+            m_streams.push_back(std::move(declaration));
+            m_indexes.emplace_back();
+        }
+        else if(type == format::block_t::chunk)
+        {
+            SIGHT_THROW_IF("Chunk of an undeclared stream in '" << _path.string() << "'.", stream >= m_streams.size());
+            SIGHT_THROW_IF("Corrupted chunk in '" << _path.string() << "'.", block_size < format::CHUNK_HEADER_SIZE);
+
+            auto& index = m_indexes[stream];
+
+            chunk_t chunk;
+            chunk.first_index = index.size;
+            chunk.count       = read_value<std::uint32_t>(body);
+            chunk.compression = read_value<std::uint32_t>(body + sizeof(std::uint32_t));
+            chunk.raw_size    = read_value<std::uint64_t>(body + (2 * sizeof(std::uint32_t)));
+            chunk.stored_size = read_value<std::uint64_t>(body + (2 * sizeof(std::uint32_t)) + sizeof(std::uint64_t));
+            chunk.table       = body + format::CHUNK_HEADER_SIZE;
+            chunk.data        = chunk.table + (std::size_t(chunk.count) * format::ENTRY_SIZE);
+
+            SIGHT_THROW_IF(
+                "Corrupted chunk in '" << _path.string() << "'.",
+                chunk.count == 0
+                || format::CHUNK_HEADER_SIZE + (std::uint64_t(chunk.count) * format::ENTRY_SIZE) + chunk.stored_size
+                != block_size
+            );
+
+            chunk.last_timestamp =
+                read_value<double>(chunk.table + (std::size_t(chunk.count - 1) * format::ENTRY_SIZE));
+
+            index.size += chunk.count;
+            index.chunks.push_back(chunk);
+        }
+        else
+        {
+            // Unknown blocks may be added by later versions, they are skipped
+            SIGHT_DEBUG("Unknown block type " << static_cast<std::uint32_t>(type) << " is skipped.");
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+recording_reader::~recording_reader()
+= default;
+
+//------------------------------------------------------------------------------
+
+std::size_t recording_reader::size(std::uint32_t _stream) const
+{
+    SIGHT_ASSERT("Stream " << _stream << " does not exist.", _stream < m_indexes.size());
+    return m_indexes[_stream].size;
+}
+
+//------------------------------------------------------------------------------
+
+const recording_reader::chunk_t& recording_reader::find_chunk(std::uint32_t _stream, std::size_t _index) const
+{
+    SIGHT_ASSERT("Stream " << _stream << " does not exist.", _stream < m_indexes.size());
+    SIGHT_ASSERT("Index " << _index << " is out of range.", _index < m_indexes[_stream].size);
+
+    const auto& chunks = m_indexes[_stream].chunks;
+    const auto it      = std::ranges::upper_bound(chunks, _index, {}, &chunk_t::first_index);
+    return *std::prev(it);
+}
+
+//------------------------------------------------------------------------------
+
+double recording_reader::timestamp(std::uint32_t _stream, std::size_t _index) const
+{
+    const auto& chunk = this->find_chunk(_stream, _index);
+    return read_value<double>(chunk.table + ((_index - chunk.first_index) * format::ENTRY_SIZE));
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t recording_reader::lower_bound(std::uint32_t _stream, double _timestamp) const
+{
+    SIGHT_ASSERT("Stream " << _stream << " does not exist.", _stream < m_indexes.size());
+
+    const auto& index = m_indexes[_stream];
+
+    // First chunk which ends after the timestamp, then first record of this chunk after the timestamp
+    const auto chunk = std::ranges::lower_bound(index.chunks, _timestamp, {}, &chunk_t::last_timestamp);
+    if(chunk == index.chunks.end())
+    {
+        return index.size;
+    }
+
+    std::size_t first = 0;
+    std::size_t count = chunk->count;
+    while(count > 0)
+    {
+        const std::size_t step = count / 2;
+        if(read_value<double>(chunk->table + ((first + step) * format::ENTRY_SIZE)) < _timestamp)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return chunk->first_index + first;
+}
+
+//------------------------------------------------------------------------------
+
+recording_reader::record_t recording_reader::read(std::uint32_t _stream, std::size_t _index) const
+{
+    const auto& chunk = this->find_chunk(_stream, _index);
+    const char* entry = chunk.table + ((_index - chunk.first_index) * format::ENTRY_SIZE);
+
+    const auto timestamp = read_value<double>(entry);
+    const auto offset    = read_value<std::uint64_t>(entry + sizeof(double));
+    const auto size      = read_value<std::uint64_t>(entry + sizeof(double) + sizeof(std::uint64_t));
+
+    SIGHT_THROW_IF("Corrupted record " << _index << " in stream " << _stream << ".", offset + size > chunk.raw_size);
+
+    const std::uint8_t* data = nullptr;
+    if(static_cast<format::compression_t>(chunk.compression) == format::compression_t::none)
+    {
+        data = reinterpret_cast<const std::uint8_t*>(chunk.data);
+    }
+    else
+    {
+        SIGHT_THROW_IF(
+            "Unknown compression " << chunk.compression << " in stream " << _stream << ".",
+            static_cast<format::compression_t>(chunk.compression) != format::compression_t::zlib
+        );
+
+        const auto& index       = m_indexes[_stream];
+        const std::size_t which = std::size_t(&chunk - index.chunks.data());
+        if(index.cached_chunk != which)
+        {
+            index.cached_chunk = std::size_t(-1);
+            index.cache.resize(chunk.raw_size);
+            auto raw_size = static_cast<uLongf>(chunk.raw_size);
+
+            const int result = uncompress(
+                index.cache.data(),
+                &raw_size,
+                reinterpret_cast<const Bytef*>(chunk.data),
+                static_cast<uLong>(chunk.stored_size)
+            );
+            SIGHT_THROW_IF(
+                "The chunk of record " << _index << " in stream " << _stream << " can not be decompressed.",
+                result != Z_OK || raw_size != chunk.raw_size
+            );
+
+            index.cached_chunk = which;
+        }
+
+        data = index.cache.data();
+    }
+
+    return {.timestamp = timestamp, .data = {data + offset, size}};
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::io::reader
@@ -0,0 +1,139 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/__/config.hpp>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace sight::io::reader
+{
+
+/**
+ * @brief Random access reader of a recording written by io::writer::recording_writer.
+ *
+ * The file is memory-mapped. Opening it only reads the block headers to build the index of the chunks, so a
+ * recording of any size opens at once. Seeking a timestamp is a binary search over the chunks of a stream, then over
+ * the record table of the chunk. The records of uncompressed chunks are read in place, without any copy, the
+ * compressed chunks are decompressed when one of their records is read, and kept until another chunk of the same
+ * stream is read.
+ *
+ * A reader must not be used by several threads at the same time.
+ */
+class SIGHT_IO_CLASS_API recording_reader final
+{
+public:
+
+    /// Stream declared in the recording
+    struct stream_t
+    {
+        std::string name;
+        std::string metadata;
+    };
+
+    /// Record of a stream
+    struct record_t
+    {
+        double timestamp {0.};
+
+        /// Data of the record, valid until another record of the same stream is read or the reader is destroyed
+        std::span<const std::uint8_t> data;
+    };
+
+    /**
+     * @brief Opens and indexes a recording.
+     *
+     * @throw core::exception if the file does not exist or is not a recording
+     */
+    SIGHT_IO_API explicit recording_reader(const std::filesystem::path& _path);
+
+    /// Destructor
+    SIGHT_IO_API ~recording_reader();
+
+    /// Returns the streams of the recording
+    [[nodiscard]] const std::vector<stream_t>& streams() const
+    {
+        return m_streams;
+    }
+
+    /// Returns the number of records of a stream
+    [[nodiscard]] SIGHT_IO_API std::size_t size(std::uint32_t _stream) const;
+
+    /// Returns the timestamp of a record
+    [[nodiscard]] SIGHT_IO_API double timestamp(std::uint32_t _stream, std::size_t _index) const;
+
+    /// Returns the index of the first record of a stream which timestamp is not before _timestamp, or size(_stream)
+    [[nodiscard]] SIGHT_IO_API std::size_t lower_bound(std::uint32_t _stream, double _timestamp) const;
+
+    /**
+     * @brief Reads a record.
+     *
+     * @throw core::exception if the chunk of the record can not be decompressed
+     */
+    SIGHT_IO_API record_t read(std::uint32_t _stream, std::size_t _index) const;
+
+private:
+
+    /// Location of a chunk in the mapped file
+    struct chunk_t
+    {
+        /// Index of the first record of the chunk in its stream
+        std::size_t first_index {0};
+        std::uint32_t count {0};
+        std::uint32_t compression {0};
+        std::uint64_t raw_size {0};
+        std::uint64_t stored_size {0};
+        double last_timestamp {0.};
+
+        /// Record table and data
+        const char* table {nullptr};
+        const char* data {nullptr};
+    };
+
+    /// Index of a stream
+    struct index_t
+    {
+        std::vector<chunk_t> chunks;
+        std::size_t size {0};
+
+        /// Last decompressed chunk
+        mutable std::size_t cached_chunk {std::size_t(-1)};
+        mutable std::vector<std::uint8_t> cache;
+    };
+
+    /// Returns the chunk holding a record
+    const chunk_t& find_chunk(std::uint32_t _stream, std::size_t _index) const;
+
+    boost::iostreams::mapped_file_source m_file;
+
+    std::vector<stream_t> m_streams;
+
+    std::vector<index_t> m_indexes;
+};
+
+} // namespace sight::io::reader
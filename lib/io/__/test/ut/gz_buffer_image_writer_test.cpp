@@ -52,18 +52,15 @@ void gz_buffer_image_writer_test::basic_test()
     gz_buffer_image_writer->set_object(image_in);
     std::filesystem::remove(filepath);
     gz_buffer_image_writer->set_file(filepath);
-    /* TODO: fix
-       CPPUNIT_ASSERT_NO_THROW(gzBufferImageWriter->write());
-       std::array<std::uint8_t, 16> array;
-       {
-        gzFile out = gzopen(filepath.c_str(), "rb");
-        gzread(out, array.data(), 16);
-        gzclose(out);
-       }
-       for(std::uint8_t i = 0; i < 16; i++){
+    CPPUNIT_ASSERT_NO_THROW(gz_buffer_image_writer->write());
+    std::array<std::uint8_t, 16> array {};
+    gzFile out = gzopen(filepath.string().c_str(), "rb");
+    gzread(out, array.data(), 16);
+    gzclose(out);
+    for(std::uint8_t i = 0 ; i < 16 ; i++)
+    {
         CPPUNIT_ASSERT_EQUAL(i, array[i]);
-       }
-     */
+    }
 }
 
 } // namespace sight::io::ut
@@ -0,0 +1,296 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "matrix_timeline_test.hpp"
+
+#include <core/exception.hpp>
+#include <core/os/temp_path.hpp>
+#include <core/profiling.hpp>
+
+#include <io/__/reader/matrix_timeline_reader.hpp>
+#include <io/__/writer/matrix_timeline_writer.hpp>
+
+#include <fstream>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::io::ut::matrix_timeline_test);
+
+namespace sight::io::ut
+{
+
+using matrix_t = io::reader::matrix_timeline_reader::matrix_t;
+
+//------------------------------------------------------------------------------
+
+static matrix_t make_matrix(std::size_t _row, std::size_t _matrix)
+{
+    matrix_t result {};
+    for(std::size_t i = 0 ; i < result.size() ; ++i)
+    {
+        result[i] = static_cast<float>(_row) + (static_cast<float>(_matrix * 16 + i) * 0.25F);
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+/// Writes a csv file like module::io::matrix::matrix_writer does
+static void write_csv(const std::filesystem::path& _path, std::size_t _rows, std::size_t _matrices)
+{
+    std::ofstream stream(_path);
+    stream.precision(7);
+    stream << std::fixed;
+
+    for(std::size_t row = 0 ; row < _rows ; ++row)
+    {
+        stream << (1000 + row * 10) << ";";
+        for(std::size_t m = 0 ; m < _matrices ; ++m)
+        {
+            for(const float value : make_matrix(row, m))
+            {
+                stream << value << ";";
+            }
+        }
+
+        stream << "\n";
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void matrix_timeline_test::csv_test()
+{
+    core::os::temp_dir tmp_dir;
+    const auto path = tmp_dir / "matrices.csv";
+
+    write_csv(path, 5, 2);
+
+    // Add lines which are not matrices, and a line with a single matrix, separated by commas and CRLF
+    {
+        std::ofstream stream(path, std::ios::app);
+        stream << "\n";
+        stream << "1100;1;2;3\n";
+        stream << "1110, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, +1,\r\n";
+    }
+
+    const io::reader::matrix_timeline_reader reader(path);
+    CPPUNIT_ASSERT(reader.format() == io::reader::matrix_timeline_reader::format_t::csv);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(6), reader.size());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), reader.matrix_count());
+
+    std::vector<matrix_t> matrices;
+    for(std::size_t row = 0 ; row < 5 ; ++row)
+    {
+        CPPUNIT_ASSERT_EQUAL(double(1000 + row * 10), reader.timestamp(row));
+        CPPUNIT_ASSERT_EQUAL(double(1000 + row * 10), reader.read(row, matrices));
+        CPPUNIT_ASSERT_EQUAL(std::size_t(2), matrices.size());
+        for(std::size_t m = 0 ; m < 2 ; ++m)
+        {
+            const auto expected = make_matrix(row, m);
+            for(std::size_t i = 0 ; i < 16 ; ++i)
+            {
+                CPPUNIT_ASSERT_DOUBLES_EQUAL(expected[i], matrices[m][i], 1e-5);
+            }
+        }
+    }
+
+    CPPUNIT_ASSERT_EQUAL(1110., reader.read(5, matrices));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), matrices.size());
+    CPPUNIT_ASSERT_EQUAL(1.F, matrices[0][0]);
+    CPPUNIT_ASSERT_EQUAL(1.F, matrices[0][15]);
+
+    // Seek by timestamp
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), reader.lower_bound(0.));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), reader.lower_bound(1020.));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), reader.lower_bound(1025.));
+    CPPUNIT_ASSERT_EQUAL(reader.size(), reader.lower_bound(2000.));
+
+    // Empty and missing files
+    std::ofstream(tmp_dir / "empty.csv").close();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), io::reader::matrix_timeline_reader(tmp_dir / "empty.csv").size());
+    CPPUNIT_ASSERT_THROW(io::reader::matrix_timeline_reader(tmp_dir / "missing.csv"), core::exception);
+}
+
+//------------------------------------------------------------------------------
+
+void matrix_timeline_test::binary_test()
+{
+    core::os::temp_dir tmp_dir;
+    const auto path = tmp_dir / ("matrices" + std::string(io::writer::matrix_timeline_writer::EXTENSION));
+
+    {
+        io::writer::matrix_timeline_writer writer(path, 2);
+        for(std::size_t row = 0 ; row < 10 ; ++row)
+        {
+            const std::array matrices {make_matrix(row, 0), make_matrix(row, 1)};
+            writer.write(double(1000 + row * 10), matrices);
+        }
+
+        // A missing matrix is written as identity
+        const std::array<matrix_t, 1> matrices {make_matrix(10, 0)};
+        writer.write(1100., matrices);
+    }
+
+    {
+        const io::reader::matrix_timeline_reader reader(path);
+        CPPUNIT_ASSERT(reader.format() == io::reader::matrix_timeline_reader::format_t::binary);
+        CPPUNIT_ASSERT_EQUAL(std::size_t(11), reader.size());
+        CPPUNIT_ASSERT_EQUAL(std::size_t(2), reader.matrix_count());
+
+        std::vector<matrix_t> matrices;
+        for(std::size_t row = 0 ; row < 10 ; ++row)
+        {
+            CPPUNIT_ASSERT_EQUAL(double(1000 + row * 10), reader.read(row, matrices));
+            CPPUNIT_ASSERT_EQUAL(std::size_t(2), matrices.size());
+            CPPUNIT_ASSERT(make_matrix(row, 0) == matrices[0]);
+            CPPUNIT_ASSERT(make_matrix(row, 1) == matrices[1]);
+        }
+
+        CPPUNIT_ASSERT_EQUAL(1100., reader.read(10, matrices));
+        CPPUNIT_ASSERT(make_matrix(10, 0) == matrices[0]);
+        CPPUNIT_ASSERT((matrix_t {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}) == matrices[1]);
+
+        CPPUNIT_ASSERT_EQUAL(std::size_t(0), reader.lower_bound(0.));
+        CPPUNIT_ASSERT_EQUAL(std::size_t(5), reader.lower_bound(1050.));
+        CPPUNIT_ASSERT_EQUAL(std::size_t(6), reader.lower_bound(1051.));
+        CPPUNIT_ASSERT_EQUAL(reader.size(), reader.lower_bound(2000.));
+    }
+
+    // An interrupted recording is still readable
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 10);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(10), io::reader::matrix_timeline_reader(path).size());
+
+    // A truncated header is not
+    std::filesystem::resize_file(path, io::writer::matrix_timeline_writer::HEADER_SIZE - 1);
+    CPPUNIT_ASSERT_THROW(io::reader::matrix_timeline_reader {path}, core::exception);
+}
+
+//------------------------------------------------------------------------------
+
+void matrix_timeline_test::append_test()
+{
+    core::os::temp_dir tmp_dir;
+    const auto path = tmp_dir / "append.tlm";
+
+    const std::array<matrix_t, 1> matrices {make_matrix(0, 0)};
+
+    // Appending to a missing file creates it
+    io::writer::matrix_timeline_writer(path, 1, true).write(1., matrices);
+    io::writer::matrix_timeline_writer(path, 1, true).write(2., matrices);
+
+    // The incomplete row of an interrupted recording is dropped before appending
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) + 7);
+    io::writer::matrix_timeline_writer(path, 1, true).write(3., matrices);
+
+    {
+        const io::reader::matrix_timeline_reader reader(path);
+        CPPUNIT_ASSERT_EQUAL(std::size_t(3), reader.size());
+        CPPUNIT_ASSERT_EQUAL(1., reader.timestamp(0));
+        CPPUNIT_ASSERT_EQUAL(2., reader.timestamp(1));
+        CPPUNIT_ASSERT_EQUAL(3., reader.timestamp(2));
+    }
+
+    // Another number of matrices can not be appended
+    CPPUNIT_ASSERT_THROW(io::writer::matrix_timeline_writer(path, 2, true), core::exception);
+
+    // Without append, the file is truncated
+    io::writer::matrix_timeline_writer(path, 2).write(4., matrices);
+    const io::reader::matrix_timeline_reader reader(path);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), reader.size());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), reader.matrix_count());
+}
+
+//------------------------------------------------------------------------------
+
+void matrix_timeline_test::benchmark_index()
+{
+    // About 7 minutes of tracking of 4 tools at 60 Hz
+    static constexpr std::size_t s_ROWS     = 25000;
+    static constexpr std::size_t s_MATRICES = 4;
+
+    core::os::temp_dir tmp_dir;
+    const auto csv_path    = tmp_dir / "benchmark.csv";
+    const auto binary_path = tmp_dir / "benchmark.tlm";
+
+    write_csv(csv_path, s_ROWS, s_MATRICES);
+
+    // Former reader: every line is parsed with a tokenizer and the matrices are all kept in memory
+    {
+        FW_PROFILE("Matrix timeline, full parse of the csv file");
+        std::vector<std::vector<matrix_t> > all_matrices;
+        std::ifstream stream(csv_path);
+        std::string line;
+        while(std::getline(stream, line))
+        {
+            std::istringstream line_stream(line);
+            std::string token;
+            std::getline(line_stream, token, ';');
+
+            auto& matrices = all_matrices.emplace_back(s_MATRICES);
+            for(auto& matrix : matrices)
+            {
+                for(float& value : matrix)
+                {
+                    std::getline(line_stream, token, ';');
+                    value = std::stof(token);
+                }
+            }
+        }
+
+        CPPUNIT_ASSERT_EQUAL(s_ROWS, all_matrices.size());
+    }
+
+    std::optional<io::reader::matrix_timeline_reader> csv_reader;
+    {
+        FW_PROFILE("Matrix timeline, csv index");
+        csv_reader.emplace(csv_path);
+    }
+    CPPUNIT_ASSERT_EQUAL(s_ROWS, csv_reader->size());
+
+    // Read every row, as a playback does
+    std::vector<matrix_t> matrices;
+    {
+        FW_PROFILE("Matrix timeline, csv playback");
+        io::writer::matrix_timeline_writer writer(binary_path, s_MATRICES);
+        for(std::size_t row = 0 ; row < csv_reader->size() ; ++row)
+        {
+            writer.write(csv_reader->read(row, matrices), matrices);
+        }
+    }
+
+    std::optional<io::reader::matrix_timeline_reader> binary_reader;
+    {
+        FW_PROFILE("Matrix timeline, binary open");
+        binary_reader.emplace(binary_path);
+    }
+    CPPUNIT_ASSERT_EQUAL(s_ROWS, binary_reader->size());
+
+    CPPUNIT_ASSERT_EQUAL(csv_reader->timestamp(s_ROWS / 2), binary_reader->timestamp(s_ROWS / 2));
+    CPPUNIT_ASSERT_EQUAL(s_ROWS / 2, binary_reader->lower_bound(binary_reader->timestamp(s_ROWS / 2)));
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::io::ut
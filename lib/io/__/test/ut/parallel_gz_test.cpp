@@ -0,0 +1,322 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "parallel_gz_test.hpp"
+
+#include <core/exception.hpp>
+#include <core/os/temp_path.hpp>
+#include <core/profiling.hpp>
+#include <core/spy_log.hpp>
+
+#include <io/__/reader/parallel_gz_reader.hpp>
+#include <io/__/writer/parallel_gz_writer.hpp>
+
+#include <zlib.h>
+
+#include <array>
+#include <fstream>
+#include <random>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::io::ut::parallel_gz_test);
+
+namespace sight::io::ut
+{
+
+//------------------------------------------------------------------------------
+
+/// Generates compressible data, like a label or CT volume
+static std::vector<std::uint8_t> make_data(std::size_t _size)
+{
+    std::mt19937 generator(0);
+    std::vector<std::uint8_t> result(_size);
+    for(std::size_t i = 0 ; i < _size ; ++i)
+    {
+        result[i] = static_cast<std::uint8_t>((i / 64) % 7 + generator() % 4);
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+/// Reads a whole file with zlib, like any gzip reader
+static std::vector<std::uint8_t> gz_read_all(const std::filesystem::path& _path, std::size_t _size)
+{
+    std::vector<std::uint8_t> result(_size + 1);
+
+    gzFile file = gzopen(_path.string().c_str(), "rb");
+    CPPUNIT_ASSERT(file != nullptr);
+
+    std::size_t read = 0;
+    int result_size  = 0;
+    while((result_size = gzread(file, result.data() + read, unsigned(result.size() - read))) > 0)
+    {
+        read += std::size_t(result_size);
+    }
+
+    gzclose(file);
+    result.resize(read);
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+void parallel_gz_test::read_write_test()
+{
+    core::os::temp_dir tmp_dir;
+    const auto path = tmp_dir / "data.gz";
+
+    // The size is not a multiple of the block size
+    const auto data = make_data((std::size_t(5) << 20) + 1234);
+
+    std::vector<double> progress;
+    {
+        io::writer::parallel_gz_writer writer(path, {.block_size = std::size_t(1) << 20, .threads = 4});
+        writer.write(data.data(), data.size(), [&](double _ratio){progress.push_back(_ratio);});
+    }
+
+    CPPUNIT_ASSERT(!progress.empty());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, progress.back(), 1e-9);
+    CPPUNIT_ASSERT(std::is_sorted(progress.begin(), progress.end()));
+
+    const io::reader::parallel_gz_reader reader(path, {.threads = 4});
+    CPPUNIT_ASSERT(reader.indexed());
+    CPPUNIT_ASSERT_EQUAL(data.size(), reader.size());
+
+    std::vector<std::uint8_t> result(data.size());
+    reader.read(0, result.data(), result.size());
+    CPPUNIT_ASSERT(data == result);
+
+    // One thread gives the same result
+    std::fill(result.begin(), result.end(), std::uint8_t(0));
+    io::reader::parallel_gz_reader(path, {.threads = 1}).read(0, result.data(), result.size());
+    CPPUNIT_ASSERT(data == result);
+
+    // Empty data
+    {
+        io::writer::parallel_gz_writer writer(path);
+        writer.write(nullptr, 0);
+    }
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), io::reader::parallel_gz_reader(path).size());
+
+    // Invalid options
+    CPPUNIT_ASSERT_THROW(io::writer::parallel_gz_writer(path, {.compression_level = 10}), core::exception);
+    CPPUNIT_ASSERT_THROW(io::writer::parallel_gz_writer(path, {.block_size = 0}), core::exception);
+}
+
+//------------------------------------------------------------------------------
+
+void parallel_gz_test::range_test()
+{
+    core::os::temp_dir tmp_dir;
+    const auto path = tmp_dir / "image.gz";
+
+    // A header followed by an image, written in two calls like the INR writer does
+    const std::string header(256, '#');
+    const auto data = make_data(std::size_t(3) << 20);
+    {
+        io::writer::parallel_gz_writer writer(path, {.block_size = std::size_t(256) << 10});
+        writer.write(header.data(), header.size());
+        writer.write(data.data(), data.size());
+    }
+
+    const io::reader::parallel_gz_reader reader(path);
+    CPPUNIT_ASSERT(reader.indexed());
+    CPPUNIT_ASSERT_EQUAL(header.size() + data.size(), reader.size());
+
+    // The image only, without decompressing the header
+    std::vector<std::uint8_t> result(data.size());
+    reader.read(header.size(), result.data(), result.size());
+    CPPUNIT_ASSERT(data == result);
+
+    // Ranges across members and inside a member
+    for(const auto& [offset, size] : std::vector<std::pair<std::size_t, std::size_t> > {
+            {100, 1000}, {(std::size_t(256) << 10) - 10, 20}, {12345, std::size_t(1) << 20}, {data.size() - 1, 1}
+        })
+    {
+        std::vector<std::uint8_t> range(size);
+        reader.read(header.size() + offset, range.data(), range.size());
+        CPPUNIT_ASSERT(std::equal(range.begin(), range.end(), data.begin() + std::ptrdiff_t(offset)));
+    }
+
+    // Appending to the file adds members
+    {
+        io::writer::parallel_gz_writer writer(path, {.append = true});
+        writer.write(header.data(), header.size());
+    }
+
+    const io::reader::parallel_gz_reader appended(path);
+    CPPUNIT_ASSERT_EQUAL(2 * header.size() + data.size(), appended.size());
+
+    // Out of the data
+    CPPUNIT_ASSERT_THROW(appended.read(appended.size() - 10, result.data(), 11), core::exception);
+}
+
+//------------------------------------------------------------------------------
+
+void parallel_gz_test::compatibility_test()
+{
+    core::os::temp_dir tmp_dir;
+    const auto data = make_data((std::size_t(2) << 20) + 17);
+
+    // Files written in parallel are read by zlib
+    {
+        const auto path = tmp_dir / "parallel.gz";
+        io::writer::parallel_gz_writer writer(path, {.block_size = std::size_t(64) << 10});
+        writer.write(data.data(), data.size());
+        writer.close();
+
+        CPPUNIT_ASSERT(data == gz_read_all(path, data.size()));
+        CPPUNIT_ASSERT_THROW(writer.write(data.data(), data.size()), core::exception);
+    }
+
+    // Files written by zlib are read sequentially
+    {
+        const auto path = tmp_dir / "zlib.gz";
+        gzFile file     = gzopen(path.string().c_str(), "wb1");
+        gzwrite(file, data.data(), unsigned(data.size()));
+        gzclose(file);
+
+        const io::reader::parallel_gz_reader reader(path);
+        CPPUNIT_ASSERT(!reader.indexed());
+
+        std::vector<std::uint8_t> result(data.size() - 1000);
+        reader.read(1000, result.data(), result.size());
+        CPPUNIT_ASSERT(std::equal(result.begin(), result.end(), data.begin() + 1000));
+    }
+
+    // Uncompressed files are read as is
+    {
+        const auto path = tmp_dir / "raw";
+        std::ofstream(path, std::ios::binary).write(
+            reinterpret_cast<const char*>(data.data()),
+            std::streamsize(data.size())
+        );
+
+        const io::reader::parallel_gz_reader reader(path);
+        CPPUNIT_ASSERT(!reader.indexed());
+
+        std::vector<std::uint8_t> result(data.size());
+        reader.read(0, result.data(), result.size());
+        CPPUNIT_ASSERT(data == result);
+    }
+
+    CPPUNIT_ASSERT_THROW(io::reader::parallel_gz_reader(tmp_dir / "missing.gz"), core::exception);
+}
+
+//------------------------------------------------------------------------------
+
+void parallel_gz_test::corrupted_test()
+{
+    core::os::temp_dir tmp_dir;
+    const auto path = tmp_dir / "corrupted.gz";
+    const auto data = make_data(std::size_t(1) << 20);
+    {
+        io::writer::parallel_gz_writer writer(path, {.block_size = std::size_t(64) << 10});
+        writer.write(data.data(), data.size());
+    }
+
+    // Alter the compressed data of the second member, which starts after the first one, whose size is stored at the
+    // end of its header
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekg(16);
+        std::array<std::uint8_t, 4> size {};
+        file.read(reinterpret_cast<char*>(size.data()), 4);
+        const auto second_member = std::uint32_t(size[0]) | (std::uint32_t(size[1]) << 8)
+                                   | (std::uint32_t(size[2]) << 16) | (std::uint32_t(size[3]) << 24);
+        file.seekp(second_member + io::writer::parallel_gz_writer::MEMBER_HEADER_SIZE + 100);
+        file.put(char(0x55));
+        file.put(char(0xAA));
+    }
+
+    const io::reader::parallel_gz_reader reader(path);
+    CPPUNIT_ASSERT(reader.indexed());
+
+    std::vector<std::uint8_t> result(data.size());
+    CPPUNIT_ASSERT_THROW(reader.read(0, result.data(), result.size()), core::exception);
+
+    // The first member is still readable
+    reader.read(0, result.data(), 1000);
+    CPPUNIT_ASSERT(std::equal(data.begin(), data.begin() + 1000, result.begin()));
+
+    // A truncated file is not indexed anymore, and is read sequentially until the truncation
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 10);
+    const io::reader::parallel_gz_reader truncated(path);
+    CPPUNIT_ASSERT(!truncated.indexed());
+    CPPUNIT_ASSERT_THROW(truncated.read(0, result.data(), result.size()), core::exception);
+}
+
+//------------------------------------------------------------------------------
+
+void parallel_gz_test::benchmark_read_write()
+{
+    // A 256 x 256 x 256 CT-like volume of 16 bits
+    static constexpr std::size_t s_SIZE = std::size_t(32) << 20;
+
+    core::os::temp_dir tmp_dir;
+    const auto data = make_data(s_SIZE);
+    std::vector<std::uint8_t> result(s_SIZE);
+
+    // zlib, single stream
+    const auto zlib_path = tmp_dir / "zlib.gz";
+    {
+        FW_PROFILE("Compression, zlib");
+        gzFile file = gzopen(zlib_path.string().c_str(), "wb1");
+        gzwrite(file, data.data(), unsigned(data.size()));
+        gzclose(file);
+    }
+
+    {
+        FW_PROFILE("Decompression, zlib");
+        gzFile file = gzopen(zlib_path.string().c_str(), "rb");
+        gzread(file, result.data(), unsigned(result.size()));
+        gzclose(file);
+    }
+    CPPUNIT_ASSERT(data == result);
+
+    // Independent members, with one thread and with all the cores
+    const auto path = tmp_dir / "parallel.gz";
+    for(std::size_t threads : {1, 0})
+    {
+        {
+            FW_PROFILE(threads == 0 ? "Compression, members in parallel" : "Compression, members on one thread");
+            io::writer::parallel_gz_writer writer(path, {.threads = threads});
+            writer.write(data.data(), data.size());
+        }
+
+        std::fill(result.begin(), result.end(), std::uint8_t(0));
+        {
+            FW_PROFILE(threads == 0 ? "Decompression, members in parallel" : "Decompression, members on one thread");
+            io::reader::parallel_gz_reader(path, {.threads = threads}).read(0, result.data(), result.size());
+        }
+        CPPUNIT_ASSERT(data == result);
+    }
+
+    SIGHT_INFO(
+        "Compressed size of " << (s_SIZE >> 20) << " MiB: zlib " << std::filesystem::file_size(zlib_path)
+        << " bytes, members " << std::filesystem::file_size(path) << " bytes"
+    );
+}
+
+} // namespace sight::io::ut
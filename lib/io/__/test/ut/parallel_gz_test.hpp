@@ -0,0 +1,48 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::io::ut
+{
+
+class parallel_gz_test : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(parallel_gz_test);
+CPPUNIT_TEST(read_write_test);
+CPPUNIT_TEST(range_test);
+CPPUNIT_TEST(compatibility_test);
+CPPUNIT_TEST(corrupted_test);
+CPPUNIT_TEST(benchmark_read_write);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    static void read_write_test();
+    static void range_test();
+    static void compatibility_test();
+    static void corrupted_test();
+    static void benchmark_read_write();
+};
+
+} // namespace sight::io::ut
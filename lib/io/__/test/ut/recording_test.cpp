@@ -0,0 +1,271 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "recording_test.hpp"
+
+#include <core/exception.hpp>
+#include <core/os/temp_path.hpp>
+#include <core/profiling.hpp>
+
+#include <io/__/reader/recording_reader.hpp>
+#include <io/__/writer/recording_writer.hpp>
+
+#include <fstream>
+#include <optional>
+#include <random>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::io::ut::recording_test);
+
+namespace sight::io::ut
+{
+
+//------------------------------------------------------------------------------
+
+static std::vector<std::uint8_t> make_record(std::size_t _index, std::size_t _size)
+{
+    std::vector<std::uint8_t> result(_size);
+    for(std::size_t i = 0 ; i < _size ; ++i)
+    {
+        result[i] = static_cast<std::uint8_t>(_index + (i / 16));
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+/// Writes a frame stream at 30 Hz and a matrix stream at 60 Hz, during _seconds seconds
+static void write_recording(
+    const std::filesystem::path& _path,
+    io::writer::recording_writer::options _options,
+    std::size_t _seconds = 10
+)
+{
+    io::writer::recording_writer writer(_path, _options);
+    const auto frames   = writer.add_stream("frames", "frame_tl 4 4 uint8 rgb 1");
+    const auto matrices = writer.add_stream("matrices", "matrix_tl 2");
+
+    for(std::size_t i = 0 ; i < _seconds * 60 ; ++i)
+    {
+        if(i % 2 == 0)
+        {
+            writer.write(frames, double(i * 1000 / 60), make_record(i, 4 * 4 * 3));
+        }
+
+        writer.write(matrices, double(i * 1000 / 60) + 1., make_record(i, 2 * 64));
+    }
+}
+
+//------------------------------------------------------------------------------
+
+static void check_recording(const io::reader::recording_reader& _reader, std::size_t _seconds = 10)
+{
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), _reader.streams().size());
+    CPPUNIT_ASSERT_EQUAL(std::string("frames"), _reader.streams()[0].name);
+    CPPUNIT_ASSERT_EQUAL(std::string("frame_tl 4 4 uint8 rgb 1"), _reader.streams()[0].metadata);
+    CPPUNIT_ASSERT_EQUAL(std::string("matrices"), _reader.streams()[1].name);
+    CPPUNIT_ASSERT_EQUAL(std::string("matrix_tl 2"), _reader.streams()[1].metadata);
+
+    CPPUNIT_ASSERT_EQUAL(_seconds * 30, _reader.size(0));
+    CPPUNIT_ASSERT_EQUAL(_seconds * 60, _reader.size(1));
+
+    for(std::size_t i = 0 ; i < _seconds * 60 ; ++i)
+    {
+        if(i % 2 == 0)
+        {
+            const auto record = _reader.read(0, i / 2);
+            CPPUNIT_ASSERT_EQUAL(double(i * 1000 / 60), record.timestamp);
+            CPPUNIT_ASSERT(std::ranges::equal(make_record(i, 4 * 4 * 3), record.data));
+        }
+
+        const auto record = _reader.read(1, i);
+        CPPUNIT_ASSERT_EQUAL(double(i * 1000 / 60) + 1., record.timestamp);
+        CPPUNIT_ASSERT_EQUAL(record.timestamp, _reader.timestamp(1, i));
+        CPPUNIT_ASSERT(std::ranges::equal(make_record(i, 2 * 64), record.data));
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void recording_test::read_write_test()
+{
+    core::os::temp_dir tmp_dir;
+    const auto path = tmp_dir / "recording.srec";
+
+    write_recording(path, {.chunk_size = 1024, .chunk_records = 16, .compression_level = 0});
+
+    const io::reader::recording_reader reader(path);
+    check_recording(reader);
+
+    // Seek in both streams
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), reader.lower_bound(0, -1.));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(30), reader.lower_bound(0, 1000.));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(31), reader.lower_bound(0, 1001.));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(60), reader.lower_bound(1, 1000.));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(60), reader.lower_bound(1, 1001.));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(61), reader.lower_bound(1, 1001.5));
+    CPPUNIT_ASSERT_EQUAL(reader.size(1), reader.lower_bound(1, 1e9));
+
+    // Records older than the previous one are ignored
+    {
+        io::writer::recording_writer writer(path);
+        const auto stream = writer.add_stream("stream", "");
+        writer.write(stream, 2., make_record(0, 8));
+        writer.write(stream, 1., make_record(1, 8));
+        writer.write(stream, 2., make_record(2, 8));
+    }
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), io::reader::recording_reader(path).size(0));
+
+    // Invalid files
+    std::ofstream(tmp_dir / "invalid.srec") << "This is not a recording";
+    CPPUNIT_ASSERT_THROW(io::reader::recording_reader(tmp_dir / "invalid.srec"), core::exception);
+    CPPUNIT_ASSERT_THROW(io::reader::recording_reader(tmp_dir / "missing.srec"), core::exception);
+}
+
+//------------------------------------------------------------------------------
+
+void recording_test::compression_test()
+{
+    core::os::temp_dir tmp_dir;
+    const auto raw_path        = tmp_dir / "raw.srec";
+    const auto compressed_path = tmp_dir / "compressed.srec";
+
+    write_recording(raw_path, {.chunk_size = 4096, .chunk_records = 64, .compression_level = 0});
+    write_recording(compressed_path, {.chunk_size = 4096, .chunk_records = 64, .compression_level = 6});
+
+    CPPUNIT_ASSERT(std::filesystem::file_size(compressed_path) < std::filesystem::file_size(raw_path) / 2);
+
+    const io::reader::recording_reader reader(compressed_path);
+    check_recording(reader);
+
+    // Random access, alternating between chunks
+    CPPUNIT_ASSERT(std::ranges::equal(make_record(598, 2 * 64), reader.read(1, 598).data));
+    CPPUNIT_ASSERT(std::ranges::equal(make_record(3, 2 * 64), reader.read(1, 3).data));
+    CPPUNIT_ASSERT(std::ranges::equal(make_record(300, 2 * 64), reader.read(1, 300).data));
+
+    // Data which do not compress are stored as they are
+    {
+        std::mt19937 generator(0);
+        std::vector<std::uint8_t> noise(4096);
+        std::ranges::generate(noise, [&generator]{return static_cast<std::uint8_t>(generator());});
+
+        io::writer::recording_writer writer(compressed_path, {.compression_level = 9});
+        writer.write(writer.add_stream("noise", ""), 0., noise);
+        writer.close();
+
+        CPPUNIT_ASSERT(std::ranges::equal(noise, io::reader::recording_reader(compressed_path).read(0, 0).data));
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void recording_test::truncated_test()
+{
+    core::os::temp_dir tmp_dir;
+    const auto path = tmp_dir / "truncated.srec";
+
+    write_recording(path, {.chunk_size = 1024, .chunk_records = 16, .compression_level = 0});
+
+    // Every complete chunk of an interrupted recording is readable
+    const auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 10);
+
+    const io::reader::recording_reader reader(path);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), reader.streams().size());
+    CPPUNIT_ASSERT(reader.size(0) + reader.size(1) < 900);
+    CPPUNIT_ASSERT(reader.size(0) + reader.size(1) >= 900 - 32);
+
+    for(std::uint32_t stream = 0 ; stream < 2 ; ++stream)
+    {
+        for(std::size_t i = 0 ; i < reader.size(stream) ; ++i)
+        {
+            CPPUNIT_ASSERT_NO_THROW(reader.read(stream, i));
+        }
+    }
+
+    // A header alone is an empty recording
+    std::filesystem::resize_file(path, io::writer::recording_writer::HEADER_SIZE);
+    CPPUNIT_ASSERT(io::reader::recording_reader(path).streams().empty());
+}
+
+//------------------------------------------------------------------------------
+
+void recording_test::benchmark_seek()
+{
+    // One minute of a 30 Hz QVGA grayscale video with a 60 Hz tracker
+    static constexpr std::size_t s_SECONDS    = 60;
+    static constexpr std::size_t s_FRAME_SIZE = std::size_t(320) * 240;
+    static constexpr std::size_t s_SEEKS      = 10000;
+
+    core::os::temp_dir tmp_dir;
+    const auto path = tmp_dir / "benchmark.srec";
+
+    {
+        FW_PROFILE("Recording, write");
+        io::writer::recording_writer writer(path, {.chunk_size = std::size_t(8) << 20, .chunk_records = 256});
+        const auto frames   = writer.add_stream("frames", "");
+        const auto matrices = writer.add_stream("matrices", "");
+
+        const std::vector<std::uint8_t> frame(s_FRAME_SIZE, 127);
+        const std::vector<std::uint8_t> matrix(64, 0);
+        for(std::size_t i = 0 ; i < s_SECONDS * 60 ; ++i)
+        {
+            if(i % 2 == 0)
+            {
+                writer.write(frames, double(i * 1000 / 60), frame);
+            }
+
+            writer.write(matrices, double(i * 1000 / 60), matrix);
+        }
+    }
+
+    std::optional<io::reader::recording_reader> reader;
+    {
+        FW_PROFILE("Recording, open");
+        reader.emplace(path);
+    }
+    CPPUNIT_ASSERT_EQUAL(s_SECONDS * 30, reader->size(0));
+
+    // Seek random timestamps and read the frame and the matrix at this time, like a scrubbing player does
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<double> distribution(0., double(s_SECONDS * 1000));
+    std::size_t checksum = 0;
+
+    {
+        FW_PROFILE("Recording, random seeks");
+        for(std::size_t i = 0 ; i < s_SEEKS ; ++i)
+        {
+            const double timestamp = distribution(generator);
+            for(std::uint32_t stream = 0 ; stream < 2 ; ++stream)
+            {
+                const auto index = std::min(reader->lower_bound(stream, timestamp), reader->size(stream) - 1);
+                checksum += reader->read(stream, index).data.size();
+            }
+        }
+    }
+
+    CPPUNIT_ASSERT(checksum > 0);
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::io::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -22,10 +22,7 @@
 
 #include "io/__/writer/gz_array_writer.hpp"
 
-#include <zlib.h>
-
-#include <filesystem>
-#include <iostream>
+#include "io/__/writer/parallel_gz_writer.hpp"
 
 namespace sight::io::writer
 {
@@ -38,30 +35,11 @@ void gz_array_writer::write()
 
     data::array::csptr array = this->get_concrete_object();
 
-    /// test if can open archive
-    gzFile raw_file = gzopen(this->get_file().string().c_str(), "wb1");
-    if(raw_file == nullptr)
-    {
-        std::string str = "gz_array_writer::write unable to open ";
-        str += get_file().string();
-        gzclose(raw_file);
-        throw std::ios_base::failure(str);
-    }
-
     const auto dump_lock = array->dump_lock();
 
-    // file is OK : process now
-    const std::size_t array_size_in_bytes = array->size_in_bytes();
-
-    const int uncompressed_bytes_written =
-        gzwrite(raw_file, array->buffer(), static_cast<unsigned int>(array_size_in_bytes));
-    gzclose(raw_file);
-    if(uncompressed_bytes_written != static_cast<int>(array_size_in_bytes))
-    {
-        std::string str = "gz_array_writer::write unable to write ";
-        str += get_file().string();
-        throw std::ios_base::failure(str);
-    }
+    // Compressed in parallel, in independent gzip members which are still readable by any gzip reader
+    io::writer::parallel_gz_writer writer(get_file());
+    writer.write(array->buffer(), array->size_in_bytes());
 }
 
 //------------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -22,11 +22,9 @@
 
 #include "io/__/writer/gz_buffer_image_writer.hpp"
 
-#include <data/image.hpp>
-
-#include <zlib.h>
+#include "io/__/writer/parallel_gz_writer.hpp"
 
-#include <iostream>
+#include <data/image.hpp>
 
 namespace sight::io::writer
 {
@@ -39,49 +37,11 @@ void gz_buffer_image_writer::write()
 
     data::image::csptr image = get_concrete_object();
 
-    /// test if can open archive
-    gzFile raw_file = gzopen(get_file().string().c_str(), "wb1");
-    SIGHT_ASSERT("rawFile not instanced", raw_file);
-    if(raw_file == nullptr)
-    {
-        std::string str = "gz_buffer_image_writer::write unable to open ";
-        str += get_file().string();
-        gzclose(raw_file);
-        throw std::ios_base::failure(str);
-    }
-
     const auto dump_lock = image->dump_lock();
 
-    // file is OK : process now
-    const std::size_t image_size_in_bytes = image->size_in_bytes();
-
-    const char* ptr           = static_cast<const char*>(image->buffer());
-    std::size_t written_bytes = 0;
-
-    int uncompressed_bytes_written = 0;
-
-    while(written_bytes < image_size_in_bytes
-          && (uncompressed_bytes_written =
-                  gzwrite(
-                      raw_file,
-                      ptr + written_bytes,
-                      static_cast<unsigned int>(image_size_in_bytes - written_bytes)
-                  )
-          ) > 0)
-    {
-        written_bytes += static_cast<std::size_t>(uncompressed_bytes_written);
-    }
-
-    gzclose(raw_file);
-
-    assert(uncompressed_bytes_written != 0 && written_bytes == image_size_in_bytes);
-
-    if(uncompressed_bytes_written != 0 && written_bytes == image_size_in_bytes)
-    {
-        std::string str = "gz_buffer_image_writer::write unable to write ";
-        str += get_file().string();
-        throw std::ios_base::failure(str);
-    }
+    // Compressed in parallel, in independent gzip members which are still readable by any gzip reader
+    io::writer::parallel_gz_writer writer(get_file());
+    writer.write(image->buffer(), image->size_in_bytes());
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,120 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/__/writer/matrix_timeline_writer.hpp"
+
+#include <core/exceptionmacros.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace sight::io::writer
+{
+
+//------------------------------------------------------------------------------
+
+matrix_timeline_writer::matrix_timeline_writer(
+    const std::filesystem::path& _path,
+    std::uint32_t _matrix_count,
+    bool _append
+) :
+    m_matrix_count(_matrix_count)
+{
+    std::error_code error;
+    const auto file_size = std::filesystem::file_size(_path, error);
+    const bool append    = _append && !error && file_size >= HEADER_SIZE;
+
+    if(append)
+    {
+        std::array<char, HEADER_SIZE> header {};
+        std::ifstream(_path, std::ios::binary).read(header.data(), header.size());
+
+        std::uint32_t version      = 0;
+        std::uint32_t matrix_count = 0;
+        std::memcpy(&version, header.data() + MAGIC.size(), sizeof(version));
+        std::memcpy(&matrix_count, header.data() + MAGIC.size() + sizeof(version), sizeof(matrix_count));
+
+        SIGHT_THROW_IF(
+            "Can not append to '" << _path.string() << "', it is not a matrix timeline file.",
+            std::string_view(header.data(), MAGIC.size()) != MAGIC || version != VERSION
+        );
+        SIGHT_THROW_IF(
+            "Can not append to '" << _path.string() << "', it holds " << matrix_count << " matrices per row instead of "
+            << _matrix_count << ".",
+            matrix_count != _matrix_count
+        );
+
+        // Drop the incomplete row of an interrupted recording, the next rows would be misaligned otherwise
+        const auto rows_size = file_size - HEADER_SIZE;
+        if(const auto remainder = rows_size % row_size(m_matrix_count); remainder != 0)
+        {
+            std::filesystem::resize_file(_path, file_size - remainder);
+        }
+    }
+
+    m_stream.open(_path, std::ios::binary | std::ios::out | (append ? std::ios::app : std::ios::trunc));
+    SIGHT_THROW_IF("The file '" << _path.string() << "' can not be opened.", !m_stream.good());
+
+    if(!append)
+    {
+        m_stream.write(MAGIC.data(), static_cast<std::streamsize>(MAGIC.size()));
+        m_stream.write(reinterpret_cast<const char*>(&VERSION), sizeof(VERSION));
+        m_stream.write(reinterpret_cast<const char*>(&m_matrix_count), sizeof(m_matrix_count));
+    }
+}
+
+//------------------------------------------------------------------------------
+
+matrix_timeline_writer::~matrix_timeline_writer()
+{
+    m_stream.flush();
+}
+
+//------------------------------------------------------------------------------
+
+void matrix_timeline_writer::write(double _timestamp, std::span<const matrix_t> _matrices)
+{
+    static constexpr matrix_t s_IDENTITY {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+
+    m_stream.write(reinterpret_cast<const char*>(&_timestamp), sizeof(_timestamp));
+
+    const std::size_t written = std::min(_matrices.size(), std::size_t(m_matrix_count));
+    m_stream.write(
+        reinterpret_cast<const char*>(_matrices.data()),
+        static_cast<std::streamsize>(written * sizeof(matrix_t))
+    );
+
+    for(std::size_t i = written ; i < m_matrix_count ; ++i)
+    {
+        m_stream.write(reinterpret_cast<const char*>(s_IDENTITY.data()), sizeof(matrix_t));
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void matrix_timeline_writer::flush()
+{
+    m_stream.flush();
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::io::writer
@@ -0,0 +1,114 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/__/config.hpp>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string_view>
+
+namespace sight::io::writer
+{
+
+/**
+ * @brief Writes a matrix timeline recording in a binary file, which reloads instantly with
+ * io::reader::matrix_timeline_reader.
+ *
+ * The file starts with a 16 bytes header: the magic "SIGHTMTL", the version and the number of matrices per row as
+ * 32 bits integers. It is followed by fixed-size rows: the timestamp as a double and the 16 floats of each matrix.
+ * Values are stored in the native byte order, which is little-endian on all our platforms.
+ *
+ * Since the number of rows is deduced from the file size, rows are appended as they come and a recording interrupted
+ * in the middle of a row is still valid, the incomplete row is ignored.
+ */
+class SIGHT_IO_CLASS_API matrix_timeline_writer final
+{
+public:
+
+    /// Values of a 4x4 matrix, in row-major order
+    using matrix_t = std::array<float, 16>;
+
+    /// Extension of the binary files
+    static constexpr std::string_view EXTENSION = ".tlm";
+
+    /// First bytes of the binary files
+    static constexpr std::string_view MAGIC = "SIGHTMTL";
+
+    /// Version of the format
+    static constexpr std::uint32_t VERSION = 1;
+
+    /// Size of the header
+    static constexpr std::size_t HEADER_SIZE = 16;
+
+    /// Returns the size of a row
+    static constexpr std::size_t row_size(std::size_t _matrix_count)
+    {
+        return sizeof(double) + (_matrix_count * sizeof(matrix_t));
+    }
+
+    /**
+     * @brief Opens the file.
+     *
+     * @param _path path of the file
+     * @param _matrix_count number of matrices of each row
+     * @param _append if true and the file exists, the rows are appended to it, otherwise the file is truncated
+     * @throw core::exception if the file can not be opened or if the file to append to holds another number of
+     *        matrices
+     */
+    SIGHT_IO_API matrix_timeline_writer(
+        const std::filesystem::path& _path,
+        std::uint32_t _matrix_count,
+        bool _append = false
+    );
+
+    /// Destructor, flushes the file
+    SIGHT_IO_API ~matrix_timeline_writer();
+
+    /// Returns the number of matrices of each row
+    [[nodiscard]] std::uint32_t matrix_count() const
+    {
+        return m_matrix_count;
+    }
+
+    /**
+     * @brief Writes a row.
+     *
+     * @param _timestamp timestamp of the matrices
+     * @param _matrices matrices of the row, the missing ones are written as identity, the extra ones are ignored
+     */
+    SIGHT_IO_API void write(double _timestamp, std::span<const matrix_t> _matrices);
+
+    /// Flushes the rows written so far
+    SIGHT_IO_API void flush();
+
+private:
+
+    std::ofstream m_stream;
+
+    const std::uint32_t m_matrix_count;
+};
+
+} // namespace sight::io::writer
@@ -0,0 +1,218 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/__/writer/parallel_gz_writer.hpp"
+
+#include <core/exceptionmacros.hpp>
+
+#include <zlib.h>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <exception>
+#include <vector>
+
+namespace sight::io::writer
+{
+
+//------------------------------------------------------------------------------
+
+static void write_le32(std::uint8_t* _destination, std::uint32_t _value)
+{
+    for(std::size_t i = 0 ; i < 4 ; ++i)
+    {
+        _destination[i] = static_cast<std::uint8_t>(_value >> (8 * i));
+    }
+}
+
+//------------------------------------------------------------------------------
+
+/// Compresses a block into a complete gzip member
+static void compress_block(
+    z_stream& _stream,
+    const std::uint8_t* _block,
+    std::size_t _size,
+    std::vector<std::uint8_t>& _member
+)
+{
+    constexpr auto header_size  = parallel_gz_writer::MEMBER_HEADER_SIZE;
+    constexpr auto trailer_size = parallel_gz_writer::MEMBER_TRAILER_SIZE;
+
+    SIGHT_THROW_IF("deflateReset() failed.", deflateReset(&_stream) != Z_OK);
+
+    _member.resize(header_size + deflateBound(&_stream, uLong(_size)) + trailer_size);
+
+    _stream.next_in   = const_cast<Bytef*>(_block);
+    _stream.avail_in  = uInt(_size);
+    _stream.next_out  = _member.data() + header_size;
+    _stream.avail_out = uInt(_member.size() - header_size - trailer_size);
+
+    SIGHT_THROW_IF("deflate() failed.", deflate(&_stream, Z_FINISH) != Z_STREAM_END);
+
+    const std::size_t member_size = header_size + _stream.total_out + trailer_size;
+    _member.resize(member_size);
+
+    // Header: magic, deflate, FEXTRA flag, no modification time, no extra flags, unknown OS
+    std::uint8_t* const header = _member.data();
+    header[0] = 0x1f;
+    header[1] = 0x8b;
+    header[2] = Z_DEFLATED;
+    header[3] = 0x04;
+    write_le32(header + 4, 0);
+    header[8] = 0;
+    header[9] = 0xff;
+
+    // Extra field: its length, then the "SG" sub-field holding the member size
+    header[10] = 8;
+    header[11] = 0;
+    header[12] = std::uint8_t(parallel_gz_writer::EXTRA_ID[0]);
+    header[13] = std::uint8_t(parallel_gz_writer::EXTRA_ID[1]);
+    header[14] = 4;
+    header[15] = 0;
+    write_le32(header + 16, std::uint32_t(member_size));
+
+    // Trailer: CRC32 and size of the uncompressed data
+    std::uint8_t* const trailer = _member.data() + member_size - trailer_size;
+    write_le32(trailer, std::uint32_t(crc32(0L, _block, uInt(_size))));
+    write_le32(trailer + 4, std::uint32_t(_size));
+}
+
+//------------------------------------------------------------------------------
+
+parallel_gz_writer::parallel_gz_writer(const std::filesystem::path& _path, options _options) :
+    m_options(_options),
+    m_stream(_path, std::ios::binary | std::ios::out | (_options.append ? std::ios::app : std::ios::trunc))
+{
+    SIGHT_THROW_IF("The file '" << _path.string() << "' can not be opened.", !m_stream.good());
+    SIGHT_THROW_IF(
+        "Invalid compression level " << m_options.compression_level << ", it must be between 0 and 9.",
+        m_options.compression_level < 0 || m_options.compression_level > Z_BEST_COMPRESSION
+    );
+
+    // The member size is stored on 32 bits, the compressed size of a block may be a bit larger than its size
+    SIGHT_THROW_IF(
+        "Invalid block size " << m_options.block_size << ", it must be between 1 and 1 GiB.",
+        m_options.block_size == 0 || m_options.block_size > (std::size_t(1) << 30)
+    );
+}
+
+//------------------------------------------------------------------------------
+
+parallel_gz_writer::parallel_gz_writer(const std::filesystem::path& _path) :
+    parallel_gz_writer(_path, options {})
+{
+}
+
+//------------------------------------------------------------------------------
+
+void parallel_gz_writer::write(const void* _data, std::size_t _size, const progress_callback_t& _progress)
+{
+    SIGHT_THROW_IF("The file is closed.", !m_stream.is_open());
+
+    const auto* const data       = static_cast<const std::uint8_t*>(_data);
+    const std::size_t block_size = m_options.block_size;
+    const std::size_t num_blocks = std::max((_size + block_size - 1) / block_size, std::size_t(1));
+
+    const int threads = m_options.threads == 0 ? omp_get_max_threads() : static_cast<int>(m_options.threads);
+
+    // Blocks are compressed by batches, so only the members of a batch are kept in memory
+    const std::size_t batch_size = std::size_t(threads) * 4;
+    std::vector<std::vector<std::uint8_t> > members(std::min(batch_size, num_blocks));
+
+    for(std::size_t first = 0 ; first < num_blocks ; first += batch_size)
+    {
+        const std::size_t last = std::min(first + batch_size, num_blocks);
+        std::exception_ptr error;
+
+        #pragma omp parallel num_threads(threads)
+        {
+            z_stream stream {};
+            const bool initialized = deflateInit2(
+                &stream,
+                m_options.compression_level,
+                Z_DEFLATED,
+                -MAX_WBITS,
+                8,
+                Z_DEFAULT_STRATEGY
+            ) == Z_OK;
+
+            #pragma omp for schedule(dynamic)
+            for(std::int64_t i = std::int64_t(first) ; i < std::int64_t(last) ; ++i)
+            {
+                try
+                {
+                    SIGHT_THROW_IF("deflateInit2() failed.", !initialized);
+
+                    const std::size_t offset = std::size_t(i) * block_size;
+                    compress_block(
+                        stream,
+                        data + offset,
+                        std::min(block_size, _size - offset),
+                        members[std::size_t(i) - first]
+                    );
+                }
+                catch(...)
+                {
+                    #pragma omp critical
+                    error = std::current_exception();
+                }
+            }
+
+            if(initialized)
+            {
+                deflateEnd(&stream);
+            }
+        }
+
+        if(error)
+        {
+            std::rethrow_exception(error);
+        }
+
+        for(std::size_t i = first ; i < last ; ++i)
+        {
+            const auto& member = members[i - first];
+            m_stream.write(reinterpret_cast<const char*>(member.data()), std::streamsize(member.size()));
+        }
+
+        SIGHT_THROW_IF("The file can not be written.", !m_stream.good());
+
+        if(_progress)
+        {
+            _progress(double(last) / double(num_blocks));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void parallel_gz_writer::close()
+{
+    if(m_stream.is_open())
+    {
+        m_stream.close();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::io::writer
@@ -0,0 +1,114 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/__/config.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string_view>
+
+namespace sight::io::writer
+{
+
+/**
+ * @brief Writes gzip files that can be compressed and decompressed in parallel, read back by
+ * io::reader::parallel_gz_reader.
+ *
+ * The data are cut in blocks which are compressed independently by several threads, each block being written as a
+ * complete gzip member. A gzip file may hold several members, so the files remain readable by any gzip reader, like
+ * zlib gzread() or gunzip.
+ *
+ * Each member header holds an extra field "SG" with the compressed size of the member, so the reader finds all the
+ * members by reading their headers only, and then decompresses them in parallel. This is the same idea as the BGZF
+ * format, but with a 32 bits size so blocks are not limited to 64 KiB.
+ */
+class SIGHT_IO_CLASS_API parallel_gz_writer final
+{
+public:
+
+    /// Identifier of the extra field holding the compressed size of a member
+    static constexpr std::string_view EXTRA_ID = "SG";
+
+    /// Size of the header of the members, including the extra field
+    static constexpr std::size_t MEMBER_HEADER_SIZE = 20;
+
+    /// Size of the trailer of the members: the CRC32 and the uncompressed size
+    static constexpr std::size_t MEMBER_TRAILER_SIZE = 8;
+
+    /// Options of the writer
+    struct options
+    {
+        /// zlib compression level, from 0 to 9
+        int compression_level {1};
+
+        /// Size of the uncompressed blocks, smaller blocks allow more parallelism but compress a bit less
+        std::size_t block_size {std::size_t(1) << 20};
+
+        /// Number of compression threads, 0 uses all the cores
+        std::size_t threads {0};
+
+        /// Appends to the file instead of truncating it
+        bool append {false};
+    };
+
+    /// Called between batches of blocks with the ratio of data written, may throw to cancel the writing
+    using progress_callback_t = std::function<void (double)>;
+
+    /**
+     * @brief Opens the file.
+     *
+     * @throw core::exception if the file can not be opened or if the options are invalid
+     */
+    SIGHT_IO_API explicit parallel_gz_writer(const std::filesystem::path& _path, options _options);
+
+    /// @copydoc parallel_gz_writer(const std::filesystem::path&, options)
+    SIGHT_IO_API explicit parallel_gz_writer(const std::filesystem::path& _path);
+
+    /// Destructor, closes the file
+    SIGHT_IO_API ~parallel_gz_writer() = default;
+
+    /**
+     * @brief Compresses and appends data to the file.
+     *
+     * Several calls append more members, data written by different calls never share a member. This allows, for
+     * instance, to decompress an image without decompressing its header.
+     *
+     * @throw core::exception if the data can not be compressed or written
+     */
+    SIGHT_IO_API void write(const void* _data, std::size_t _size, const progress_callback_t& _progress = nullptr);
+
+    /// Closes the file, further writes throw
+    SIGHT_IO_API void close();
+
+private:
+
+    /// Options of the writer
+    const options m_options;
+
+    /// Output file
+    std::ofstream m_stream;
+};
+
+} // namespace sight::io::writer
@@ -0,0 +1,236 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/__/writer/recording_writer.hpp"
+
+#include <core/exceptionmacros.hpp>
+#include <core/spy_log.hpp>
+
+#include <zlib.h>
+
+namespace sight::io::writer
+{
+
+//------------------------------------------------------------------------------
+
+template<typename T>
+static void write_value(std::ofstream& _stream, const T& _value)
+{
+    _stream.write(reinterpret_cast<const char*>(&_value), sizeof(T));
+}
+
+//------------------------------------------------------------------------------
+
+recording_writer::recording_writer(const std::filesystem::path& _path, options _options) :
+    m_options(_options),
+    m_stream(_path, std::ios::binary | std::ios::out | std::ios::trunc)
+{
+    SIGHT_THROW_IF("The file '" << _path.string() << "' can not be opened.", !m_stream.good());
+    SIGHT_THROW_IF(
+        "Invalid compression level " << m_options.compression_level << ", it must be between 0 and 9.",
+        m_options.compression_level < 0 || m_options.compression_level > Z_BEST_COMPRESSION
+    );
+
+    m_stream.write(MAGIC.data(), static_cast<std::streamsize>(MAGIC.size()));
+    write_value(m_stream, VERSION);
+    write_value(m_stream, std::uint32_t(0));
+}
+
+//------------------------------------------------------------------------------
+
+recording_writer::recording_writer(const std::filesystem::path& _path) :
+    recording_writer(_path, options {})
+{
+}
+
+//------------------------------------------------------------------------------
+
+recording_writer::~recording_writer()
+{
+    try
+    {
+        this->close();
+    }
+    catch(const std::exception& e)
+    {
+        SIGHT_ERROR("The recording can not be closed: " << e.what());
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::uint32_t recording_writer::add_stream(const std::string& _name, const std::string& _metadata)
+{
+    SIGHT_THROW_IF("The recording is closed.", !m_stream.is_open());
+
+    const auto index = static_cast<std::uint32_t>(m_pending.size());
+    m_pending.emplace_back();
+
+    write_block_header(
+        block_t::stream,
+        index,
+        (2 * sizeof(std::uint32_t)) + _name.size() + _metadata.size()
+    );
+
+    for(const auto* const text : {&_name, &_metadata})
+    {
+        write_value(m_stream, static_cast<std::uint32_t>(text->size()));
+        m_stream.write(text->data(), static_cast<std::streamsize>(text->size()));
+    }
+
+    return index;
+}
+
+//------------------------------------------------------------------------------
+
+void recording_writer::write(std::uint32_t _stream, double _timestamp, std::span<const std::uint8_t> _data)
+{
+    SIGHT_THROW_IF("The recording is closed.", !m_stream.is_open());
+    SIGHT_THROW_IF("Stream " << _stream << " is not declared.", _stream >= m_pending.size());
+
+    auto& pending = m_pending[_stream];
+
+    const bool older = !pending.timestamps.empty() && _timestamp < pending.timestamps.back();
+    SIGHT_WARN_IF(
+        "Record at " << _timestamp << " is older than the previous record of stream " << _stream << ", it is ignored.",
+        older
+    );
+    if(older)
+    {
+        return;
+    }
+
+    pending.timestamps.push_back(_timestamp);
+    pending.offsets.push_back(pending.data.size());
+    pending.sizes.push_back(_data.size());
+    pending.data.insert(pending.data.end(), _data.begin(), _data.end());
+
+    if(pending.data.size() >= m_options.chunk_size || pending.timestamps.size() >= m_options.chunk_records)
+    {
+        this->flush_chunk(_stream);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void recording_writer::flush()
+{
+    if(!m_stream.is_open())
+    {
+        return;
+    }
+
+    for(std::uint32_t i = 0 ; i < m_pending.size() ; ++i)
+    {
+        this->flush_chunk(i);
+    }
+
+    m_stream.flush();
+}
+
+//------------------------------------------------------------------------------
+
+void recording_writer::close()
+{
+    if(!m_stream.is_open())
+    {
+        return;
+    }
+
+    this->flush();
+    m_stream.close();
+    m_pending.clear();
+}
+
+//------------------------------------------------------------------------------
+
+void recording_writer::write_block_header(block_t _type, std::uint32_t _stream, std::uint64_t _size)
+{
+    write_value(m_stream, static_cast<std::uint32_t>(_type));
+    write_value(m_stream, _stream);
+    write_value(m_stream, _size);
+}
+
+//------------------------------------------------------------------------------
+
+void recording_writer::flush_chunk(std::uint32_t _stream)
+{
+    auto& pending = m_pending[_stream];
+    if(pending.timestamps.empty())
+    {
+        return;
+    }
+
+    const std::uint8_t* stored   = pending.data.data();
+    std::uint64_t stored_size    = pending.data.size();
+    compression_t compression    = compression_t::none;
+    const std::uint64_t raw_size = pending.data.size();
+
+    if(m_options.compression_level > 0 && raw_size > 0)
+    {
+        auto compressed_size = compressBound(static_cast<uLong>(raw_size));
+        m_compressed.resize(compressed_size);
+
+        const int result = compress2(
+            m_compressed.data(),
+            &compressed_size,
+            pending.data.data(),
+            static_cast<uLong>(raw_size),
+            m_options.compression_level
+        );
+
+        // Data which do not compress, like already encoded frames, are stored as is
+        if(result == Z_OK && compressed_size < raw_size)
+        {
+            stored      = m_compressed.data();
+            stored_size = compressed_size;
+            compression = compression_t::zlib;
+        }
+    }
+
+    const auto count = static_cast<std::uint32_t>(pending.timestamps.size());
+
+    write_block_header(block_t::chunk, _stream, CHUNK_HEADER_SIZE + (count * ENTRY_SIZE) + stored_size);
+
+    write_value(m_stream, count);
+    write_value(m_stream, static_cast<std::uint32_t>(compression));
+    write_value(m_stream, raw_size);
+    write_value(m_stream, stored_size);
+
+    for(std::size_t i = 0 ; i < count ; ++i)
+    {
+        write_value(m_stream, pending.timestamps[i]);
+        write_value(m_stream, pending.offsets[i]);
+        write_value(m_stream, pending.sizes[i]);
+    }
+
+    m_stream.write(reinterpret_cast<const char*>(stored), static_cast<std::streamsize>(stored_size));
+    SIGHT_THROW_IF("The recording can not be written.", !m_stream.good());
+
+    pending.timestamps.clear();
+    pending.offsets.clear();
+    pending.sizes.clear();
+    pending.data.clear();
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::io::writer
@@ -0,0 +1,161 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/__/config.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sight::io::writer
+{
+
+/**
+ * @brief Writes several timelines in a single chunked recording file, read back by io::reader::recording_reader.
+ *
+ * Each stream gathers the records of a timeline, a record being a timestamp and an opaque buffer. Records are kept
+ * in memory until their chunk is full, then the chunk is appended to the file, optionally compressed with zlib. Each
+ * chunk starts with the table of its records, which is never compressed, so the reader seeks any timestamp without
+ * decompressing anything.
+ *
+ * The file starts with a 16 bytes header: the magic "SIGHTREC", the version and a reserved 32 bits integer. It is
+ * followed by blocks, each one starting with its type, its stream and the size of its payload:
+ * - a stream block declares a stream: the length and the characters of its name, then of its metadata,
+ * - a chunk block holds records: their number, the compression, the size of the uncompressed and of the stored data,
+ *   then a table with the timestamp, the offset and the size of each record in the uncompressed data, then the data.
+ *
+ * There is no trailing index, the reader builds it from the block headers. A recording interrupted before close()
+ * thus remains readable, only the pending chunks are lost. Values are stored in the native byte order, which is
+ * little-endian on all our platforms.
+ */
+class SIGHT_IO_CLASS_API recording_writer final
+{
+public:
+
+    /// Extension of the recording files
+    static constexpr std::string_view EXTENSION = ".srec";
+
+    /// First bytes of the recording files
+    static constexpr std::string_view MAGIC = "SIGHTREC";
+
+    /// Version of the format
+    static constexpr std::uint32_t VERSION = 1;
+
+    /// Sizes of the file header, of the block headers, of the chunk headers and of the entries of the record tables
+    static constexpr std::size_t HEADER_SIZE       = 16;
+    static constexpr std::size_t BLOCK_HEADER_SIZE = 16;
+    static constexpr std::size_t CHUNK_HEADER_SIZE = 24;
+    static constexpr std::size_t ENTRY_SIZE        = 24;
+
+    /// Type of a block
+    enum class block_t : std::uint32_t
+    {
+        stream = 1,
+        chunk  = 2
+    };
+
+    /// Compression of the data of a chunk
+    enum class compression_t : std::uint32_t
+    {
+        none = 0,
+        zlib = 1
+    };
+
+    /// Options of the writer
+    struct options
+    {
+        /// A chunk is written once its data reach this size...
+        std::size_t chunk_size {std::size_t(1) << 20};
+
+        /// ... or once it holds this number of records, so slow streams are not kept in memory for too long
+        std::size_t chunk_records {256};
+
+        /// zlib compression level of the chunks, from 1 to 9, 0 disables the compression
+        int compression_level {0};
+    };
+
+    /**
+     * @brief Creates the file, truncating it if it exists.
+     *
+     * @throw core::exception if the file can not be opened
+     */
+    SIGHT_IO_API explicit recording_writer(const std::filesystem::path& _path, options _options);
+
+    /// @copydoc recording_writer(const std::filesystem::path&, options)
+    SIGHT_IO_API explicit recording_writer(const std::filesystem::path& _path);
+
+    /// Destructor, writes the pending chunks
+    SIGHT_IO_API ~recording_writer();
+
+    /**
+     * @brief Declares a stream.
+     *
+     * @param _name name of the stream, usually the identifier of the recorded timeline
+     * @param _metadata anything required to replay the stream, like the format of the frames
+     * @return the index of the stream, to be given to write()
+     */
+    SIGHT_IO_API std::uint32_t add_stream(const std::string& _name, const std::string& _metadata);
+
+    /**
+     * @brief Adds a record to a stream.
+     *
+     * The timestamps of a stream must not decrease, records with an older timestamp than the previous one are ignored.
+     */
+    SIGHT_IO_API void write(std::uint32_t _stream, double _timestamp, std::span<const std::uint8_t> _data);
+
+    /// Writes the pending chunks of all streams
+    SIGHT_IO_API void flush();
+
+    /// Writes the pending chunks and closes the file, further calls are ignored
+    SIGHT_IO_API void close();
+
+private:
+
+    /// Records of a stream which are not written yet
+    struct pending_chunk
+    {
+        std::vector<double> timestamps;
+        std::vector<std::uint64_t> offsets;
+        std::vector<std::uint64_t> sizes;
+        std::vector<std::uint8_t> data;
+    };
+
+    void write_block_header(block_t _type, std::uint32_t _stream, std::uint64_t _size);
+
+    void flush_chunk(std::uint32_t _stream);
+
+    const options m_options;
+
+    std::ofstream m_stream;
+
+    std::vector<pending_chunk> m_pending;
+
+    /// Buffer of the compressed data, kept to reuse its allocation
+    std::vector<std::uint8_t> m_compressed;
+};
+
+} // namespace sight::io::writer
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -160,8 +160,8 @@ public:
         // Use the defaults from libJPEG
         jpeg_set_defaults(&m_cinfo);
 
-        // Set the quality to max
-        jpeg_set_quality(&m_cinfo, 100, true);
+        // Set the quality, the maximum by default
+        jpeg_set_quality(&m_cinfo, m_quality, true);
 
         // Optimize or not huffman code. 10% slower - 20% smaller
         switch(_mode)
@@ -299,6 +299,9 @@ public:
 
     bool m_valid {false};
     static constexpr std::string_view m_name {"LibJPEGWriter"};
+
+    /// JPEG quality, from 1 to 100
+    int m_quality {100};
 };
 
 } // namespace sight::io::bitmap::detail
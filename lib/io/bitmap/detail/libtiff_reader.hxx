@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -24,6 +24,17 @@
 #include "libtiff_common.hxx"
 #include "reader_impl.hxx"
 
+#include <omp.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <vector>
+
 // cspell:ignore nvjpeg NOLINTNEXTLINE TIFFTAG IMAGEWIDTH IMAGELENGTH BITSPERSAMPLE SAMPLESPERPIXEL MINISBLACK
 // cspell:ignore PLANARCONFIG TOPLEFT ROWSPERSTRIP Scanline XRESOLUTION YRESOLUTION thandle SAMPLEFORMAT
 // cspell:ignore PACKBITS EXTRASAMPLE RESOLUTIONUNIT RESUNIT EXTRASAMPLES tiffio tmsize
@@ -48,180 +59,482 @@ public:
     /// Destructor
     inline ~lib_tiff_reader() noexcept = default;
 
+    /// Decoding options
+    struct options
+    {
+        /// Rectangle to decode, the whole page if not set
+        std::optional<reader::region> region;
+
+        /// Read all the pages into a 3D image
+        bool multi_page {false};
+
+        /// Number of decoding threads, 0 uses all the cores
+        std::size_t threads {0};
+
+        /// File the stream was opened from, other threads open it again to decode concurrently
+        std::filesystem::path path;
+    };
+
     /// Reading
     inline void read(data::image& _image, std::istream& _istream, flag /*flag*/)
     {
-        // Create an RAII to be sure everything is cleaned at exit
-        struct keeper final
-        {
-            inline ~keeper()
-            {
-                if(m_tiff != nullptr)
-                {
-                    TIFFClose(m_tiff);
-                    m_tiff = nullptr;
-                }
-            }
-
-            TIFF* m_tiff {nullptr};
-        } keeper;
+        read(_image, _istream, options {});
+    }
 
+    /// Reading with options
+    inline void read(data::image& _image, std::istream& _istream, const options& _options)
+    {
         // Open the tiff file for reading
+        tiff_keeper keeper;
         keeper.m_tiff = tiff_stream_open(_istream);
         SIGHT_THROW_IF("TIFFOpen() failed.", keeper.m_tiff == nullptr);
 
-        // Get the image size and format
-        std::uint32_t width              = 0;
-        std::uint32_t height             = 0;
-        std::uint16_t samples_per_pixels = 0;
-        std::uint16_t sample_format      = 0;
-        std::uint16_t bits_per_sample    = 0;
-        std::uint16_t photometric        = 0;
-        std::uint16_t planar_config      = 0;
-
-        CHECK_TIFF(TIFFGetField(keeper.m_tiff, TIFFTAG_IMAGEWIDTH, &width));
-        CHECK_TIFF(TIFFGetField(keeper.m_tiff, TIFFTAG_IMAGELENGTH, &height));
-        CHECK_TIFF(TIFFGetField(keeper.m_tiff, TIFFTAG_SAMPLESPERPIXEL, &samples_per_pixels));
-        CHECK_TIFF(TIFFGetField(keeper.m_tiff, TIFFTAG_BITSPERSAMPLE, &bits_per_sample));
-        CHECK_TIFF(TIFFGetField(keeper.m_tiff, TIFFTAG_PHOTOMETRIC, &photometric));
-        CHECK_TIFF(TIFFGetField(keeper.m_tiff, TIFFTAG_PLANARCONFIG, &planar_config));
+        const format first_format = read_format(keeper.m_tiff);
+        const auto width          = first_format.width;
+        const auto height         = first_format.height;
 
-        // Sample format may be not present
-        if(TIFFGetField(keeper.m_tiff, TIFFTAG_SAMPLEFORMAT, &sample_format) != 1)
-        {
-            sample_format = SAMPLEFORMAT_UINT;
-        }
+        const auto num_pages = static_cast<std::uint16_t>(
+            _options.multi_page ? TIFFNumberOfDirectories(keeper.m_tiff) : 1
+        );
+        SIGHT_THROW_IF("No page found.", num_pages == 0);
+
+        // Rectangle to decode
+        const std::array<std::uint32_t, 2> origin {
+            _options.region ? std::uint32_t(_options.region->origin[0]) : 0,
+            _options.region ? std::uint32_t(_options.region->origin[1]) : 0
+        };
+        const std::array<std::uint32_t, 2> size {
+            _options.region ? std::uint32_t(_options.region->size[0]) : width,
+            _options.region ? std::uint32_t(_options.region->size[1]) : height
+        };
+
+        SIGHT_THROW_IF(
+            "The region [" << origin[0] << ", " << origin[1] << "] + [" << size[0] << ", " << size[1]
+            << "] is outside of the " << width << "x" << height << " image.",
+            size[0] == 0 || size[1] == 0 || std::uint64_t(origin[0]) + size[0] > width
+            || std::uint64_t(origin[1]) + size[1] > height
+        );
 
-        // Depending of the format, we use scanline approach if possible, or libtiff automatic rgba conversion if we are
-        // not able to interpret pixels data
-        if(samples_per_pixels > 4
-           || (sample_format != SAMPLEFORMAT_UINT
-               && sample_format != SAMPLEFORMAT_INT
-               && sample_format != SAMPLEFORMAT_IEEEFP)
-           || (photometric != PHOTOMETRIC_MINISBLACK
-               && photometric != PHOTOMETRIC_RGB)
-           || (planar_config != PLANARCONFIG_CONTIG))
+        // Depending of the format, we decode tiles or strips directly if possible, or use libtiff automatic rgba
+        // conversion if we are not able to interpret pixels data
+        if(first_format.samples_per_pixels > 4
+           || (first_format.sample_format != SAMPLEFORMAT_UINT
+               && first_format.sample_format != SAMPLEFORMAT_INT
+               && first_format.sample_format != SAMPLEFORMAT_IEEEFP)
+           || (first_format.photometric != PHOTOMETRIC_MINISBLACK
+               && first_format.photometric != PHOTOMETRIC_RGB)
+           || (first_format.planar_config != PLANARCONFIG_CONTIG))
         {
             // TIFFReadRGBAImage approach
             // Allocate destination image
             _image.resize(
-                {width, height, 0},
-                sample_format == SAMPLEFORMAT_INT ? core::type::INT8 : core::type::UINT8,
+                {size[0], size[1], num_pages > 1 ? std::size_t(num_pages) : 0},
+                first_format.sample_format == SAMPLEFORMAT_INT ? core::type::INT8 : core::type::UINT8,
                 data::image::pixel_format_t::rgba
             );
 
-            CHECK_TIFF(
-                TIFFReadRGBAImage(
-                    keeper.m_tiff,
-                    width,
-                    height,
-                    reinterpret_cast<std::uint32_t*>(_image.buffer()),
-                    0
-                )
-            );
+            const bool whole_page = size[0] == width && size[1] == height;
+
+            for(std::uint16_t page = 0 ; page < num_pages ; ++page)
+            {
+                set_page(keeper.m_tiff, page, first_format);
+
+                auto* const slice = reinterpret_cast<std::uint32_t*>(_image.buffer())
+                                    + std::size_t(page) * size[0] * size[1];
+
+                if(whole_page)
+                {
+                    CHECK_TIFF(TIFFReadRGBAImage(keeper.m_tiff, width, height, slice, 0));
+                }
+                else
+                {
+                    read_rgba_region(keeper.m_tiff, origin, size, height, slice);
+                }
+            }
+
+            return;
         }
-        else
+
+        // Allocate destination image
+        _image.resize(
+            {size[0], size[1], num_pages > 1 ? std::size_t(num_pages) : 0},
+            component_type(first_format),
+            pixel_format(first_format)
+        );
+
+        const std::size_t pixel_size = std::size_t(first_format.samples_per_pixels) * first_format.bits_per_sample / 8;
+
+        // List the tiles or strips overlapping the region, in every page
+        std::vector<unit> units;
+        std::size_t buffer_size = 0;
+        for(std::uint16_t page = 0 ; page < num_pages ; ++page)
         {
-            // Scanline approach
-            // Convert bits_per_sample to Sight format
-            const auto component_type =
-                [&]
-                {
-                    if(sample_format == SAMPLEFORMAT_IEEEFP)
-                    {
-                        switch(bits_per_sample)
-                        {
-                            case 32:
-                                return core::type::FLOAT;
+            set_page(keeper.m_tiff, page, first_format);
 
-                            case 64:
-                                return core::type::DOUBLE;
+            const bool tiled          = TIFFIsTiled(keeper.m_tiff) != 0;
+            std::uint32_t unit_width  = width;
+            std::uint32_t unit_height = height;
 
-                            default:
-                                SIGHT_THROW("Unsupported bit depth for float format: '" << bits_per_sample << "'");
-                        }
-                    }
-                    else if(sample_format == SAMPLEFORMAT_UINT)
-                    {
-                        switch(bits_per_sample)
+            if(tiled)
+            {
+                CHECK_TIFF(TIFFGetField(keeper.m_tiff, TIFFTAG_TILEWIDTH, &unit_width));
+                CHECK_TIFF(TIFFGetField(keeper.m_tiff, TIFFTAG_TILELENGTH, &unit_height));
+                buffer_size = std::max(buffer_size, std::size_t(TIFFTileSize(keeper.m_tiff)));
+            }
+            else
+            {
+                CHECK_TIFF(TIFFGetFieldDefaulted(keeper.m_tiff, TIFFTAG_ROWSPERSTRIP, &unit_height));
+                unit_height = std::min(unit_height, height);
+                buffer_size = std::max(buffer_size, std::size_t(TIFFStripSize(keeper.m_tiff)));
+            }
+
+            for(std::uint32_t y = origin[1] / unit_height * unit_height ; y < origin[1] + size[1] ; y += unit_height)
+            {
+                for(std::uint32_t x = origin[0] / unit_width * unit_width ; x < origin[0] + size[0] ; x += unit_width)
+                {
+                    units.push_back(
                         {
-                            case 8:
-                                return core::type::UINT8;
+                            .page   = page,
+                            .index  = tiled ? TIFFComputeTile(keeper.m_tiff, x, y, 0, 0)
+                                            : TIFFComputeStrip(keeper.m_tiff, y, 0),
+                            .tiled  = tiled,
+                            .x      = x,
+                            .y      = y,
+                            .width  = unit_width,
+                            .height = unit_height
+                        });
+                }
+            }
+        }
 
-                            case 16:
-                                return core::type::UINT16;
+        // libtiff handles can not be shared between threads, so each thread decodes with its own one. A stream can
+        // not be opened again, so it is decoded by the calling thread only. By default, small images are decoded by
+        // the calling thread too, since opening the file again costs more than decoding them.
+        std::size_t max_threads = _options.threads;
+        if(_options.path.empty())
+        {
+            max_threads = 1;
+        }
+        else if(max_threads == 0)
+        {
+            max_threads = std::min(
+                std::size_t(omp_get_max_threads()),
+                _image.size_in_bytes() / MIN_BYTES_PER_THREAD
+            );
+        }
 
-                            case 32:
-                                return core::type::UINT32;
+        const int threads = static_cast<int>(std::clamp(units.size(), std::size_t(1), std::max(max_threads, std::size_t(1))));
 
-                            case 64:
-                                return core::type::UINT64;
+        auto* const buffer = static_cast<std::uint8_t*>(_image.buffer());
+        std::exception_ptr error;
 
-                            default:
-                                SIGHT_THROW("Unsupported bits per sample: '" << bits_per_sample << "'");
-                        }
-                    }
-                    else if(sample_format == SAMPLEFORMAT_INT)
-                    {
-                        switch(bits_per_sample)
-                        {
-                            case 8:
-                                return core::type::INT8;
+        #pragma omp parallel num_threads(threads)
+        {
+            std::ifstream thread_stream;
+            tiff_keeper thread_keeper;
+            TIFF* tiff = keeper.m_tiff;
 
-                            case 16:
-                                return core::type::INT16;
+            if(omp_get_thread_num() != 0)
+            {
+                try
+                {
+                    thread_stream.open(_options.path, std::ios::in | std::ios::binary);
+                    thread_keeper.m_tiff = tiff_stream_open(thread_stream);
+                    SIGHT_THROW_IF("TIFFOpen() failed.", thread_keeper.m_tiff == nullptr);
+                }
+                catch(...)
+                {
+                    #pragma omp critical
+                    error = std::current_exception();
+                }
 
-                            case 32:
-                                return core::type::INT32;
+                tiff = thread_keeper.m_tiff;
+            }
 
-                            case 64:
-                                return core::type::INT64;
+            std::vector<std::uint8_t> unit_buffer(buffer_size);
 
-                            default:
-                                SIGHT_THROW("Unsupported bits per sample: '" << bits_per_sample << "'");
-                        }
-                    }
-                    else
+            // The units are sorted by page, so each thread decodes a contiguous run of them, mostly from the same
+            // page, and rarely changes of directory
+            #pragma omp for schedule(static)
+            for(std::int64_t i = 0 ; i < std::int64_t(units.size()) ; ++i)
+            {
+                if(tiff == nullptr)
+                {
+                    continue;
+                }
+
+                try
+                {
+                    const auto& u = units[std::size_t(i)];
+                    if(TIFFCurrentDirectory(tiff) != u.page)
                     {
-                        SIGHT_THROW("Unsupported sample format: '" << sample_format << "'");
+                        CHECK_TIFF(TIFFSetDirectory(tiff, u.page));
                     }
-                }();
 
-            // Convert photometric to Sight format. Except PHOTOMETRIC_MINISBLACK and PHOTOMETRIC_RGB all others are
-            // decoded with TIFFReadRGBAImage, so we only look at sample per pixels
-            const auto pixel_format =
-                [&]
+                    decode_unit(tiff, u, unit_buffer, width, height, pixel_size, origin, size, buffer);
+                }
+                catch(...)
                 {
-                    switch(samples_per_pixels)
-                    {
-                        case 1:
-                            return data::image::pixel_format_t::gray_scale;
+                    #pragma omp critical
+                    error = std::current_exception();
+                }
+            }
+        }
+
+        if(error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
 
-                        case 2:
-                            return data::image::pixel_format_t::rg;
+private:
 
-                        case 3:
-                            return data::image::pixel_format_t::rgb;
+    /// Minimum number of decoded bytes per thread, when the number of threads is not set
+    static constexpr std::size_t MIN_BYTES_PER_THREAD = 4UL * 1024 * 1024;
 
-                        case 4:
-                            return data::image::pixel_format_t::rgba;
+    /// Create an RAII to be sure everything is cleaned at exit
+    struct tiff_keeper final
+    {
+        tiff_keeper() = default;
 
-                        default:
-                            SIGHT_THROW("Unsupported sample per pixels: '" << samples_per_pixels << "'");
-                    }
-                }();
+        tiff_keeper(const tiff_keeper&)            = delete;
+        tiff_keeper& operator=(const tiff_keeper&) = delete;
 
-            // Allocate destination image
-            _image.resize({width, height, 0}, component_type, pixel_format);
+        inline ~tiff_keeper()
+        {
+            if(m_tiff != nullptr)
+            {
+                TIFFClose(m_tiff);
+                m_tiff = nullptr;
+            }
+        }
+
+        TIFF* m_tiff {nullptr};
+    };
+
+    /// Size and format of a page
+    struct format
+    {
+        std::uint32_t width {0};
+        std::uint32_t height {0};
+        std::uint16_t samples_per_pixels {0};
+        std::uint16_t sample_format {0};
+        std::uint16_t bits_per_sample {0};
+        std::uint16_t photometric {0};
+        std::uint16_t planar_config {0};
+
+        bool operator==(const format&) const = default;
+    };
+
+    /// Tile or strip of a page
+    struct unit
+    {
+        std::uint16_t page {0};
+        std::uint32_t index {0};
+        bool tiled {false};
+        std::uint32_t x {0};
+        std::uint32_t y {0};
+        std::uint32_t width {0};
+        std::uint32_t height {0};
+    };
+
+    //------------------------------------------------------------------------------
+
+    inline static format read_format(TIFF* _tiff)
+    {
+        format f;
+
+        CHECK_TIFF(TIFFGetField(_tiff, TIFFTAG_IMAGEWIDTH, &f.width));
+        CHECK_TIFF(TIFFGetField(_tiff, TIFFTAG_IMAGELENGTH, &f.height));
+        CHECK_TIFF(TIFFGetField(_tiff, TIFFTAG_SAMPLESPERPIXEL, &f.samples_per_pixels));
+        CHECK_TIFF(TIFFGetField(_tiff, TIFFTAG_BITSPERSAMPLE, &f.bits_per_sample));
+        CHECK_TIFF(TIFFGetField(_tiff, TIFFTAG_PHOTOMETRIC, &f.photometric));
+        CHECK_TIFF(TIFFGetField(_tiff, TIFFTAG_PLANARCONFIG, &f.planar_config));
+
+        // Sample format may be not present
+        if(TIFFGetField(_tiff, TIFFTAG_SAMPLEFORMAT, &f.sample_format) != 1)
+        {
+            f.sample_format = SAMPLEFORMAT_UINT;
+        }
+
+        return f;
+    }
+
+    //------------------------------------------------------------------------------
+
+    /// Decodes a rectangle of the current page with the RGBA interface, which only decodes the tiles or strips
+    /// overlapping it. Like TIFFReadRGBAImage(), the rows of the page are stored from the bottom to the top, so the
+    /// region is taken from the flipped page.
+    inline static void read_rgba_region(
+        TIFF* _tiff,
+        const std::array<std::uint32_t, 2>& _origin,
+        const std::array<std::uint32_t, 2>& _size,
+        std::uint32_t _height,
+        std::uint32_t* _raster
+    )
+    {
+        std::array<char, 1024> message {};
+        TIFFRGBAImage rgba {};
+        SIGHT_THROW_IF(
+            "TIFFRGBAImageBegin() failed: " << message.data(),
+            TIFFRGBAImageOK(_tiff, message.data()) == 0
+            || TIFFRGBAImageBegin(&rgba, _tiff, 0, message.data()) == 0
+        );
+
+        rgba.row_offset = int(_height - _origin[1] - _size[1]);
+        rgba.col_offset = int(_origin[0]);
+
+        const int result = TIFFRGBAImageGet(&rgba, _raster, _size[0], _size[1]);
+        TIFFRGBAImageEnd(&rgba);
+        CHECK_TIFF(result);
+    }
+
+    //------------------------------------------------------------------------------
+
+    inline static void set_page(TIFF* _tiff, std::uint16_t _page, const format& _format)
+    {
+        if(TIFFCurrentDirectory(_tiff) != _page)
+        {
+            CHECK_TIFF(TIFFSetDirectory(_tiff, _page));
+            SIGHT_THROW_IF(
+                "Page " << _page << " does not have the same size and format as the first one.",
+                read_format(_tiff) != _format
+            );
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    /// Converts bits_per_sample to Sight format
+    inline static core::type component_type(const format& _format)
+    {
+        if(_format.sample_format == SAMPLEFORMAT_IEEEFP)
+        {
+            switch(_format.bits_per_sample)
+            {
+                case 32:
+                    return core::type::FLOAT;
+
+                case 64:
+                    return core::type::DOUBLE;
+
+                default:
+                    SIGHT_THROW("Unsupported bit depth for float format: '" << _format.bits_per_sample << "'");
+            }
+        }
+        else if(_format.sample_format == SAMPLEFORMAT_UINT)
+        {
+            switch(_format.bits_per_sample)
+            {
+                case 8:
+                    return core::type::UINT8;
+
+                case 16:
+                    return core::type::UINT16;
+
+                case 32:
+                    return core::type::UINT32;
+
+                case 64:
+                    return core::type::UINT64;
 
-            for(std::uint32_t row = 0 ; row < height ; ++row)
+                default:
+                    SIGHT_THROW("Unsupported bits per sample: '" << _format.bits_per_sample << "'");
+            }
+        }
+        else if(_format.sample_format == SAMPLEFORMAT_INT)
+        {
+            switch(_format.bits_per_sample)
             {
-                CHECK_TIFF(TIFFReadScanline(keeper.m_tiff, _image.get_pixel(row * width), row));
+                case 8:
+                    return core::type::INT8;
+
+                case 16:
+                    return core::type::INT16;
+
+                case 32:
+                    return core::type::INT32;
+
+                case 64:
+                    return core::type::INT64;
+
+                default:
+                    SIGHT_THROW("Unsupported bits per sample: '" << _format.bits_per_sample << "'");
             }
         }
+        else
+        {
+            SIGHT_THROW("Unsupported sample format: '" << _format.sample_format << "'");
+        }
     }
 
-private:
+    //------------------------------------------------------------------------------
+
+    /// Converts photometric to Sight format. Except PHOTOMETRIC_MINISBLACK and PHOTOMETRIC_RGB all others are
+    /// decoded with TIFFReadRGBAImage, so we only look at sample per pixels
+    inline static data::image::pixel_format_t pixel_format(const format& _format)
+    {
+        switch(_format.samples_per_pixels)
+        {
+            case 1:
+                return data::image::pixel_format_t::gray_scale;
+
+            case 2:
+                return data::image::pixel_format_t::rg;
+
+            case 3:
+                return data::image::pixel_format_t::rgb;
+
+            case 4:
+                return data::image::pixel_format_t::rgba;
+
+            default:
+                SIGHT_THROW("Unsupported sample per pixels: '" << _format.samples_per_pixels << "'");
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    /// Decodes a tile or a strip and copies the part overlapping the region in the destination buffer
+    inline static void decode_unit(
+        TIFF* _tiff,
+        const unit& _unit,
+        std::vector<std::uint8_t>& _unit_buffer,
+        std::uint32_t _width,
+        std::uint32_t _height,
+        std::size_t _pixel_size,
+        const std::array<std::uint32_t, 2>& _origin,
+        const std::array<std::uint32_t, 2>& _size,
+        std::uint8_t* _destination
+    )
+    {
+        const auto unit_buffer_size = static_cast<tmsize_t>(_unit_buffer.size());
+        const tmsize_t decoded      = _unit.tiled
+                                      ? TIFFReadEncodedTile(_tiff, _unit.index, _unit_buffer.data(), unit_buffer_size)
+                                      : TIFFReadEncodedStrip(_tiff, _unit.index, _unit_buffer.data(), unit_buffer_size);
+
+        SIGHT_THROW_IF("Decoding of " << (_unit.tiled ? "tile " : "strip ") << _unit.index << " failed.", decoded < 0);
+
+        // Part of the unit inside both the image and the region
+        const std::uint32_t x_begin = std::max(_unit.x, _origin[0]);
+        const std::uint32_t x_end   = std::min({_unit.x + _unit.width, _origin[0] + _size[0], _width});
+        const std::uint32_t y_begin = std::max(_unit.y, _origin[1]);
+        const std::uint32_t y_end   = std::min({_unit.y + _unit.height, _origin[1] + _size[1], _height});
+
+        const std::size_t row_size = std::size_t(x_end - x_begin) * _pixel_size;
+        const std::size_t page     = std::size_t(_unit.page) * _size[0] * _size[1];
+
+        for(std::uint32_t y = y_begin ; y < y_end ; ++y)
+        {
+            const std::uint8_t* const source = _unit_buffer.data()
+                                               + (std::size_t(y - _unit.y) * _unit.width + (x_begin - _unit.x))
+                                               * _pixel_size;
+            std::uint8_t* const destination = _destination
+                                              + (page + std::size_t(y - _origin[1]) * _size[0] + (x_begin - _origin[0]))
+                                              * _pixel_size;
+            std::memcpy(destination, source, row_size);
+        }
+    }
 
     /// TIFF c++ API (tiffio.hxx and tif_stream.cxx) is not available on Windows. We simply recreate it
     /// @{
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -170,6 +170,13 @@ public:
             cudaSuccess
         );
 
+        // Update the quality if it was changed since the last encoding
+        if(m_quality != m_encoder_quality)
+        {
+            CHECK_CUDA(nvjpegEncoderParamsSetQuality(m_params, m_quality, m_stream), NVJPEG_STATUS_SUCCESS);
+            m_encoder_quality = m_quality;
+        }
+
         // Prepare the input buffer
         nvjpegImage_t nv_image {};
         nv_image.channel[0] = reinterpret_cast<unsigned char*>(m_gpu_buffer);
@@ -342,10 +349,16 @@ private:
 
     std::vector<unsigned char> m_output_buffer;
 
+    /// Quality currently set in the encoder parameters
+    int m_encoder_quality {100};
+
 public:
 
     bool m_valid {false};
     static constexpr std::string_view m_name {"NvJPEGWriter"};
+
+    /// JPEG quality, from 1 to 100
+    int m_quality {100};
 };
 
 } // namespace sight::io::bitmap::detail
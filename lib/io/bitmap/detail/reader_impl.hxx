@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -65,12 +65,18 @@ public:
     inline ~reader_impl() noexcept = default;
 
     /// Main read function
-    inline void read(std::istream& _istream, backend _backend)
+    /// @arg path: the file the stream was opened from, if any, so that it can be decoded by several threads
+    inline void read(std::istream& _istream, backend _backend, const std::filesystem::path& _path = {})
     {
         // Get the image pointer
         auto image = m_reader->get_concrete_object();
         SIGHT_THROW_IF("Output image is null", image == nullptr);
 
+        SIGHT_THROW_IF(
+            "Region and multi-page decoding are only supported by LIBTIFF.",
+            _backend != backend::libtiff && (m_options.region.has_value() || m_options.multi_page)
+        );
+
         // Protect the image from dump
         const auto dump_lock = image->dump_lock();
 
@@ -118,7 +124,13 @@ public:
         }
         else if(_backend == backend::libtiff)
         {
-            read<lib_tiff_reader>(m_lib_tiff, *image, _istream);
+            if(m_lib_tiff == nullptr)
+            {
+                m_lib_tiff = std::make_unique<lib_tiff_reader>();
+            }
+
+            m_options.path = _path;
+            m_lib_tiff->read(*image, _istream, m_options);
         }
         else if(_backend == backend::libpng)
         {
@@ -132,6 +144,9 @@ public:
         sight::data::helper::medical_image::check_image_slice_index(image);
     }
 
+    /// Options of the TIFF backend
+    lib_tiff_reader::options m_options;
+
 private:
 
     //------------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -62,6 +62,19 @@ public:
     /// Default destructor
     inline ~writer_impl() noexcept = default;
 
+    /// Sets the quality of lossy backends
+    inline void set_quality(int _quality)
+    {
+        SIGHT_THROW_IF("Quality must be between 1 and 100, got " << _quality, _quality < 1 || _quality > 100);
+        m_quality = _quality;
+    }
+
+    /// Returns the quality of lossy backends
+    [[nodiscard]] inline int quality() const
+    {
+        return m_quality;
+    }
+
     /// Main write function
     template<typename O>
     inline std::size_t write(O& _output, backend _backend, writer::mode _mode)
@@ -154,13 +167,13 @@ public:
 #ifdef SIGHT_ENABLE_NVJPEG
         if(nv_jpeg() && _backend == backend::nvjpeg)
         {
-            return write<nv_jpeg_writer>(m_nv_jpeg, *image, _output, _mode);
+            return write<nv_jpeg_writer>(m_nv_jpeg, *image, _output, _mode, flag::none, m_quality);
         }
         else
 #endif
         if(_backend == backend::libjpeg)
         {
-            return write<lib_jpeg_writer>(m_lib_jpeg, *image, _output, _mode);
+            return write<lib_jpeg_writer>(m_lib_jpeg, *image, _output, _mode, flag::none, m_quality);
         }
         else if(_backend == backend::libtiff)
         {
@@ -186,7 +199,8 @@ private:
         const data::image& _image,
         O& _output,
         writer::mode _mode,
-        flag _flag = flag::none
+        flag _flag   = flag::none,
+        int _quality = 100
 )
     {
         if(_backend == nullptr)
@@ -195,12 +209,20 @@ private:
             SIGHT_THROW_IF("Failed to initialize" << _backend->m_name << " backend.", !_backend->m_valid);
         }
 
+        if constexpr(requires {_backend->m_quality;})
+        {
+            _backend->m_quality = _quality;
+        }
+
         return _backend->write(_image, _output, _mode, _flag);
     }
 
     /// Pointer to the public interface
     writer* const m_writer;
 
+    /// Quality of lossy backends
+    int m_quality {100};
+
 #ifdef SIGHT_ENABLE_NVJPEG
     std::unique_ptr<nv_jpeg_writer> m_nv_jpeg;
 #endif
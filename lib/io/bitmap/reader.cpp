@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -24,8 +24,11 @@
 #include "detail/reader_impl.hxx"
 
 #include <algorithm>
+#include <exception>
 #include <fstream>
 
+#include <omp.h>
+
 // cspell:ignore nvjpeg nvjpeg2k nppi bitstream LRCP BGRI RGBI NOLINTNEXTLINE LIBJPEG OPENJPEG
 
 namespace sight::io::bitmap
@@ -101,7 +104,8 @@ void reader::read(backend _backend)
     std::ifstream input;
     input.open(file.string(), std::ios::in | std::ios::binary);
 
-    read(input, backend_to_use);
+    // The file can be opened again by the threads decoding it
+    m_pimpl->read(input, backend_to_use, file);
 }
 
 //------------------------------------------------------------------------------
@@ -111,4 +115,71 @@ void reader::read(std::istream& _istream, backend _backend)
     m_pimpl->read(_istream, _backend);
 }
 
+//------------------------------------------------------------------------------
+
+std::vector<data::image::sptr> reader::read_batch(
+    const std::vector<std::filesystem::path>& _files,
+    backend _backend,
+    std::size_t _threads
+)
+{
+    std::vector<data::image::sptr> images(_files.size());
+    std::vector<std::exception_ptr> errors(_files.size());
+
+    const int threads = _threads == 0 ? omp_get_max_threads() : static_cast<int>(_threads);
+
+    #pragma omp parallel for num_threads(threads) schedule(dynamic)
+    for(std::int64_t i = 0 ; i < std::int64_t(_files.size()) ; ++i)
+    {
+        try
+        {
+            auto image  = std::make_shared<data::image>();
+            auto reader = std::make_shared<io::bitmap::reader>();
+            reader->set_object(image);
+            reader->set_file(_files[std::size_t(i)]);
+
+            // Files are already decoded concurrently, decoding each of them in parallel would oversubscribe the cores
+            reader->set_threads(1);
+            reader->read(_backend);
+
+            images[std::size_t(i)] = image;
+        }
+        catch(...)
+        {
+            errors[std::size_t(i)] = std::current_exception();
+        }
+    }
+
+    for(const auto& error : errors)
+    {
+        if(error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    return images;
+}
+
+//------------------------------------------------------------------------------
+
+void reader::set_region(const std::optional<region>& _region)
+{
+    m_pimpl->m_options.region = _region;
+}
+
+//------------------------------------------------------------------------------
+
+void reader::set_multi_page(bool _multi_page)
+{
+    m_pimpl->m_options.multi_page = _multi_page;
+}
+
+//------------------------------------------------------------------------------
+
+void reader::set_threads(std::size_t _threads)
+{
+    m_pimpl->m_options.threads = _threads;
+}
+
 } // namespace sight::io::bitmap
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -33,7 +33,11 @@
 
 #include <io/__/reader/generic_object_reader.hpp>
 
+#include <array>
+#include <filesystem>
+#include <optional>
 #include <ostream>
+#include <vector>
 
 // cspell:ignore nvjpeg LIBJPEG OPENJPEG
 
@@ -54,6 +58,10 @@ namespace sight::io::bitmap
  * achieve very fast decoding. Otherwise, libjpeg-turbo, openJPEG, libtiff or libPNG are used as fallback.
  * The performance should still be better than VTK or even OpenCV because of direct API calls and avoided unneeded
  * buffer copy.
+ *
+ * TIFF files can be decoded partially with set_region(), all their pages can be read into a 3D image with
+ * set_multi_page(), and their tiles or strips are decoded in parallel when read from a file. read_batch() decodes
+ * several files concurrently.
  */
 class SIGHT_IO_BITMAP_CLASS_API reader final : public io::reader::generic_object_reader<data::image>,
                                                public core::location::single_file,
@@ -65,6 +73,13 @@ public:
 
     SIGHT_ALLOW_SHARED_FROM_THIS();
 
+    /// Rectangle of a page, in pixels
+    struct region
+    {
+        std::array<std::size_t, 2> origin {0, 0};
+        std::array<std::size_t, 2> size {0, 0};
+    };
+
     /// Delete default constructors and assignment operators
     reader(const reader&)            = delete;
     reader(reader&&)                 = delete;
@@ -96,6 +111,29 @@ public:
         backend _backend = backend::libtiff
     );
 
+    /// Reads several files concurrently, each one into its own image. Images are returned in the same order as files.
+    /// @arg files: the files to read
+    /// @arg backend: the backend to use, ANY guesses it from the extension of each file
+    /// @arg threads: the number of files decoded at the same time, 0 uses all the cores
+    SIGHT_IO_BITMAP_API static std::vector<data::image::sptr> read_batch(
+        const std::vector<std::filesystem::path>& _files,
+        backend _backend     = backend::any,
+        std::size_t _threads = 0
+    );
+
+    /// Only decodes the given rectangle of the image, and only the tiles or strips it overlaps. Only LIBTIFF supports
+    /// it, std::nullopt decodes the whole image.
+    SIGHT_IO_BITMAP_API void set_region(const std::optional<region>& _region);
+
+    /// Reads all the pages of a multi-page file into a 3D image, they must share the same size and format. Only
+    /// LIBTIFF supports it.
+    SIGHT_IO_BITMAP_API void set_multi_page(bool _multi_page);
+
+    /// Sets the number of threads decoding the tiles or strips of a TIFF file, 0 uses up to all the cores for large
+    /// images and only the calling thread for small ones. Images read from a stream are always decoded by the calling
+    /// thread.
+    SIGHT_IO_BITMAP_API void set_threads(std::size_t _threads);
+
     /// Return the extension to use, by default, or the one from file set by single_file::set_file(), if valid
     /// @return an extension as string
     [[nodiscard]] SIGHT_IO_BITMAP_API std::string extension() const override;
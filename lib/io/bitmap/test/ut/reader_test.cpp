@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -24,15 +24,21 @@
 
 #include <io/bitmap/reader.hpp>
 #include <core/os/temp_path.hpp>
+#include <core/profiling.hpp>
 
 #include <utest/filter.hpp>
 #include <utest/profiling.hpp>
 
+#include <tiffio.h>
+
 #include <cstdlib>
+#include <fstream>
 #include <future>
 
 // This is for putenv() which is part of <cstdlib>
 // cspell:ignore hicpp nvjpeg LIBJPEG LIBTIFF LUMA Acuson IMWRITE IMREAD ANYDEPTH ANYCOLOR OPENCV stoull
+// cspell:ignore TIFFTAG IMAGEWIDTH IMAGELENGTH BITSPERSAMPLE SAMPLESPERPIXEL MINISBLACK MINISWHITE PLANARCONFIG
+// cspell:ignore TILEWIDTH TILELENGTH ROWSPERSTRIP ADOBE SUBFILETYPE FILETYPE PAGENUMBER
 // NOLINTNEXTLINE(hicpp-deprecated-headers,modernize-deprecated-headers)
 #include <stdlib.h>
 
@@ -219,6 +225,156 @@ inline static void profile_reader(
 
 //------------------------------------------------------------------------------
 
+/// Value of a voxel of the images written by write_tiff()
+inline static std::uint16_t voxel_value(std::size_t _x, std::size_t _y, std::size_t _page)
+{
+    return static_cast<std::uint16_t>((_x * 7 + _y * 13 + _page * 1031) & 0xFFFF);
+}
+
+//------------------------------------------------------------------------------
+
+/// Writes a deflate compressed grayscale uint16 TIFF file, with tiles of the given size or strips of one row if
+/// the tile size is zero.
+inline static void write_tiff(
+    const std::filesystem::path& _path,
+    std::uint32_t _width,
+    std::uint32_t _height,
+    std::uint16_t _pages,
+    std::uint32_t _tile_size
+)
+{
+    TIFF* const tiff = TIFFOpen(_path.string().c_str(), "w");
+    CPPUNIT_ASSERT(tiff != nullptr);
+
+    std::vector<std::uint16_t> buffer;
+
+    for(std::uint16_t page = 0 ; page < _pages ; ++page)
+    {
+        TIFFSetField(tiff, TIFFTAG_IMAGEWIDTH, _width);
+        TIFFSetField(tiff, TIFFTAG_IMAGELENGTH, _height);
+        TIFFSetField(tiff, TIFFTAG_SAMPLESPERPIXEL, 1);
+        TIFFSetField(tiff, TIFFTAG_BITSPERSAMPLE, 16);
+        TIFFSetField(tiff, TIFFTAG_SAMPLEFORMAT, SAMPLEFORMAT_UINT);
+        TIFFSetField(tiff, TIFFTAG_PHOTOMETRIC, PHOTOMETRIC_MINISBLACK);
+        TIFFSetField(tiff, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
+        TIFFSetField(tiff, TIFFTAG_COMPRESSION, COMPRESSION_ADOBE_DEFLATE);
+
+        if(_pages > 1)
+        {
+            TIFFSetField(tiff, TIFFTAG_SUBFILETYPE, FILETYPE_PAGE);
+            TIFFSetField(tiff, TIFFTAG_PAGENUMBER, page, _pages);
+        }
+
+        if(_tile_size > 0)
+        {
+            TIFFSetField(tiff, TIFFTAG_TILEWIDTH, _tile_size);
+            TIFFSetField(tiff, TIFFTAG_TILELENGTH, _tile_size);
+
+            buffer.resize(std::size_t(_tile_size) * _tile_size);
+
+            for(std::uint32_t tile_y = 0 ; tile_y < _height ; tile_y += _tile_size)
+            {
+                for(std::uint32_t tile_x = 0 ; tile_x < _width ; tile_x += _tile_size)
+                {
+                    for(std::uint32_t y = 0 ; y < _tile_size ; ++y)
+                    {
+                        for(std::uint32_t x = 0 ; x < _tile_size ; ++x)
+                        {
+                            buffer[std::size_t(y) * _tile_size + x] = voxel_value(tile_x + x, tile_y + y, page);
+                        }
+                    }
+
+                    CPPUNIT_ASSERT(
+                        TIFFWriteTile(tiff, buffer.data(), tile_x, tile_y, 0, 0) >= 0
+                    );
+                }
+            }
+        }
+        else
+        {
+            TIFFSetField(tiff, TIFFTAG_ROWSPERSTRIP, 1);
+
+            buffer.resize(_width);
+
+            for(std::uint32_t y = 0 ; y < _height ; ++y)
+            {
+                for(std::uint32_t x = 0 ; x < _width ; ++x)
+                {
+                    buffer[x] = voxel_value(x, y, page);
+                }
+
+                CPPUNIT_ASSERT(TIFFWriteScanline(tiff, buffer.data(), y, 0) == 1);
+            }
+        }
+
+        CPPUNIT_ASSERT(TIFFWriteDirectory(tiff) == 1);
+    }
+
+    TIFFClose(tiff);
+}
+
+//------------------------------------------------------------------------------
+
+/// Checks an image read from a file written by write_tiff()
+inline static void check_tiff(
+    const data::image& _image,
+    const io::bitmap::reader::region& _region,
+    std::size_t _pages
+)
+{
+    const auto& sizes = _image.size();
+    CPPUNIT_ASSERT_EQUAL(_region.size[0], sizes[0]);
+    CPPUNIT_ASSERT_EQUAL(_region.size[1], sizes[1]);
+    CPPUNIT_ASSERT_EQUAL(_pages > 1 ? _pages : std::size_t(0), sizes[2]);
+    CPPUNIT_ASSERT_EQUAL(core::type::UINT16, _image.type());
+    CPPUNIT_ASSERT_EQUAL(data::image::pixel_format_t::gray_scale, _image.pixel_format());
+
+    const auto* const buffer = static_cast<const std::uint16_t*>(_image.buffer());
+
+    for(std::size_t page = 0 ; page < _pages ; ++page)
+    {
+        for(std::size_t y = 0 ; y < _region.size[1] ; ++y)
+        {
+            for(std::size_t x = 0 ; x < _region.size[0] ; ++x)
+            {
+                const auto expected = voxel_value(x + _region.origin[0], y + _region.origin[1], page);
+                const auto actual   = buffer[(page * _region.size[1] + y) * _region.size[0] + x];
+
+                if(expected != actual)
+                {
+                    CPPUNIT_FAIL(
+                        "Voxel [" + std::to_string(x) + ", " + std::to_string(y) + ", " + std::to_string(page)
+                        + "]: expected " + std::to_string(expected) + ", got " + std::to_string(actual)
+                    );
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+inline static data::image::sptr read_tiff(
+    const std::filesystem::path& _path,
+    const std::optional<io::bitmap::reader::region>& _region = std::nullopt,
+    bool _multi_page                                         = false,
+    std::size_t _threads                                     = 0
+)
+{
+    auto image  = std::make_shared<data::image>();
+    auto reader = std::make_shared<io::bitmap::reader>();
+    reader->set_object(image);
+    reader->set_file(_path);
+    reader->set_region(_region);
+    reader->set_multi_page(_multi_page);
+    reader->set_threads(_threads);
+    reader->read(backend::libtiff);
+
+    return image;
+}
+
+//------------------------------------------------------------------------------
+
 void reader_test::setUp()
 {
     std::string jasper("OPENCV_IO_ENABLE_JASPER=1");
@@ -408,6 +564,178 @@ void reader_test::lib_tiff_test()
 
 //------------------------------------------------------------------------------
 
+void reader_test::tiled_multi_page_test()
+{
+    core::os::temp_dir temp_dir;
+
+    // The image size is not a multiple of the tile size, to test partial tiles
+    const auto tiled = temp_dir / "tiled.tiff";
+    write_tiff(tiled, 300, 200, 3, 64);
+
+    // Only the first page is read by default
+    check_tiff(*read_tiff(tiled), {.origin = {0, 0}, .size = {300, 200}}, 1);
+
+    // All pages in a 3D image
+    check_tiff(*read_tiff(tiled, std::nullopt, true), {.origin = {0, 0}, .size = {300, 200}}, 3);
+
+    // The parallel decoding gives the same result as the sequential one
+    const auto sequential = read_tiff(tiled, std::nullopt, true, 1);
+    const auto parallel   = read_tiff(tiled, std::nullopt, true, 4);
+    CPPUNIT_ASSERT(*sequential == *parallel);
+
+    // A stream is decoded by the calling thread only, but still gives all the pages
+    {
+        auto image  = std::make_shared<data::image>();
+        auto reader = std::make_shared<io::bitmap::reader>();
+        reader->set_object(image);
+        reader->set_multi_page(true);
+
+        std::ifstream stream(tiled, std::ios::in | std::ios::binary);
+        reader->read(stream, backend::libtiff);
+
+        CPPUNIT_ASSERT(*sequential == *image);
+    }
+
+    // Multi-page reading is only supported by LIBTIFF
+    {
+        auto reader = std::make_shared<io::bitmap::reader>();
+        reader->set_object(std::make_shared<data::image>());
+        reader->set_file(temp_dir / "wrong.png");
+        reader->set_multi_page(true);
+
+        cv::imwrite((temp_dir / "wrong.png").string(), image_to_mat(get_synthetic_image(0)));
+        CPPUNIT_ASSERT_THROW(reader->read(backend::libpng), core::exception);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void reader_test::region_test()
+{
+    core::os::temp_dir temp_dir;
+
+    const auto tiled = temp_dir / "tiled.tiff";
+    write_tiff(tiled, 300, 200, 2, 64);
+
+    const auto stripped = temp_dir / "stripped.tiff";
+    write_tiff(stripped, 300, 200, 2, 0);
+
+    for(const auto& path : {tiled, stripped})
+    {
+        // A region across several tiles, not aligned on tile boundaries
+        const io::bitmap::reader::region region {.origin = {37, 21}, .size = {150, 101}};
+        check_tiff(*read_tiff(path, region), region, 1);
+        check_tiff(*read_tiff(path, region, true), region, 2);
+        check_tiff(*read_tiff(path, region, true, 1), region, 2);
+
+        // A region in the last partial tile
+        const io::bitmap::reader::region corner {.origin = {290, 195}, .size = {10, 5}};
+        check_tiff(*read_tiff(path, corner, true), corner, 2);
+
+        // The whole image
+        const io::bitmap::reader::region whole {.origin = {0, 0}, .size = {300, 200}};
+        check_tiff(*read_tiff(path, whole, true), whole, 2);
+
+        // Out of the image
+        const io::bitmap::reader::region outside {.origin = {200, 0}, .size = {101, 10}};
+        CPPUNIT_ASSERT_THROW(read_tiff(path, outside), core::exception);
+
+        const io::bitmap::reader::region empty {.origin = {0, 0}, .size = {0, 10}};
+        CPPUNIT_ASSERT_THROW(read_tiff(path, empty), core::exception);
+    }
+
+    // Partial decoding also works with libtiff RGBA interface, which is used for formats that can not be decoded
+    // directly, like "min is white" grayscale
+    {
+        const auto path = temp_dir / "min_is_white.tiff";
+        {
+            TIFF* const tiff = TIFFOpen(path.string().c_str(), "w");
+            CPPUNIT_ASSERT(tiff != nullptr);
+
+            TIFFSetField(tiff, TIFFTAG_IMAGEWIDTH, 300);
+            TIFFSetField(tiff, TIFFTAG_IMAGELENGTH, 200);
+            TIFFSetField(tiff, TIFFTAG_SAMPLESPERPIXEL, 1);
+            TIFFSetField(tiff, TIFFTAG_BITSPERSAMPLE, 8);
+            TIFFSetField(tiff, TIFFTAG_PHOTOMETRIC, PHOTOMETRIC_MINISWHITE);
+            TIFFSetField(tiff, TIFFTAG_PLANARCONFIG, PLANARCONFIG_CONTIG);
+            TIFFSetField(tiff, TIFFTAG_ROWSPERSTRIP, 1);
+
+            std::vector<std::uint8_t> row(300);
+            for(std::uint32_t y = 0 ; y < 200 ; ++y)
+            {
+                for(std::uint32_t x = 0 ; x < 300 ; ++x)
+                {
+                    row[x] = static_cast<std::uint8_t>(voxel_value(x, y, 0));
+                }
+
+                CPPUNIT_ASSERT(TIFFWriteScanline(tiff, row.data(), y, 0) == 1);
+            }
+
+            TIFFClose(tiff);
+        }
+
+        const io::bitmap::reader::region region {.origin = {10, 20}, .size = {100, 50}};
+        const auto full    = read_tiff(path);
+        const auto cropped = read_tiff(path, region);
+
+        CPPUNIT_ASSERT_EQUAL(data::image::pixel_format_t::rgba, cropped->pixel_format());
+        CPPUNIT_ASSERT_EQUAL(region.size[0], cropped->size()[0]);
+        CPPUNIT_ASSERT_EQUAL(region.size[1], cropped->size()[1]);
+
+        const auto pixel_size            = full->type().size() * full->num_components();
+        const auto* const full_buffer    = static_cast<const std::uint8_t*>(full->buffer());
+        const auto* const cropped_buffer = static_cast<const std::uint8_t*>(cropped->buffer());
+
+        for(std::size_t y = 0 ; y < region.size[1] ; ++y)
+        {
+            CPPUNIT_ASSERT(
+                std::equal(
+                    cropped_buffer + y * region.size[0] * pixel_size,
+                    cropped_buffer + (y + 1) * region.size[0] * pixel_size,
+                    full_buffer + ((y + region.origin[1]) * full->size()[0] + region.origin[0]) * pixel_size
+                )
+            );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void reader_test::batch_test()
+{
+    core::os::temp_dir temp_dir;
+
+    std::vector<std::filesystem::path> files;
+
+    for(std::uint32_t i = 0 ; i < 8 ; ++i)
+    {
+        const auto& extension = i % 2 == 0 ? ".tiff" : ".png";
+        files.push_back(temp_dir / ("image_" + std::to_string(i) + extension));
+        cv::imwrite(files.back().string(), image_to_mat(get_synthetic_image(i)));
+    }
+
+    const auto images = io::bitmap::reader::read_batch(files);
+    CPPUNIT_ASSERT_EQUAL(files.size(), images.size());
+
+    for(std::size_t i = 0 ; i < files.size() ; ++i)
+    {
+        auto image  = std::make_shared<data::image>();
+        auto reader = std::make_shared<io::bitmap::reader>();
+        reader->set_object(image);
+        reader->set_file(files[i]);
+        reader->read();
+
+        CPPUNIT_ASSERT(images[i]);
+        CPPUNIT_ASSERT(*image == *images[i]);
+    }
+
+    // An error in one of the files is reported
+    files.push_back(temp_dir / "missing.tiff");
+    CPPUNIT_ASSERT_THROW(io::bitmap::reader::read_batch(files), core::exception);
+}
+
+//------------------------------------------------------------------------------
+
 void reader_test::profiling_test()
 {
     // Check how many loop to perform
@@ -437,4 +765,74 @@ void reader_test::profiling_test()
     profile_reader(s_LOOP_COUNT, backend::libtiff);
 }
 
+//------------------------------------------------------------------------------
+
+void reader_test::parallel_benchmark()
+{
+    const bool slow             = !utest::filter::ignore_slow_tests();
+    const std::uint32_t size    = slow ? 4096 : 1024;
+    const std::uint16_t pages   = 4;
+    const std::size_t num_files = 16;
+
+    core::os::temp_dir temp_dir;
+
+    const auto tiled = temp_dir / "tiled.tiff";
+    write_tiff(tiled, size, size, pages, 256);
+
+    const auto stripped = temp_dir / "stripped.tiff";
+    write_tiff(stripped, size, size, pages, 0);
+
+    for(const auto& path : {tiled, stripped})
+    {
+        const bool is_tiled = path == tiled;
+
+        data::image::sptr sequential;
+        {
+            FW_PROFILE(is_tiled ? "Tiled TIFF, sequential" : "Stripped TIFF, sequential");
+            sequential = read_tiff(path, std::nullopt, true, 1);
+        }
+
+        data::image::sptr parallel;
+        {
+            FW_PROFILE(is_tiled ? "Tiled TIFF, parallel" : "Stripped TIFF, parallel");
+            parallel = read_tiff(path, std::nullopt, true);
+        }
+
+        CPPUNIT_ASSERT(*sequential == *parallel);
+
+        const io::bitmap::reader::region region {.origin = {size / 2, size / 2}, .size = {size / 8, size / 8}};
+        {
+            FW_PROFILE(is_tiled ? "Tiled TIFF, region" : "Stripped TIFF, region");
+            check_tiff(*read_tiff(path, region, true), region, pages);
+        }
+    }
+
+    // Batch decoding of several files, compared to reading them one after the other
+    std::vector<std::filesystem::path> files;
+    for(std::size_t i = 0 ; i < num_files ; ++i)
+    {
+        files.push_back(temp_dir / ("batch_" + std::to_string(i) + ".tiff"));
+        write_tiff(files.back(), size / 4, size / 4, 1, 0);
+    }
+
+    {
+        FW_PROFILE("TIFF files, loop");
+        for(const auto& file : files)
+        {
+            check_tiff(*read_tiff(file, std::nullopt, false, 1), {.origin = {0, 0}, .size = {size / 4, size / 4}}, 1);
+        }
+    }
+
+    std::vector<data::image::sptr> images;
+    {
+        FW_PROFILE("TIFF files, batch");
+        images = io::bitmap::reader::read_batch(files, backend::libtiff);
+    }
+
+    for(const auto& image : images)
+    {
+        check_tiff(*image, {.origin = {0, 0}, .size = {size / 4, size / 4}}, 1);
+    }
+}
+
 } // namespace sight::io::bitmap::ut
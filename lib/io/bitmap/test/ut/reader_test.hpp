@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -42,7 +42,11 @@ public:
     CPPUNIT_TEST(lib_jpeg_test);
     CPPUNIT_TEST(open_jpeg_test);
     CPPUNIT_TEST(lib_tiff_test);
+    CPPUNIT_TEST(tiled_multi_page_test);
+    CPPUNIT_TEST(region_test);
+    CPPUNIT_TEST(batch_test);
     CPPUNIT_TEST(profiling_test);
+    CPPUNIT_TEST(parallel_benchmark);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -61,7 +65,12 @@ public:
     static void open_jpeg_test();
     static void lib_tiff_test();
 
+    static void tiled_multi_page_test();
+    static void region_test();
+    static void batch_test();
+
     static void profiling_test();
+    static void parallel_benchmark();
 };
 
 } // namespace sight::io::bitmap::ut
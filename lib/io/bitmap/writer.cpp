@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -41,6 +41,20 @@ writer::~writer() = default;
 
 //------------------------------------------------------------------------------
 
+void writer::set_quality(int _quality)
+{
+    m_pimpl->set_quality(_quality);
+}
+
+//------------------------------------------------------------------------------
+
+int writer::quality() const
+{
+    return m_pimpl->quality();
+}
+
+//------------------------------------------------------------------------------
+
 std::string writer::extension() const
 {
     try
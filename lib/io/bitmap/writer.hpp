@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -149,6 +149,13 @@ public:
         mode _mode       = mode::fast
     );
 
+    /// Sets the quality, from 1 to 100, used by lossy backends (LIBJPEG and NVJPEG). The default is 100.
+    /// Lower values produce smaller files, which is useful to fit images in a limited bandwidth.
+    SIGHT_IO_BITMAP_API void set_quality(int _quality);
+
+    /// Returns the quality used by lossy backends
+    [[nodiscard]] SIGHT_IO_BITMAP_API int quality() const;
+
     /// Return the extension to use, by default, or the one from file set by single_file::set_file(), if valid
     /// @return an extension as string
     [[nodiscard]] SIGHT_IO_BITMAP_API std::string extension() const override;
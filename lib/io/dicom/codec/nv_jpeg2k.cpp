@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -21,6 +21,8 @@
 
 #include "nv_jpeg2k.hpp"
 
+#include "parallel_codec.hpp"
+
 #include "gdcmSequenceOfFragments.h"
 
 #include <io/bitmap/writer.hpp>
@@ -30,83 +32,6 @@ namespace sight::io::dicom::codec
 
 //------------------------------------------------------------------------------
 
-static inline core::type gdcm_to_sight_pf(const gdcm::PixelFormat& _pf)
-{
-    switch(_pf.GetScalarType())
-    {
-        case gdcm::PixelFormat::SINGLEBIT:
-        case gdcm::PixelFormat::UINT8:
-            return core::type::UINT8;
-
-        case gdcm::PixelFormat::INT8:
-            return core::type::INT8;
-
-        case gdcm::PixelFormat::UINT16:
-            return core::type::UINT16;
-
-        case gdcm::PixelFormat::INT16:
-            return core::type::INT16;
-
-        case gdcm::PixelFormat::UINT32:
-            return core::type::UINT32;
-
-        case gdcm::PixelFormat::INT32:
-            return core::type::INT32;
-
-        case gdcm::PixelFormat::UINT64:
-            return core::type::UINT64;
-
-        case gdcm::PixelFormat::INT64:
-            return core::type::INT64;
-
-        case gdcm::PixelFormat::FLOAT32:
-            return core::type::FLOAT;
-
-        case gdcm::PixelFormat::FLOAT64:
-            return core::type::DOUBLE;
-
-        default:
-            return core::type::NONE;
-    }
-}
-
-//------------------------------------------------------------------------------
-
-static inline enum data::image::pixel_format_t gdcm_to_sight_pi(
-    const gdcm::PhotometricInterpretation& _pi,
-    const gdcm::PixelFormat& _pf
-)
-{
-    if(_pi == gdcm::PhotometricInterpretation::PALETTE_COLOR)
-    {
-        // PALETTE_COLOR is always expended as RGB
-        return data::image::pixel_format_t::rgb;
-    }
-
-    const auto gdcm_sample_per_pixel = _pf.GetSamplesPerPixel();
-
-    if(gdcm_sample_per_pixel == 1)
-    {
-        // No need to check, no color space conversion...
-        return data::image::pixel_format_t::gray_scale;
-    }
-
-    if(gdcm_sample_per_pixel == 3
-       && (_pi == gdcm::PhotometricInterpretation::YBR_FULL
-           || _pi == gdcm::PhotometricInterpretation::YBR_FULL_422
-           || _pi == gdcm::PhotometricInterpretation::YBR_ICT
-           || _pi == gdcm::PhotometricInterpretation::YBR_RCT
-           || _pi == gdcm::PhotometricInterpretation::RGB))
-    {
-        return data::image::pixel_format_t::rgb;
-    }
-
-    // Unsupported...
-    return data::image::pixel_format_t::undefined;
-}
-
-//------------------------------------------------------------------------------
-
 bool nv_jpeg2_k::Code(gdcm::DataElement const& _in, gdcm::DataElement& _out)
 {
     _out = _in;
@@ -131,9 +56,9 @@ bool nv_jpeg2_k::Code(gdcm::DataElement const& _in, gdcm::DataElement& _out)
     // The output buffer is resized by the writer if not big enough
     std::vector<std::uint8_t> output_buffer(frame_size);
 
-    const auto& sight_type   = gdcm_to_sight_pf(this->GetPixelFormat());
+    const auto& sight_type   = detail::gdcm_to_sight_pf(this->GetPixelFormat());
     const auto& sight_size   = sight::data::image::size_t {dims[0], dims[1], 1};
-    const auto& sight_format = gdcm_to_sight_pi(this->GetPhotometricInterpretation(), this->GetPixelFormat());
+    const auto& sight_format = detail::gdcm_to_sight_pi(this->GetPhotometricInterpretation(), this->GetPixelFormat());
 
     for(std::size_t z = 0, end = dims[2] ; z < end ; ++z)
     {
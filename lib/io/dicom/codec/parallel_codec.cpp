@@ -0,0 +1,115 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "parallel_codec.hpp"
+
+#include <io/bitmap/writer.hpp>
+
+// cspell:ignore JPEGLS
+
+namespace sight::io::dicom::codec
+{
+
+//------------------------------------------------------------------------------
+
+void parallel_jpeg2k::encode_frame(
+    const char* _frame,
+    std::size_t /*_size*/,
+    std::vector<std::uint8_t>& _output
+) const
+{
+    const auto* dims = this->GetDimensions();
+
+    // Wrap the frame in an image, without copying it
+    auto image           = std::make_shared<data::image>();
+    const auto dump_lock = image->dump_lock();
+
+    image->set_buffer(
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        const_cast<char*>(_frame),
+        false,
+        detail::gdcm_to_sight_pf(this->GetPixelFormat()),
+        {dims[0], dims[1], 1},
+        detail::gdcm_to_sight_pi(this->GetPhotometricInterpretation(), this->GetPixelFormat()),
+        std::make_shared<core::memory::buffer_no_alloc_policy>()
+    );
+
+    auto writer = std::make_shared<bitmap::writer>();
+    writer->set_object(image);
+
+    // The output buffer is resized by the writer if not big enough
+    const auto output_size = writer->write(_output, m_backend, bitmap::writer::mode::fast);
+    _output.resize(output_size);
+}
+
+//------------------------------------------------------------------------------
+
+gdcm::ImageCodec* parallel_jpeg2k::Clone() const
+{
+    return new parallel_jpeg2k(m_threads, m_backend);
+}
+
+//------------------------------------------------------------------------------
+
+void parallel_jpegls::encode_frame(const char* _frame, std::size_t _size, std::vector<std::uint8_t>& _output) const
+{
+    const auto* dims                 = this->GetDimensions();
+    const unsigned int frame_dims[3] = {dims[0], dims[1], 1};
+
+    // CharLS codecs are not shareable between threads, use a single frame codec configured like this one
+    gdcm::JPEGLSCodec frame_codec;
+    frame_codec.SetNumberOfDimensions(2);
+    frame_codec.SetDimensions(frame_dims);
+    frame_codec.SetPixelFormat(this->GetPixelFormat());
+    frame_codec.SetPlanarConfiguration(this->GetPlanarConfiguration());
+    frame_codec.SetPhotometricInterpretation(this->GetPhotometricInterpretation());
+    frame_codec.SetLossless(!this->IsLossy());
+    frame_codec.SetLossyError(m_lossy_error);
+
+    // Pixel Data
+    gdcm::DataElement in(gdcm::Tag(0x7fe0, 0x0010));
+    in.SetByteValue(_frame, std::uint32_t(_size));
+
+    gdcm::DataElement out;
+    SIGHT_THROW_IF("JPEG-LS frame encoding failed.", !frame_codec.Code(in, out));
+
+    const auto* fragments = out.GetSequenceOfFragments();
+    SIGHT_THROW_IF(
+        "JPEG-LS frame encoding produced an unexpected output.",
+        fragments == nullptr || fragments->GetNumberOfFragments() != 1
+    );
+
+    const auto* encoded = fragments->GetFragment(0).GetByteValue();
+    _output.assign(encoded->GetPointer(), encoded->GetPointer() + encoded->GetLength());
+}
+
+//------------------------------------------------------------------------------
+
+gdcm::ImageCodec* parallel_jpegls::Clone() const
+{
+    auto* codec = new parallel_jpegls(m_threads);
+    codec->SetLossless(!this->IsLossy());
+    codec->set_lossy_error(m_lossy_error);
+
+    return codec;
+}
+
+} // namespace sight::io::dicom::codec
@@ -0,0 +1,321 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <core/exceptionmacros.hpp>
+#include <core/type.hpp>
+
+#include <data/image.hpp>
+
+#include <io/bitmap/backend.hpp>
+
+#include <gdcmJPEG2000Codec.h>
+#include <gdcmJPEGLSCodec.h>
+#include <gdcmSequenceOfFragments.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace sight::io::dicom::codec
+{
+
+namespace detail
+{
+
+//------------------------------------------------------------------------------
+
+inline core::type gdcm_to_sight_pf(const gdcm::PixelFormat& _pf)
+{
+    switch(_pf.GetScalarType())
+    {
+        case gdcm::PixelFormat::SINGLEBIT:
+        case gdcm::PixelFormat::UINT8:
+            return core::type::UINT8;
+
+        case gdcm::PixelFormat::INT8:
+            return core::type::INT8;
+
+        case gdcm::PixelFormat::UINT16:
+            return core::type::UINT16;
+
+        case gdcm::PixelFormat::INT16:
+            return core::type::INT16;
+
+        case gdcm::PixelFormat::UINT32:
+            return core::type::UINT32;
+
+        case gdcm::PixelFormat::INT32:
+            return core::type::INT32;
+
+        case gdcm::PixelFormat::UINT64:
+            return core::type::UINT64;
+
+        case gdcm::PixelFormat::INT64:
+            return core::type::INT64;
+
+        case gdcm::PixelFormat::FLOAT32:
+            return core::type::FLOAT;
+
+        case gdcm::PixelFormat::FLOAT64:
+            return core::type::DOUBLE;
+
+        default:
+            return core::type::NONE;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+inline enum data::image::pixel_format_t gdcm_to_sight_pi(
+    const gdcm::PhotometricInterpretation& _pi,
+    const gdcm::PixelFormat& _pf
+)
+{
+    if(_pi == gdcm::PhotometricInterpretation::PALETTE_COLOR)
+    {
+        // PALETTE_COLOR is always expended as RGB
+        return data::image::pixel_format_t::rgb;
+    }
+
+    const auto gdcm_sample_per_pixel = _pf.GetSamplesPerPixel();
+
+    if(gdcm_sample_per_pixel == 1)
+    {
+        // No need to check, no color space conversion...
+        return data::image::pixel_format_t::gray_scale;
+    }
+
+    if(gdcm_sample_per_pixel == 3
+       && (_pi == gdcm::PhotometricInterpretation::YBR_FULL
+           || _pi == gdcm::PhotometricInterpretation::YBR_FULL_422
+           || _pi == gdcm::PhotometricInterpretation::YBR_ICT
+           || _pi == gdcm::PhotometricInterpretation::YBR_RCT
+           || _pi == gdcm::PhotometricInterpretation::RGB))
+    {
+        return data::image::pixel_format_t::rgb;
+    }
+
+    // Unsupported...
+    return data::image::pixel_format_t::undefined;
+}
+
+} // namespace detail
+
+/**
+ * @brief GDCM codec that encodes each frame of a multi-frame pixel data element independently, on a bounded pool of
+ *        threads.
+ *
+ * Frames are processed by batches of twice the number of threads. Once a batch is encoded, its frames are appended
+ * to the output sequence of fragments in frame order and the encoding buffers are reused for the next batch, so the
+ * memory overhead does not depend on the number of frames.
+ *
+ * @tparam CODEC the GDCM codec to extend. GDCM only uses a user codec if it can be casted to the codec it would have
+ *         picked for the requested transfer syntax, thus the base class must match the transfer syntax.
+ */
+template<class CODEC>
+class parallel_codec : public CODEC
+{
+public:
+
+    /// Called from the calling thread after each batch, with the number of encoded frames and the total.
+    using progress_callback_t = std::function<void (std::size_t _encoded, std::size_t _total)>;
+
+    /// @param _threads number of encoding threads, 0 means one per hardware thread
+    explicit parallel_codec(std::size_t _threads = 0) :
+        m_threads(_threads == 0 ? std::max(1U, std::thread::hardware_concurrency()) : _threads)
+    {
+    }
+
+    ~parallel_codec() override = default;
+
+    /// Sets a callback to follow the encoding progress
+    void set_progress_callback(progress_callback_t _callback)
+    {
+        m_progress_callback = std::move(_callback);
+    }
+
+    /// Returns the total size of the encoded frames of the last call to Code()
+    [[nodiscard]] std::size_t encoded_size() const noexcept
+    {
+        return m_encoded_size;
+    }
+
+    //------------------------------------------------------------------------------
+
+    bool Code(gdcm::DataElement const& _in, gdcm::DataElement& _out) override
+    {
+        _out = _in;
+
+        const auto* in_byte_value = _in.GetByteValue();
+        SIGHT_THROW_IF("Pixel data cannot be encoded: missing byte value.", in_byte_value == nullptr);
+
+        const auto* dims             = this->GetDimensions();
+        const std::size_t num_frames = this->GetNumberOfDimensions() > 2 ? std::max(dims[2], 1U) : 1;
+        const char* const in_pointer = in_byte_value->GetPointer();
+        const std::size_t frame_size = in_byte_value->GetLength() / num_frames;
+        const std::size_t batch_size = 2 * m_threads;
+        const auto num_threads       = static_cast<int>(m_threads);
+        std::vector<std::vector<std::uint8_t> > encoded_frames(std::min(batch_size, num_frames));
+
+        gdcm::SmartPointer<gdcm::SequenceOfFragments> sq = new gdcm::SequenceOfFragments;
+        m_encoded_size = 0;
+
+        for(std::size_t first = 0 ; first < num_frames ; first += batch_size)
+        {
+            const auto last = static_cast<std::int64_t>(std::min(first + batch_size, num_frames));
+            std::exception_ptr error;
+
+            // NOLINTNEXTLINE(clang-diagnostic-unknown-pragmas)
+            #pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+            for(auto z = static_cast<std::int64_t>(first) ; z < last ; ++z)
+            {
+                try
+                {
+                    const auto frame = static_cast<std::size_t>(z);
+                    this->encode_frame(
+                        in_pointer + (frame * frame_size),
+                        frame_size,
+                        encoded_frames[frame - first]
+                    );
+                }
+                catch(...)
+                {
+                    // NOLINTNEXTLINE(clang-diagnostic-unknown-pragmas)
+                    #pragma omp critical
+                    error = std::current_exception();
+                }
+            }
+
+            if(error)
+            {
+                std::rethrow_exception(error);
+            }
+
+            // Append the batch in frame order
+            for(std::size_t frame = first ; frame < std::size_t(last) ; ++frame)
+            {
+                const auto& encoded_frame = encoded_frames[frame - first];
+                SIGHT_THROW_IF("Output size is greater than 4GB", encoded_frame.size() > 0xFFFFFFFF);
+
+                gdcm::Fragment frag;
+                frag.SetByteValue(
+                    reinterpret_cast<const char*>(encoded_frame.data()),
+                    std::uint32_t(encoded_frame.size())
+                );
+                sq->AddFragment(frag);
+
+                m_encoded_size += encoded_frame.size();
+            }
+
+            if(m_progress_callback)
+            {
+                m_progress_callback(std::size_t(last), num_frames);
+            }
+        }
+
+        _out.SetValue(*sq);
+
+        return true;
+    }
+
+protected:
+
+    /// Encodes a single frame. Must be thread safe, as it is called concurrently for different frames.
+    /// @param _frame pointer to the raw frame
+    /// @param _size size of the raw frame in bytes
+    /// @param _output encoded frame, resized to the encoded size
+    virtual void encode_frame(const char* _frame, std::size_t _size, std::vector<std::uint8_t>& _output) const = 0;
+
+    const std::size_t m_threads;
+
+private:
+
+    progress_callback_t m_progress_callback;
+    std::size_t m_encoded_size {0};
+};
+
+/// Lossless JPEG2000 codec relying on io::bitmap backends (OpenJPEG by default)
+class parallel_jpeg2k final : public parallel_codec<gdcm::JPEG2000Codec>
+{
+public:
+
+    explicit parallel_jpeg2k(std::size_t _threads = 0, bitmap::backend _backend = bitmap::backend::openjpeg_j2k) :
+        parallel_codec<gdcm::JPEG2000Codec>(_threads),
+        m_backend(_backend)
+    {
+    }
+
+    ~parallel_jpeg2k() override = default;
+
+    [[nodiscard]] gdcm::ImageCodec* Clone() const override;
+
+protected:
+
+    void encode_frame(const char* _frame, std::size_t _size, std::vector<std::uint8_t>& _output) const override;
+
+private:
+
+    const bitmap::backend m_backend;
+};
+
+/// JPEG-LS codec (lossless or near lossless) relying on the CharLS implementation of GDCM, one frame at a time
+class parallel_jpegls final : public parallel_codec<gdcm::JPEGLSCodec>
+{
+public:
+
+    explicit parallel_jpegls(std::size_t _threads = 0) :
+        parallel_codec<gdcm::JPEGLSCodec>(_threads)
+    {
+    }
+
+    ~parallel_jpegls() override = default;
+
+    /// Sets the maximum absolute error per sample of near lossless encoding, forwarded to each frame encoder
+    void set_lossy_error(int _error)
+    {
+        m_lossy_error = _error;
+        this->SetLossyError(_error);
+    }
+
+    /// Returns the maximum absolute error per sample of near lossless encoding
+    [[nodiscard]] int lossy_error() const noexcept
+    {
+        return m_lossy_error;
+    }
+
+    [[nodiscard]] gdcm::ImageCodec* Clone() const override;
+
+protected:
+
+    void encode_frame(const char* _frame, std::size_t _size, std::vector<std::uint8_t>& _output) const override;
+
+private:
+
+    /// GDCM does not expose the lossy error of its codec, so it is kept here to configure the frame codecs
+    int m_lossy_error {0};
+};
+
+} // namespace sight::io::dicom::codec
@@ -0,0 +1,212 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/dicom/helper/frame_position.hpp"
+
+#include <core/spy_log.hpp>
+
+#include <gdcmImageReader.h>
+
+#include <glm/glm.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+
+namespace sight::io::dicom::helper
+{
+
+//------------------------------------------------------------------------------
+
+inline static std::optional<double> compute_frame_position(
+    const data::series& _series,
+    std::size_t _instance,
+    std::vector<double> _position,
+    std::vector<double> _orientation
+)
+{
+    auto position    = std::move(_position);
+    auto orientation = std::move(_orientation);
+
+    if(position.size() != 3 || orientation.size() != 6)
+    {
+        // Fallback to gdcm::ImageReader if the position is not available
+        // This is of course slower...
+        const auto& file = _series.get_file(_instance);
+
+        if(file.empty() || !std::filesystem::exists(file) || std::filesystem::is_directory(file))
+        {
+            // Nothing to do here.
+            return std::nullopt;
+        }
+
+        // Create the reader
+        gdcm::ImageReader gdcm_image_reader;
+        const auto& filename = file.string();
+        gdcm_image_reader.SetFileName(filename.c_str());
+
+        if(!gdcm_image_reader.Read())
+        {
+            return std::nullopt;
+        }
+
+        const auto& image               = gdcm_image_reader.GetImage();
+        const double* const gdcm_origin = image.GetOrigin();
+        position = {gdcm_origin[0], gdcm_origin[1], gdcm_origin[2]};
+
+        const double* const gdcm_orientation = image.GetDirectionCosines();
+        orientation = {
+            gdcm_orientation[0], gdcm_orientation[1], gdcm_orientation[2],
+            gdcm_orientation[3], gdcm_orientation[4], gdcm_orientation[5]
+        };
+    }
+
+    // Compute w
+    const glm::dvec3 glm_u = {orientation[0], orientation[1], orientation[2]};
+    const glm::dvec3 glm_v = {orientation[3], orientation[4], orientation[5]};
+
+    const auto glm_w = glm::cross(glm_u, glm_v);
+
+    // Compute z position
+    const glm::dvec3 glm_position = {position[0], position[1], position[2]};
+    return glm::dot(glm_position, glm_w);
+}
+
+//------------------------------------------------------------------------------
+
+std::optional<std::vector<double> > compute_frame_positions(const data::series& _series)
+{
+    const auto num_instances = _series.num_instances();
+
+    std::vector<std::vector<double> > positions;
+    std::vector<std::vector<double> > orientations;
+
+    if(!_series.is_multi_frame())
+    {
+        // Parse the attributes of all instances at once, they stay cached for the next sorting or spacing passes
+        positions    = _series.get_image_positions_patient();
+        orientations = _series.get_image_orientations_patient();
+    }
+    else
+    {
+        positions.reserve(num_instances);
+        orientations.reserve(num_instances);
+
+        for(std::size_t instance = 0 ; instance < num_instances ; ++instance)
+        {
+            positions.push_back(_series.get_image_position_patient(instance));
+            orientations.push_back(_series.get_image_orientation_patient(instance));
+        }
+    }
+
+    std::vector<double> frame_positions;
+    frame_positions.reserve(num_instances);
+
+    for(std::size_t instance = 0 ; instance < num_instances ; ++instance)
+    {
+        const auto& value = compute_frame_position(
+            _series,
+            instance,
+            std::move(positions[instance]),
+            std::move(orientations[instance])
+        );
+
+        if(!value)
+        {
+            // No need to continue if we cannot compute the position for one frame
+            return std::nullopt;
+        }
+
+        frame_positions.push_back(*value);
+    }
+
+    return frame_positions;
+}
+
+//------------------------------------------------------------------------------
+
+std::optional<double> compute_z_spacing(const data::series& _series)
+{
+    // Use a map to sort for us....
+    std::map<std::int64_t, double> sorted_positions;
+
+    if(_series.num_instances() < 2)
+    {
+        SIGHT_WARN(
+            "The Z spacing cannot be computed, there is not enough instances."
+        );
+
+        return _series.get_slice_thickness();
+    }
+
+    const auto& frame_positions = compute_frame_positions(_series);
+
+    if(!frame_positions)
+    {
+        // No need to continue if we cannot compute the position for one frame
+        return std::nullopt;
+    }
+
+    for(const double position : *frame_positions)
+    {
+        // Simplify the z position, using the EPSILON precision
+        const auto index = std::int64_t(position / Z_EPSILON);
+
+        // Let the map sort the frames
+        sorted_positions.insert_or_assign(index, position);
+    }
+
+    if(sorted_positions.size() < 2)
+    {
+        SIGHT_WARN(
+            "The Z spacing cannot be computed, too much frame where dropped."
+        );
+
+        return _series.get_slice_thickness();
+    }
+
+    // cspell: ignore crbegin
+    const double first_position  = sorted_positions.cbegin()->second;
+    const double second_position = (++sorted_positions.cbegin())->second;
+    const double last_position   = sorted_positions.crbegin()->second;
+
+    const double first_spacing = std::abs(first_position - second_position);
+    const double all_spacing   = std::abs(last_position - first_position);
+    const double error         = std::abs(first_spacing * double(sorted_positions.size() - 1)) - all_spacing;
+
+    if(error > Z_EPSILON)
+    {
+        SIGHT_WARN(
+            "The Z spacing cannot be calculated, error ("
+            << error
+            << ") is bigger than current epsilon ("
+            << Z_EPSILON
+            << ")."
+        );
+
+        return _series.get_slice_thickness();
+    }
+
+    return first_spacing;
+}
+
+} // namespace sight::io::dicom::helper
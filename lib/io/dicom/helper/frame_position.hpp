@@ -0,0 +1,52 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/dicom/config.hpp>
+
+#include <data/series.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace sight::io::dicom::helper
+{
+
+/// Precision of frame positions along the slice normal.
+/// All frames that have a z position closer than this will be considered as the same.
+static constexpr double Z_EPSILON = 1e-3;
+
+/**
+ * @brief Computes the position of every frame along the normal of its image plane.
+ * Falls back to reading the instance file with GDCM when the plane attributes are missing.
+ * @return the positions in instance order, or nothing if one frame position cannot be computed
+ */
+SIGHT_IO_DICOM_API std::optional<std::vector<double> > compute_frame_positions(const data::series& _series);
+
+/**
+ * @brief Computes the spacing between frames from their positions.
+ * @return the regular spacing, the slice thickness if the frames are not evenly spaced, or nothing if the frame
+ *         positions cannot be computed
+ */
+SIGHT_IO_DICOM_API std::optional<double> compute_z_spacing(const data::series& _series);
+
+} // namespace sight::io::dicom::helper
@@ -22,6 +22,7 @@
 #include "file.hpp"
 
 #include "core/jobs/job.hpp"
+#include "io/dicom/helper/frame_position.hpp"
 
 #include <core/compare.hpp>
 
@@ -53,9 +54,7 @@
 namespace sight::io::dicom::reader
 {
 
-// We consider that 1e-3 is a good enough precision for our purpose.
-// All frames that have a z position closer than 1e-3 will be considered as the same.
-static constexpr double Z_EPSILON = 1e-3;
+using helper::Z_EPSILON;
 
 struct fiducial_set_with_metadata
 {
@@ -445,126 +444,6 @@ inline static enum data::image::pixel_format_t compute_format(
 
 //------------------------------------------------------------------------------
 
-inline static std::optional<double> compute_frame_position(const data::series& _series, std::size_t _instance)
-{
-    auto position    = _series.get_image_position_patient(_instance);
-    auto orientation = _series.get_image_orientation_patient(_instance);
-
-    if(position.size() != 3 || orientation.size() != 6)
-    {
-        // Fallback to gdcm::ImageReader if the position is not available
-        // This is of course slower...
-        const auto& file = _series.get_file(_instance);
-
-        if(file.empty() || !std::filesystem::exists(file) || std::filesystem::is_directory(file))
-        {
-            // Nothing to do here.
-            return std::nullopt;
-        }
-
-        // Create the reader
-        gdcm::ImageReader gdcm_image_reader;
-        const auto& filename = file.string();
-        gdcm_image_reader.SetFileName(filename.c_str());
-
-        if(!gdcm_image_reader.Read())
-        {
-            return std::nullopt;
-        }
-
-        const auto& image               = gdcm_image_reader.GetImage();
-        const double* const gdcm_origin = image.GetOrigin();
-        position = {gdcm_origin[0], gdcm_origin[1], gdcm_origin[2]};
-
-        const double* const gdcm_orientation = image.GetDirectionCosines();
-        orientation = {
-            gdcm_orientation[0], gdcm_orientation[1], gdcm_orientation[2],
-            gdcm_orientation[3], gdcm_orientation[4], gdcm_orientation[5]
-        };
-    }
-
-    // Compute w
-    const glm::dvec3 glm_u = {orientation[0], orientation[1], orientation[2]};
-    const glm::dvec3 glm_v = {orientation[3], orientation[4], orientation[5]};
-
-    const auto glm_w = glm::cross(glm_u, glm_v);
-
-    // Compute z position
-    const glm::dvec3 glm_position = {position[0], position[1], position[2]};
-    return glm::dot(glm_position, glm_w);
-}
-
-//------------------------------------------------------------------------------
-
-inline static std::optional<double> compute_z_spacing(const data::series& _series)
-{
-    // Use a map to sort for us....
-    std::map<std::int64_t, double> sorted_positions;
-
-    if(_series.num_instances() < 2)
-    {
-        SIGHT_WARN(
-            "The Z spacing cannot be computed, there is not enough instances."
-        );
-
-        return _series.get_slice_thickness();
-    }
-
-    for(std::size_t instance = 0, end = _series.num_instances() ; instance < end ; ++instance)
-    {
-        const auto& value = compute_frame_position(_series, instance);
-
-        if(!value)
-        {
-            // No need to continue if we cannot compute the position for one frame
-            return std::nullopt;
-        }
-
-        const double position = *value;
-
-        // Simplify the z position, using the EPSILON precision
-        const auto index = std::int64_t(position / Z_EPSILON);
-
-        // Let the map sort the frames
-        sorted_positions.insert_or_assign(index, position);
-    }
-
-    if(sorted_positions.size() < 2)
-    {
-        SIGHT_WARN(
-            "The Z spacing cannot be computed, too much frame where dropped."
-        );
-
-        return _series.get_slice_thickness();
-    }
-
-    // cspell: ignore crbegin
-    const double first_position  = sorted_positions.cbegin()->second;
-    const double second_position = (++sorted_positions.cbegin())->second;
-    const double last_position   = sorted_positions.crbegin()->second;
-
-    const double first_spacing = std::abs(first_position - second_position);
-    const double all_spacing   = std::abs(last_position - first_position);
-    const double error         = std::abs(first_spacing * double(sorted_positions.size() - 1)) - all_spacing;
-
-    if(error > Z_EPSILON)
-    {
-        SIGHT_WARN(
-            "The Z spacing cannot be calculated, error ("
-            << error
-            << ") is bigger than current epsilon ("
-            << Z_EPSILON
-            << ")."
-        );
-
-        return _series.get_slice_thickness();
-    }
-
-    return first_spacing;
-}
-
-//------------------------------------------------------------------------------
-
 inline static data::image::spacing_t compute_spacing(
     const data::series& _source,
     const gdcm::Image& _gdcm_image
@@ -580,7 +459,7 @@ inline static data::image::spacing_t compute_spacing(
     // Overwrite only if GDCM returned the default value (1.0), since GDCM usually knows to compute it right
     if(core::is_equal(spacing[2], 1.0))
     {
-        const auto& computed_spacing = compute_z_spacing(_source);
+        const auto& computed_spacing = helper::compute_z_spacing(_source);
 
         if(computed_spacing)
         {
@@ -1322,18 +1201,18 @@ public:
         // Use a map to sort for us....
         std::map<std::int64_t, std::size_t> sorter;
 
-        for(std::size_t instance = 0, end = _series->num_instances() ; instance < end ; ++instance)
-        {
-            const auto& value = compute_frame_position(*_series, instance);
+        const auto& frame_positions = helper::compute_frame_positions(*_series);
 
-            if(!value)
-            {
-                // No need to continue if we cannot compute the position for one frame
-                return false;
-            }
+        if(!frame_positions)
+        {
+            // No need to continue if we cannot compute the position for one frame
+            return false;
+        }
 
+        for(std::size_t instance = 0, end = frame_positions->size() ; instance < end ; ++instance)
+        {
             // Simplify the z position, using the EPSILON precision
-            const auto index = std::int64_t(*value / Z_EPSILON);
+            const auto index = std::int64_t((*frame_positions)[instance] / Z_EPSILON);
 
             // Let the map sort the frames
             sorter.insert_or_assign(index, instance);
@@ -23,10 +23,12 @@
 #include "reader_test.hpp"
 
 #include <core/memory/buffer_manager.hpp>
+#include <core/profiling.hpp>
 
 #include <data/image_series.hpp>
 #include <data/model_series.hpp>
 
+#include <io/dicom/helper/frame_position.hpp>
 #include <io/dicom/reader/file.hpp>
 #include <io/dicom/reader/series_set.hpp>
 
@@ -38,7 +40,10 @@
 
 #include <cppunit/extensions/HelperMacros.h>
 
+#include <algorithm>
 #include <filesystem>
+#include <numeric>
+#include <random>
 
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::io::dicom::ut::reader_test);
 
@@ -882,4 +887,77 @@ void reader_test::read_ultrasound_multiframe_image_test()
     }
 }
 
+//------------------------------------------------------------------------------
+
+void reader_test::benchmark_spacing_and_sort()
+{
+    static constexpr std::size_t s_INSTANCES = 1024;
+    static constexpr double s_SPACING        = 0.625;
+
+    // Instances are stored in a random order, as they usually come out of a directory scan
+    std::vector<std::size_t> order(s_INSTANCES);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+    std::shuffle(order.begin(), order.end(), std::mt19937(0));
+
+    const auto make_series =
+        [&order](bool _warm)
+        {
+            auto series = std::make_shared<data::image_series>();
+            series->set_sop_keyword(data::dicom::sop::Keyword::CTImageStorage);
+
+            for(std::size_t i = 0 ; i < s_INSTANCES ; ++i)
+            {
+                series->set_image_position_patient({-125.5, -130.25, double(order[i]) * s_SPACING}, i);
+                series->set_image_orientation_patient({1., 0., 0., 0., 1., 0.}, i);
+            }
+
+            if(_warm)
+            {
+                // Fill the attribute cache, as a previous sort or spacing pass would do
+                [[maybe_unused]] const auto& positions    = series->get_image_positions_patient();
+                [[maybe_unused]] const auto& orientations = series->get_image_orientations_patient();
+            }
+
+            return series;
+        };
+
+    // Z spacing
+    for(const bool warm : {false, true})
+    {
+        const auto series = make_series(warm);
+
+        std::optional<double> spacing;
+        {
+            FW_PROFILE(warm ? "Z spacing, warm cache" : "Z spacing, cold cache");
+            spacing = io::dicom::helper::compute_z_spacing(*series);
+        }
+
+        CPPUNIT_ASSERT(spacing);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(s_SPACING, *spacing, io::dicom::helper::Z_EPSILON);
+    }
+
+    // Sort
+    for(const bool warm : {false, true})
+    {
+        const auto series     = make_series(warm);
+        const auto series_set = std::make_shared<data::series_set>();
+        series_set->push_back(series);
+
+        auto reader = std::make_shared<io::dicom::reader::file>();
+        reader->set_scanned(series_set);
+
+        {
+            FW_PROFILE(warm ? "Series sort, warm cache" : "Series sort, cold cache");
+            reader->sort();
+        }
+
+        CPPUNIT_ASSERT_EQUAL(s_INSTANCES, series->num_instances());
+
+        for(std::size_t i = 0 ; i < s_INSTANCES ; ++i)
+        {
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(double(i) * s_SPACING, series->get_image_position_patient(i)[2], 1e-6);
+        }
+    }
+}
+
 } // namespace sight::io::dicom::ut
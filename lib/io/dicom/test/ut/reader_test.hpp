@@ -41,6 +41,7 @@ CPPUNIT_TEST(read_ct_series_set_issue01_test);
 CPPUNIT_TEST(read_enhanced_us_volume_test);
 CPPUNIT_TEST(read_ultrasound_image_test);
 CPPUNIT_TEST(read_ultrasound_multiframe_image_test);
+CPPUNIT_TEST(benchmark_spacing_and_sort);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -80,6 +81,9 @@ public:
 
     /// Read Ultrasound Multi-frame image Storage
     static void read_ultrasound_multiframe_image_test();
+
+    /// Measure the Z spacing computation and the sort on a large series, with cold and warm attribute caches
+    static void benchmark_spacing_and_sort();
 };
 
 } // namespace sight::io::dicom::ut
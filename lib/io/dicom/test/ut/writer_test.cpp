@@ -21,6 +21,7 @@
 
 #include "writer_test.hpp"
 
+#include <core/jobs/job.hpp>
 #include <core/os/temp_path.hpp>
 
 #include <data/image_series.hpp>
@@ -39,7 +40,9 @@
 
 #include <glm/glm.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
 #include <ctime>
 
 // cspell: ignore orthogonalize
@@ -633,4 +636,138 @@ void writer_test::transfer_syntax_test()
     }
 }
 
+//------------------------------------------------------------------------------
+
+void writer_test::encoding_threads_test()
+{
+    const auto& expected = get_us_volume_image(0xFFFF, 32);
+
+    for(const auto& transfer_syntax : {
+            io::dicom::writer::file::transfer_syntax::jpeg_2000_lossless,
+            io::dicom::writer::file::transfer_syntax::jpeg_ls_lossless
+        })
+    {
+        const std::string transfer_syntax_name(io::dicom::writer::file::transfer_syntax_to_string(transfer_syntax));
+
+        // Sequential encoding is the reference, then use a fixed number of threads and one per hardware thread
+        for(const std::size_t threads : {1, 4, 0})
+        {
+            core::os::temp_dir tmp_dir;
+
+            auto series_set = std::make_shared<data::series_set>();
+            series_set->push_back(expected);
+
+            auto writer = std::make_shared<io::dicom::writer::file>();
+            writer->set_object(series_set);
+            writer->set_folder(tmp_dir);
+            writer->set_transfer_syntax(transfer_syntax);
+            writer->set_encoding_threads(threads);
+            writer->force_cpu(true);
+
+            core::jobs::job::sptr job;
+            job = std::make_shared<core::jobs::job>(
+                "Write",
+                [&](core::jobs::job&)
+                {
+                    writer->set_job(job);
+
+                    SIGHT_PROFILE_FUNC(
+                        [&](std::size_t)
+                    {
+                        CPPUNIT_ASSERT_NO_THROW(writer->write());
+                    },
+                        3,
+                        "Write (" + transfer_syntax_name + ", " + std::to_string(threads) + " threads): ",
+                        0.1
+                    );
+                });
+
+            job->run();
+
+            // The throughput of each written series is reported in the job
+            const auto& logs = job->get_logs();
+            CPPUNIT_ASSERT(
+                std::ranges::any_of(
+                    logs,
+                    [](const std::string& _log)
+                {
+                    return _log.find("frames/s") != std::string::npos;
+                })
+            );
+
+            // Frames must be read back in the same order
+            auto read_series_set = std::make_shared<data::series_set>();
+            auto reader          = std::make_shared<io::dicom::reader::file>();
+            reader->set_object(read_series_set);
+            reader->set_folder(tmp_dir);
+
+            CPPUNIT_ASSERT_NO_THROW(reader->read());
+            CPPUNIT_ASSERT_EQUAL(std::size_t(1), read_series_set->size());
+
+            compare_enhanced_us_volume(
+                expected,
+                std::dynamic_pointer_cast<data::image_series>(read_series_set->front())
+            );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void writer_test::jpeg_ls_near_lossless_test()
+{
+    static constexpr int s_LOSSY_ERROR = 3;
+
+    const auto& expected = get_us_volume_image(2, 4);
+
+    // The sequential GDCM codec and the parallel one must both honor the lossy error
+    for(const std::size_t threads : {1, 4})
+    {
+        core::os::temp_dir tmp_dir;
+
+        auto series_set = std::make_shared<data::series_set>();
+        series_set->push_back(expected);
+
+        auto writer = std::make_shared<io::dicom::writer::file>();
+        writer->set_object(series_set);
+        writer->set_folder(tmp_dir);
+        writer->set_transfer_syntax(io::dicom::writer::file::transfer_syntax::jpeg_ls_nearlossless);
+        writer->set_encoding_threads(threads);
+        writer->set_lossy_error(s_LOSSY_ERROR);
+
+        CPPUNIT_ASSERT_NO_THROW(writer->write());
+
+        auto read_series_set = std::make_shared<data::series_set>();
+        auto reader          = std::make_shared<io::dicom::reader::file>();
+        reader->set_object(read_series_set);
+        reader->set_folder(tmp_dir);
+
+        CPPUNIT_ASSERT_NO_THROW(reader->read());
+        CPPUNIT_ASSERT_EQUAL(std::size_t(1), read_series_set->size());
+
+        const auto actual = std::dynamic_pointer_cast<data::image_series>(read_series_set->front());
+        CPPUNIT_ASSERT(actual);
+        CPPUNIT_ASSERT(expected->size() == actual->size());
+        CPPUNIT_ASSERT_EQUAL(expected->type(), actual->type());
+        CPPUNIT_ASSERT_EQUAL(expected->pixel_format(), actual->pixel_format());
+
+        const auto expected_locked = expected->dump_lock();
+        const auto actual_locked   = actual->dump_lock();
+
+        int max_error = 0;
+        for(auto expected_it = expected->begin<std::uint8_t>(), actual_it = actual->begin<std::uint8_t>() ;
+            expected_it != expected->end<std::uint8_t>() ;
+            ++expected_it, ++actual_it)
+        {
+            max_error = std::max(max_error, std::abs(int(*expected_it) - int(*actual_it)));
+        }
+
+        const std::string message = std::to_string(threads) + " threads, maximum error: " + std::to_string(max_error);
+
+        // The random image cannot be encoded losslessly with this lossy error, but must stay within its bound
+        CPPUNIT_ASSERT_MESSAGE(message, max_error > 0);
+        CPPUNIT_ASSERT_MESSAGE(message, max_error <= s_LOSSY_ERROR);
+    }
+}
+
 } // namespace sight::io::dicom::ut
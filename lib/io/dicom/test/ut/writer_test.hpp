@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -32,6 +32,8 @@ CPPUNIT_TEST_SUITE(writer_test);
 CPPUNIT_TEST(write_enhanced_us_volume_test);
 CPPUNIT_TEST(force_cpu_test);
 CPPUNIT_TEST(transfer_syntax_test);
+CPPUNIT_TEST(encoding_threads_test);
+CPPUNIT_TEST(jpeg_ls_near_lossless_test);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -42,6 +44,8 @@ public:
     static void write_enhanced_us_volume_test();
     static void force_cpu_test();
     static void transfer_syntax_test();
+    static void encoding_threads_test();
+    static void jpeg_ls_near_lossless_test();
 };
 
 } // namespace sight::io::dicom::ut
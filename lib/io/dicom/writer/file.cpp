@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -24,6 +24,7 @@
 #include "data/model_series.hpp"
 
 #include "io/dicom/codec/nv_jpeg2k.hpp"
+#include "io/dicom/codec/parallel_codec.hpp"
 
 #include <core/macros.hpp>
 
@@ -35,8 +36,11 @@
 
 #include <gdcmImageChangeTransferSyntax.h>
 #include <gdcmImageWriter.h>
+#include <gdcmJPEGLSCodec.h>
 
+#include <chrono>
 #include <filesystem>
+#include <functional>
 #include <iomanip>
 #include <sstream>
 
@@ -122,7 +126,10 @@ inline static void write_enhanced_us_volume(
     data::series& _series_copy,
     const std::string& _filepath,
     writer::file::transfer_syntax _transfer_syntax,
-    [[maybe_unused]] bool _force_cpu
+    [[maybe_unused]] bool _force_cpu,
+    std::size_t _threads,
+    int _lossy_error,
+    const std::function<void(std::size_t, std::size_t)>& _progress
 )
 {
     data::matrix4 transform;
@@ -394,9 +401,18 @@ inline static void write_enhanced_us_volume(
 
     gdcm_image.SetDataElement(pixeldata);
 
-    std::unique_ptr<codec::nv_jpeg2_k> nvjpeg2k_codec;
+    std::unique_ptr<gdcm::ImageCodec> user_codec;
     gdcm::ImageChangeTransferSyntax transfer_syntax_changer;
 
+    // Installs a codec which encodes the frames in parallel
+    const auto& use_parallel_codec =
+        [&]<class CODEC>(std::unique_ptr<CODEC> _codec)
+        {
+            _codec->set_progress_callback(_progress);
+            transfer_syntax_changer.SetUserCodec(_codec.get());
+            user_codec = std::move(_codec);
+        };
+
     switch(_transfer_syntax)
     {
         case writer::file::transfer_syntax::raw:
@@ -416,17 +432,40 @@ inline static void write_enhanced_us_volume(
             break;
 
         case writer::file::transfer_syntax::jpeg_ls_nearlossless:
-            transfer_syntax_changer.SetTransferSyntax(gdcm::TransferSyntax::JPEGLSNearLossless);
-            break;
-
         case writer::file::transfer_syntax::jpeg_ls_lossless:
-            transfer_syntax_changer.SetTransferSyntax(gdcm::TransferSyntax::JPEGLSLossless);
+        {
+            const bool lossless = _transfer_syntax == writer::file::transfer_syntax::jpeg_ls_lossless;
+            transfer_syntax_changer.SetTransferSyntax(
+                lossless
+                ? gdcm::TransferSyntax::JPEGLSLossless
+                : gdcm::TransferSyntax::JPEGLSNearLossless
+            );
+
+            if(_threads != 1)
+            {
+                auto jpegls_codec = std::make_unique<codec::parallel_jpegls>(_threads);
+                jpegls_codec->SetLossless(lossless);
+                jpegls_codec->set_lossy_error(_lossy_error);
+                use_parallel_codec(std::move(jpegls_codec));
+            }
+            else if(!lossless)
+            {
+                // GDCM only takes the lossy error from a user codec
+                auto jpegls_codec = std::make_unique<gdcm::JPEGLSCodec>();
+                jpegls_codec->SetLossless(false);
+                jpegls_codec->SetLossyError(_lossy_error);
+                transfer_syntax_changer.SetUserCodec(jpegls_codec.get());
+                user_codec = std::move(jpegls_codec);
+            }
+
             break;
+        }
 
         case writer::file::transfer_syntax::jpeg_2000:
             transfer_syntax_changer.SetTransferSyntax(gdcm::TransferSyntax::JPEG2000);
             break;
 
+        case writer::file::transfer_syntax::jpeg_2000_lossless:
         default:
         {
             if(_image_series.type().size() <= 2)
@@ -443,8 +482,8 @@ inline static void write_enhanced_us_volume(
                         !io::bitmap::nv_jpeg_2k()
                     );
 
-                    nvjpeg2k_codec = std::make_unique<codec::nv_jpeg2_k>();
-                    transfer_syntax_changer.SetUserCodec(nvjpeg2k_codec.get());
+                    user_codec = std::make_unique<codec::nv_jpeg2_k>();
+                    transfer_syntax_changer.SetUserCodec(user_codec.get());
 
                     SIGHT_INFO("nvJPEG2000 will be used for JPEG2000 compression.");
                 }
@@ -457,6 +496,11 @@ inline static void write_enhanced_us_volume(
 #else
                 SIGHT_INFO("OpenJPEG will be used for JPEG2000 compression.");
 #endif
+
+                if(!user_codec && _threads != 1)
+                {
+                    use_parallel_codec(std::make_unique<codec::parallel_jpeg2k>(_threads));
+                }
             }
             else
             {
@@ -604,12 +648,48 @@ public:
 
     //------------------------------------------------------------------------------
 
+    /// Logs the number of frames and the bandwidth of the last written series in the job
+    void log_throughput(
+        const data::image_series& _image_series,
+        const std::filesystem::path& _filepath,
+        double _seconds
+    ) const
+    {
+        const auto& size          = _image_series.size();
+        const auto frames         = size[2] == 0 ? std::size_t(1) : size[2];
+        const auto raw_mb         = double(_image_series.size_in_bytes()) / (1024. * 1024.);
+        const auto written_mb     = double(std::filesystem::file_size(_filepath)) / (1024. * 1024.);
+        const double safe_seconds = std::max(_seconds, 1e-6);
+
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(2);
+        ss << "Series '" << _image_series.get_series_instance_uid() << "' written: ";
+        ss << frames << " frames, " << raw_mb << " MB in " << _seconds << " s (";
+        ss << double(frames) / safe_seconds << " frames/s, " << raw_mb / safe_seconds << " MB/s, ";
+        ss << "compression ratio " << (written_mb > 0. ? raw_mb / written_mb : 0.) << ")";
+
+        SIGHT_INFO(ss.str());
+
+        if(m_job)
+        {
+            m_job->log(ss.str());
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
     /// The default job. Allows to watch for cancellation and report progress.
     core::jobs::job::sptr m_job;
 
     /// True to disable GPU codec
     bool m_force_cpu {false};
 
+    /// Number of threads used to encode the frames, 0 means one per hardware thread
+    std::size_t m_encoding_threads {1};
+
+    /// Maximum error per sample of JPEG-LS near lossless encoding
+    int m_lossy_error {0};
+
     /// The overriden transfer syntax
     transfer_syntax m_transfer_syntax {transfer_syntax::sop_default};
 };
@@ -646,7 +726,8 @@ void file::write()
     const auto& series_set = get_concrete_object();
 
     // Compute progress for one step
-    const size_t progress_step = (100 - 20) / series_set->size();
+    const size_t progress_step   = (100 - 20) / series_set->size();
+    std::uint64_t progress_start = 10;
 
     // Compute the base name
     const auto& file         = get_file();
@@ -704,13 +785,28 @@ void file::write()
             auto series_copy = std::make_shared<data::series>();
             series_copy->shallow_copy(series);
 
+            // Report the progress frame by frame, when the codec allows it
+            const auto& progress =
+                [&](std::size_t _encoded, std::size_t _total)
+                {
+                    m_pimpl->progress(progress_start + (progress_step * _encoded) / _total);
+                };
+
+            const auto start = std::chrono::steady_clock::now();
+
             write_enhanced_us_volume(
                 *image_series,
                 *series_copy,
                 filepath.string(),
                 m_pimpl->m_transfer_syntax,
-                m_pimpl->m_force_cpu
+                m_pimpl->m_force_cpu,
+                m_pimpl->m_encoding_threads,
+                m_pimpl->m_lossy_error,
+                progress
             );
+
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            m_pimpl->log_throughput(*image_series, filepath, elapsed.count());
         }
         else
         {
@@ -753,7 +849,8 @@ void file::write()
             }
         }
 
-        m_pimpl->progress(progress_step);
+        m_pimpl->progress(progress_start + progress_step);
+        progress_start += progress_step;
         ++index;
     }
 }
@@ -784,6 +881,20 @@ void file::force_cpu(bool _force)
 
 //------------------------------------------------------------------------------
 
+void file::set_encoding_threads(std::size_t _threads)
+{
+    m_pimpl->m_encoding_threads = _threads;
+}
+
+//------------------------------------------------------------------------------
+
+void file::set_lossy_error(int _error)
+{
+    m_pimpl->m_lossy_error = _error;
+}
+
+//------------------------------------------------------------------------------
+
 void file::set_transfer_syntax(file::transfer_syntax _transfer_syntax)
 {
     m_pimpl->m_transfer_syntax = _transfer_syntax;
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -70,6 +70,17 @@ public:
     /// @arg force: true to force CPU backend, false to use GPU and throw an exception if not available
     SIGHT_IO_DICOM_API void force_cpu(bool _force);
 
+    /// Set the number of threads used to encode the frames of multi-frame images with JPEG2000 lossless or JPEG-LS.
+    /// Frames are encoded independently by batches, then appended in order to the pixel data. The default is 1, which
+    /// keeps the GDCM sequential codecs.
+    /// @param _threads the number of threads, 0 means one per hardware thread
+    SIGHT_IO_DICOM_API void set_encoding_threads(std::size_t _threads);
+
+    /// Set the maximum absolute error per sample allowed by the JPEG-LS near lossless transfer syntax.
+    /// The default is 0, which encodes losslessly even with the near lossless transfer syntax.
+    /// @param _error the maximum error, JPEG-LS NEAR parameter
+    SIGHT_IO_DICOM_API void set_lossy_error(int _error);
+
     /// Allowed transfer syntax. The default will depends of the SOP classes.
     /// @note All transfer syntaxes are not supported by all SOP classes.
     /// @note this is a simplified version of the DICOM standard, only the most used are supported.
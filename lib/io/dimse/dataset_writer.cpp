@@ -0,0 +1,331 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "dataset_writer.hpp"
+
+#include "io/dimse/exceptions/request_failure.hpp"
+
+#include <core/spy_log.hpp>
+#include <core/thread/worker.hpp>
+
+#include <dcmtk/dcmdata/dcdeftag.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace sight::io::dimse
+{
+
+using steady_clock_t = std::chrono::steady_clock;
+
+class dataset_writer::dataset_writer_impl
+{
+public:
+
+    /// Retrieval state of a series
+    struct series_state
+    {
+        series_statistics statistics;
+        std::optional<steady_clock_t::time_point> start;
+    };
+
+    //------------------------------------------------------------------------------
+
+    dataset_writer_impl(std::filesystem::path _folder, std::size_t _threads) :
+        m_folder(std::move(_folder)),
+        // Enough pending datasets to keep all threads busy while the network receives the next ones
+        m_max_pending(4 * _threads)
+    {
+        for(std::size_t i = 0 ; i < _threads ; ++i)
+        {
+            auto worker = core::thread::worker::make();
+            worker->set_thread_name("dimse_writer_" + std::to_string(i));
+            m_workers.push_back(worker);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    ~dataset_writer_impl()
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock, [this]{return m_pending == 0;});
+        }
+
+        for(const auto& worker : m_workers)
+        {
+            worker->stop();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    void write(DcmFileFormat& _file)
+    {
+        // Find the series and the instance UIDs.
+        OFString series_id;
+        _file.getDataset()->findAndGetOFStringArray(DCM_SeriesInstanceUID, series_id);
+
+        OFString instance_id;
+        _file.getDataset()->findAndGetOFStringArray(DCM_SOPInstanceUID, instance_id);
+
+        // Create Folder.
+        const auto series_path = m_folder / series_id.c_str();
+        std::error_code error;
+        std::filesystem::create_directories(series_path, error);
+
+        if(error)
+        {
+            throw io::dimse::exceptions::request_failure(
+                      "Unable to create '" + series_path.string() + "': " + error.message()
+            );
+        }
+
+        // Save the file in the specified folder (Create new meta header for gdcm reader).
+        const auto file_path = series_path / instance_id.c_str();
+        const OFCondition result = _file.saveFile(
+            file_path.string().c_str(),
+            EXS_Unknown,
+            EET_UndefinedLength,
+            EGL_recalcGL,
+            EPD_noChange,
+            0,
+            0,
+            EWM_createNewMeta
+        );
+
+        if(result.bad())
+        {
+            throw io::dimse::exceptions::request_failure(
+                      "Unable to write '" + file_path.string() + "': " + std::string(result.text())
+            );
+        }
+
+        const auto size = std::filesystem::file_size(file_path);
+
+        unsigned int index = 0;
+        written_callback_t callback;
+        {
+            std::unique_lock lock(m_mutex);
+
+            auto& state    = m_series[series_id.c_str()];
+            const auto now = steady_clock_t::now();
+            if(!state.start)
+            {
+                state.start = now;
+            }
+
+            ++state.statistics.instances;
+            state.statistics.bytes  += size;
+            state.statistics.elapsed = now - *state.start;
+
+            index    = ++m_instance_index;
+            callback = m_callback;
+        }
+
+        // Notify callback.
+        if(callback)
+        {
+            callback(series_id.c_str(), index, file_path.string());
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    void push(std::unique_ptr<DcmFileFormat> _file)
+    {
+        std::shared_ptr<DcmFileFormat> file(std::move(_file));
+
+        core::thread::worker::sptr worker;
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock, [this]{return m_pending < m_max_pending;});
+            ++m_pending;
+            worker = m_workers[m_next_worker++ % m_workers.size()];
+        }
+
+        worker->post(
+            [this, file]
+            {
+                try
+                {
+                    this->write(*file);
+                }
+                catch(const std::exception& e)
+                {
+                    SIGHT_ERROR(e.what());
+
+                    std::unique_lock lock(m_mutex);
+                    if(!m_error)
+                    {
+                        m_error = std::current_exception();
+                    }
+                }
+
+                {
+                    std::unique_lock lock(m_mutex);
+                    --m_pending;
+                }
+                m_condition.notify_all();
+            });
+    }
+
+    //------------------------------------------------------------------------------
+
+    void wait()
+    {
+        std::exception_ptr error;
+        {
+            std::unique_lock lock(m_mutex);
+            m_condition.wait(lock, [this]{return m_pending == 0;});
+            std::swap(error, m_error);
+        }
+
+        if(error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /// Root folder
+    const std::filesystem::path m_folder;
+
+    /// Maximum number of datasets waiting to be written
+    const std::size_t m_max_pending;
+
+    /// Writer threads, datasets are dispatched in turn
+    std::vector<core::thread::worker::sptr> m_workers;
+    std::size_t m_next_worker {0};
+
+    /// Protects the following members
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::size_t m_pending {0};
+    std::exception_ptr m_error;
+    std::map<std::string, series_state> m_series;
+    unsigned int m_instance_index {0};
+    written_callback_t m_callback;
+};
+
+//------------------------------------------------------------------------------
+
+dataset_writer::dataset_writer(std::filesystem::path _folder, std::size_t _threads) :
+    m_pimpl(std::make_unique<dataset_writer_impl>(std::move(_folder), _threads))
+{
+}
+
+//------------------------------------------------------------------------------
+
+dataset_writer::~dataset_writer() = default;
+
+//------------------------------------------------------------------------------
+
+void dataset_writer::set_callback(written_callback_t _callback)
+{
+    std::unique_lock lock(m_pimpl->m_mutex);
+    m_pimpl->m_callback = std::move(_callback);
+}
+
+//------------------------------------------------------------------------------
+
+void dataset_writer::start_series(const std::string& _series_instance_uid)
+{
+    std::unique_lock lock(m_pimpl->m_mutex);
+    m_pimpl->m_series[_series_instance_uid].start = steady_clock_t::now();
+}
+
+//------------------------------------------------------------------------------
+
+void dataset_writer::write(std::unique_ptr<DcmFileFormat> _file)
+{
+    SIGHT_ASSERT("The file cannot be null.", _file);
+
+    if(m_pimpl->m_workers.empty())
+    {
+        m_pimpl->write(*_file);
+    }
+    else
+    {
+        m_pimpl->push(std::move(_file));
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void dataset_writer::wait()
+{
+    m_pimpl->wait();
+}
+
+//------------------------------------------------------------------------------
+
+dataset_writer::statistics_t dataset_writer::get_statistics() const
+{
+    std::unique_lock lock(m_pimpl->m_mutex);
+
+    statistics_t statistics;
+    for(const auto& [uid, state] : m_pimpl->m_series)
+    {
+        statistics[uid] = state.statistics;
+    }
+
+    return statistics;
+}
+
+//------------------------------------------------------------------------------
+
+void dataset_writer::reset()
+{
+    std::unique_lock lock(m_pimpl->m_mutex);
+    m_pimpl->m_series.clear();
+    m_pimpl->m_instance_index = 0;
+}
+
+//------------------------------------------------------------------------------
+
+void dataset_writer::log_statistics() const
+{
+    for(const auto& [uid, statistics] : this->get_statistics())
+    {
+        const double seconds   = std::max(statistics.elapsed.count(), 1e-6);
+        const double megabytes = static_cast<double>(statistics.bytes) / (1024. * 1024.);
+
+        SIGHT_INFO(
+            "Series '" << uid << "' retrieved: " << statistics.instances << " instances, " << megabytes
+            << " MB in " << statistics.elapsed.count() << " s ("
+            << static_cast<double>(statistics.instances) / seconds << " instances/s, "
+            << megabytes / seconds << " MB/s)."
+        );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+const std::filesystem::path& dataset_writer::folder() const
+{
+    return m_pimpl->m_folder;
+}
+
+} // namespace sight::io::dimse
@@ -0,0 +1,119 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/dimse/config.hpp>
+
+#include <dcmtk/config/osconfig.h>
+#include <dcmtk/dcmdata/dcfilefo.h>
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace sight::io::dimse
+{
+
+/**
+ * @brief Writes the DICOM datasets received from a PACS, in `<folder>/<SeriesInstanceUID>/<SOPInstanceUID>`.
+ *
+ * With writer threads, datasets are written asynchronously, so the network thread can keep receiving while the
+ * previous datasets are encoded and written. The number of pending datasets is bounded: write() blocks when the
+ * writer threads fall behind, to keep the memory usage under control.
+ *
+ * The writer also gathers the number of instances, the number of bytes and the duration of the retrieval of each
+ * series, in order to report the throughput.
+ *
+ * All methods are thread safe, the same writer can be shared between several associations.
+ */
+class SIGHT_IO_DIMSE_CLASS_API dataset_writer final
+{
+public:
+
+    /// Retrieval statistics of a series
+    struct series_statistics
+    {
+        std::size_t instances {0};
+        std::size_t bytes {0};
+
+        /// Duration between the request (or the first received instance) and the last written instance
+        std::chrono::duration<double> elapsed {0};
+    };
+
+    using statistics_t = std::map<std::string, series_statistics>;
+
+    /// Called from a writer thread each time an instance is written, with the index of the instance (starting at 1)
+    using written_callback_t = std::function<void (const std::string& _series_instance_uid,
+                                                   unsigned int _instance_index,
+                                                   const std::string& _file_path)>;
+
+    /**
+     * @brief Constructor.
+     * @param _folder the root folder of the written series
+     * @param _threads number of writer threads, 0 means the datasets are written synchronously by write()
+     */
+    SIGHT_IO_DIMSE_API explicit dataset_writer(std::filesystem::path _folder, std::size_t _threads = 0);
+
+    /// Waits for the pending datasets to be written
+    SIGHT_IO_DIMSE_API ~dataset_writer();
+
+    /// Sets the callback called each time an instance is written
+    SIGHT_IO_DIMSE_API void set_callback(written_callback_t _callback);
+
+    /// Marks the beginning of the retrieval of a series, used to compute its throughput
+    SIGHT_IO_DIMSE_API void start_series(const std::string& _series_instance_uid);
+
+    /**
+     * @brief Writes a dataset, the meta header is regenerated.
+     * @param _file the dataset to write, taken by the writer
+     */
+    SIGHT_IO_DIMSE_API void write(std::unique_ptr<DcmFileFormat> _file);
+
+    /**
+     * @brief Waits for the pending datasets to be written.
+     * @throw io::dimse::exceptions::request_failure if a dataset could not be written
+     */
+    SIGHT_IO_DIMSE_API void wait();
+
+    /// Returns the statistics of the series written since the last reset
+    [[nodiscard]] SIGHT_IO_DIMSE_API statistics_t get_statistics() const;
+
+    /// Clears the statistics and the instance index
+    SIGHT_IO_DIMSE_API void reset();
+
+    /// Logs the throughput of each series
+    SIGHT_IO_DIMSE_API void log_statistics() const;
+
+    /// Returns the root folder of the written series
+    [[nodiscard]] SIGHT_IO_DIMSE_API const std::filesystem::path& folder() const;
+
+private:
+
+    /// PImpl
+    class dataset_writer_impl;
+    std::unique_ptr<dataset_writer_impl> m_pimpl;
+};
+
+} // namespace sight::io::dimse
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -29,11 +29,14 @@
 #include "io/dimse/exceptions/tag_missing.hpp"
 
 #include <core/os/temp_path.hpp>
+#include <core/thread/worker.hxx>
 
 #include <dcmtk/config/osconfig.h>
 #include <dcmtk/dcmdata/dcfilefo.h>
 #include <dcmtk/dcmnet/diutil.h>
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 
 /**
@@ -86,6 +89,9 @@ void series_enquirer::initialize(
         std::filesystem::create_directories(m_path);
     }
 
+    // Instances are written synchronously by default.
+    this->set_writer_threads(0);
+
     // Configure network connection.
     this->setAETitle(_application_title.c_str());
     this->setPeerHostName(_peer_host_name.c_str());
@@ -807,7 +813,7 @@ void series_enquirer::pull_series_using_move_retrieve_method(InstanceUIDContaine
 void series_enquirer::pull_series_using_get_retrieve_method(InstanceUIDContainer _instance_uid_container)
 {
     // Reset instance count.
-    m_instance_index = 0;
+    m_writer->reset();
 
     DcmDataset dataset;
     OFCondition result;
@@ -818,6 +824,7 @@ void series_enquirer::pull_series_using_get_retrieve_method(InstanceUIDContainer
         dataset.putAndInsertOFStringArray(DCM_SeriesInstanceUID, series_instance_uid.c_str());
 
         // Fetches all images of this particular study.
+        m_writer->start_series(series_instance_uid);
         result = this->send_get_request(dataset);
 
         if(result.good())
@@ -831,6 +838,192 @@ void series_enquirer::pull_series_using_get_retrieve_method(InstanceUIDContainer
             throw io::dimse::exceptions::request_failure(msg);
         }
     }
+
+    // Wait for the last instances to be written.
+    m_writer->wait();
+    m_writer->log_statistics();
+}
+
+//------------------------------------------------------------------------------
+
+dataset_writer::statistics_t series_enquirer::pull_series(
+    const InstanceUIDContainer& _instance_uid_container,
+    data::pacs_configuration::retrieve_method _method,
+    std::size_t _associations
+)
+{
+    SIGHT_ASSERT("The series enquirer must be connected.", this->is_connected_to_pacs());
+
+    using retrieve_method_t = data::pacs_configuration::retrieve_method;
+
+    // Reset instance count.
+    m_writer->reset();
+
+    if(_instance_uid_container.empty())
+    {
+        return {};
+    }
+
+    // Open the additional associations, there is no need for more associations than series.
+    const std::size_t associations = std::clamp(_associations, std::size_t(1), _instance_uid_container.size());
+
+    std::vector<series_enquirer::sptr> enquirers;
+    for(std::size_t i = 1 ; i < associations ; ++i)
+    {
+        auto enquirer = std::make_shared<series_enquirer>();
+        enquirer->initialize(
+            this->getAETitle().c_str(),
+            this->getPeerHostName().c_str(),
+            this->getPeerPort(),
+            this->getPeerAETitle().c_str(),
+            m_move_application_title
+        );
+
+        // Received instances are written by the shared writer.
+        enquirer->m_writer = m_writer;
+
+        try
+        {
+            enquirer->connect();
+            enquirers.push_back(enquirer);
+        }
+        catch(const io::dimse::exceptions::base& e)
+        {
+            SIGHT_WARN("Unable to open more than " << i << " associations with the PACS: " << e.what());
+            break;
+        }
+    }
+
+    // Each association requests the next series, until all series are requested.
+    std::atomic<std::size_t> next_series {0};
+    const auto pull =
+        [&](series_enquirer& _enquirer)
+        {
+            for(std::size_t i = next_series++ ; i < _instance_uid_container.size() ; i = next_series++)
+            {
+                const std::string& series_instance_uid = _instance_uid_container[i];
+
+                DcmDataset dataset;
+                dataset.putAndInsertOFStringArray(DCM_QueryRetrieveLevel, "SERIES");
+                dataset.putAndInsertOFStringArray(DCM_SeriesInstanceUID, series_instance_uid.c_str());
+
+                OFCondition result;
+                if(_method == retrieve_method_t::move)
+                {
+                    result = _enquirer.send_move_request(dataset);
+                }
+                else
+                {
+                    m_writer->start_series(series_instance_uid);
+                    result = _enquirer.send_get_request(dataset);
+                }
+
+                if(result.bad())
+                {
+                    const std::string msg = "Unable to send a retrieve request to the server. "
+                                            "(Series instance UID =" + series_instance_uid + ") : "
+                                            + std::string(result.text());
+                    throw io::dimse::exceptions::request_failure(msg);
+                }
+            }
+        };
+
+    std::vector<core::thread::worker::sptr> workers;
+    std::vector<std::shared_future<void> > futures;
+    for(const auto& enquirer : enquirers)
+    {
+        auto worker = core::thread::worker::make();
+        futures.push_back(worker->post_task<void>([&pull, enquirer]{pull(*enquirer);}));
+        workers.push_back(worker);
+    }
+
+    // This association is used by the calling thread.
+    std::exception_ptr error;
+    try
+    {
+        pull(*this);
+    }
+    catch(...)
+    {
+        error = std::current_exception();
+    }
+
+    // Wait for all associations before reporting the first error.
+    for(const auto& future : futures)
+    {
+        try
+        {
+            future.get();
+        }
+        catch(...)
+        {
+            if(!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    for(const auto& worker : workers)
+    {
+        worker->stop();
+    }
+
+    for(const auto& enquirer : enquirers)
+    {
+        enquirer->disconnect();
+    }
+
+    // Wait for the last instances to be written.
+    try
+    {
+        m_writer->wait();
+    }
+    catch(...)
+    {
+        if(!error)
+        {
+            error = std::current_exception();
+        }
+    }
+
+    if(error)
+    {
+        std::rethrow_exception(error);
+    }
+
+    SIGHT_INFO(
+        "Pulled " << _instance_uid_container.size() << " series on " << enquirers.size() + 1 << " associations."
+    );
+
+    if(_method == retrieve_method_t::move)
+    {
+        // Instances are received by the series retriever, not by this enquirer.
+        return {};
+    }
+
+    m_writer->log_statistics();
+    return m_writer->get_statistics();
+}
+
+//------------------------------------------------------------------------------
+
+void series_enquirer::set_writer_threads(std::size_t _threads)
+{
+    SIGHT_ASSERT("The path where to store the series is not set.", !m_path.empty());
+
+    m_writer = std::make_shared<dataset_writer>(m_path, _threads);
+
+    // Notify callback.
+    m_writer->set_callback(
+        [callback = m_progress_callback](const std::string& _series_instance_uid, unsigned int _index,
+                                         const std::string& _file_path)
+        {
+            if(callback)
+            {
+                callback->async_run(_series_instance_uid, _index, _file_path);
+            }
+        });
 }
 
 //------------------------------------------------------------------------------
@@ -874,7 +1067,7 @@ void series_enquirer::pull_instance_using_get_retrieve_method(
 )
 {
     // Reset instance count.
-    m_instance_index = 0;
+    m_writer->reset();
 
     DcmDataset dataset;
     OFCondition result;
@@ -897,6 +1090,9 @@ void series_enquirer::pull_instance_using_get_retrieve_method(
                                 + std::string(result.text());
         throw io::dimse::exceptions::request_failure(msg);
     }
+
+    // Wait for the instance to be written.
+    m_writer->wait();
 }
 
 //------------------------------------------------------------------------------
@@ -997,44 +1193,8 @@ OFCondition series_enquirer::handleSTORERequest(
 
     if(_incoming_object != nullptr)
     {
-        // Find the series UID.
-        OFString series_id;
-        if(_incoming_object->findAndGetOFStringArray(DCM_SeriesInstanceUID, series_id).good())
-        {
-        }
-
-        // Find the instance UID.
-        OFString instance_id;
-        if(_incoming_object->findAndGetOFStringArray(DCM_SOPInstanceUID, instance_id).good())
-        {
-        }
-
-        // Create Folder.
-        std::filesystem::path series_path = std::filesystem::path(m_path.string() + series_id.c_str() + "/");
-        if(!std::filesystem::exists(series_path))
-        {
-            std::filesystem::create_directories(series_path);
-        }
-
-        // Save the file in the specified folder (Create new meta header for gdcm reader).
-        std::string file_path = series_path.string() + instance_id.c_str();
-        DcmFileFormat file_format(_incoming_object);
-        file_format.saveFile(
-            file_path.c_str(),
-            EXS_Unknown,
-            EET_UndefinedLength,
-            EGL_recalcGL,
-            EPD_noChange,
-            0,
-            0,
-            EWM_createNewMeta
-        );
-
-        // Notify callback.
-        if(m_progress_callback)
-        {
-            m_progress_callback->async_run(series_id.c_str(), ++m_instance_index, file_path);
-        }
+        // The dataset is copied, as it is deleted by DCMTK once the C-STORE response is sent.
+        m_writer->write(std::make_unique<DcmFileFormat>(_incoming_object));
     }
 
     return result;
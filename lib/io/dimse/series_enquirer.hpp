@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -24,6 +24,9 @@
 
 #include <sight/io/dimse/config.hpp>
 
+#include "io/dimse/data/pacs_configuration.hpp"
+#include "io/dimse/dataset_writer.hpp"
+
 #include <core/base_object.hpp>
 #include <core/com/slot.hpp>
 #include <core/com/slots.hpp>
@@ -195,6 +198,35 @@ public:
      */
     SIGHT_IO_DIMSE_API void pull_series_using_get_retrieve_method(InstanceUIDContainer _instance_uid_container);
 
+    /**
+     * @brief Pulls series on several associations in parallel.
+     *
+     * The additional associations are opened with the parameters of this enquirer, which must be connected. If the
+     * PACS refuses some of them, the series are pulled on the associations that could be opened. Each association
+     * requests the next series not yet requested, until all series are pulled.
+     *
+     * With C-GET, the received instances are written by the writer threads (see set_writer_threads()), shared by all
+     * associations, while the associations keep receiving. With C-MOVE, they are received by the series_retriever
+     * listening for the move application title.
+     *
+     * @param _instance_uid_container The series instance UID container.
+     * @param _method The retrieve method.
+     * @param _associations The number of associations, including this one.
+     * @return The retrieval statistics of each series, empty with C-MOVE.
+     */
+    SIGHT_IO_DIMSE_API dataset_writer::statistics_t pull_series(
+        const InstanceUIDContainer& _instance_uid_container,
+        data::pacs_configuration::retrieve_method _method,
+        std::size_t _associations
+    );
+
+    /**
+     * @brief Sets the number of threads writing the instances received with C-GET requests.
+     * @param _threads The number of threads, 0 (default) means the instances are written by the receiving thread.
+     * @pre initialize() must have been called.
+     */
+    SIGHT_IO_DIMSE_API void set_writer_threads(std::size_t _threads);
+
     /**
      * @brief Pulls instance using C-MOVE requests.
      * @param _series_instance_uid The series instance UID.
@@ -309,6 +341,9 @@ private:
 
     /// Sets the dowloaded instance index.
     unsigned int m_instance_index {0};
+
+    /// Writes the instances received with C-GET requests, shared with the additional associations.
+    std::shared_ptr<dataset_writer> m_writer;
 };
 
 } // namespace sight::io::dimse.
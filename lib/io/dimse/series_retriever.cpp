@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -29,6 +29,7 @@
 #include <core/thread/worker.hpp>
 
 #include <dcmtk/config/osconfig.h>
+#include <dcmtk/dcmdata/dcfilefo.h>
 #include <dcmtk/dcmnet/diutil.h>
 
 #include <filesystem>
@@ -69,6 +70,9 @@ void series_retriever::initialize(
         std::filesystem::create_directories(m_path);
     }
 
+    // Instances are written synchronously by default
+    this->set_writer_threads(0);
+
     //Configure network connection
     this->setAETitle(_application_title.c_str());
     this->setPort(_applicationport);
@@ -90,6 +94,7 @@ bool series_retriever::start()
 {
     // Reset instance count
     m_instance_index = 0;
+    m_writer->reset();
 
     // Start listening
     return this->listen().good();
@@ -97,6 +102,33 @@ bool series_retriever::start()
 
 // ----------------------------------------------------------------------------
 
+void series_retriever::set_writer_threads(std::size_t _threads)
+{
+    SIGHT_ASSERT("The path where to store the series is not set.", !m_path.empty());
+
+    m_writer = std::make_shared<dataset_writer>(m_path, _threads);
+
+    // Notify callback
+    m_writer->set_callback(
+        [callback = m_progress_callback](const std::string& _series_instance_uid, unsigned int _index,
+                                         const std::string& _file_path)
+        {
+            if(callback)
+            {
+                callback->async_run(_series_instance_uid, _index, _file_path);
+            }
+        });
+}
+
+// ----------------------------------------------------------------------------
+
+std::shared_ptr<dataset_writer> series_retriever::get_writer() const
+{
+    return m_writer;
+}
+
+// ----------------------------------------------------------------------------
+
 OFCondition series_retriever::handleIncomingCommand(
     T_DIMSE_Message* _incoming_msg,
     const DcmPresentationContextInfo& _pres_context_info
@@ -127,57 +159,25 @@ OFCondition series_retriever::handleSTORERequest(
 {
     OFCondition cond;
 
-    // Dump incoming message
-    OFString temp_str;
-
     // Get Dataset
-    auto* dataset = new DcmDataset();
-    if(this->receiveDIMSEDataset(&_pres_id, &dataset).good())
+    DcmDataset* dataset = nullptr;
+    if(this->receiveDIMSEDataset(&_pres_id, &dataset).good() && dataset != nullptr)
     {
-        if(dataset != nullptr)
-        {
-            //Find the series UID
-            OFString series_id;
-            if(dataset->findAndGetOFStringArray(DCM_SeriesInstanceUID, series_id).good())
-            {
-            }
-
-            //Find the instance UID
-            OFString instance_id;
-            if(dataset->findAndGetOFStringArray(DCM_SOPInstanceUID, instance_id).good())
-            {
-            }
-
-            //Create Folder
-            std::filesystem::path series_path = std::filesystem::path(m_path.string() + series_id.c_str() + "/");
-            if(!std::filesystem::exists(series_path))
-            {
-                std::filesystem::create_directories(series_path);
-            }
-
-            //Save the file in the specified folder
-            std::string file_path = series_path.string() + instance_id.c_str();
-            dataset->saveFile(file_path.c_str());
+        const std::unique_ptr<DcmDataset> received(dataset);
 
-            // Send a store response
-            T_DIMSE_C_StoreRSP rsp {};
-            rsp.DimseStatus = STATUS_Success;
-            cond            = this->sendSTOREResponse(_pres_id, _incoming_msg->msg.CStoreRQ, rsp.DimseStatus);
+        // Send a store response, the dataset is written while the next one is received
+        T_DIMSE_C_StoreRSP rsp {};
+        rsp.DimseStatus = STATUS_Success;
+        cond            = this->sendSTOREResponse(_pres_id, _incoming_msg->msg.CStoreRQ, rsp.DimseStatus);
 
-            // Dump outgoing message
-
-            if(cond.bad())
-            {
-                const std::string msg = "Cannot send C-STORE Response to the server.";
-                throw io::dimse::exceptions::request_failure(msg);
-            }
-
-            // Notify callback
-            if(m_progress_callback)
-            {
-                m_progress_callback->async_run(series_id.c_str(), ++m_instance_index, file_path);
-            }
+        if(cond.bad())
+        {
+            const std::string msg = "Cannot send C-STORE Response to the server.";
+            throw io::dimse::exceptions::request_failure(msg);
         }
+
+        //Save the file in the series folder
+        m_writer->write(std::make_unique<DcmFileFormat>(received.get()));
     }
 
     return cond;
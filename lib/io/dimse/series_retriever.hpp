@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -24,6 +24,8 @@
 
 #include <sight/io/dimse/config.hpp>
 
+#include "io/dimse/dataset_writer.hpp"
+
 #include <core/com/slot.hpp>
 #include <core/com/slots.hpp>
 #include <core/tools/progress_adviser.hpp>
@@ -73,6 +75,17 @@ public:
     /// Start the server
     SIGHT_IO_DIMSE_API bool start();
 
+    /**
+     * @brief Sets the number of threads writing the received instances, so the incoming associations are not blocked
+     * by the writing of the previous instances.
+     * @param[in] _threads Number of threads, 0 (default) means the instances are written by the receiving thread
+     * @pre initialize() must have been called.
+     */
+    SIGHT_IO_DIMSE_API void set_writer_threads(std::size_t _threads);
+
+    /// Returns the writer of the received instances, to wait for them or to get the retrieval statistics
+    SIGHT_IO_DIMSE_API std::shared_ptr<dataset_writer> get_writer() const;
+
 protected:
 
     // workaround warning 'sight::io::dimse::SeriesRetriever::handleSTORERequest' hides overloaded virtual function
@@ -100,6 +113,9 @@ protected:
 
     /// Downloaded instance index
     unsigned int m_instance_index {};
+
+    /// Writes the received instances
+    std::shared_ptr<dataset_writer> m_writer;
 };
 
 } // namespace sight::io::dimse
@@ -0,0 +1,233 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "dataset_writer_test.hpp"
+
+#include <core/os/temp_path.hpp>
+#include <core/profiling.hpp>
+
+#include <io/dimse/dataset_writer.hpp>
+#include <io/dimse/exceptions/request_failure.hpp>
+
+#include <dcmtk/config/osconfig.h>
+#include <dcmtk/dcmdata/dcdeftag.h>
+#include <dcmtk/dcmdata/dcuid.h>
+
+#include <fstream>
+#include <mutex>
+#include <set>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::io::dimse::ut::dataset_writer_test);
+
+namespace sight::io::dimse::ut
+{
+
+//------------------------------------------------------------------------------
+
+static std::unique_ptr<DcmFileFormat> make_instance(
+    const std::string& _series_instance_uid,
+    std::size_t _index,
+    std::size_t _size
+)
+{
+    const std::string sop_instance_uid = _series_instance_uid + "." + std::to_string(_index + 1);
+
+    DcmDataset dataset;
+    dataset.putAndInsertString(DCM_SOPClassUID, UID_SecondaryCaptureImageStorage);
+    dataset.putAndInsertString(DCM_SOPInstanceUID, sop_instance_uid.c_str());
+    dataset.putAndInsertString(DCM_SeriesInstanceUID, _series_instance_uid.c_str());
+
+    const std::vector<Uint8> pixels(_size, static_cast<Uint8>(_index));
+    dataset.putAndInsertUint8Array(DCM_PixelData, pixels.data(), static_cast<unsigned long>(pixels.size()));
+
+    // Like DCMTK with received datasets, the file format holds a copy of the dataset.
+    return std::make_unique<DcmFileFormat>(&dataset);
+}
+
+//------------------------------------------------------------------------------
+
+void dataset_writer_test::setUp()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void dataset_writer_test::tearDown()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void dataset_writer_test::write_test()
+{
+    static const std::vector<std::string> s_SERIES {"1.2.3.1", "1.2.3.2", "1.2.3.3"};
+    static constexpr std::size_t s_INSTANCES = 20;
+    static constexpr std::size_t s_SIZE      = 4096;
+
+    for(const std::size_t threads : {0, 1, 4})
+    {
+        core::os::temp_dir tmp_dir;
+
+        std::mutex mutex;
+        std::set<unsigned int> indices;
+        std::set<std::string> files;
+
+        {
+            io::dimse::dataset_writer writer(tmp_dir, threads);
+            writer.set_callback(
+                [&](const std::string& _series_instance_uid, unsigned int _index, const std::string& _file_path)
+                {
+                    std::unique_lock lock(mutex);
+                    CPPUNIT_ASSERT(std::filesystem::path(_file_path).parent_path().filename() == _series_instance_uid);
+                    indices.insert(_index);
+                    files.insert(_file_path);
+                });
+
+            for(const auto& series : s_SERIES)
+            {
+                writer.start_series(series);
+            }
+
+            // Interleave the instances of the series, as with several associations
+            for(std::size_t i = 0 ; i < s_INSTANCES ; ++i)
+            {
+                for(const auto& series : s_SERIES)
+                {
+                    writer.write(make_instance(series, i, s_SIZE));
+                }
+            }
+
+            CPPUNIT_ASSERT_NO_THROW(writer.wait());
+
+            const auto& statistics = writer.get_statistics();
+            CPPUNIT_ASSERT_EQUAL(s_SERIES.size(), statistics.size());
+
+            for(const auto& series : s_SERIES)
+            {
+                const auto& series_statistics = statistics.at(series);
+                CPPUNIT_ASSERT_EQUAL(s_INSTANCES, series_statistics.instances);
+                CPPUNIT_ASSERT(series_statistics.bytes > s_INSTANCES * s_SIZE);
+                CPPUNIT_ASSERT(series_statistics.elapsed.count() > 0.);
+            }
+
+            writer.log_statistics();
+        }
+
+        // Each instance is notified once, with a distinct index
+        const auto total = s_SERIES.size() * s_INSTANCES;
+        CPPUNIT_ASSERT_EQUAL(total, indices.size());
+        CPPUNIT_ASSERT_EQUAL(1U, *indices.begin());
+        CPPUNIT_ASSERT_EQUAL(static_cast<unsigned int>(total), *indices.rbegin());
+        CPPUNIT_ASSERT_EQUAL(total, files.size());
+
+        // Files are written in one folder per series, with a meta header
+        for(const auto& file : files)
+        {
+            DcmFileFormat file_format;
+            CPPUNIT_ASSERT(file_format.loadFile(file.c_str()).good());
+
+            OFString sop_class_uid;
+            CPPUNIT_ASSERT(file_format.getMetaInfo()->findAndGetOFString(DCM_MediaStorageSOPClassUID, sop_class_uid)
+                           .good());
+            CPPUNIT_ASSERT_EQUAL(std::string(UID_SecondaryCaptureImageStorage), std::string(sop_class_uid.c_str()));
+
+            OFString sop_instance_uid;
+            CPPUNIT_ASSERT(file_format.getDataset()->findAndGetOFString(DCM_SOPInstanceUID, sop_instance_uid).good());
+            CPPUNIT_ASSERT_EQUAL(
+                std::filesystem::path(file).filename().string(),
+                std::string(sop_instance_uid.c_str())
+            );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void dataset_writer_test::error_test()
+{
+    core::os::temp_dir tmp_dir;
+
+    // A file prevents the creation of the series folder
+    const auto series = std::string("1.2.3.4");
+    std::ofstream(tmp_dir / series) << "not a folder";
+
+    {
+        io::dimse::dataset_writer writer(tmp_dir, 0);
+        CPPUNIT_ASSERT_THROW(writer.write(make_instance(series, 0, 16)), io::dimse::exceptions::request_failure);
+    }
+
+    {
+        io::dimse::dataset_writer writer(tmp_dir, 2);
+
+        // The error is reported once all datasets are written
+        writer.write(make_instance(series, 0, 16));
+        writer.write(make_instance("1.2.3.5", 0, 16));
+        CPPUNIT_ASSERT_THROW(writer.wait(), io::dimse::exceptions::request_failure);
+        CPPUNIT_ASSERT(std::filesystem::exists(tmp_dir / "1.2.3.5" / "1.2.3.5.1"));
+
+        // The error is only reported once
+        CPPUNIT_ASSERT_NO_THROW(writer.wait());
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void dataset_writer_test::benchmark_writer_threads()
+{
+    static constexpr std::size_t s_INSTANCES = 128;
+    static constexpr std::size_t s_SIZE      = std::size_t(512) * 512 * 2;
+
+    // Build the datasets beforehand, only the time spent by the receiving thread in write() is measured
+    for(const std::size_t threads : {0, 4})
+    {
+        core::os::temp_dir tmp_dir;
+        std::vector<std::unique_ptr<DcmFileFormat> > instances;
+        for(std::size_t i = 0 ; i < s_INSTANCES ; ++i)
+        {
+            instances.push_back(make_instance("1.2.3.6", i, s_SIZE));
+        }
+
+        io::dimse::dataset_writer writer(tmp_dir, threads);
+
+        {
+            FW_PROFILE(threads == 0 ? "Dataset writer without threads, total" : "Dataset writer with threads, total");
+            {
+                FW_PROFILE(
+                    threads == 0
+                    ? "Dataset writer without threads, receiving thread blocked"
+                    : "Dataset writer with threads, receiving thread blocked"
+                );
+                for(auto& instance : instances)
+                {
+                    writer.write(std::move(instance));
+                }
+            }
+
+            writer.wait();
+        }
+
+        CPPUNIT_ASSERT_EQUAL(s_INSTANCES, writer.get_statistics().at("1.2.3.6").instances);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::io::dimse::ut
@@ -0,0 +1,53 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::io::dimse::ut
+{
+
+class dataset_writer_test : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(dataset_writer_test);
+CPPUNIT_TEST(write_test);
+CPPUNIT_TEST(error_test);
+CPPUNIT_TEST(benchmark_writer_threads);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // Interface
+    void setUp() override;
+    void tearDown() override;
+
+    /// Writes datasets of several series, synchronously and with writer threads, and checks files and statistics.
+    static void write_test();
+
+    /// Checks that a writing error is reported by wait().
+    static void error_test();
+
+    /// Compares the time spent by the receiving thread with and without writer threads.
+    static void benchmark_writer_threads();
+};
+
+} // namespace sight::io::dimse::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -308,4 +308,44 @@ void series_enquirer_test::pull_instance_using_get_retrieve_method()
 
 //------------------------------------------------------------------------------
 
+void series_enquirer_test::pull_series_in_parallel()
+{
+    // A local DCMTK dcmqrscp, filled with storescu, can stand in for the PACS.
+    m_series_enquirer = std::make_shared<io::dimse::series_enquirer>();
+    m_series_enquirer->initialize(
+        m_local_application_title,
+        m_pacs_host_name,
+        m_pacs_application_port,
+        m_pacs_application_title,
+        m_move_application_title
+    );
+    m_series_enquirer->set_writer_threads(2);
+    m_series_enquirer->connect();
+
+    OFList<QRResponse*> responses = m_series_enquirer->find_series_by_date("17890101", "20991231");
+    const auto& series_instance_uids = io::dimse::helper::series::to_series_instance_uid_container(responses);
+    io::dimse::helper::series::release_responses(responses);
+    CPPUNIT_ASSERT(!series_instance_uids.empty());
+
+    // Pull all series on 4 associations with C-GET
+    const auto& statistics = m_series_enquirer->pull_series(
+        series_instance_uids,
+        io::dimse::data::pacs_configuration::retrieve_method::get,
+        4
+    );
+
+    CPPUNIT_ASSERT_EQUAL(series_instance_uids.size(), statistics.size());
+    for(const auto& series_instance_uid : series_instance_uids)
+    {
+        CPPUNIT_ASSERT(statistics.at(series_instance_uid).instances > 0);
+    }
+
+    // The enquirer is still usable on its own association
+    CPPUNIT_ASSERT(m_series_enquirer->ping_pacs());
+
+    m_series_enquirer->disconnect();
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace sight::io::dimse::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -42,6 +42,7 @@ CPPUNIT_TEST_SUITE(series_enquirer_test);
 // CPPUNIT_TEST( pullSeriesUsingGetRetrieveMethod );
 // CPPUNIT_TEST( pullInstanceUsingMoveRetrieveMethod );
 // CPPUNIT_TEST( pullInstanceUsingGetRetrieveMethod );
+// CPPUNIT_TEST( pull_series_in_parallel );
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -56,6 +57,7 @@ public:
     void pull_series_using_get_retrieve_method();
     void pull_instance_using_move_retrieve_method();
     void pull_instance_using_get_retrieve_method();
+    void pull_series_in_parallel();
     void push_series();
 
 protected:
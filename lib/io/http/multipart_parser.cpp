@@ -0,0 +1,216 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "multipart_parser.hpp"
+
+#include <core/exceptionmacros.hpp>
+
+#include <boost/algorithm/string.hpp>
+
+namespace sight::io::http
+{
+
+//------------------------------------------------------------------------------
+
+multipart_parser::multipart_parser(std::string _boundary, callbacks _callbacks) :
+    m_delimiter("\r\n--" + std::move(_boundary)),
+    m_callbacks(std::move(_callbacks)),
+    // The first delimiter may not be preceded by a line break, adding one allows to look for a single pattern
+    m_buffer("\r\n")
+{
+    SIGHT_THROW_IF("Multipart boundary cannot be empty.", m_delimiter.size() == 4);
+}
+
+//------------------------------------------------------------------------------
+
+void multipart_parser::feed(std::string_view _chunk)
+{
+    if(m_state == state::epilogue)
+    {
+        return;
+    }
+
+    m_buffer.append(_chunk);
+
+    while(parse())
+    {
+    }
+}
+
+//------------------------------------------------------------------------------
+
+bool multipart_parser::parse()
+{
+    switch(m_state)
+    {
+        case state::preamble:
+        case state::body:
+        {
+            const auto pos = m_buffer.find(m_delimiter);
+
+            if(pos == std::string::npos)
+            {
+                // Keep enough data to detect a delimiter split between two chunks
+                const auto keep = m_delimiter.size() - 1;
+
+                if(m_buffer.size() > keep)
+                {
+                    if(m_state == state::body && m_callbacks.on_part_data)
+                    {
+                        m_callbacks.on_part_data(std::string_view(m_buffer).substr(0, m_buffer.size() - keep));
+                    }
+
+                    m_buffer.erase(0, m_buffer.size() - keep);
+                }
+
+                return false;
+            }
+
+            if(m_state == state::body)
+            {
+                if(pos > 0 && m_callbacks.on_part_data)
+                {
+                    m_callbacks.on_part_data(std::string_view(m_buffer).substr(0, pos));
+                }
+
+                if(m_callbacks.on_part_end)
+                {
+                    m_callbacks.on_part_end();
+                }
+
+                ++m_num_parts;
+            }
+
+            m_buffer.erase(0, pos + m_delimiter.size());
+            m_state = state::delimiter;
+            return true;
+        }
+
+        case state::delimiter:
+        {
+            if(m_buffer.size() < 2)
+            {
+                return false;
+            }
+
+            // Close delimiter
+            if(m_buffer.starts_with("--"))
+            {
+                m_buffer.clear();
+                m_state = state::epilogue;
+                return false;
+            }
+
+            // Skip the optional transport padding and the line break
+            const auto pos = m_buffer.find("\r\n");
+
+            if(pos == std::string::npos)
+            {
+                return false;
+            }
+
+            m_buffer.erase(0, pos + 2);
+            m_state = state::headers;
+            return true;
+        }
+
+        case state::headers:
+        {
+            headers_t headers;
+
+            if(m_buffer.starts_with("\r\n"))
+            {
+                // No header
+                m_buffer.erase(0, 2);
+            }
+            else
+            {
+                const auto pos = m_buffer.find("\r\n\r\n");
+
+                if(pos == std::string::npos)
+                {
+                    return false;
+                }
+
+                std::vector<std::string> lines;
+                const auto& header_block = m_buffer.substr(0, pos);
+                boost::split(lines, header_block, boost::is_any_of("\r\n"), boost::token_compress_on);
+
+                for(const auto& line : lines)
+                {
+                    if(const auto colon = line.find(':'); colon != std::string::npos)
+                    {
+                        headers[boost::to_lower_copy(boost::trim_copy(line.substr(0, colon)))] =
+                            boost::trim_copy(line.substr(colon + 1));
+                    }
+                }
+
+                m_buffer.erase(0, pos + 4);
+            }
+
+            if(m_callbacks.on_part_begin)
+            {
+                m_callbacks.on_part_begin(headers);
+            }
+
+            m_state = state::body;
+            return true;
+        }
+
+        default:
+            m_buffer.clear();
+            return false;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::optional<std::string> multipart_parser::boundary(std::string_view _content_type)
+{
+    const auto& content_type = boost::to_lower_copy(std::string(_content_type));
+
+    if(!boost::starts_with(boost::trim_left_copy(content_type), "multipart/"))
+    {
+        return std::nullopt;
+    }
+
+    const auto pos = content_type.find("boundary=");
+
+    if(pos == std::string::npos)
+    {
+        return std::nullopt;
+    }
+
+    // Boundaries are case sensitive, read the value from the original string
+    std::string value(_content_type.substr(pos + 9));
+    value = value.substr(0, value.find(';'));
+    boost::trim(value);
+    boost::trim_if(value, boost::is_any_of("\""));
+
+    if(value.empty())
+    {
+        return std::nullopt;
+    }
+
+    return value;
+}
+
+} // namespace sight::io::http
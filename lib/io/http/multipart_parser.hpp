@@ -0,0 +1,126 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/http/config.hpp>
+
+#include "io/http/request.hpp"
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace sight::io::http
+{
+
+/**
+ * @brief Streaming parser of multipart bodies (RFC 2046), as used by WADO-RS "multipart/related" responses.
+ *
+ * The body can be fed in chunks of any size, as they are received. The content of the parts is forwarded as soon as
+ * it is known not to contain the boundary, so a part is never fully buffered in memory.
+ */
+class SIGHT_IO_HTTP_CLASS_API multipart_parser final
+{
+public:
+
+    /// Part headers, with lower case names
+    using headers_t = request::headers_t;
+
+    /// Callbacks called while parsing
+    struct callbacks
+    {
+        /// Called when the headers of a new part have been parsed
+        std::function<void(const headers_t& _headers)> on_part_begin;
+
+        /// Called with consecutive chunks of the part content
+        std::function<void(std::string_view _data)> on_part_data;
+
+        /// Called at the end of a part
+        std::function<void()> on_part_end;
+    };
+
+    /**
+     * @brief Constructor
+     * @param _boundary the boundary, without the leading "--"
+     * @param _callbacks the parsing callbacks
+     */
+    SIGHT_IO_HTTP_API multipart_parser(std::string _boundary, callbacks _callbacks);
+
+    /// Parses the next chunk of the body
+    SIGHT_IO_HTTP_API void feed(std::string_view _chunk);
+
+    /// Returns true once the final boundary has been parsed
+    [[nodiscard]] bool finished() const noexcept;
+
+    /// Returns the number of completely parsed parts
+    [[nodiscard]] std::size_t num_parts() const noexcept;
+
+    /**
+     * @brief Extracts the boundary of a Content-Type header value
+     * @param _content_type value of the Content-Type header, i.e. 'multipart/related; boundary="xyz"'
+     * @return the boundary or nothing if the content is not multipart
+     */
+    SIGHT_IO_HTTP_API static std::optional<std::string> boundary(std::string_view _content_type);
+
+private:
+
+    enum class state : std::uint8_t
+    {
+        preamble,
+        delimiter,
+        headers,
+        body,
+        epilogue
+    };
+
+    /// Parses the buffered data, returns false when more data is needed
+    bool parse();
+
+    /// "\r\n--" + boundary
+    const std::string m_delimiter;
+
+    const callbacks m_callbacks;
+
+    /// Unprocessed data
+    std::string m_buffer;
+
+    state m_state {state::preamble};
+
+    std::size_t m_num_parts {0};
+};
+
+//------------------------------------------------------------------------------
+
+inline bool multipart_parser::finished() const noexcept
+{
+    return m_state == state::epilogue;
+}
+
+//------------------------------------------------------------------------------
+
+inline std::size_t multipart_parser::num_parts() const noexcept
+{
+    return m_num_parts;
+}
+
+} // namespace sight::io::http
@@ -0,0 +1,793 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "retriever.hpp"
+
+#include "io/http/exceptions/connection_refused.hpp"
+#include "io/http/exceptions/content_not_found.hpp"
+#include "io/http/exceptions/host_not_found.hpp"
+#include "io/http/multipart_parser.hpp"
+
+#include <core/exceptionmacros.hpp>
+#include <core/spy_log.hpp>
+
+#include <boost/algorithm/string.hpp>
+
+#include <curl/curl.h>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+#include <thread>
+
+namespace sight::io::http
+{
+
+namespace
+{
+
+/// Receives the parts of a request. Parts are only delivered on commit(), when the request has succeeded.
+class sink
+{
+public:
+
+    sink()                       = default;
+    sink(const sink&)            = delete;
+    sink(sink&&)                 = delete;
+    sink& operator=(const sink&) = delete;
+    sink& operator=(sink&&)      = delete;
+    virtual ~sink()              = default;
+
+    virtual void begin(const request::headers_t& _headers) = 0;
+    virtual void write(std::string_view _data)             = 0;
+    virtual void end()                                     = 0;
+    virtual std::size_t commit()                           = 0;
+    virtual void rollback()                                = 0;
+};
+
+//------------------------------------------------------------------------------
+
+/// Streams each part to a temporary file, renamed on commit
+class file_sink final : public sink
+{
+public:
+
+    file_sink(std::filesystem::path _folder, std::size_t _request, std::vector<std::filesystem::path>& _files) :
+        m_folder(std::move(_folder)),
+        m_request(_request),
+        m_files(_files)
+    {
+    }
+
+    ~file_sink() override
+    {
+        rollback();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void begin(const request::headers_t& _headers) override
+    {
+        std::stringstream ss;
+        ss << std::setfill('0') << std::setw(6) << m_request << "_" << std::setw(4) << m_parts.size();
+
+        if(const auto& it = _headers.find("content-type");
+           it != _headers.end() && it->second.find("dicom") != std::string::npos)
+        {
+            ss << ".dcm";
+        }
+
+        m_parts.push_back(m_folder / ss.str());
+
+        m_stream.open(m_parts.back().string() + ".part", std::ios::binary | std::ios::trunc);
+        SIGHT_THROW_IF("Unable to write '" << m_parts.back().string() << ".part'.", !m_stream.is_open());
+    }
+
+    //------------------------------------------------------------------------------
+
+    void write(std::string_view _data) override
+    {
+        m_stream.write(_data.data(), std::streamsize(_data.size()));
+    }
+
+    //------------------------------------------------------------------------------
+
+    void end() override
+    {
+        m_stream.close();
+    }
+
+    //------------------------------------------------------------------------------
+
+    std::size_t commit() override
+    {
+        for(const auto& part : m_parts)
+        {
+            std::filesystem::rename(part.string() + ".part", part);
+        }
+
+        m_files = std::move(m_parts);
+        m_parts = {};
+        return m_files.size();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void rollback() override
+    {
+        m_stream.close();
+
+        for(const auto& part : m_parts)
+        {
+            std::error_code error;
+            std::filesystem::remove(part.string() + ".part", error);
+        }
+
+        m_parts.clear();
+    }
+
+private:
+
+    const std::filesystem::path m_folder;
+    const std::size_t m_request;
+    std::vector<std::filesystem::path>& m_files;
+    std::vector<std::filesystem::path> m_parts;
+    std::ofstream m_stream;
+};
+
+//------------------------------------------------------------------------------
+
+/// Keeps each part in memory, forwarded to a callback on commit
+class memory_sink final : public sink
+{
+public:
+
+    memory_sink(std::size_t _request, const retriever::part_callback_t& _callback) :
+        m_request(_request),
+        m_callback(_callback)
+    {
+    }
+
+    ~memory_sink() override = default;
+
+    //------------------------------------------------------------------------------
+
+    void begin(const request::headers_t& _headers) override
+    {
+        m_parts.emplace_back(_headers, std::string());
+    }
+
+    //------------------------------------------------------------------------------
+
+    void write(std::string_view _data) override
+    {
+        m_parts.back().second.append(_data);
+    }
+
+    //------------------------------------------------------------------------------
+
+    void end() override
+    {
+    }
+
+    //------------------------------------------------------------------------------
+
+    std::size_t commit() override
+    {
+        auto parts = std::exchange(m_parts, {});
+
+        for(auto& [headers, content] : parts)
+        {
+            m_callback(m_request, headers, std::move(content));
+        }
+
+        return parts.size();
+    }
+
+    //------------------------------------------------------------------------------
+
+    void rollback() override
+    {
+        m_parts.clear();
+    }
+
+private:
+
+    const std::size_t m_request;
+    const retriever::part_callback_t& m_callback;
+    std::vector<std::pair<request::headers_t, std::string> > m_parts;
+};
+
+//------------------------------------------------------------------------------
+
+/// State of a request
+struct transfer
+{
+    transfer(const transfer&)            = delete;
+    transfer(transfer&&)                 = delete;
+    transfer& operator=(const transfer&) = delete;
+    transfer& operator=(transfer&&)      = delete;
+
+    transfer(request::sptr _request, std::unique_ptr<sink> _output) :
+        http_request(std::move(_request)),
+        output(std::move(_output))
+    {
+    }
+
+    ~transfer()
+    {
+        curl_slist_free_all(header_list);
+    }
+
+    //------------------------------------------------------------------------------
+
+    /// Clears the response of the previous attempt
+    void reset()
+    {
+        output->rollback();
+        response_headers.clear();
+        parser.reset();
+        bytes   = 0;
+        status  = 0;
+        started = false;
+    }
+
+    request::sptr http_request;
+    std::unique_ptr<sink> output;
+
+    CURL* easy {nullptr};
+    curl_slist* header_list {nullptr};
+    std::array<char, CURL_ERROR_SIZE> error {};
+
+    request::headers_t response_headers;
+    std::optional<multipart_parser> parser;
+    std::exception_ptr exception;
+    std::size_t bytes {0};
+    std::size_t attempt {0};
+    std::chrono::steady_clock::time_point due;
+    long status {0}; // NOLINT(google-runtime-int)
+    bool started {false};
+};
+
+//------------------------------------------------------------------------------
+
+std::size_t header_callback(char* _buffer, std::size_t _size, std::size_t _nitems, void* _user_data)
+{
+    auto* const t = static_cast<transfer*>(_user_data);
+    const std::string line(_buffer, _size * _nitems);
+
+    if(line.starts_with("HTTP/"))
+    {
+        // New response (after a redirection or a "100 Continue")
+        t->response_headers.clear();
+    }
+    else if(const auto colon = line.find(':'); colon != std::string::npos)
+    {
+        t->response_headers[boost::to_lower_copy(boost::trim_copy(line.substr(0, colon)))] =
+            boost::trim_copy(line.substr(colon + 1));
+    }
+
+    return _size * _nitems;
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t write_callback(char* _buffer, std::size_t _size, std::size_t _nmemb, void* _user_data)
+{
+    auto* const t       = static_cast<transfer*>(_user_data);
+    const auto length   = _size * _nmemb;
+    const auto& content = std::string_view(_buffer, length);
+
+    if(t->status == 0)
+    {
+        curl_easy_getinfo(t->easy, CURLINFO_RESPONSE_CODE, &t->status);
+    }
+
+    // Error bodies are discarded, but read until the end to keep the connection alive
+    if(t->status < 200 || t->status >= 300)
+    {
+        return length;
+    }
+
+    try
+    {
+        if(!t->started)
+        {
+            t->started = true;
+
+            const auto& content_type = t->response_headers["content-type"];
+
+            if(const auto& boundary = multipart_parser::boundary(content_type); boundary)
+            {
+                t->parser.emplace(
+                    *boundary,
+                    multipart_parser::callbacks {
+                        .on_part_begin = [t](const request::headers_t& _headers){t->output->begin(_headers);},
+                        .on_part_data  = [t](std::string_view _data){t->output->write(_data);},
+                        .on_part_end   = [t]{t->output->end();}
+                    });
+            }
+            else
+            {
+                t->output->begin(t->response_headers);
+            }
+        }
+
+        if(t->parser)
+        {
+            t->parser->feed(content);
+        }
+        else
+        {
+            t->output->write(content);
+        }
+    }
+    catch(...)
+    {
+        // Exceptions must not go through libcurl, abort the transfer and rethrow later
+        t->exception = std::current_exception();
+        return 0;
+    }
+
+    t->bytes += length;
+
+    return length;
+}
+
+//------------------------------------------------------------------------------
+
+/// Returns true if a failed request may succeed later
+// NOLINTNEXTLINE(google-runtime-int)
+bool is_retryable(CURLcode _result, long _status)
+{
+    switch(_result)
+    {
+        case CURLE_OK:
+            return _status == 408 || _status == 429 || _status >= 500;
+
+        case CURLE_UNSUPPORTED_PROTOCOL:
+        case CURLE_URL_MALFORMAT:
+        case CURLE_COULDNT_RESOLVE_HOST:
+        case CURLE_WRITE_ERROR:
+            return false;
+
+        default:
+            return true;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+/// Builds the exception matching the error
+// NOLINTNEXTLINE(google-runtime-int)
+std::exception_ptr make_error(const transfer& _transfer, CURLcode _result, long _status)
+{
+    const auto& url = _transfer.http_request->get_url();
+
+    if(_result == CURLE_COULDNT_CONNECT)
+    {
+        return std::make_exception_ptr(exceptions::connection_refused("Connection refused: " + url));
+    }
+
+    if(_result == CURLE_COULDNT_RESOLVE_HOST)
+    {
+        return std::make_exception_ptr(exceptions::host_not_found("Host not found: " + url));
+    }
+
+    if(_result == CURLE_OK && _status == 404)
+    {
+        return std::make_exception_ptr(exceptions::content_not_found("Content not found: " + url));
+    }
+
+    if(_result != CURLE_OK)
+    {
+        const std::string message = _transfer.error[0] != '\0' ? _transfer.error.data() : curl_easy_strerror(_result);
+        return std::make_exception_ptr(exceptions::base("Unable to retrieve '" + url + "': " + message));
+    }
+
+    if(_status >= 200 && _status < 300)
+    {
+        return std::make_exception_ptr(exceptions::base("Incomplete multipart response: " + url));
+    }
+
+    return std::make_exception_ptr(
+        exceptions::base("Unable to retrieve '" + url + "': HTTP status " + std::to_string(_status))
+    );
+}
+
+} // namespace
+
+/// Private retriever implementation
+class retriever::retriever_impl
+{
+public:
+
+    /// Delete default constructors and assignment operators
+    retriever_impl(const retriever_impl&)            = delete;
+    retriever_impl(retriever_impl&&)                 = delete;
+    retriever_impl& operator=(const retriever_impl&) = delete;
+    retriever_impl& operator=(retriever_impl&&)      = delete;
+
+    /// Constructor
+    explicit retriever_impl(config _config) :
+        m_config(std::move(_config)),
+        m_multi(curl_multi_init())
+    {
+        SIGHT_THROW_IF("Cannot initialize CURL.", m_multi == nullptr);
+        SIGHT_THROW_IF("At least one connection is needed.", m_config.max_connections == 0);
+
+        // NOLINTBEGIN(google-runtime-int)
+        curl_multi_setopt(m_multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, long(m_config.max_connections));
+        curl_multi_setopt(m_multi, CURLMOPT_MAXCONNECTS, long(m_config.max_connections));
+        // NOLINTEND(google-runtime-int)
+    }
+
+    /// Destructor
+    ~retriever_impl()
+    {
+        for(auto* const easy : m_idle)
+        {
+            curl_easy_cleanup(easy);
+        }
+
+        curl_multi_cleanup(m_multi);
+    }
+
+    //------------------------------------------------------------------------------
+
+    /// Performs all requests, see retriever documentation
+    void run(std::vector<std::unique_ptr<transfer> >& _transfers)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        m_statistics = {.requests = _transfers.size()};
+
+        std::deque<transfer*> pending;
+        std::vector<transfer*> delayed;
+        std::vector<transfer*> running;
+        std::exception_ptr failure;
+        std::size_t completed = 0;
+
+        std::ranges::transform(_transfers, std::back_inserter(pending), [](const auto& _t){return _t.get();});
+
+        try
+        {
+            while(completed < _transfers.size())
+            {
+                const auto now = std::chrono::steady_clock::now();
+
+                // Retry the requests whose delay is elapsed, in priority
+                const auto& [first, last] = std::ranges::partition(delayed, [&](transfer* _t){return _t->due > now;});
+                pending.insert(pending.begin(), first, last);
+                delayed.erase(first, last);
+
+                // Fill the connection pool
+                while(running.size() < m_config.max_connections && !pending.empty())
+                {
+                    running.push_back(pending.front());
+                    start_transfer(*pending.front());
+                    pending.pop_front();
+                }
+
+                int still_running = 0;
+                curl_multi_perform(m_multi, &still_running);
+
+                int messages       = 0;
+                bool some_finished = false;
+                while(CURLMsg* const message = curl_multi_info_read(m_multi, &messages))
+                {
+                    if(message->msg != CURLMSG_DONE)
+                    {
+                        continue;
+                    }
+
+                    transfer* t = nullptr;
+                    curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &t);
+                    std::erase(running, t);
+                    some_finished = true;
+
+                    if(finish_transfer(*t, message->data.result, failure))
+                    {
+                        delayed.push_back(t);
+                    }
+                    else
+                    {
+                        ++completed;
+
+                        if(m_progress_callback)
+                        {
+                            m_progress_callback(completed, _transfers.size());
+                        }
+                    }
+                }
+
+                // Start the next requests immediately
+                if(some_finished || completed == _transfers.size())
+                {
+                    continue;
+                }
+
+                // Wait for network activity, but not longer than the next retry
+                auto timeout = std::chrono::milliseconds(100);
+                for(const auto* const t : delayed)
+                {
+                    timeout = std::clamp(
+                        std::chrono::duration_cast<std::chrono::milliseconds>(t->due - now),
+                        std::chrono::milliseconds(0),
+                        timeout
+                    );
+                }
+
+                if(running.empty())
+                {
+                    std::this_thread::sleep_for(timeout);
+                }
+                else
+                {
+                    curl_multi_poll(m_multi, nullptr, 0, int(timeout.count()), nullptr);
+                }
+            }
+        }
+        catch(...)
+        {
+            for(auto* const t : running)
+            {
+                release(*t);
+            }
+
+            throw;
+        }
+
+        m_statistics.elapsed = std::chrono::steady_clock::now() - start;
+
+        SIGHT_INFO(
+            "Retrieved " << m_statistics.requests << " requests (" << m_statistics.parts << " parts, "
+            << m_statistics.bytes << " bytes) in " << m_statistics.elapsed.count() << " s, using "
+            << m_statistics.connections << " connections and " << m_statistics.retries << " retries."
+        );
+
+        if(failure)
+        {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    /// Configures a transfer and adds it to the multi handle
+    void start_transfer(transfer& _transfer)
+    {
+        if(m_idle.empty())
+        {
+            _transfer.easy = curl_easy_init();
+            SIGHT_THROW_IF("Cannot initialize CURL.", _transfer.easy == nullptr);
+        }
+        else
+        {
+            // Reusing the handles allows to reuse their connection
+            _transfer.easy = m_idle.back();
+            m_idle.pop_back();
+            curl_easy_reset(_transfer.easy);
+        }
+
+        curl_slist_free_all(_transfer.header_list);
+        _transfer.header_list = nullptr;
+
+        for(const auto& [key, value] : _transfer.http_request->get_headers())
+        {
+            _transfer.header_list = curl_slist_append(_transfer.header_list, (key + ": " + value).c_str());
+        }
+
+        _transfer.error[0] = '\0';
+
+        // NOLINTBEGIN(google-runtime-int)
+        CURL* const easy = _transfer.easy;
+        curl_easy_setopt(easy, CURLOPT_URL, _transfer.http_request->get_url().c_str());
+        curl_easy_setopt(easy, CURLOPT_HTTPHEADER, _transfer.header_list);
+        curl_easy_setopt(easy, CURLOPT_PRIVATE, &_transfer);
+        curl_easy_setopt(easy, CURLOPT_ERRORBUFFER, _transfer.error.data());
+        curl_easy_setopt(easy, CURLOPT_HEADERFUNCTION, header_callback);
+        curl_easy_setopt(easy, CURLOPT_HEADERDATA, &_transfer);
+        curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, write_callback);
+        curl_easy_setopt(easy, CURLOPT_WRITEDATA, &_transfer);
+        curl_easy_setopt(easy, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(easy, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(easy, CURLOPT_TCP_KEEPALIVE, 1L);
+        curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);
+        curl_easy_setopt(easy, CURLOPT_ACCEPT_ENCODING, "");
+        curl_easy_setopt(easy, CURLOPT_TIMEOUT_MS, long(m_config.timeout.count()));
+        // NOLINTEND(google-runtime-int)
+
+        curl_multi_add_handle(m_multi, easy);
+    }
+
+    //------------------------------------------------------------------------------
+
+    /// Detaches the handle of a transfer and keeps it for a future transfer
+    void release(transfer& _transfer)
+    {
+        curl_multi_remove_handle(m_multi, _transfer.easy);
+        m_idle.push_back(_transfer.easy);
+        _transfer.easy = nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+
+    /// Handles the end of a transfer, returns true if it must be retried
+    bool finish_transfer(transfer& _transfer, CURLcode _result, std::exception_ptr& _failure)
+    {
+        long status = 0; // NOLINT(google-runtime-int)
+        curl_easy_getinfo(_transfer.easy, CURLINFO_RESPONSE_CODE, &status);
+
+        long connections = 0; // NOLINT(google-runtime-int)
+        curl_easy_getinfo(_transfer.easy, CURLINFO_NUM_CONNECTS, &connections);
+        m_statistics.connections += std::size_t(connections);
+
+        release(_transfer);
+
+        if(_transfer.exception)
+        {
+            // Local error (i.e. unable to write a file), retrying would not help
+            _transfer.reset();
+
+            if(!_failure)
+            {
+                _failure = _transfer.exception;
+            }
+
+            return false;
+        }
+
+        const bool complete = !_transfer.parser || _transfer.parser->finished();
+
+        if(_result == CURLE_OK && status >= 200 && status < 300 && complete)
+        {
+            if(_transfer.started && !_transfer.parser)
+            {
+                _transfer.output->end();
+            }
+
+            m_statistics.parts += _transfer.output->commit();
+            m_statistics.bytes += _transfer.bytes;
+            return false;
+        }
+
+        _transfer.reset();
+
+        if((!complete || is_retryable(_result, status)) && _transfer.attempt < m_config.max_retries)
+        {
+            _transfer.due = std::chrono::steady_clock::now() + m_config.retry_delay * (1U << _transfer.attempt);
+            ++_transfer.attempt;
+            ++m_statistics.retries;
+
+            SIGHT_WARN(
+                "Request '" << _transfer.http_request->get_url() << "' failed (CURL error " << int(_result)
+                << ", HTTP status " << status << "), retry " << _transfer.attempt << "/" << m_config.max_retries
+            );
+
+            return true;
+        }
+
+        if(!_failure)
+        {
+            _failure = make_error(_transfer, _result, status);
+        }
+
+        return false;
+    }
+
+    /// Retrieval parameters
+    const config m_config;
+
+    /// Handle shared by all transfers, holding the connection cache
+    CURLM* const m_multi;
+
+    /// Easy handles available for new transfers
+    std::vector<CURL*> m_idle;
+
+    /// Statistics of the last retrieval
+    statistics m_statistics;
+
+    /// Progress callback
+    progress_callback_t m_progress_callback;
+};
+
+//------------------------------------------------------------------------------
+
+retriever::retriever() :
+    retriever(config {})
+{
+}
+
+//------------------------------------------------------------------------------
+
+retriever::retriever(config _config) :
+    m_pimpl(std::make_unique<retriever_impl>(std::move(_config)))
+{
+}
+
+// Defining the destructor here, allows us to use PImpl with a unique_ptr
+retriever::~retriever() = default;
+
+//------------------------------------------------------------------------------
+
+std::vector<std::filesystem::path> retriever::get_files(
+    const std::vector<request::sptr>& _requests,
+    const std::filesystem::path& _folder
+)
+{
+    std::filesystem::create_directories(_folder);
+
+    std::vector<std::vector<std::filesystem::path> > files(_requests.size());
+    std::vector<std::unique_ptr<transfer> > transfers;
+    transfers.reserve(_requests.size());
+
+    for(std::size_t i = 0 ; i < _requests.size() ; ++i)
+    {
+        transfers.push_back(
+            std::make_unique<transfer>(_requests[i], std::make_unique<file_sink>(_folder, i, files[i]))
+        );
+    }
+
+    m_pimpl->run(transfers);
+
+    std::vector<std::filesystem::path> result;
+    for(auto& request_files : files)
+    {
+        std::ranges::move(request_files, std::back_inserter(result));
+    }
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+
+void retriever::get(const std::vector<request::sptr>& _requests, const part_callback_t& _callback)
+{
+    std::vector<std::unique_ptr<transfer> > transfers;
+    transfers.reserve(_requests.size());
+
+    for(std::size_t i = 0 ; i < _requests.size() ; ++i)
+    {
+        transfers.push_back(std::make_unique<transfer>(_requests[i], std::make_unique<memory_sink>(i, _callback)));
+    }
+
+    m_pimpl->run(transfers);
+}
+
+//------------------------------------------------------------------------------
+
+void retriever::set_progress_callback(progress_callback_t _callback)
+{
+    m_pimpl->m_progress_callback = std::move(_callback);
+}
+
+//------------------------------------------------------------------------------
+
+const retriever::statistics& retriever::get_statistics() const
+{
+    return m_pimpl->m_statistics;
+}
+
+} // namespace sight::io::http
@@ -0,0 +1,134 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/http/config.hpp>
+
+#include "io/http/request.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sight::io::http
+{
+
+/**
+ * @brief Retrieves many resources concurrently, using libcurl.
+ *
+ * Requests are performed on a bounded number of concurrent connections, which are kept alive and reused between
+ * requests. Responses are processed while they are received: "multipart/related" responses (i.e. series level WADO-RS
+ * requests) are split into their parts on the fly, other responses are considered as a single part.
+ *
+ * Failed requests (connection errors, HTTP 408, 429 and 5xx) are retried after a delay that doubles at each attempt.
+ * The parts of a request are only delivered once the request has succeeded, so a retried request never delivers
+ * duplicated parts.
+ *
+ * All methods block until all requests are done. An exception derived from io::http::exceptions::base is thrown if
+ * any request finally failed, after the completion of the others.
+ *
+ * @code{.cpp}
+    io::http::retriever retriever({.max_connections = 8});
+    const auto& files = retriever.get_files({io::http::request::New(url)}, folder);
+   @endcode
+ */
+class SIGHT_IO_HTTP_CLASS_API retriever final
+{
+public:
+
+    /// Retrieval parameters
+    struct config
+    {
+        /// Maximum number of concurrent connections
+        std::size_t max_connections {8};
+
+        /// Maximum number of retries of a failed request
+        std::size_t max_retries {3};
+
+        /// Delay before the first retry, doubled at each retry
+        std::chrono::milliseconds retry_delay {200};
+
+        /// Maximum duration of a request, 0 means no limit
+        std::chrono::milliseconds timeout {0};
+    };
+
+    /// Statistics of the last retrieval
+    struct statistics
+    {
+        std::size_t requests {0};
+        std::size_t retries {0};
+        std::size_t parts {0};
+        std::size_t bytes {0};
+
+        /// Number of opened connections, lower than the number of requests when connections are reused
+        std::size_t connections {0};
+
+        std::chrono::duration<double> elapsed {0};
+    };
+
+    /// Called from the calling thread each time a request is completed
+    using progress_callback_t = std::function<void (std::size_t _done, std::size_t _total)>;
+
+    /// Called from the calling thread with each part of a completed request, in order
+    using part_callback_t = std::function<void (std::size_t _request, const request::headers_t& _headers,
+                                                std::string&& _content)>;
+
+    /// Constructors/Destructor
+    SIGHT_IO_HTTP_API retriever();
+    SIGHT_IO_HTTP_API explicit retriever(config _config);
+    SIGHT_IO_HTTP_API ~retriever();
+
+    /**
+     * @brief Retrieves the requests and writes each part in a file of the given folder, while it is received.
+     * @param _requests the requests to perform
+     * @param _folder the destination folder, created if needed
+     * @return the written files, ordered by request then by part
+     */
+    SIGHT_IO_HTTP_API std::vector<std::filesystem::path> get_files(
+        const std::vector<request::sptr>& _requests,
+        const std::filesystem::path& _folder
+    );
+
+    /**
+     * @brief Retrieves the requests in memory.
+     * @param _requests the requests to perform
+     * @param _callback called with each part
+     */
+    SIGHT_IO_HTTP_API void get(const std::vector<request::sptr>& _requests, const part_callback_t& _callback);
+
+    /// Sets a callback to follow the progress
+    SIGHT_IO_HTTP_API void set_progress_callback(progress_callback_t _callback);
+
+    /// Returns the statistics of the last retrieval
+    [[nodiscard]] SIGHT_IO_HTTP_API const statistics& get_statistics() const;
+
+private:
+
+    /// PImpl
+    class retriever_impl;
+    std::unique_ptr<retriever_impl> m_pimpl;
+};
+
+} // namespace sight::io::http
@@ -0,0 +1,527 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "retriever_test.hpp"
+
+#include <core/os/temp_path.hpp>
+#include <core/spy_log.hpp>
+
+#include <io/http/exceptions/content_not_found.hpp>
+#include <io/http/multipart_parser.hpp>
+
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <fstream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::io::http::ut::retriever_test);
+
+namespace sight::io::http::ut
+{
+
+namespace
+{
+
+/// Minimal HTTP/1.1 server, standing for a PACS. Each connection is served by its own thread and kept alive.
+class http_stand_in final
+{
+public:
+
+    /// Returns the whole response (status line, headers and body) to a request target
+    using handler_t = std::function<std::string (const std::string& _target)>;
+
+    http_stand_in(const http_stand_in&)            = delete;
+    http_stand_in(http_stand_in&&)                 = delete;
+    http_stand_in& operator=(const http_stand_in&) = delete;
+    http_stand_in& operator=(http_stand_in&&)      = delete;
+
+    explicit http_stand_in(handler_t _handler) :
+        m_handler(std::move(_handler)),
+        m_acceptor(m_context, {boost::asio::ip::address_v4::loopback(), 0}),
+        m_thread([this]{accept();})
+    {
+    }
+
+    ~http_stand_in()
+    {
+        m_stopped = true;
+
+        // Wake up the acceptor
+        boost::system::error_code error;
+        boost::asio::ip::tcp::socket waker(m_context);
+        waker.connect(m_acceptor.local_endpoint(), error);
+        m_thread.join();
+
+        {
+            std::lock_guard lock(m_mutex);
+            for(auto& socket : m_sockets)
+            {
+                socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, error);
+            }
+        }
+
+        for(auto& thread : m_connection_threads)
+        {
+            thread.join();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    [[nodiscard]] std::string url(const std::string& _target) const
+    {
+        return "http://127.0.0.1:" + std::to_string(m_acceptor.local_endpoint().port()) + _target;
+    }
+
+    //------------------------------------------------------------------------------
+
+    [[nodiscard]] std::size_t connections() const
+    {
+        return m_connections;
+    }
+
+    //------------------------------------------------------------------------------
+
+    static std::string response(
+        const std::string& _body,
+        const std::string& _content_type = "application/dicom",
+        const std::string& _status       = "200 OK"
+    )
+    {
+        return "HTTP/1.1 " + _status + "\r\nContent-Type: " + _content_type + "\r\nContent-Length: "
+               + std::to_string(_body.size()) + "\r\n\r\n" + _body;
+    }
+
+private:
+
+    //------------------------------------------------------------------------------
+
+    void accept()
+    {
+        while(true)
+        {
+            boost::asio::ip::tcp::socket* socket = nullptr;
+            {
+                std::lock_guard lock(m_mutex);
+                socket = &m_sockets.emplace_back(m_context);
+            }
+
+            boost::system::error_code error;
+            m_acceptor.accept(*socket, error);
+
+            if(m_stopped || error)
+            {
+                return;
+            }
+
+            ++m_connections;
+            m_connection_threads.emplace_back([this, socket]{serve(*socket);});
+        }
+    }
+
+    //------------------------------------------------------------------------------
+
+    void serve(boost::asio::ip::tcp::socket& _socket)
+    {
+        boost::asio::streambuf buffer;
+        boost::system::error_code error;
+
+        while(!m_stopped)
+        {
+            const auto size = boost::asio::read_until(_socket, buffer, "\r\n\r\n", error);
+
+            if(error)
+            {
+                return;
+            }
+
+            const auto begin = boost::asio::buffers_begin(buffer.data());
+            const std::string header(begin, begin + std::ptrdiff_t(size));
+            buffer.consume(size);
+
+            // "GET <target> HTTP/1.1"
+            const auto first  = header.find(' ') + 1;
+            const auto target = header.substr(first, header.find(' ', first) - first);
+
+            boost::asio::write(_socket, boost::asio::buffer(m_handler(target)), error);
+
+            if(error)
+            {
+                return;
+            }
+        }
+    }
+
+    handler_t m_handler;
+    boost::asio::io_context m_context;
+    boost::asio::ip::tcp::acceptor m_acceptor;
+    std::mutex m_mutex;
+    std::list<boost::asio::ip::tcp::socket> m_sockets;
+    std::vector<std::thread> m_connection_threads;
+    std::atomic_bool m_stopped {false};
+    std::atomic_size_t m_connections {0};
+    std::thread m_thread;
+};
+
+//------------------------------------------------------------------------------
+
+/// Content of a fake DICOM instance, containing line breaks and dashes to challenge the multipart parser
+std::string instance_content(std::size_t _index)
+{
+    std::string content = "DICM\r\n--instance-" + std::to_string(_index) + "\r\n-";
+    content.append(1000 + _index, char('A' + (_index % 26)));
+    return content;
+}
+
+//------------------------------------------------------------------------------
+
+std::string multipart_body(const std::string& _boundary, std::size_t _parts)
+{
+    std::string body = "preamble to ignore\r\n";
+
+    for(std::size_t i = 0 ; i < _parts ; ++i)
+    {
+        body += "--" + _boundary + "\r\nContent-Type: application/dicom\r\n\r\n" + instance_content(i) + "\r\n";
+    }
+
+    return body + "--" + _boundary + "--\r\nepilogue to ignore";
+}
+
+//------------------------------------------------------------------------------
+
+std::string read_file(const std::filesystem::path& _path)
+{
+    std::ifstream stream(_path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+}
+
+//------------------------------------------------------------------------------
+
+std::vector<request::sptr> instance_requests(const http_stand_in& _server, std::size_t _count)
+{
+    std::vector<request::sptr> requests;
+
+    for(std::size_t i = 0 ; i < _count ; ++i)
+    {
+        requests.push_back(request::New(_server.url("/instances/" + std::to_string(i) + "/file")));
+    }
+
+    return requests;
+}
+
+//------------------------------------------------------------------------------
+
+std::size_t instance_index(const std::string& _target)
+{
+    // "/instances/<index>/file"
+    return std::stoul(_target.substr(11, _target.find('/', 11) - 11));
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+void retriever_test::setUp()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void retriever_test::tearDown()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void retriever_test::multipart_parser_test()
+{
+    CPPUNIT_ASSERT(!multipart_parser::boundary("application/dicom"));
+    CPPUNIT_ASSERT_EQUAL(
+        std::string("Xy-12"),
+        *multipart_parser::boundary(R"(multipart/related; type="application/dicom"; boundary="Xy-12")")
+    );
+    CPPUNIT_ASSERT_EQUAL(std::string("Xy-12"), *multipart_parser::boundary("Multipart/Related;boundary=Xy-12"));
+
+    const std::string boundary = "abc-boundary";
+    const auto& body           = multipart_body(boundary, 5);
+
+    // Feed the body with chunks of every size, the parts must be identical
+    for(std::size_t chunk_size = 1 ; chunk_size < 64 ; ++chunk_size)
+    {
+        std::vector<std::string> parts;
+        std::vector<request::headers_t> headers;
+        std::size_t ended = 0;
+
+        multipart_parser parser(
+            boundary,
+            {
+                .on_part_begin = [&](const request::headers_t& _headers)
+                {
+                    headers.push_back(_headers);
+                    parts.emplace_back();
+                },
+                .on_part_data = [&](std::string_view _data){parts.back().append(_data);},
+                .on_part_end  = [&]{++ended;}
+            });
+
+        for(std::size_t offset = 0 ; offset < body.size() ; offset += chunk_size)
+        {
+            parser.feed(std::string_view(body).substr(offset, chunk_size));
+        }
+
+        CPPUNIT_ASSERT(parser.finished());
+        CPPUNIT_ASSERT_EQUAL(std::size_t(5), parser.num_parts());
+        CPPUNIT_ASSERT_EQUAL(std::size_t(5), ended);
+        CPPUNIT_ASSERT_EQUAL(std::size_t(5), parts.size());
+
+        for(std::size_t i = 0 ; i < parts.size() ; ++i)
+        {
+            CPPUNIT_ASSERT_EQUAL(instance_content(i), parts[i]);
+            CPPUNIT_ASSERT_EQUAL(std::string("application/dicom"), headers[i]["content-type"]);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void retriever_test::get_files_test()
+{
+    constexpr std::size_t num_instances = 64;
+
+    http_stand_in server(
+        [](const std::string& _target)
+        {
+            return http_stand_in::response(instance_content(instance_index(_target)));
+        });
+
+    core::os::temp_dir tmp_dir;
+    std::size_t last_progress = 0;
+
+    io::http::retriever retriever({.max_connections = 4});
+    retriever.set_progress_callback(
+        [&](std::size_t _done, std::size_t _total)
+        {
+            CPPUNIT_ASSERT_EQUAL(num_instances, _total);
+            CPPUNIT_ASSERT_EQUAL(last_progress + 1, _done);
+            last_progress = _done;
+        });
+
+    const auto& files = retriever.get_files(instance_requests(server, num_instances), tmp_dir);
+
+    CPPUNIT_ASSERT_EQUAL(num_instances, last_progress);
+    CPPUNIT_ASSERT_EQUAL(num_instances, files.size());
+
+    // Files are ordered like the requests
+    for(std::size_t i = 0 ; i < files.size() ; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(std::string(".dcm"), files[i].extension().string());
+        CPPUNIT_ASSERT_EQUAL(instance_content(i), read_file(files[i]));
+    }
+
+    // Connections are kept alive and reused
+    const auto& statistics = retriever.get_statistics();
+    CPPUNIT_ASSERT_EQUAL(num_instances, statistics.requests);
+    CPPUNIT_ASSERT_EQUAL(num_instances, statistics.parts);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), statistics.retries);
+    CPPUNIT_ASSERT(statistics.connections <= 4);
+    CPPUNIT_ASSERT(server.connections() <= 4);
+}
+
+//------------------------------------------------------------------------------
+
+void retriever_test::multipart_test()
+{
+    constexpr std::size_t num_series    = 3;
+    constexpr std::size_t num_instances = 20;
+    const std::string boundary          = "3d6b6a416f9b5";
+
+    http_stand_in server(
+        [&](const std::string&)
+        {
+            return http_stand_in::response(
+                multipart_body(boundary, num_instances),
+                R"(multipart/related; type="application/dicom"; boundary=)" + boundary
+            );
+        });
+
+    std::vector<request::sptr> requests;
+    for(std::size_t i = 0 ; i < num_series ; ++i)
+    {
+        requests.push_back(request::New(server.url("/dicom-web/studies/1/series/" + std::to_string(i))));
+        requests.back()->add_header("Accept", R"(multipart/related; type="application/dicom")");
+    }
+
+    std::map<std::size_t, std::vector<std::string> > parts;
+
+    io::http::retriever retriever;
+    retriever.get(
+        requests,
+        [&](std::size_t _request, const request::headers_t& _headers, std::string&& _content)
+        {
+            CPPUNIT_ASSERT_EQUAL(std::string("application/dicom"), _headers.at("content-type"));
+            parts[_request].push_back(std::move(_content));
+        });
+
+    CPPUNIT_ASSERT_EQUAL(num_series, parts.size());
+
+    for(const auto& [request_index, series_parts] : parts)
+    {
+        CPPUNIT_ASSERT_EQUAL(num_instances, series_parts.size());
+
+        for(std::size_t i = 0 ; i < series_parts.size() ; ++i)
+        {
+            CPPUNIT_ASSERT_EQUAL(instance_content(i), series_parts[i]);
+        }
+    }
+
+    CPPUNIT_ASSERT_EQUAL(num_series * num_instances, retriever.get_statistics().parts);
+}
+
+//------------------------------------------------------------------------------
+
+void retriever_test::retry_test()
+{
+    constexpr std::size_t num_instances = 16;
+
+    // Each instance fails twice before being served
+    std::mutex mutex;
+    std::map<std::string, std::size_t> attempts;
+
+    http_stand_in server(
+        [&](const std::string& _target)
+        {
+            {
+                std::lock_guard lock(mutex);
+                if(++attempts[_target] <= 2)
+                {
+                    return http_stand_in::response("busy", "text/plain", "503 Service Unavailable");
+                }
+            }
+
+            return http_stand_in::response(instance_content(instance_index(_target)));
+        });
+
+    io::http::retriever retriever(
+        {.max_connections = 4, .max_retries = 2, .retry_delay = std::chrono::milliseconds(5)});
+
+    std::vector<std::string> contents(num_instances);
+    retriever.get(
+        instance_requests(server, num_instances),
+        [&](std::size_t _request, const request::headers_t&, std::string&& _content)
+        {
+            contents[_request] = std::move(_content);
+        });
+
+    for(std::size_t i = 0 ; i < num_instances ; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(instance_content(i), contents[i]);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(2 * num_instances, retriever.get_statistics().retries);
+}
+
+//------------------------------------------------------------------------------
+
+void retriever_test::error_test()
+{
+    constexpr std::size_t num_instances = 8;
+    std::atomic_size_t missing_requests {0};
+
+    // Odd instances are missing
+    http_stand_in server(
+        [&](const std::string& _target)
+        {
+            if(const auto index = instance_index(_target); index % 2 == 0)
+            {
+                return http_stand_in::response(instance_content(index));
+            }
+
+            ++missing_requests;
+            return http_stand_in::response("missing", "text/plain", "404 Not Found");
+        });
+
+    core::os::temp_dir tmp_dir;
+    io::http::retriever retriever({.max_connections = 2, .retry_delay = std::chrono::milliseconds(5)});
+
+    CPPUNIT_ASSERT_THROW(
+        retriever.get_files(instance_requests(server, num_instances), tmp_dir),
+        io::http::exceptions::content_not_found
+    );
+
+    // Missing content is not retried, and all other instances have been retrieved
+    CPPUNIT_ASSERT_EQUAL(num_instances / 2, std::size_t(missing_requests));
+    CPPUNIT_ASSERT_EQUAL(num_instances / 2, retriever.get_statistics().parts);
+
+    std::size_t num_files = 0;
+    for(const auto& entry : std::filesystem::directory_iterator(tmp_dir))
+    {
+        CPPUNIT_ASSERT_EQUAL(std::string(".dcm"), entry.path().extension().string());
+        ++num_files;
+    }
+
+    CPPUNIT_ASSERT_EQUAL(num_instances / 2, num_files);
+}
+
+//------------------------------------------------------------------------------
+
+void retriever_test::benchmark_concurrent_retrieval()
+{
+    constexpr std::size_t num_instances = 64;
+
+    // Simulates the latency of a PACS
+    http_stand_in server(
+        [](const std::string& _target)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            return http_stand_in::response(instance_content(instance_index(_target)));
+        });
+
+    const auto& retrieve =
+        [&](std::size_t _connections)
+        {
+            io::http::retriever retriever({.max_connections = _connections});
+            std::size_t parts = 0;
+            retriever.get(
+                instance_requests(server, num_instances),
+                [&](std::size_t, const request::headers_t&, std::string&&){++parts;});
+
+            CPPUNIT_ASSERT_EQUAL(num_instances, parts);
+
+            const auto& statistics = retriever.get_statistics();
+            SIGHT_INFO(
+                "Retrieval of " << num_instances << " instances with " << _connections << " connections: "
+                << statistics.elapsed.count() << " s"
+            );
+
+            return statistics.elapsed;
+        };
+
+    const auto sequential = retrieve(1);
+    const auto concurrent = retrieve(8);
+
+    CPPUNIT_ASSERT(concurrent < sequential);
+}
+
+} // namespace sight::io::http::ut
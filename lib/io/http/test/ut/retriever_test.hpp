@@ -0,0 +1,64 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <io/http/retriever.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::io::http::ut
+{
+
+/// Unit test of io::http::retriever and io::http::multipart_parser, against a local HTTP server.
+class retriever_test : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(retriever_test);
+CPPUNIT_TEST(multipart_parser_test);
+CPPUNIT_TEST(get_files_test);
+CPPUNIT_TEST(multipart_test);
+CPPUNIT_TEST(retry_test);
+CPPUNIT_TEST(error_test);
+CPPUNIT_TEST(benchmark_concurrent_retrieval);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    /// Does nothing.
+    void setUp() final;
+    /// Does nothing.
+    void tearDown() final;
+
+    /// Tests the parsing of multipart bodies split in chunks of any size.
+    static void multipart_parser_test();
+    /// Tests the retrieval of many single part resources to files, on a few kept alive connections.
+    static void get_files_test();
+    /// Tests the streaming of a "multipart/related" response in memory.
+    static void multipart_test();
+    /// Tests that failing requests are retried.
+    static void retry_test();
+    /// Tests that unrecoverable errors are reported once all other requests are done.
+    static void error_test();
+    /// Compares sequential and concurrent retrieval on a server with latency.
+    static void benchmark_concurrent_retrieval();
+};
+
+} // namespace sight::io::http::ut
@@ -3,3 +3,14 @@ if(VCPKG_TARGET_TRIPLET)
 else()
     find_package(OpenIGTLink QUIET REQUIRED)
 endif()
+
+# ZSTD
+find_package(PkgConfig QUIET)
+
+if(PKGCONFIG_FOUND)
+    pkg_check_modules(ZSTD libzstd)
+endif()
+
+if(WIN32 OR NOT ZSTD_FOUND)
+    find_package(zstd CONFIG REQUIRED)
+endif()
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2014-2023 IRCAD France
+ * Copyright (C) 2014-2025 IRCAD France
  * Copyright (C) 2014-2017 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -98,6 +98,9 @@ void client::connect(const std::string& _addr, std::uint16_t _port)
         std::string("Cannot connect to the server at ") + _addr + " : " + port_str,
         result == -1
     );
+
+    // A new peer has to announce its capabilities again
+    m_peer_capabilities = peer_capabilities::unknown;
 }
 
 //------------------------------------------------------------------------------
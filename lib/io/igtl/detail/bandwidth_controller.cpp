@@ -0,0 +1,130 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/igtl/detail/bandwidth_controller.hpp"
+
+#include <algorithm>
+
+namespace sight::io::igtl::detail
+{
+
+namespace
+{
+
+/// Fraction of a window spent blocked in the socket above which the link is considered congested
+constexpr double CONGESTED = 0.5;
+
+/// Fraction of the target below which a cheaper encoding is tried
+constexpr double UNDERUSED = 0.4;
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+bandwidth_controller::bandwidth_controller(image_compression _settings) :
+    m_settings(std::move(_settings)),
+    m_ladder({
+        {.codec = image_codec::raw, .level = 0},
+        {.codec = image_codec::zstd, .level = -5},
+        {.codec = image_codec::zstd, .level = 1},
+        {.codec = image_codec::zstd, .level = 3},
+        {.codec = image_codec::zstd, .level = 9}
+    })
+{
+    if(m_settings.lossy)
+    {
+        for(const int quality : {95, 85, 75, 60, 45, 30})
+        {
+            m_ladder.push_back({.codec = image_codec::jpeg, .level = quality});
+        }
+    }
+
+    // Start from the configured encoding if it is in the ladder, otherwise from the first zstd level
+    const auto it = std::find(m_ladder.begin(), m_ladder.end(), m_settings.encoding);
+    m_step = it != m_ladder.end() ? std::size_t(std::distance(m_ladder.begin(), it)) : 1;
+}
+
+//------------------------------------------------------------------------------
+
+image_encoding bandwidth_controller::encoding() const
+{
+    return m_settings.bandwidth.has_value() ? m_ladder[m_step] : m_settings.encoding;
+}
+
+//------------------------------------------------------------------------------
+
+void bandwidth_controller::update(std::size_t _bytes, clock_t::time_point _start, clock_t::time_point _end)
+{
+    if(!m_settings.bandwidth.has_value())
+    {
+        return;
+    }
+
+    if(!m_window_start.has_value())
+    {
+        m_window_start = _start;
+    }
+
+    m_window_bytes   += _bytes;
+    m_window_blocked += _end - _start;
+    ++m_window_frames;
+
+    const auto elapsed = _end - *m_window_start;
+    if(elapsed < WINDOW || m_window_frames < WINDOW_FRAMES)
+    {
+        return;
+    }
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    const double blocked = std::chrono::duration<double>(m_window_blocked).count() / seconds;
+    m_rate = double(m_window_bytes) / seconds;
+
+    const double target = *m_settings.bandwidth;
+    if((m_rate > target || blocked > CONGESTED) && m_step + 1 < m_ladder.size())
+    {
+        ++m_step;
+    }
+    else if(m_rate < target * UNDERUSED && blocked < CONGESTED * UNDERUSED && m_step > 0)
+    {
+        --m_step;
+    }
+
+    m_window_start.reset();
+    m_window_bytes   = 0;
+    m_window_frames  = 0;
+    m_window_blocked = clock_t::duration::zero();
+}
+
+//------------------------------------------------------------------------------
+
+double bandwidth_controller::rate() const
+{
+    return m_rate;
+}
+
+//------------------------------------------------------------------------------
+
+const std::vector<image_encoding>& bandwidth_controller::ladder() const
+{
+    return m_ladder;
+}
+
+} // namespace sight::io::igtl::detail
@@ -0,0 +1,90 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/igtl/config.hpp>
+
+#include "io/igtl/image_compression.hpp"
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace sight::io::igtl::detail
+{
+
+/**
+ * @brief Adapts the encoding of the images sent to one peer to a target bandwidth.
+ *
+ * The encodings are ordered in a ladder, from the cheapest to compute to the smallest output: raw, zstd levels, then
+ * decreasing JPEG qualities if lossy compression is allowed. The output rate and the time spent blocked in the socket
+ * are measured over windows of a few frames. The controller moves up the ladder when the rate exceeds the target or
+ * when the link is congested, and moves down when the rate is well below the target, to spend less time encoding.
+ */
+class SIGHT_IO_IGTL_CLASS_API bandwidth_controller
+{
+public:
+
+    using clock_t = std::chrono::steady_clock;
+
+    /// Minimal duration of a measurement window
+    static constexpr std::chrono::milliseconds WINDOW {250};
+
+    /// Minimal number of frames in a measurement window
+    static constexpr std::size_t WINDOW_FRAMES = 3;
+
+    SIGHT_IO_IGTL_API explicit bandwidth_controller(image_compression _settings);
+
+    /// Returns the encoding of the next frame
+    [[nodiscard]] SIGHT_IO_IGTL_API image_encoding encoding() const;
+
+    /// Accounts for a frame of _bytes whose sending started at _start and ended at _end
+    SIGHT_IO_IGTL_API void update(std::size_t _bytes, clock_t::time_point _start, clock_t::time_point _end);
+
+    /// Returns the output rate measured on the last window, in bytes per second
+    [[nodiscard]] SIGHT_IO_IGTL_API double rate() const;
+
+    /// Returns the encodings the controller chooses from
+    [[nodiscard]] SIGHT_IO_IGTL_API const std::vector<image_encoding>& ladder() const;
+
+private:
+
+    /// Settings given by the user
+    image_compression m_settings;
+
+    /// Encodings, from the cheapest to compute to the smallest
+    std::vector<image_encoding> m_ladder;
+
+    /// Index of the current encoding in the ladder
+    std::size_t m_step {0};
+
+    /// Current measurement window
+    std::optional<clock_t::time_point> m_window_start;
+    std::size_t m_window_bytes {0};
+    std::size_t m_window_frames {0};
+    clock_t::duration m_window_blocked {0};
+
+    /// Rate measured on the last window
+    double m_rate {0.};
+};
+
+} // namespace sight::io::igtl::detail
@@ -0,0 +1,94 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/igtl/detail/converter/compressed_image_converter.hpp"
+
+#include "io/igtl/detail/data_converter.hpp"
+#include "io/igtl/detail/image_compressor.hpp"
+
+#include <data/helper/medical_image.hpp>
+#include <data/image.hpp>
+
+namespace sight::io::igtl::detail::converter
+{
+
+const std::string compressed_image_converter::IGTL_TYPE          = std::string(image_compressor::IGTL_TYPE);
+const std::string compressed_image_converter::FWDATA_OBJECT_TYPE = "sight::io::igtl::compressed_image";
+
+CONVERTER_REGISTER_MACRO(io::igtl::detail::converter::compressed_image_converter);
+
+compressed_image_converter::compressed_image_converter()
+= default;
+
+//-----------------------------------------------------------------------------
+
+compressed_image_converter::~compressed_image_converter()
+= default;
+
+//-----------------------------------------------------------------------------
+
+::igtl::MessageBase::Pointer compressed_image_converter::from_fw_data_object(data::object::csptr _src) const
+{
+    const auto image = std::dynamic_pointer_cast<const data::image>(_src);
+    SIGHT_THROW_EXCEPTION_IF(exception::conversion("Object is not an image"), image == nullptr);
+
+    return {image_compressor::encode(image, image_compression {}.encoding).GetPointer()};
+}
+
+//-----------------------------------------------------------------------------
+
+data::object::sptr compressed_image_converter::from_igtl_message(const ::igtl::MessageBase::Pointer _src) const
+{
+    const auto* const msg = dynamic_cast<raw_message*>(_src.GetPointer());
+    SIGHT_THROW_EXCEPTION_IF(exception::conversion("Message is not a compressed image"), msg == nullptr);
+
+    data::image::sptr image = image_compressor::decode(msg->get_message());
+
+    if(sight::data::helper::medical_image::check_image_validity(image))
+    {
+        sight::data::helper::medical_image::check_image_slice_index(image);
+    }
+
+    return image;
+}
+
+//-----------------------------------------------------------------------------
+
+base::sptr compressed_image_converter::New()
+{
+    return std::make_shared<compressed_image_converter>();
+}
+
+//-----------------------------------------------------------------------------
+
+std::string const& compressed_image_converter::get_igtl_type() const
+{
+    return compressed_image_converter::IGTL_TYPE;
+}
+
+//-----------------------------------------------------------------------------
+
+std::string const& compressed_image_converter::get_fw_data_object_type() const
+{
+    return compressed_image_converter::FWDATA_OBJECT_TYPE;
+}
+
+} // namespace sight::io::igtl::detail::converter
@@ -0,0 +1,95 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include "io/igtl/detail/converter/base.hpp"
+#include "io/igtl/detail/exception/conversion.hpp"
+
+namespace sight::io::igtl::detail::converter
+{
+
+/**
+ *
+ * @brief class to manage conversion between data::image and compressed image messages exchanged by Sight peers
+ *
+ * Decoding is done through the converter registry. Encoding is driven by network, which only compresses images for
+ * the peers that listed this message type in their capabilities, so this converter is never chosen by
+ * data_converter::from_fw_object().
+ */
+class SIGHT_IO_IGTL_CLASS_API compressed_image_converter :
+    public base
+{
+public:
+
+    /// Constructor
+    SIGHT_IO_IGTL_API compressed_image_converter();
+
+    /// Destructor
+    SIGHT_IO_IGTL_API ~compressed_image_converter() override;
+
+    /**
+     * @brief convert a compressed image message to a data::object
+     *
+     * @return a data::image decompressed from the message
+     */
+    [[nodiscard]] SIGHT_IO_IGTL_API data::object::sptr from_igtl_message(::igtl::MessageBase::Pointer _src) const
+    override;
+
+    /**
+     * @brief convert a data::image to a compressed image message, with the default encoding
+     *
+     * @return a raw message containing the compressed image
+     */
+    [[nodiscard]] SIGHT_IO_IGTL_API ::igtl::MessageBase::Pointer from_fw_data_object(data::object::csptr _src) const
+    override;
+
+    /**
+     * @brief create a new compressed_image_converter smart pointer
+     *
+     * @return a smart pointer to a compressed_image_converter
+     */
+    SIGHT_IO_IGTL_API static base::sptr New();
+
+    /**
+     * @brief get the igtlType supported for conversion
+     *
+     * @return the igtlType supported for conversion
+     */
+    [[nodiscard]] SIGHT_IO_IGTL_API std::string const& get_igtl_type() const override;
+
+    /**
+     * @brief get the fwData object type supported for conversion
+     *
+     * @return a type name that matches no data class, see the class description
+     */
+    [[nodiscard]] SIGHT_IO_IGTL_API std::string const& get_fw_data_object_type() const override;
+
+private:
+
+    /// igtl type supported for conversion
+    static const std::string IGTL_TYPE;
+
+    /// fwData type supported for conversion
+    static const std::string FWDATA_OBJECT_TYPE;
+};
+
+} // namespace sight::io::igtl::detail::converter
@@ -0,0 +1,370 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "io/igtl/detail/image_compressor.hpp"
+
+#include "io/igtl/detail/exception/conversion.hpp"
+#include "io/igtl/detail/helper/scalar_to_bytes.hpp"
+#include "io/igtl/detail/image_type_converter.hpp"
+#include "io/igtl/exception.hpp"
+
+#include <io/bitmap/backend.hpp>
+#include <io/bitmap/reader.hpp>
+#include <io/bitmap/writer.hpp>
+
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+
+#include <zstd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace sight::io::igtl::detail
+{
+
+namespace
+{
+
+constexpr std::uint8_t VERSION = 1;
+
+/// Size of the header preceding the compressed pixels
+constexpr std::size_t HEADER_SIZE = 4 * sizeof(std::uint8_t) + 3 * sizeof(std::uint32_t) + 6 * sizeof(double)
+                                    + sizeof(std::uint64_t);
+
+/// Appends a scalar to a body
+template<typename T>
+void append(raw_message::raw_data_t& _body, T _value)
+{
+    const auto bytes = helper::scalar_to_bytes<T>::to_bytes(_value);
+    _body.insert(_body.end(), bytes.begin(), bytes.end());
+}
+
+/// Reads a scalar from a body and moves the cursor after it
+template<typename T>
+T read(const raw_message::raw_data_t& _body, std::size_t& _cursor)
+{
+    const T value = helper::scalar_to_bytes<T>::from_bytes(_body.data() + _cursor);
+    _cursor += sizeof(T);
+    return value;
+}
+
+/// Returns the pixel format stored in a header, throws if it is not a valid format
+data::image::pixel_format_t read_pixel_format(std::uint8_t _value)
+{
+    SIGHT_THROW_EXCEPTION_IF(
+        igtl::exception("Compressed image message has an invalid pixel format " + std::to_string(int(_value))),
+        _value == data::image::pixel_format_t::undefined || _value >= data::image::pixel_format_t::count
+    );
+    return static_cast<data::image::pixel_format_t>(_value);
+}
+
+//------------------------------------------------------------------------------
+
+/// Returns the component type stored in a header, throws if it is not a valid type
+core::type read_type(std::uint8_t _value)
+{
+    try
+    {
+        return image_type_converter::get_fw_tools_type(_value);
+    }
+    catch(const exception::conversion&)
+    {
+        SIGHT_THROW_EXCEPTION(
+            igtl::exception("Compressed image message has an invalid component type " + std::to_string(int(_value)))
+        );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+/// Returns the size in bytes of the pixels described by a header, like data::image::size_in_bytes()
+std::size_t pixels_size(
+    const data::image::size_t& _size,
+    const core::type& _type,
+    data::image::pixel_format_t _format
+)
+{
+    std::size_t size = _type.size();
+    switch(_format)
+    {
+        case data::image::pixel_format_t::rgb:
+        case data::image::pixel_format_t::bgr:
+            size *= 3;
+            break;
+
+        case data::image::pixel_format_t::rgba:
+        case data::image::pixel_format_t::bgra:
+            size *= 4;
+            break;
+
+        case data::image::pixel_format_t::rg:
+            size *= 2;
+            break;
+
+        default:
+            break;
+    }
+
+    for(std::size_t i = 0 ; i < _size.size() && _size[i] > 0 ; ++i)
+    {
+        SIGHT_THROW_EXCEPTION_IF(
+            igtl::exception("Compressed image message has an invalid size"),
+            size > std::numeric_limits<std::size_t>::max() / _size[i]
+        );
+        size *= _size[i];
+    }
+
+    return _size[0] > 0 ? size : 0;
+}
+
+//------------------------------------------------------------------------------
+
+/// Returns the JPEG backend, on the GPU when it is available
+io::bitmap::backend jpeg_backend()
+{
+    return io::bitmap::nv_jpeg() ? io::bitmap::backend::nvjpeg : io::bitmap::backend::libjpeg;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+bool image_compressor::supports(const data::image& _image, igtl::image_codec _codec)
+{
+    if(_codec != igtl::image_codec::jpeg)
+    {
+        return true;
+    }
+
+    const auto format = _image.pixel_format();
+    return _image.type() == core::type::UINT8
+           && _image.size()[2] <= 1
+           && (format == data::image::pixel_format_t::gray_scale
+               || format == data::image::pixel_format_t::rgb
+               || format == data::image::pixel_format_t::bgr);
+}
+
+//------------------------------------------------------------------------------
+
+raw_message::Pointer image_compressor::encode(const data::image::csptr& _image, const image_encoding& _encoding)
+{
+    SIGHT_ASSERT("Image is null", _image);
+    const auto dump_lock = _image->dump_lock();
+
+    // JPEG is only used on the images it supports, others fall back to a lossless codec
+    image_encoding encoding = _encoding;
+    if(!supports(*_image, encoding.codec))
+    {
+        encoding = {.codec = igtl::image_codec::zstd, .level = 3};
+    }
+
+    raw_message::Pointer msg = raw_message::New(std::string(IGTL_TYPE));
+    auto& body               = msg->get_message();
+
+    const std::size_t raw_size = _image->size_in_bytes();
+    body.reserve(HEADER_SIZE);
+    append(body, VERSION);
+    append(body, static_cast<std::uint8_t>(encoding.codec));
+    append(body, static_cast<std::uint8_t>(_image->pixel_format()));
+    append(body, image_type_converter::get_igtl_type(_image->type()));
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        append(body, static_cast<std::uint32_t>(_image->size()[i]));
+    }
+
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        append(body, _image->spacing()[i]);
+    }
+
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        append(body, _image->origin()[i]);
+    }
+
+    append(body, static_cast<std::uint64_t>(raw_size));
+
+    const auto* const pixels = static_cast<const char*>(_image->buffer());
+
+    switch(encoding.codec)
+    {
+        case igtl::image_codec::raw:
+            body.insert(body.end(), pixels, pixels + raw_size);
+            break;
+
+        case igtl::image_codec::zstd:
+        {
+            // Compress directly after the header
+            body.resize(HEADER_SIZE + ZSTD_compressBound(raw_size));
+            const std::size_t compressed_size = ZSTD_compress(
+                body.data() + HEADER_SIZE,
+                body.size() - HEADER_SIZE,
+                pixels,
+                raw_size,
+                encoding.level
+            );
+            SIGHT_THROW_EXCEPTION_IF(
+                igtl::exception(std::string("Cannot compress the image: ") + ZSTD_getErrorName(compressed_size)),
+                ZSTD_isError(compressed_size) != 0
+            );
+            body.resize(HEADER_SIZE + compressed_size);
+            break;
+        }
+
+        case igtl::image_codec::jpeg:
+        {
+            auto writer = std::make_shared<io::bitmap::writer>();
+            writer->set_object(_image);
+            writer->set_quality(std::clamp(encoding.level, 1, 100));
+
+            std::vector<std::uint8_t> jpeg;
+            const std::size_t jpeg_size = writer->write(jpeg, jpeg_backend(), io::bitmap::writer::mode::fast);
+            body.insert(body.end(), jpeg.begin(), jpeg.begin() + std::ptrdiff_t(jpeg_size));
+            break;
+        }
+    }
+
+    return msg;
+}
+
+//------------------------------------------------------------------------------
+
+data::image::sptr image_compressor::decode(const raw_message::raw_data_t& _body)
+{
+    SIGHT_THROW_EXCEPTION_IF(igtl::exception("Compressed image message is truncated"), _body.size() < HEADER_SIZE);
+
+    std::size_t cursor = 0;
+    const auto version = read<std::uint8_t>(_body, cursor);
+    SIGHT_THROW_EXCEPTION_IF(
+        igtl::exception("Unsupported compressed image version " + std::to_string(version)),
+        version != VERSION
+    );
+
+    const auto codec        = static_cast<igtl::image_codec>(read<std::uint8_t>(_body, cursor));
+    const auto pixel_format = read_pixel_format(read<std::uint8_t>(_body, cursor));
+    const auto type         = read_type(read<std::uint8_t>(_body, cursor));
+
+    data::image::size_t size {};
+    data::image::spacing_t spacing {};
+    data::image::origin_t origin {};
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        size[i] = read<std::uint32_t>(_body, cursor);
+    }
+
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        spacing[i] = read<double>(_body, cursor);
+    }
+
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        origin[i] = read<double>(_body, cursor);
+    }
+
+    const auto raw_size = read<std::uint64_t>(_body, cursor);
+
+    // The pixels are allocated from the header, so it must agree with the size of the sent pixels
+    SIGHT_THROW_EXCEPTION_IF(
+        igtl::exception("Compressed image message has an invalid size"),
+        codec != igtl::image_codec::jpeg && pixels_size(size, type, pixel_format) != raw_size
+    );
+
+    const char* const payload      = _body.data() + HEADER_SIZE;
+    const std::size_t payload_size = _body.size() - HEADER_SIZE;
+    auto image                     = std::make_shared<data::image>();
+    const auto dump_lock           = image->dump_lock();
+
+    switch(codec)
+    {
+        case igtl::image_codec::raw:
+        {
+            SIGHT_THROW_EXCEPTION_IF(
+                igtl::exception("Compressed image message is truncated"),
+                payload_size != raw_size
+            );
+            image->resize(size, type, pixel_format);
+            SIGHT_THROW_EXCEPTION_IF(
+                igtl::exception("Compressed image message has an invalid size"),
+                image->size_in_bytes() != raw_size
+            );
+            std::memcpy(image->buffer(), payload, payload_size);
+            break;
+        }
+
+        case igtl::image_codec::zstd:
+        {
+            image->resize(size, type, pixel_format);
+            SIGHT_THROW_EXCEPTION_IF(
+                igtl::exception("Compressed image message has an invalid size"),
+                image->size_in_bytes() != raw_size
+            );
+
+            const std::size_t result = ZSTD_decompress(image->buffer(), raw_size, payload, payload_size);
+            SIGHT_THROW_EXCEPTION_IF(
+                igtl::exception(std::string("Cannot decompress the image: ") + ZSTD_getErrorName(result)),
+                ZSTD_isError(result) != 0 || result != raw_size
+            );
+            break;
+        }
+
+        case igtl::image_codec::jpeg:
+        {
+            auto reader = std::make_shared<io::bitmap::reader>();
+            reader->set_object(image);
+
+            boost::iostreams::stream<boost::iostreams::array_source> stream(payload, payload_size);
+            reader->read(stream, jpeg_backend());
+
+            SIGHT_THROW_EXCEPTION_IF(
+                igtl::exception("Compressed image message has an invalid size"),
+                image->size_in_bytes() != raw_size
+            );
+
+            // JPEG decoders return RGB, restore the channel order of the sent image
+            if(pixel_format == data::image::pixel_format_t::bgr
+               && image->pixel_format() == data::image::pixel_format_t::rgb)
+            {
+                auto* const pixels = static_cast<std::uint8_t*>(image->buffer());
+                for(std::size_t i = 0 ; i < raw_size ; i += 3)
+                {
+                    std::swap(pixels[i], pixels[i + 2]);
+                }
+
+                image->resize(image->size(), image->type(), data::image::pixel_format_t::bgr);
+            }
+
+            break;
+        }
+
+        default:
+            SIGHT_THROW_EXCEPTION(igtl::exception("Unsupported image codec " + std::to_string(int(codec))));
+    }
+
+    image->set_spacing(spacing);
+    image->set_origin(origin);
+
+    return image;
+}
+
+} // namespace sight::io::igtl::detail
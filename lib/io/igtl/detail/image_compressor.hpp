@@ -0,0 +1,76 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/igtl/config.hpp>
+
+#include "io/igtl/detail/raw_message.hpp"
+#include "io/igtl/image_compression.hpp"
+
+#include <data/image.hpp>
+
+#include <string_view>
+
+namespace sight::io::igtl::detail
+{
+
+/**
+ * @brief Encodes and decodes the body of compressed image messages.
+ *
+ * The body starts with a fixed header in host byte order, like the other raw messages: a version, the codec, the
+ * pixel format, the igtl scalar type, the size, spacing and origin of the image and the size of its raw buffer. The
+ * compressed pixels follow.
+ */
+class SIGHT_IO_IGTL_CLASS_API image_compressor
+{
+public:
+
+    /// Type of the messages carrying a compressed image
+    static constexpr std::string_view IGTL_TYPE = "SIGHT_CIMG";
+
+    image_compressor()  = delete;
+    ~image_compressor() = delete;
+
+    /// Returns true if the image can be compressed with the given codec. JPEG needs an 8-bit 2D gray scale, RGB or
+    /// BGR image; other images are compressed with zstd instead.
+    SIGHT_IO_IGTL_API static bool supports(const data::image& _image, igtl::image_codec _codec);
+
+    /**
+     * @brief compresses an image in a new message
+     * @param[in] _image image to compress
+     * @param[in] _encoding codec and level
+     * @return a raw message of type IGTL_TYPE
+     */
+    SIGHT_IO_IGTL_API static raw_message::Pointer encode(
+        const data::image::csptr& _image,
+        const image_encoding& _encoding
+    );
+
+    /**
+     * @brief decompresses the body of a message
+     * @param[in] _body body of a message of type IGTL_TYPE
+     * @throw sight::io::igtl::exception if the body is truncated or cannot be decompressed
+     */
+    SIGHT_IO_IGTL_API static data::image::sptr decode(const raw_message::raw_data_t& _body);
+};
+
+} // namespace sight::io::igtl::detail
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -22,8 +22,10 @@
 
 #include "message_factory.hpp"
 
+#include "io/igtl/detail/image_compressor.hpp"
 #include "io/igtl/detail/raw_message.hpp"
 
+#include <igtlCapabilityMessage.h>
 #include <igtlImageMessage.h>
 #include <igtlPointMessage.h>
 #include <igtlPolyDataMessage.h>
@@ -44,15 +46,21 @@ message_factory::creator_container_t message_factory::init_factory()
     creator_container_t container;
 
     // Create messages without parameters.
-    container["TRANSFORM"] = &MessageMaker< ::igtl::TransformMessage, false>::create_message;
-    container["IMAGE"]     = &MessageMaker< ::igtl::ImageMessage, false>::create_message;
-    container["POINT"]     = &MessageMaker< ::igtl::PointMessage, false>::create_message;
-    container["STRING"]    = &MessageMaker< ::igtl::StringMessage, false>::create_message;
-    container["POSITION"]  = &MessageMaker< ::igtl::PositionMessage, false>::create_message;
-    container["POLYDATA"]  = &MessageMaker< ::igtl::PolyDataMessage, false>::create_message;
-    container["TDATA"]     = &MessageMaker< ::igtl::TrackingDataMessage, false>::create_message;
-    container["STT_TDATA"] = &MessageMaker< ::igtl::StartTrackingDataMessage, false>::create_message;
-    container["STP_TDATA"] = &MessageMaker< ::igtl::StopTrackingDataMessage, false>::create_message;
+    container["TRANSFORM"]  = &MessageMaker< ::igtl::TransformMessage, false>::create_message;
+    container["IMAGE"]      = &MessageMaker< ::igtl::ImageMessage, false>::create_message;
+    container["POINT"]      = &MessageMaker< ::igtl::PointMessage, false>::create_message;
+    container["STRING"]     = &MessageMaker< ::igtl::StringMessage, false>::create_message;
+    container["POSITION"]   = &MessageMaker< ::igtl::PositionMessage, false>::create_message;
+    container["POLYDATA"]   = &MessageMaker< ::igtl::PolyDataMessage, false>::create_message;
+    container["TDATA"]      = &MessageMaker< ::igtl::TrackingDataMessage, false>::create_message;
+    container["STT_TDATA"]  = &MessageMaker< ::igtl::StartTrackingDataMessage, false>::create_message;
+    container["STP_TDATA"]  = &MessageMaker< ::igtl::StopTrackingDataMessage, false>::create_message;
+    container["CAPABILITY"] = &MessageMaker< ::igtl::CapabilityMessage, false>::create_message;
+
+    // Create messages with parameters.
+    const std::string compressed_image(image_compressor::IGTL_TYPE);
+    container[compressed_image] =
+        [compressed_image]{return MessageMaker<raw_message, true>::create_message(compressed_image);};
 
     return container;
 }
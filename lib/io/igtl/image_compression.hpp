@@ -0,0 +1,69 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <sight/io/igtl/config.hpp>
+
+#include <compare>
+#include <cstdint>
+#include <optional>
+
+namespace sight::io::igtl
+{
+
+/// Codecs used to compress the images sent to Sight peers
+enum class image_codec : std::uint8_t
+{
+    raw  = 0, ///< No compression
+    zstd = 1, ///< Lossless, the level goes from -7 (as fast as LZ4) to 22 (best ratio)
+    jpeg = 2  ///< Lossy, the level is the quality from 1 to 100. Only 8-bit 2D gray scale, RGB and BGR images.
+};
+
+/// Codec with its level, which is the zstd compression level or the JPEG quality
+struct image_encoding
+{
+    image_codec codec {image_codec::raw};
+    int level {0};
+
+    auto operator<=>(const image_encoding&) const = default;
+};
+
+/**
+ * @brief Compression of the images sent to the peers which announced they can decode them.
+ *
+ * Peers which did not send a CAPABILITY message listing the compressed image type, like third-party OpenIGTLink
+ * applications, keep receiving plain IMAGE messages.
+ */
+struct image_compression
+{
+    /// Encoding used when no bandwidth is set, and the first one used when it is
+    image_encoding encoding {.codec = image_codec::zstd, .level = 1};
+
+    /// Target bandwidth of each peer, in bytes per second. When set, the codec and its level are adapted to the
+    /// measured output rate and to the time spent blocked on the socket.
+    std::optional<double> bandwidth;
+
+    /// Allows the adaptation to use JPEG when lossless codecs do not fit in the bandwidth
+    bool lossy {false};
+};
+
+} // namespace sight::io::igtl
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2014-2023 IRCAD France
+ * Copyright (C) 2014-2025 IRCAD France
  * Copyright (C) 2014-2018 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -24,10 +24,26 @@
 
 #include "io/igtl/exception.hpp"
 
+#include <io/igtl/detail/bandwidth_controller.hpp>
 #include <io/igtl/detail/data_converter.hpp>
+#include <io/igtl/detail/image_compressor.hpp>
+#include <io/igtl/detail/image_type_converter.hpp>
 #include <io/igtl/detail/message_factory.hpp>
 
+#include <data/helper/medical_image.hpp>
+
+#include <igtl_header.h>
+#include <igtl_image.h>
+#include <igtl_util.h>
+#include <igtlCapabilityMessage.h>
+#include <igtlImageMessage.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <climits>
 #include <cmath>
+#include <cstring>
 
 #if defined(_WIN32)
   #include <windows.h>
@@ -63,13 +79,159 @@ network::~network()
 
 bool network::send_object(const data::object::csptr& _obj)
 {
-    ::igtl::MessageBase::Pointer msg;
+    encoded_messages_t encoded;
+    return this->send_object(_obj, encoded);
+}
+
+//------------------------------------------------------------------------------
+
+bool network::send_object(const data::object::csptr& _obj, encoded_messages_t& _encoded)
+{
+    const auto image              = std::dynamic_pointer_cast<const data::image>(_obj);
+    const image_encoding encoding = image ? this->get_image_encoding() : image_encoding {};
+
+    // Raw images are sent as plain IMAGE messages, that all peers understand
+    ::igtl::MessageBase::Pointer& msg = _encoded[encoding];
+    if(msg.IsNull())
+    {
+        if(encoding.codec == image_codec::raw)
+        {
+            detail::data_converter::sptr converter = detail::data_converter::get_instance();
+            msg = converter->from_fw_object(_obj);
+        }
+        else
+        {
+            msg = ::igtl::MessageBase::Pointer(detail::image_compressor::encode(image, encoding).GetPointer());
+        }
+    }
 
-    detail::data_converter::sptr converter = detail::data_converter::get_instance();
-    msg = converter->from_fw_object(_obj);
     msg->SetDeviceName(m_device_name_out.c_str());
     msg->Pack();
-    return m_socket->Send(msg->GetPackPointer(), msg->GetPackSize()) == 1;
+
+    const auto start = std::chrono::steady_clock::now();
+    const bool sent  = m_socket->Send(msg->GetPackPointer(), msg->GetPackSize()) == 1;
+
+    if(image && m_bandwidth_controller && m_peer_capabilities == peer_capabilities::compression)
+    {
+        m_bandwidth_controller->update(std::size_t(msg->GetPackSize()), start, std::chrono::steady_clock::now());
+    }
+
+    return sent;
+}
+
+//------------------------------------------------------------------------------
+
+void network::set_image_compression(std::optional<image_compression> _compression)
+{
+    m_image_compression = std::move(_compression);
+    m_bandwidth_controller.reset();
+    if(m_image_compression.has_value())
+    {
+        m_bandwidth_controller = std::make_unique<detail::bandwidth_controller>(*m_image_compression);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+std::optional<image_compression> network::get_image_compression() const
+{
+    return m_image_compression;
+}
+
+//------------------------------------------------------------------------------
+
+image_encoding network::get_image_encoding()
+{
+    const bool compression = m_probe_capabilities
+                             ? this->peer_supports_compression()
+                             : m_peer_capabilities == peer_capabilities::compression;
+    if(m_bandwidth_controller && compression)
+    {
+        return m_bandwidth_controller->encoding();
+    }
+
+    return {};
+}
+
+//------------------------------------------------------------------------------
+
+bool network::send_capabilities()
+{
+    return this->send_msg(detail::data_converter::get_instance()->get_capabilities_message());
+}
+
+//------------------------------------------------------------------------------
+
+bool network::peer_supports_compression()
+{
+    const int socket = m_socket.IsNotNull() ? m_socket->m_SocketDescriptor : -1;
+    if(m_peer_capabilities != peer_capabilities::unknown || socket < 0)
+    {
+        return m_peer_capabilities == peer_capabilities::compression;
+    }
+
+    // Look for a pending message without blocking
+    fd_set sockets;
+    FD_ZERO(&sockets);
+    FD_SET(socket, &sockets);
+    timeval timeout {};
+    if(select(socket + 1, &sockets, nullptr, nullptr, &timeout) <= 0)
+    {
+        return false;
+    }
+
+    // Peek at its header, to leave it in the socket if it is not a CAPABILITY message
+    constexpr std::size_t device_type_offset = 2;
+    constexpr std::size_t device_type_size   = 12;
+    std::array<char, IGTL_HEADER_SIZE> raw_header {};
+    const auto peeked = recv(socket, raw_header.data(), int(raw_header.size()), MSG_PEEK);
+    if(peeked < int(raw_header.size()))
+    {
+        return false;
+    }
+
+    const std::string device_type(
+        raw_header.data() + device_type_offset,
+        strnlen(raw_header.data() + device_type_offset, device_type_size)
+    );
+    if(device_type != "CAPABILITY")
+    {
+        m_peer_capabilities = peer_capabilities::none;
+        return false;
+    }
+
+    ::igtl::MessageHeader::Pointer header = ::igtl::MessageHeader::New();
+    header->InitPack();
+    this->receive_buffer(header->GetPackPointer(), std::size_t(header->GetPackSize()));
+    header->Unpack();
+
+    this->read_capabilities(this->receive_body(header));
+
+    return m_peer_capabilities == peer_capabilities::compression;
+}
+
+//------------------------------------------------------------------------------
+
+bool network::read_capabilities(const ::igtl::MessageBase::Pointer& _msg)
+{
+    auto* const capabilities = dynamic_cast< ::igtl::CapabilityMessage*>(_msg.GetPointer());
+    if(capabilities == nullptr)
+    {
+        return false;
+    }
+
+    auto peer = peer_capabilities::none;
+    for(int i = 0 ; i < capabilities->GetNumberOfTypes() ; ++i)
+    {
+        if(detail::image_compressor::IGTL_TYPE == capabilities->GetType(i))
+        {
+            peer = peer_capabilities::compression;
+        }
+    }
+
+    m_peer_capabilities = peer;
+
+    return true;
 }
 
 //------------------------------------------------------------------------------
@@ -84,16 +246,22 @@ bool network::send_msg(::igtl::MessageBase::Pointer _msg)
 //------------------------------------------------------------------------------
 
 data::object::sptr network::receive_object(std::string& _device_name)
+{
+    double timestamp = 0.;
+    return this->receive_object(_device_name, timestamp);
+}
+
+//------------------------------------------------------------------------------
+
+data::object::sptr network::receive_object(std::string& _device_name, double& _timestamp)
 {
     data::object::sptr obj;
     ::igtl::MessageHeader::Pointer header_msg = this->receive_header();
     if(header_msg.IsNotNull())
     {
-        ::igtl::MessageBase::Pointer msg = this->receive_body(header_msg);
-        if(msg.IsNotNull())
+        obj = this->receive_object(header_msg, _timestamp);
+        if(obj)
         {
-            detail::data_converter::sptr converter = detail::data_converter::get_instance();
-            obj          = converter->from_igtl_message(msg);
             _device_name = header_msg->GetDeviceName();
         }
     }
@@ -103,33 +271,129 @@ data::object::sptr network::receive_object(std::string& _device_name)
 
 //------------------------------------------------------------------------------
 
-data::object::sptr network::receive_object(std::string& _device_name, double& _timestamp)
+namespace
 {
-    data::object::sptr obj;
-    ::igtl::MessageHeader::Pointer header_msg = this->receive_header();
-    if(header_msg.IsNotNull())
+
+/// Returns the timestamp of a message in milliseconds
+double timestamp_in_ms(::igtl::MessageBase* _msg)
+{
+    unsigned int sec  = 0;
+    unsigned int frac = 0;
+    _msg->GetTimeStamp(&sec, &frac);
+
+    // convert into milliseconds
+    return static_cast<double>(frac) / 1000000. + static_cast<double>(sec) * 1000.;
+}
+
+//------------------------------------------------------------------------------
+
+/// Returns the CRC stored in a received header.
+/// Depending on the igtl version, unpacking the header may have converted it in place to the host byte order, so the
+/// body size field, that is known, tells in which order the CRC field is stored.
+std::uint64_t header_crc(const ::igtl::MessageHeader::Pointer& _header)
+{
+    constexpr std::size_t body_size_offset = 42;
+    constexpr std::size_t crc_offset       = 50;
+    static_assert(crc_offset + sizeof(std::uint64_t) == IGTL_HEADER_SIZE);
+
+    const auto* const raw = static_cast<const std::uint8_t*>(_header->GetPackPointer());
+    const auto big_endian =
+        [raw](std::size_t _offset)
+        {
+            std::uint64_t value = 0;
+            for(std::size_t i = 0 ; i < sizeof(std::uint64_t) ; ++i)
+            {
+                value = (value << 8U) | raw[_offset + i];
+            }
+
+            return value;
+        };
+
+    if(big_endian(body_size_offset) == _header->GetBodySizeToRead())
     {
-        ::igtl::MessageBase::Pointer msg = this->receive_body(header_msg);
-        if(msg.IsNotNull())
+        return big_endian(crc_offset);
+    }
+
+    std::uint64_t crc = 0;
+    std::memcpy(&crc, raw + crc_offset, sizeof(crc));
+    return crc;
+}
+
+//------------------------------------------------------------------------------
+
+/// Reverses the byte order of each of the _count elements of _element_size bytes of a buffer
+void swap_bytes(std::uint8_t* _buffer, std::size_t _count, std::size_t _element_size)
+{
+    if(_element_size > 1)
+    {
+        for(std::size_t i = 0 ; i < _count ; ++i)
         {
-            // get message timestamp
-            unsigned int sec  = 0;
-            unsigned int frac = 0;
-            msg->GetTimeStamp(&sec, &frac);
-            double sec_d  = NAN;
-            double frac_d = NAN;
-            sec_d  = static_cast<double>(sec);
-            frac_d = static_cast<double>(frac);
-
-            // convert into milliseconds
-            frac_d    /= 1000000.;
-            sec_d     *= 1000.;
-            _timestamp = frac_d + sec_d;
+            std::reverse(_buffer + i * _element_size, _buffer + (i + 1) * _element_size);
+        }
+    }
+}
 
-            detail::data_converter::sptr converter = detail::data_converter::get_instance();
-            obj          = converter->from_igtl_message(msg);
-            _device_name = header_msg->GetDeviceName();
+//------------------------------------------------------------------------------
+
+/// Returns the image pixel format for a number of components
+data::image::pixel_format_t pixel_format(std::size_t _num_components)
+{
+    switch(_num_components)
+    {
+        case 1:
+            return data::image::pixel_format_t::gray_scale;
+
+        case 3:
+            return data::image::pixel_format_t::rgb;
+
+        case 4:
+            return data::image::pixel_format_t::rgba;
+
+        default:
+            throw sight::io::igtl::exception("Invalid number of components: " + std::to_string(_num_components));
+    }
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+data::object::sptr network::receive_object(const ::igtl::MessageHeader::Pointer& _header, double& _timestamp)
+{
+    if(m_image_allocation_policy && std::string(_header->GetDeviceType()) == "IMAGE")
+    {
+        auto image = std::make_shared<data::image>();
+        image->set_allocation_policy(m_image_allocation_policy);
+        const auto dump_lock = image->dump_lock();
+
+        const image_info info = this->receive_image(
+            _header,
+            [&image](const image_info& _info)
+            {
+                image->resize(_info.size, _info.type, _info.pixel_format);
+                return image->buffer();
+            });
+
+        image->set_spacing(info.spacing);
+        image->set_origin(info.origin);
+
+        if(sight::data::helper::medical_image::check_image_validity(image))
+        {
+            sight::data::helper::medical_image::check_image_slice_index(image);
         }
+
+        _timestamp = info.timestamp;
+        return image;
+    }
+
+    data::object::sptr obj;
+    ::igtl::MessageBase::Pointer msg = this->receive_body(_header);
+    if(msg.IsNotNull() && !this->read_capabilities(msg))
+    {
+        _timestamp = timestamp_in_ms(msg);
+
+        detail::data_converter::sptr converter = detail::data_converter::get_instance();
+        obj = converter->from_igtl_message(msg);
     }
 
     return obj;
@@ -137,6 +401,161 @@ data::object::sptr network::receive_object(std::string& _device_name, double& _t
 
 //------------------------------------------------------------------------------
 
+network::image_info network::receive_image(
+    const ::igtl::MessageHeader::Pointer& _header,
+    const image_allocator_t& _allocator
+)
+{
+    if(_header == nullptr || std::string(_header->GetDeviceType()) != "IMAGE")
+    {
+        throw sight::io::igtl::exception("Invalid image header message");
+    }
+
+    const std::uint64_t body_size = _header->GetBodySizeToRead();
+    if(body_size < IGTL_IMAGE_HEADER_SIZE)
+    {
+        throw sight::io::igtl::exception("Body pack is not valid");
+    }
+
+    std::array<std::uint8_t, IGTL_IMAGE_HEADER_SIZE> raw_header {};
+    this->receive_buffer(raw_header.data(), raw_header.size());
+
+    image_info info;
+    info.device_name = _header->GetDeviceName();
+    info.timestamp   = timestamp_in_ms(_header);
+
+    igtl_image_header image_header {};
+    std::memcpy(&image_header, raw_header.data(), raw_header.size());
+    igtl_image_convert_byte_order(&image_header);
+
+    bool whole_volume = image_header.version == IGTL_IMAGE_HEADER_VERSION;
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        whole_volume = whole_volume && image_header.subvol_offset[i] == 0
+                       && image_header.subvol_size[i] == image_header.size[i];
+    }
+
+    if(!whole_volume)
+    {
+        // Unpack the message as usual, the image header is already received
+        auto msg = ::igtl::ImageMessage::New();
+        msg->SetMessageHeader(_header);
+        msg->AllocatePack();
+        auto* const body = static_cast<std::uint8_t*>(msg->GetPackBodyPointer());
+        std::copy(raw_header.begin(), raw_header.end(), body);
+        this->receive_buffer(body + raw_header.size(), body_size - raw_header.size());
+
+        if(msg->Unpack(1) != ::igtl::MessageHeader::UNPACK_BODY)
+        {
+            throw sight::io::igtl::exception("Body pack is not valid");
+        }
+
+        detail::data_converter::sptr converter = detail::data_converter::get_instance();
+        const auto image = std::dynamic_pointer_cast<data::image>(
+            converter->from_igtl_message(::igtl::MessageBase::Pointer(msg.GetPointer()))
+        );
+        const auto dump_lock = image->dump_lock();
+
+        info.size          = image->size();
+        info.spacing       = image->spacing();
+        info.origin        = image->origin();
+        info.type          = image->type();
+        info.pixel_format  = image->pixel_format();
+        info.size_in_bytes = image->size_in_bytes();
+
+        auto* const dest = static_cast<std::uint8_t*>(_allocator(info));
+        const auto* const src = static_cast<const std::uint8_t*>(image->buffer());
+        std::copy(src, src + info.size_in_bytes, dest);
+        return info;
+    }
+
+    std::array<float, 3> spacing {};
+    std::array<float, 3> origin {};
+    std::array<float, 3> norm_i {};
+    std::array<float, 3> norm_j {};
+    std::array<float, 3> norm_k {};
+    igtl_image_get_matrix(spacing.data(), origin.data(), norm_i.data(), norm_j.data(), norm_k.data(), &image_header);
+
+    const std::size_t num_components = image_header.num_components;
+    info.type         = detail::image_type_converter::get_fw_tools_type(image_header.scalar_type);
+    info.pixel_format = pixel_format(num_components);
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        info.size[i]    = image_header.size[i];
+        info.spacing[i] = static_cast<double>(spacing[i]);
+        info.origin[i]  = static_cast<double>(origin[i]);
+    }
+
+    const std::size_t num_scalars = info.size[0] * info.size[1] * info.size[2] * num_components;
+    info.size_in_bytes = num_scalars * info.type.size();
+
+    if(body_size != IGTL_IMAGE_HEADER_SIZE + info.size_in_bytes)
+    {
+        throw sight::io::igtl::exception("Body pack is not valid");
+    }
+
+    auto* const pixels = static_cast<std::uint8_t*>(_allocator(info));
+    this->receive_buffer(pixels, info.size_in_bytes);
+
+    // The CRC is computed on the received bytes, before they are converted to the host byte order
+    std::uint64_t crc = crc64(nullptr, 0, 0LL);
+    crc = crc64(raw_header.data(), raw_header.size(), crc);
+    crc = crc64(pixels, info.size_in_bytes, crc);
+    if(crc != header_crc(_header))
+    {
+        throw sight::io::igtl::exception("Invalid CRC of the image message");
+    }
+
+    const bool little_endian = igtl_is_little_endian() != 0;
+    if((image_header.endian == IGTL_IMAGE_ENDIAN_LITTLE) != little_endian)
+    {
+        swap_bytes(pixels, num_scalars, info.type.size());
+    }
+
+    return info;
+}
+
+//------------------------------------------------------------------------------
+
+void network::receive_buffer(void* _buffer, std::size_t _size)
+{
+    auto* data = static_cast<char*>(_buffer);
+    while(_size > 0)
+    {
+        const int chunk  = static_cast<int>(std::min<std::size_t>(_size, INT_MAX));
+        const int result = m_socket->Receive(data, chunk);
+
+        if(result == -1) // Timeout
+        {
+            throw sight::io::igtl::exception("Network timeout");
+        }
+
+        if(result <= 0) // Error
+        {
+            throw sight::io::igtl::exception("Network Error");
+        }
+
+        data  += result;
+        _size -= static_cast<std::size_t>(result);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void network::set_image_allocation_policy(core::memory::buffer_allocation_policy::sptr _policy)
+{
+    m_image_allocation_policy = std::move(_policy);
+}
+
+//------------------------------------------------------------------------------
+
+core::memory::buffer_allocation_policy::sptr network::get_image_allocation_policy() const
+{
+    return m_image_allocation_policy;
+}
+
+//------------------------------------------------------------------------------
+
 ::igtl::MessageHeader::Pointer network::receive_header()
 {
     ::igtl::MessageHeader::Pointer header_msg = ::igtl::MessageHeader::New();
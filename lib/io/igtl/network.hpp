@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2014-2024 IRCAD France
+ * Copyright (C) 2014-2025 IRCAD France
  * Copyright (C) 2014-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -26,19 +26,36 @@
 // Patched header.
 #include "io/igtl/patch/igtlSocket.h"
 
+#include "io/igtl/image_compression.hpp"
+
 #include <core/exception.hpp>
+#include <core/memory/buffer_allocation_policy.hpp>
+#include <core/type.hpp>
 
+#include <data/image.hpp>
 #include <data/object.hpp>
 
 #include <igtlMessageHeader.h>
 #include <igtlSocket.h>
 
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
 #include <set>
 #include <string>
 
 namespace sight::io::igtl
 {
 
+namespace detail
+{
+
+class bandwidth_controller;
+
+} // namespace detail
+
 /**
  *
  * @brief a interface for client and server classes
@@ -47,6 +64,25 @@ class SIGHT_IO_IGTL_CLASS_API network
 {
 public:
 
+    /// Description of an image message, read from its header before its pixels are received
+    struct image_info
+    {
+        std::string device_name;
+        double timestamp {0.};
+        data::image::size_t size {0, 0, 0};
+        data::image::spacing_t spacing {1., 1., 1.};
+        data::image::origin_t origin {0., 0., 0.};
+        core::type type;
+        data::image::pixel_format_t pixel_format {data::image::pixel_format_t::gray_scale};
+        std::size_t size_in_bytes {0};
+    };
+
+    /// Returns the buffer where the pixels of the described image must be written, of at least size_in_bytes bytes
+    using image_allocator_t = std::function<void* (const image_info& _info)>;
+
+    /// Messages already encoded for one object, shared by the peers of a broadcast to encode each image only once
+    using encoded_messages_t = std::map<image_encoding, ::igtl::MessageBase::Pointer>;
+
     /**
      * @brief default constructor
      */
@@ -75,6 +111,50 @@ public:
      */
     SIGHT_IO_IGTL_API data::object::sptr receive_object(std::string& _device_name, double& _timestamp);
 
+    /**
+     * @brief receives the body of a message whose header was already received, and converts it to a sight object
+     *
+     * If an image allocation policy is set, IMAGE messages are decoded directly into the buffer of the returned image,
+     * which is allocated with that policy, instead of being unpacked in an intermediate igtl message and then copied.
+     *
+     * @param[in] _header header returned by receive_header()
+     * @param[out] _timestamp timestamp of the message, in milliseconds
+     * @throw igtl::exception on error (network error, timeout or corrupted message).
+     */
+    SIGHT_IO_IGTL_API data::object::sptr receive_object(
+        const ::igtl::MessageHeader::Pointer& _header,
+        double& _timestamp
+    );
+
+    /**
+     * @brief receives the body of an IMAGE message straight into a buffer provided by the caller
+     *
+     * The image header is read first, then _allocator is called with the image description and the pixels are read
+     * from the socket directly into the returned buffer. The CRC of the message is verified on the received bytes and
+     * the pixels are byte-swapped in place if the sender has a different endianness. Sub-volume messages, which are
+     * rare, are unpacked and copied into the buffer instead.
+     *
+     * @param[in] _header header of an IMAGE message returned by receive_header()
+     * @param[in] _allocator returns the destination buffer of the pixels
+     * @throw igtl::exception on error (network error, timeout, unsupported or corrupted message).
+     * @return the description of the received image
+     */
+    SIGHT_IO_IGTL_API image_info receive_image(
+        const ::igtl::MessageHeader::Pointer& _header,
+        const image_allocator_t& _allocator
+    );
+
+    /**
+     * @brief sets the policy used to allocate the images returned by receive_object()
+     *
+     * Use core::memory::buffer_pool_policy::get_default() to recycle the buffers of the images released by the
+     * application. A null policy restores the default path, where image messages are unpacked then copied.
+     */
+    SIGHT_IO_IGTL_API void set_image_allocation_policy(core::memory::buffer_allocation_policy::sptr _policy);
+
+    /// Returns the policy used to allocate the received images, null if they are unpacked then copied
+    [[nodiscard]] SIGHT_IO_IGTL_API core::memory::buffer_allocation_policy::sptr get_image_allocation_policy() const;
+
     /**
      * @brief generic method to send a object the type of object is determined by classname
      *        this method call the correct sender method. If the client is not connected you receive
@@ -83,6 +163,57 @@ public:
      */
     SIGHT_IO_IGTL_API bool send_object(const data::object::csptr& _dest);
 
+    /**
+     * @brief sends an object, reusing the compressed images already encoded for other peers
+     *
+     * If image compression is set and the peer announced it can decode compressed images, images are sent compressed
+     * with the encoding chosen for this peer. Otherwise, the object is sent as with send_object(_dest).
+     *
+     * @param[in] _dest object to send
+     * @param[in,out] _encoded compressed messages of _dest, the message encoded for this peer is added if missing
+     */
+    SIGHT_IO_IGTL_API bool send_object(const data::object::csptr& _dest, encoded_messages_t& _encoded);
+
+    /**
+     * @brief sets the compression of the images sent to the peer
+     *
+     * Images are only compressed once the peer announced, with a CAPABILITY message, that it can decode them, see
+     * send_capabilities(). Other peers keep receiving plain IMAGE messages. A null value disables compression.
+     */
+    SIGHT_IO_IGTL_API virtual void set_image_compression(std::optional<image_compression> _compression);
+
+    /// Returns the compression of the images sent to the peer
+    [[nodiscard]] SIGHT_IO_IGTL_API std::optional<image_compression> get_image_compression() const;
+
+    /// Returns the encoding of the next image sent to the peer, raw if it is sent uncompressed
+    [[nodiscard]] SIGHT_IO_IGTL_API image_encoding get_image_encoding();
+
+    /**
+     * @brief sends the message types this side can decode in a CAPABILITY message
+     * Sight senders with image compression enabled then send compressed images to this side.
+     */
+    SIGHT_IO_IGTL_API bool send_capabilities();
+
+    /**
+     * @brief returns true if the peer announced it can decode compressed images
+     * This checks, without waiting, for a CAPABILITY message sent by the peer. Other incoming messages are left in
+     * the socket, and the peer is considered unable to decode compressed images if its first message is another one.
+     * This reads the socket, so it must not be called while another thread receives messages from the same peer.
+     */
+    SIGHT_IO_IGTL_API bool peer_supports_compression();
+
+    /**
+     * @brief sets whether sending images checks the socket for a CAPABILITY message, see peer_supports_compression()
+     * Disable it when another thread receives the messages of the peer, and passes them to read_capabilities().
+     */
+    inline void set_probe_capabilities(bool _probe);
+
+    /**
+     * @brief records the capabilities of the peer if the message is a CAPABILITY message
+     * @return true if the message was a CAPABILITY message, which does not carry any object
+     */
+    SIGHT_IO_IGTL_API bool read_capabilities(const ::igtl::MessageBase::Pointer& _msg);
+
     /**
      * @brief generic method to send a igtl Msg, this method is useful for redirect message
      * @param[in] _msg message to send
@@ -162,6 +293,18 @@ protected:
     /// Patched version: Doesn't rely on VTK_HAVE_SO_REUSEADDR to add option SO_REUSEADDR.
     static int bind_socket(int _socket_descriptor, std::uint16_t _port);
 
+    /// Receives exactly _size bytes in _buffer
+    /// @throw igtl::exception on error (network error or timeout).
+    void receive_buffer(void* _buffer, std::size_t _size);
+
+    /// What the peer announced it can decode
+    enum class peer_capabilities : std::uint8_t
+    {
+        unknown,
+        compression,
+        none
+    };
+
     /// client socket
     ::igtl::Socket::Pointer m_socket;
 
@@ -173,6 +316,28 @@ protected:
 
     /// device name in the sent message
     std::string m_device_name_out;
+
+    /// Policy used to allocate the received images, null to unpack then copy them
+    core::memory::buffer_allocation_policy::sptr m_image_allocation_policy;
+
+    /// Compression of the sent images
+    std::optional<image_compression> m_image_compression;
+
+    /// Chooses the encoding of the sent images
+    std::unique_ptr<detail::bandwidth_controller> m_bandwidth_controller;
+
+    /// Capabilities announced by the peer, reset when a new connection is made
+    std::atomic<peer_capabilities> m_peer_capabilities {peer_capabilities::unknown};
+
+    /// Whether sending images reads the socket to find the capabilities of the peer
+    bool m_probe_capabilities {true};
 };
 
+//------------------------------------------------------------------------------
+
+inline void network::set_probe_capabilities(bool _probe)
+{
+    m_probe_capabilities = _probe;
+}
+
 } // namespace sight::io::igtl
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2014-2023 IRCAD France
+ * Copyright (C) 2014-2025 IRCAD France
  * Copyright (C) 2014-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -85,6 +85,14 @@ void server::run_server()
                 new_client->get_socket()->SetReceiveTimeout(static_cast<int>(m_receive_timeout.value()));
             }
 
+            // The socket of the client is only read under the mutex, by the receiving thread or by broadcast()
+            new_client->set_probe_capabilities(false);
+            new_client->set_image_compression(m_image_compression);
+            if(m_advertise_capabilities)
+            {
+                new_client->send_capabilities();
+            }
+
             m_clients.push_back(new_client);
         }
     }
@@ -95,10 +103,21 @@ void server::run_server()
 void server::broadcast(const data::object::csptr& _obj)
 {
     std::vector<client::sptr>::iterator it;
+    network::encoded_messages_t encoded;
 
     for(it = m_clients.begin() ; it != m_clients.end() ; )
     {
-        if(!(*it)->send_object(_obj))
+        if(m_image_compression.has_value())
+        {
+            // Look for the capabilities of the client, unless a receiving thread is already reading its socket
+            core::mt::scoped_lock lock(m_mutex, boost::try_to_lock);
+            if(lock.owns_lock())
+            {
+                (*it)->peer_supports_compression();
+            }
+        }
+
+        if(!(*it)->send_object(_obj, encoded))
         {
             core::mt::scoped_lock lock(m_mutex);
             (*it)->disconnect();
@@ -113,6 +132,19 @@ void server::broadcast(const data::object::csptr& _obj)
 
 //------------------------------------------------------------------------------
 
+void server::set_image_compression(std::optional<image_compression> _compression)
+{
+    network::set_image_compression(_compression);
+
+    core::mt::scoped_lock lock(m_mutex);
+    for(const auto& client : m_clients)
+    {
+        client->set_image_compression(_compression);
+    }
+}
+
+//------------------------------------------------------------------------------
+
 void server::broadcast(::igtl::MessageBase::Pointer _msg)
 {
     std::vector<client::sptr>::iterator it;
@@ -353,7 +385,7 @@ std::vector<data::object::sptr> server::receive_objects(std::vector<std::string>
         if(header_msg.IsNotNull())
         {
             ::igtl::MessageBase::Pointer msg = this->receive_body(header_msg, std::uint32_t(client));
-            if(msg.IsNotNull())
+            if(msg.IsNotNull() && !this->read_client_capabilities(msg, client))
             {
                 detail::data_converter::sptr converter = detail::data_converter::get_instance();
                 obj_vect.push_back(converter->from_igtl_message(msg));
@@ -369,6 +401,14 @@ std::vector<data::object::sptr> server::receive_objects(std::vector<std::string>
 
 //------------------------------------------------------------------------------
 
+bool server::read_client_capabilities(const ::igtl::MessageBase::Pointer& _msg, std::size_t _client)
+{
+    core::mt::scoped_lock lock(m_mutex);
+    return _client < m_clients.size() && m_clients[_client]->read_capabilities(_msg);
+}
+
+//------------------------------------------------------------------------------
+
 void server::set_message_device_name(const std::string& _device_name)
 {
     for(const auto& client : m_clients)
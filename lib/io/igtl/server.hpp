@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2014-2024 IRCAD France
+ * Copyright (C) 2014-2025 IRCAD France
  * Copyright (C) 2014-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -87,6 +87,7 @@ public:
 
     /**
      * @brief method to broadcast to all client the obj
+     * The object is converted once, and images are compressed once per encoding used by the clients.
      */
     SIGHT_IO_IGTL_API void broadcast(const data::object::csptr& _obj);
 
@@ -149,6 +150,13 @@ public:
     /// Gets the current receive timeout.
     inline std::optional<int> get_receive_timeout() const;
 
+    /// Sets the compression of the images sent to the connected and future clients.
+    /// The encoding adapts to the bandwidth of each client separately.
+    SIGHT_IO_IGTL_API void set_image_compression(std::optional<image_compression> _compression) override;
+
+    /// Sends a CAPABILITY message to each new client, so that Sight clients compress the images they send
+    inline void set_advertise_capabilities(bool _advertise);
+
 private:
 
     /// Patched version of igtlServer::CreateServer.
@@ -156,6 +164,9 @@ private:
 
     static void remove_client(client::sptr _client);
 
+    /// Records the capabilities announced by a client, returns false if the message is not a CAPABILITY message
+    bool read_client_capabilities(const ::igtl::MessageBase::Pointer& _msg, std::size_t _client);
+
     /// server socket
     ::igtl::ServerSocket::Pointer m_server_socket;
 
@@ -179,6 +190,9 @@ private:
 
     /// Optional timeout for receiving message from clients
     std::optional<unsigned int> m_receive_timeout;
+
+    /// Whether the capabilities are sent to new clients
+    bool m_advertise_capabilities {false};
 };
 
 //------------------------------------------------------------------------------
@@ -195,4 +209,11 @@ inline std::optional<int> server::get_receive_timeout() const
     return m_receive_timeout;
 }
 
+//------------------------------------------------------------------------------
+
+inline void server::set_advertise_capabilities(bool _advertise)
+{
+    m_advertise_capabilities = _advertise;
+}
+
 } // namespace sight::io::igtl
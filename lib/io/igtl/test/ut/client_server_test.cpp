@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2022-2023 IRCAD France
+ * Copyright (C) 2022-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -21,14 +21,27 @@
 
 #include "client_server_test.hpp"
 
+#include <core/memory/buffer_allocation_policy.hpp>
+#include <core/profiling.hpp>
+#include <core/spy_log.hpp>
+
+#include <data/image.hpp>
+
 #include <io/igtl/client.hpp>
+#include <io/igtl/detail/data_converter.hpp>
+#include <io/igtl/detail/image_compressor.hpp>
 #include <io/igtl/detail/message_factory.hpp>
 #include <io/igtl/exception.hpp>
 #include <io/igtl/server.hpp>
 
+#include <utest_data/generator/image.hpp>
+
 #include <igtlStringMessage.h>
 
+#include <chrono>
+#include <cstring>
 #include <thread>
+#include <utility>
 
 CPPUNIT_TEST_SUITE_REGISTRATION(sight::io::igtl::ut::client_server_test);
 
@@ -309,4 +322,254 @@ void client_server_test::server_body_exception_test()
 
 //------------------------------------------------------------------------------
 
+void client_server_test::receive_image_test()
+{
+    auto image = std::make_shared<data::image>();
+    utest_data::generator::image::generate_image(
+        image,
+        {61, 37, 3},
+        {0.5, 0.25, 2.},
+        {1., -2., 3.},
+        {1, 0, 0, 0, 1, 0, 0, 0, 1},
+        core::type::INT16,
+        data::image::pixel_format_t::gray_scale,
+        0
+    );
+    const auto dump_lock = image->dump_lock();
+
+    // Image decoded directly in a pooled buffer
+    const auto pool = core::memory::buffer_pool_policy::get_default();
+    s_client->set_image_allocation_policy(pool);
+    CPPUNIT_ASSERT(s_client->get_image_allocation_policy() == pool);
+
+    s_server->broadcast(image);
+
+    std::string device_name;
+    double timestamp = 0.;
+    data::object::sptr obj;
+    CPPUNIT_ASSERT_NO_THROW(obj = s_client->receive_object(device_name, timestamp));
+    CPPUNIT_ASSERT_EQUAL(std::string("Sight_Tests_Server"), device_name);
+
+    const auto received = std::dynamic_pointer_cast<data::image>(obj);
+    CPPUNIT_ASSERT(received);
+    CPPUNIT_ASSERT(received->get_allocation_policy() == pool);
+    CPPUNIT_ASSERT(image->size() == received->size());
+    CPPUNIT_ASSERT_EQUAL(image->type(), received->type());
+    CPPUNIT_ASSERT_EQUAL(image->pixel_format(), received->pixel_format());
+    CPPUNIT_ASSERT(image->spacing() == received->spacing());
+    CPPUNIT_ASSERT(image->origin() == received->origin());
+
+    const auto received_lock = received->dump_lock();
+    CPPUNIT_ASSERT_EQUAL(image->size_in_bytes(), received->size_in_bytes());
+    CPPUNIT_ASSERT(std::memcmp(image->buffer(), received->buffer(), image->size_in_bytes()) == 0);
+
+    // Image decoded in a buffer of the caller
+    s_server->broadcast(image);
+
+    ::igtl::MessageHeader::Pointer header;
+    CPPUNIT_ASSERT_NO_THROW(header = s_client->receive_header());
+    CPPUNIT_ASSERT(header);
+
+    std::vector<std::uint8_t> pixels;
+    client::image_info info;
+    CPPUNIT_ASSERT_NO_THROW(
+        info = s_client->receive_image(
+            header,
+            [&pixels](const client::image_info& _info)
+            {
+                pixels.resize(_info.size_in_bytes);
+                return pixels.data();
+            })
+    );
+    CPPUNIT_ASSERT_EQUAL(std::string("Sight_Tests_Server"), info.device_name);
+    CPPUNIT_ASSERT(image->size() == info.size);
+    CPPUNIT_ASSERT_EQUAL(image->type(), info.type);
+    CPPUNIT_ASSERT_EQUAL(image->size_in_bytes(), pixels.size());
+    CPPUNIT_ASSERT(std::memcmp(image->buffer(), pixels.data(), pixels.size()) == 0);
+
+    // Other messages still go through the converters
+    ::igtl::StringMessage::Pointer string_msg = ::igtl::StringMessage::New();
+    string_msg->SetString("Hello from server!");
+    s_server->broadcast(static_cast< ::igtl::MessageBase::Pointer>(string_msg));
+    CPPUNIT_ASSERT_NO_THROW(obj = s_client->receive_object(device_name));
+    CPPUNIT_ASSERT(obj);
+    CPPUNIT_ASSERT(!std::dynamic_pointer_cast<data::image>(obj));
+}
+
+//------------------------------------------------------------------------------
+
+void client_server_test::receive_image_benchmark()
+{
+    static constexpr std::size_t s_FRAMES = 200;
+
+    // One 720p RGB video frame, converted once so that the sender only packs the message
+    auto image = std::make_shared<data::image>();
+    utest_data::generator::image::generate_image(
+        image,
+        {1280, 720, 1},
+        {1., 1., 1.},
+        {0., 0., 0.},
+        {1, 0, 0, 0, 1, 0, 0, 0, 1},
+        core::type::UINT8,
+        data::image::pixel_format_t::rgb,
+        0
+    );
+    const ::igtl::MessageBase::Pointer msg = detail::data_converter::get_instance()->from_fw_object(image);
+
+    const auto receive_all =
+        [&msg](const core::memory::buffer_allocation_policy::sptr& _policy)
+        {
+            s_client->set_image_allocation_policy(_policy);
+
+            auto sender = std::async(
+                std::launch::async,
+                [&msg]
+                {
+                    for(std::size_t i = 0 ; i < s_FRAMES ; ++i)
+                    {
+                        s_server->broadcast(msg);
+                    }
+                });
+
+            {
+                FW_PROFILE(_policy ? "Loopback reception, zero-copy into pooled buffers" : "Loopback reception, copy");
+                data::object::sptr last;
+                for(std::size_t i = 0 ; i < s_FRAMES ; ++i)
+                {
+                    // Releasing the previous frame lets the pool recycle its buffer
+                    std::string device_name;
+                    last = s_client->receive_object(device_name);
+                    CPPUNIT_ASSERT(std::dynamic_pointer_cast<data::image>(last));
+                }
+            }
+
+            sender.wait();
+        };
+
+    receive_all(nullptr);
+    receive_all(core::memory::buffer_pool_policy::get_default());
+}
+
+//------------------------------------------------------------------------------
+
+void client_server_test::compression_negotiation_test()
+{
+    auto image = std::make_shared<data::image>();
+    utest_data::generator::image::generate_image(
+        image,
+        {64, 48, 1},
+        {1., 1., 1.},
+        {0., 0., 0.},
+        {1, 0, 0, 0, 1, 0, 0, 0, 1},
+        core::type::UINT8,
+        data::image::pixel_format_t::rgb,
+        0
+    );
+    const auto dump_lock = image->dump_lock();
+
+    s_server->set_image_compression(image_compression {});
+
+    const auto receive_image =
+        [&image](const std::string& _expected_type)
+        {
+            ::igtl::MessageHeader::Pointer header;
+            CPPUNIT_ASSERT_NO_THROW(header = s_client->receive_header());
+            CPPUNIT_ASSERT(header);
+            CPPUNIT_ASSERT_EQUAL(_expected_type, std::string(header->GetDeviceType()));
+
+            double timestamp = 0.;
+            const auto received =
+                std::dynamic_pointer_cast<data::image>(s_client->receive_object(header, timestamp));
+            CPPUNIT_ASSERT(received);
+            CPPUNIT_ASSERT(image->size() == received->size());
+            CPPUNIT_ASSERT_EQUAL(image->pixel_format(), received->pixel_format());
+
+            const auto received_lock = received->dump_lock();
+            CPPUNIT_ASSERT(std::memcmp(image->buffer(), received->buffer(), image->size_in_bytes()) == 0);
+        };
+
+    // The client did not announce anything yet, so it may be a third-party application expecting IMAGE messages
+    s_server->broadcast(image);
+    receive_image("IMAGE");
+
+    // Once the client announced it can decode compressed images, they are sent compressed
+    CPPUNIT_ASSERT(s_client->send_capabilities());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    s_server->broadcast(image);
+    receive_image(std::string(detail::image_compressor::IGTL_TYPE));
+
+    // Disabling the compression restores the plain messages
+    s_server->set_image_compression(std::nullopt);
+    s_server->broadcast(image);
+    receive_image("IMAGE");
+}
+
+//------------------------------------------------------------------------------
+
+void client_server_test::compression_benchmark()
+{
+    static constexpr std::size_t s_FRAMES = 100;
+
+    // One smooth 720p RGB video frame, closer to endoscopic or ultrasound frames than random values
+    auto image = std::make_shared<data::image>();
+    image->resize({1280, 720, 1}, core::type::UINT8, data::image::pixel_format_t::rgb);
+    {
+        const auto dump_lock = image->dump_lock();
+        auto* const buffer   = static_cast<std::uint8_t*>(image->buffer());
+        for(std::size_t i = 0 ; i < image->size_in_bytes() ; ++i)
+        {
+            const std::size_t x = (i / 3) % 1280;
+            const std::size_t y = i / (3 * 1280);
+            buffer[i] = std::uint8_t((x + y * (i % 3 + 1)) / 8 + (x * y) % 3);
+        }
+    }
+
+    CPPUNIT_ASSERT(s_client->send_capabilities());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    for(const auto& [encoding, label] : {
+        std::pair {image_encoding {.codec = image_codec::raw, .level = 0}, "Loopback sending, raw"},
+        std::pair {image_encoding {.codec = image_codec::zstd, .level = -5}, "Loopback sending, zstd -5"},
+        std::pair {image_encoding {.codec = image_codec::zstd, .level = 1}, "Loopback sending, zstd 1"},
+        std::pair {image_encoding {.codec = image_codec::zstd, .level = 9}, "Loopback sending, zstd 9"},
+        std::pair {image_encoding {.codec = image_codec::jpeg, .level = 90}, "Loopback sending, jpeg 90"}
+    })
+    {
+        image_compression compression;
+        compression.encoding = encoding;
+        s_server->set_image_compression(compression);
+
+        const std::size_t bytes = encoding.codec == image_codec::raw
+                                  ? image->size_in_bytes()
+                                  : detail::image_compressor::encode(image, encoding)->get_message().size();
+
+        auto sender = std::async(
+            std::launch::async,
+            [&image]
+            {
+                for(std::size_t i = 0 ; i < s_FRAMES ; ++i)
+                {
+                    s_server->broadcast(image);
+                }
+            });
+
+        // The time covers the encoding, the transfer and the decoding, pipelined between both threads
+        {
+            FW_PROFILE(label);
+            for(std::size_t i = 0 ; i < s_FRAMES ; ++i)
+            {
+                std::string device_name;
+                CPPUNIT_ASSERT(std::dynamic_pointer_cast<data::image>(s_client->receive_object(device_name)));
+            }
+        }
+
+        sender.wait();
+
+        SIGHT_INFO(label << ": " << double(bytes) / 1e6 << " MB per frame");
+    }
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace sight::io::igtl::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2022-2023 IRCAD France
+ * Copyright (C) 2022-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -36,6 +36,10 @@ CPPUNIT_TEST(client_header_exception_test);
 CPPUNIT_TEST(server_header_exception_test);
 CPPUNIT_TEST(client_body_exception_test);
 CPPUNIT_TEST(server_body_exception_test);
+CPPUNIT_TEST(receive_image_test);
+CPPUNIT_TEST(receive_image_benchmark);
+CPPUNIT_TEST(compression_negotiation_test);
+CPPUNIT_TEST(compression_benchmark);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -49,6 +53,10 @@ public:
     static void server_header_exception_test();
     static void client_body_exception_test();
     static void server_body_exception_test();
+    static void receive_image_test();
+    static void receive_image_benchmark();
+    static void compression_negotiation_test();
+    static void compression_benchmark();
 };
 
 } // namespace sight::io::igtl::ut
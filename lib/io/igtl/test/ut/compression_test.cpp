@@ -0,0 +1,322 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "compression_test.hpp"
+
+#include <data/image.hpp>
+
+#include <io/igtl/detail/bandwidth_controller.hpp>
+#include <io/igtl/detail/data_converter.hpp>
+#include <io/igtl/detail/image_compressor.hpp>
+#include <io/igtl/exception.hpp>
+
+#include <utest_data/generator/image.hpp>
+
+#include <igtlCapabilityMessage.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::io::igtl::detail::ut::compression_test);
+
+namespace sight::io::igtl::detail::ut
+{
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+
+/// Creates a smooth 8-bit image, that JPEG compresses well
+data::image::sptr gradient_image(const data::image::size_t& _size, data::image::pixel_format_t _format)
+{
+    auto image = std::make_shared<data::image>();
+    image->resize(_size, core::type::UINT8, _format);
+    image->set_spacing({0.5, 0.25, 1.});
+    image->set_origin({1., -2., 0.});
+
+    const auto dump_lock         = image->dump_lock();
+    auto* const buffer           = static_cast<std::uint8_t*>(image->buffer());
+    const std::size_t components = image->num_components();
+    for(std::size_t y = 0 ; y < _size[1] ; ++y)
+    {
+        for(std::size_t x = 0 ; x < _size[0] ; ++x)
+        {
+            for(std::size_t c = 0 ; c < components ; ++c)
+            {
+                buffer[(y * _size[0] + x) * components + c] = std::uint8_t((x * (c + 1) + y) / 4);
+            }
+        }
+    }
+
+    return image;
+}
+
+//------------------------------------------------------------------------------
+
+/// Checks that the geometry and the pixels of two images are equal
+void compare_images(const data::image& _expected, const data::image& _actual)
+{
+    CPPUNIT_ASSERT(_expected.size() == _actual.size());
+    CPPUNIT_ASSERT_EQUAL(_expected.type(), _actual.type());
+    CPPUNIT_ASSERT_EQUAL(_expected.pixel_format(), _actual.pixel_format());
+    CPPUNIT_ASSERT(_expected.spacing() == _actual.spacing());
+    CPPUNIT_ASSERT(_expected.origin() == _actual.origin());
+
+    const auto expected_lock = _expected.dump_lock();
+    const auto actual_lock   = _actual.dump_lock();
+    CPPUNIT_ASSERT_EQUAL(_expected.size_in_bytes(), _actual.size_in_bytes());
+    CPPUNIT_ASSERT(std::memcmp(_expected.buffer(), _actual.buffer(), _expected.size_in_bytes()) == 0);
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+void compression_test::setUp()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void compression_test::tearDown()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void compression_test::lossless_round_trip_test()
+{
+    auto image = std::make_shared<data::image>();
+    utest_data::generator::image::generate_image(
+        image,
+        {61, 37, 3},
+        {0.5, 0.25, 2.},
+        {1., -2., 3.},
+        {1, 0, 0, 0, 1, 0, 0, 0, 1},
+        core::type::INT16,
+        data::image::pixel_format_t::gray_scale,
+        0
+    );
+
+    for(const image_encoding encoding : {
+        image_encoding {.codec = image_codec::raw, .level = 0},
+        image_encoding {.codec = image_codec::zstd, .level = -5},
+        image_encoding {.codec = image_codec::zstd, .level = 9},
+        // JPEG does not support 16-bit images, they are compressed losslessly instead
+        image_encoding {.codec = image_codec::jpeg, .level = 90}
+    })
+    {
+        const raw_message::Pointer msg = image_compressor::encode(image, encoding);
+        CPPUNIT_ASSERT_EQUAL(std::string(image_compressor::IGTL_TYPE), std::string(msg->GetDeviceType()));
+
+        const data::image::sptr decoded = image_compressor::decode(msg->get_message());
+        CPPUNIT_ASSERT(decoded);
+        compare_images(*image, *decoded);
+    }
+
+    // A smooth image is smaller once compressed
+    const auto gradient = gradient_image({256, 256, 1}, data::image::pixel_format_t::rgb);
+    const auto raw_size = image_compressor::encode(gradient, {.codec = image_codec::raw, .level = 0})
+                          ->get_message().size();
+    const auto zstd_size = image_compressor::encode(gradient, {.codec = image_codec::zstd, .level = 1})
+                           ->get_message().size();
+    CPPUNIT_ASSERT_GREATER(gradient->size_in_bytes(), raw_size);
+    CPPUNIT_ASSERT_LESS(raw_size / 2, zstd_size);
+
+    // Truncated messages are rejected
+    auto truncated = image_compressor::encode(gradient, {.codec = image_codec::zstd, .level = 1})->get_message();
+    truncated.resize(truncated.size() / 2);
+    CPPUNIT_ASSERT_THROW(image_compressor::decode(truncated), sight::io::igtl::exception);
+
+    // Headers that do not describe the sent pixels are rejected before any pixel is copied
+    const auto raw = image_compressor::encode(gradient, {.codec = image_codec::raw, .level = 0})->get_message();
+    for(const auto& [offset, value] : std::vector<std::pair<std::size_t, std::uint8_t> > {
+        {2, std::uint8_t(data::image::pixel_format_t::undefined)},
+        {2, std::uint8_t(data::image::pixel_format_t::count)},
+        {2, std::uint8_t(data::image::pixel_format_t::rgba)},
+        {3, 0xFF},
+        {5, std::uint8_t(raw[5] ^ 0x10)}
+    })
+    {
+        auto forged    = raw;
+        forged[offset] = char(value);
+        CPPUNIT_ASSERT_THROW(image_compressor::decode(forged), sight::io::igtl::exception);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void compression_test::jpeg_test()
+{
+    for(const auto format : {data::image::pixel_format_t::rgb, data::image::pixel_format_t::gray_scale})
+    {
+        const auto image = gradient_image({320, 240, 1}, format);
+        CPPUNIT_ASSERT(image_compressor::supports(*image, image_codec::jpeg));
+
+        const auto msg = image_compressor::encode(image, {.codec = image_codec::jpeg, .level = 90});
+        CPPUNIT_ASSERT_LESS(image->size_in_bytes() / 4, msg->get_message().size());
+
+        const data::image::sptr decoded = image_compressor::decode(msg->get_message());
+        CPPUNIT_ASSERT(decoded);
+        CPPUNIT_ASSERT(image->size() == decoded->size());
+        CPPUNIT_ASSERT_EQUAL(image->type(), decoded->type());
+        CPPUNIT_ASSERT_EQUAL(image->pixel_format(), decoded->pixel_format());
+        CPPUNIT_ASSERT(image->spacing() == decoded->spacing());
+
+        // Lossy, but close to the original
+        const auto image_lock   = image->dump_lock();
+        const auto decoded_lock = decoded->dump_lock();
+        const auto* const expected = static_cast<const std::uint8_t*>(image->buffer());
+        const auto* const actual   = static_cast<const std::uint8_t*>(decoded->buffer());
+        double error               = 0.;
+        for(std::size_t i = 0 ; i < image->size_in_bytes() ; ++i)
+        {
+            error += std::abs(double(expected[i]) - double(actual[i]));
+        }
+
+        CPPUNIT_ASSERT_LESS(2., error / double(image->size_in_bytes()));
+    }
+
+    // Only 8-bit 2D images are supported
+    const auto volume = gradient_image({8, 8, 4}, data::image::pixel_format_t::rgb);
+    CPPUNIT_ASSERT(!image_compressor::supports(*volume, image_codec::jpeg));
+    const auto rgba = gradient_image({8, 8, 1}, data::image::pixel_format_t::rgba);
+    CPPUNIT_ASSERT(!image_compressor::supports(*rgba, image_codec::jpeg));
+}
+
+//------------------------------------------------------------------------------
+
+void compression_test::converter_test()
+{
+    const auto image = gradient_image({64, 48, 1}, data::image::pixel_format_t::rgb);
+
+    const ::igtl::MessageBase::Pointer msg = image_compressor::encode(image, {.codec = image_codec::zstd, .level = 3});
+
+    const auto converter = data_converter::get_instance();
+    const auto decoded   = std::dynamic_pointer_cast<data::image>(converter->from_igtl_message(msg));
+    CPPUNIT_ASSERT(decoded);
+    compare_images(*image, *decoded);
+
+    // The receivers announce the compressed images in their capabilities
+    const ::igtl::MessageBase::Pointer capabilities_msg = converter->get_capabilities_message();
+    auto* const capabilities = dynamic_cast< ::igtl::CapabilityMessage*>(capabilities_msg.GetPointer());
+    CPPUNIT_ASSERT(capabilities != nullptr);
+
+    bool found = false;
+    for(int i = 0 ; i < capabilities->GetNumberOfTypes() ; ++i)
+    {
+        found = found || capabilities->GetType(i) == image_compressor::IGTL_TYPE;
+    }
+
+    CPPUNIT_ASSERT(found);
+}
+
+//------------------------------------------------------------------------------
+
+void compression_test::fixed_encoding_test()
+{
+    const image_compression settings {
+        .encoding  = {.codec = image_codec::zstd, .level = 7},
+        .bandwidth = std::nullopt,
+        .lossy     = false
+    };
+    bandwidth_controller controller(settings);
+
+    // Without target bandwidth, the configured encoding is always used
+    auto now = bandwidth_controller::clock_t::time_point {};
+    for(std::size_t i = 0 ; i < 100 ; ++i)
+    {
+        controller.update(std::size_t(1) << 30U, now, now + std::chrono::milliseconds(90));
+        now += std::chrono::milliseconds(100);
+        CPPUNIT_ASSERT(settings.encoding == controller.encoding());
+    }
+
+    // Lossy encodings are only in the ladder when allowed
+    CPPUNIT_ASSERT(
+        std::none_of(
+            controller.ladder().begin(),
+            controller.ladder().end(),
+            [](const image_encoding& _e){return _e.codec == image_codec::jpeg;})
+    );
+}
+
+//------------------------------------------------------------------------------
+
+void compression_test::bandwidth_adaptation_test()
+{
+    using namespace std::chrono_literals;
+
+    const image_compression settings {
+        .encoding  = {.codec = image_codec::zstd, .level = 1},
+        .bandwidth = 1e6,
+        .lossy     = true
+    };
+    bandwidth_controller controller(settings);
+    CPPUNIT_ASSERT(settings.encoding == controller.encoding());
+
+    const auto& ladder = controller.ladder();
+    CPPUNIT_ASSERT(ladder.front() == (image_encoding {.codec = image_codec::raw, .level = 0}));
+    CPPUNIT_ASSERT_EQUAL(image_codec::jpeg, ladder.back().codec);
+
+    // Sends one measurement window of four frames, 100 ms apart
+    auto now               = bandwidth_controller::clock_t::time_point {};
+    const auto send_window =
+        [&](std::size_t _bytes, bandwidth_controller::clock_t::duration _blocked)
+        {
+            for(std::size_t i = 0 ; i < 4 ; ++i)
+            {
+                controller.update(_bytes, now, now + _blocked);
+                now += 100ms;
+            }
+        };
+
+    // Over the target: each window moves to a smaller encoding, down to the last one
+    send_window(1'000'000, 10ms);
+    CPPUNIT_ASSERT(ladder[3] == controller.encoding());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(4e6 / 0.31, controller.rate(), 1.);
+    for(std::size_t i = 0 ; i < ladder.size() ; ++i)
+    {
+        send_window(1'000'000, 10ms);
+    }
+
+    CPPUNIT_ASSERT(ladder.back() == controller.encoding());
+
+    // Well below the target: each window moves to a cheaper encoding, up to sending raw images
+    for(std::size_t i = 0 ; i < ladder.size() ; ++i)
+    {
+        send_window(1'000, 1ms);
+    }
+
+    CPPUNIT_ASSERT(ladder.front() == controller.encoding());
+
+    // Blocked in the socket most of the time: the link is congested even if the rate is low
+    send_window(1'000, 90ms);
+    CPPUNIT_ASSERT(ladder[1] == controller.encoding());
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::io::igtl::detail::ut
@@ -0,0 +1,51 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+namespace sight::io::igtl::detail::ut
+{
+
+class compression_test : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(compression_test);
+CPPUNIT_TEST(lossless_round_trip_test);
+CPPUNIT_TEST(jpeg_test);
+CPPUNIT_TEST(converter_test);
+CPPUNIT_TEST(fixed_encoding_test);
+CPPUNIT_TEST(bandwidth_adaptation_test);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    void setUp() override;
+    void tearDown() override;
+
+    static void lossless_round_trip_test();
+    static void jpeg_test();
+    static void converter_test();
+    static void fixed_encoding_test();
+    static void bandwidth_adaptation_test();
+};
+
+} // namespace sight::io::igtl::detail::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -27,6 +27,9 @@
 #include <core/exception.hpp>
 #include <core/spy_log.hpp>
 
+#include <io/__/reader/parallel_gz_reader.hpp>
+#include <io/__/writer/parallel_gz_writer.hpp>
+
 #include <boost/lexical_cast.hpp>
 
 #include <itk_zlib.h>
@@ -354,68 +357,17 @@ void inr_image_io::ReadImageInformation()
 
 void inr_image_io::Read(void* _buffer)
 {
-    using namespace std::literals::string_literals;
-
-    gzFile file = gzopen(GetFileName(), "rb");
-
-    if(file == nullptr)
-    {
-        throw ExceptionObject(__FILE__, __LINE__, "INR file "s + GetFileName() + " could not be read");
-    }
-
-    // Skip the header
-    int bytes_skipped = int(gzseek(file, m_header_size, SEEK_CUR));
-    if(bytes_skipped != m_header_size)
-    {
-        throw ExceptionObject(
-                  __FILE__,
-                  __LINE__,
-                  "INR file "s + GetFileName() + " could not be read (header size : " + std::to_string(
-                      bytes_skipped
-                  ) + "/" + std::to_string(m_header_size) + ")."
-        );
-    }
-
-    // And read the buffer
-
-    // Replace this line :
-    //int bytesRead = gzread(file, buffer, GetImageSizeInBytes());
-    // by
-    int bytes_read    = 0;
-    int nb_step       = 10;
-    std::int64_t size = ((GetImageSizeInBytes() > 1024LL * 1024 * 10)
-                         ? (GetImageSizeInBytes() / nb_step) + 1
-                         : GetImageSizeInBytes());
-
-    try
-    {
-        int step = 0;
-
-        while(bytes_read < GetImageSizeInBytes() && step < nb_step)
+    // Decompress the image straight into the buffer, in parallel if the file was written by this class. This throws
+    // core::exception if the file can not be read or if the progress bar is canceled.
+    const sight::io::reader::parallel_gz_reader reader(GetFileName());
+    reader.read(
+        std::size_t(m_header_size),
+        _buffer,
+        std::size_t(GetImageSizeInBytes()),
+        [this](double _ratio)
         {
-            step++;
-            UpdateProgress(((float) bytes_read) / float(GetImageSizeInBytes()));
-            bytes_read +=
-                gzread(
-                    file,
-                    reinterpret_cast<char*>(_buffer) + bytes_read,
-                    std::uint32_t(std::min(size, GetImageSizeInBytes() - bytes_read))
-                );
-        }
-    }
-    catch(sight::core::exception& /*e*/) // catch progress bar cancel exception
-    {
-        gzclose(file);
-        throw;
-    }
-    UpdateProgress(1.0);
-    // End replace
-
-    if(bytes_read != GetImageSizeInBytes())
-    {
-        gzclose(file);
-        throw ExceptionObject(__FILE__, __LINE__, "INR file "s + GetFileName() + " could not be read");
-    }
+            UpdateProgress(float(_ratio));
+        });
 
     const auto image_size_in_components = std::size_t(GetImageSizeInComponents());
 
@@ -495,7 +447,6 @@ void inr_image_io::Read(void* _buffer)
                 break;
 
             default:
-                gzclose(file);
                 throw ExceptionObject(__FILE__, __LINE__, "Pixel Type Unknown");
         }
     }
@@ -574,12 +525,9 @@ void inr_image_io::Read(void* _buffer)
                 break;
 
             default:
-                gzclose(file);
                 throw ExceptionObject(__FILE__, __LINE__, "Pixel Type Unknown");
         }
     }
-
-    gzclose(file);
 }
 
 //------------------------------------------------------------------------------
@@ -710,19 +658,9 @@ void inr_image_io::WriteImageInformation()
 
     if(index == filename.length() - std::string(".inr.gz").length())
     {
-        gzFile output_file = gzopen(this->GetFileName(), "wb9");
-        if(output_file == nullptr)
-        {
-            throw ExceptionObject(
-                      __FILE__,
-                      __LINE__,
-                      "File "s + GetFileName() + " could not be written : error writing header."
-            );
-        }
-
-        std::string header_string = header_stream.str();
-        gzwrite(output_file, header_string.c_str(), std::uint32_t(header_string.length()));
-        gzclose(output_file);
+        // The header is compressed in its own gzip member, so it can be skipped without decompressing the image
+        sight::io::writer::parallel_gz_writer writer(this->GetFileName(), {.compression_level = 9});
+        writer.write(header.c_str(), header.length());
     }
     else
     {
@@ -761,47 +699,16 @@ void inr_image_io::Write(const void* _buffer)
     std::string::size_type const index = filename.rfind(suffix);
     if(index == filename.length() - suffix.length())
     {
-        gzFile output_file = gzopen(this->GetFileName(), "ab");
-        if(output_file == nullptr)
-        {
-            throw ExceptionObject(
-                      __FILE__,
-                      __LINE__,
-                      "File "s + GetFileName() + " could not be written : error writing buffer."
-            );
-        }
-
-        // Replace this line :
-        // gzwrite(outputFile, const_cast<void*>(buffer), GetImageSizeInBytes());
-        // by
-        std::int64_t size = ((GetImageSizeInBytes() > 1024LL * 1024 * 10)
-                             ? (GetImageSizeInBytes() / 10) + 1
-                             : GetImageSizeInBytes());
-
-        try
-        {
-            int written = 0;
-
-            while(written < GetImageSizeInBytes())
+        // Compressed in parallel, in independent gzip members which are still readable by any gzip reader. This throws
+        // core::exception if the file can not be written or if the progress bar is canceled.
+        sight::io::writer::parallel_gz_writer writer(this->GetFileName(), {.compression_level = 6, .append = true});
+        writer.write(
+            _buffer,
+            std::size_t(GetImageSizeInBytes()),
+            [this](double _ratio)
             {
-                UpdateProgress(((float) written) / float(GetImageSizeInBytes()));
-                written +=
-                    gzwrite(
-                        output_file,
-                        reinterpret_cast<const char*>(_buffer) + written,
-                        std::uint32_t(std::min(size, GetImageSizeInBytes() - written))
-                    );
-            }
-        }
-        catch(sight::core::exception& /*e*/) // catch progress bar cancel exception
-        {
-            gzclose(output_file);
-            throw;
-        }
-        UpdateProgress(1.0);
-        // End replace
-
-        gzclose(output_file);
+                UpdateProgress(float(_ratio));
+            });
     }
     else
     {
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023-2024 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -25,6 +25,8 @@
 
 #include <core/base.hpp>
 #include <core/os/temp_path.hpp>
+#include <core/profiling.hpp>
+#include <core/spy_log.hpp>
 
 #include <data/helper/medical_image.hpp>
 
@@ -306,6 +308,68 @@ void image_reader_writer_test::inr_read_jpeg_write_test()
 
 //------------------------------------------------------------------------------
 
+void image_reader_writer_test::inr_benchmark()
+{
+    // A 256 x 256 x 256 CT-like volume, made of smooth areas so it compresses like a real one
+    auto image = std::make_shared<data::image>();
+    utest_data::generator::image::generate_image(
+        image,
+        {256, 256, 256},
+        {1., 1., 1.},
+        {0., 0., 0.},
+        {1., 0., 0., 0., 1., 0., 0., 0., 1.},
+        core::type::INT16
+    );
+    {
+        const auto dump_lock = image->dump_lock();
+        std::size_t i        = 0;
+        for(auto it = image->begin<std::int16_t>(), end = image->end<std::int16_t>() ; it != end ; ++it, ++i)
+        {
+            *it = static_cast<std::int16_t>(int((i / 4096) % 512) - 256 + int(i % 7));
+        }
+    }
+
+    core::os::temp_dir tmp_dir;
+    const std::filesystem::path path = tmp_dir / "benchmark.inr.gz";
+
+    {
+        FW_PROFILE("INR 256x256x256 int16, write");
+        auto writer = std::make_shared<io::itk::inr_image_writer>();
+        writer->set_object(image);
+        writer->set_file(path);
+        writer->write();
+    }
+
+    auto image2 = std::make_shared<data::image>();
+    {
+        FW_PROFILE("INR 256x256x256 int16, read");
+        auto reader = std::make_shared<io::itk::inr_image_reader>();
+        reader->set_object(image2);
+        reader->set_file(path);
+        reader->read();
+    }
+
+    CPPUNIT_ASSERT_EQUAL(image->size_in_bytes(), image2->size_in_bytes());
+    {
+        const auto dump_lock  = image->dump_lock();
+        const auto dump_lock2 = image2->dump_lock();
+        CPPUNIT_ASSERT(
+            std::equal(
+                image->begin<std::int16_t>(),
+                image->end<std::int16_t>(),
+                image2->begin<std::int16_t>()
+            )
+        );
+    }
+
+    SIGHT_INFO(
+        "INR 256x256x256 int16 (" << (image->size_in_bytes() >> 20) << " MiB, " << std::filesystem::file_size(path)
+        << " bytes compressed)"
+    );
+}
+
+//------------------------------------------------------------------------------
+
 void image_reader_writer_test::inr_stress_test_with_type(core::type _type, int _nb_test)
 {
     for(int nb = 0 ; nb < _nb_test ; ++nb)
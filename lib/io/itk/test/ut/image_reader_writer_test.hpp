@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2015 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -41,6 +41,7 @@ CPPUNIT_TEST(nifti_read_test);
 CPPUNIT_TEST(nifti_write_test);
 CPPUNIT_TEST(jpeg_write_test);
 CPPUNIT_TEST(inr_read_jpeg_write_test);
+CPPUNIT_TEST(inr_benchmark);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -55,6 +56,7 @@ public:
     static void nifti_write_test();
     static void jpeg_write_test();
     static void inr_read_jpeg_write_test();
+    static void inr_benchmark();
 
 private:
 
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -29,7 +29,6 @@
 #include <QItemSelectionModel>
 #include <QKeyEvent>
 #include <QModelIndexList>
-#include <QStandardItem>
 #include <QString>
 
 namespace sight::ui::qt::series
@@ -52,6 +51,22 @@ selector::selector(const std::string& _display_column, QWidget* _parent) :
     );
     QObject::connect(m_model, &selector_model::remove_series_id, this, &selector::on_remove_series_id);
 
+    // Studies fetched by the view are expanded like the ones added one by one
+    QObject::connect(
+        m_model,
+        &selector_model::rowsInserted,
+        this,
+        [this](const QModelIndex& _parent, int _first, int _last)
+        {
+            if(!_parent.isValid())
+            {
+                for(int row = _first ; row <= _last ; ++row)
+                {
+                    this->expand(m_model->index(row, 0));
+                }
+            }
+        });
+
     this->setDragEnabled(false);
     this->setAcceptDrops(false);
 }
@@ -61,8 +76,19 @@ selector::selector(const std::string& _display_column, QWidget* _parent) :
 void selector::add_series(data::series::sptr _series)
 {
     m_model->add_series(_series);
-    QStandardItem* study_item = m_model->find_study_item(_series);
-    this->expand(m_model->indexFromItem(study_item));
+    this->expand(m_model->find_study_item(_series));
+
+    for(int i = 0 ; i < m_model->columnCount() ; ++i)
+    {
+        this->resizeColumnToContents(i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void selector::add_series(const std::vector<data::series::sptr>& _series)
+{
+    m_model->add_series(_series);
 
     for(int i = 0 ; i < m_model->columnCount() ; ++i)
     {
@@ -139,15 +165,14 @@ QModelIndexList selector::get_study_indexes(const QModelIndexList& _index_list)
 selector::series_vector_t selector::get_series_from_study_index(const QModelIndex& _index) const
 {
     series_vector_t v_series;
-    QStandardItem* item = m_model->itemFromIndex(_index);
-    SIGHT_ASSERT("Item shouldn't be null", item);
-    const int nb_row = item->rowCount();
+    SIGHT_ASSERT("Index shouldn't be invalid", _index.isValid());
+    const int nb_row = m_model->rowCount(_index);
     for(int row = 0 ; row < nb_row ; ++row)
     {
         // Retrieve UID of the series using the DESCRIPTION column.
-        QStandardItem* child = item->child(row, 0);
-        SIGHT_ASSERT("Child is null", child);
-        const std::string uid = child->data(selector_model::uid).toString().toStdString();
+        const QModelIndex child = m_model->index(row, 0, _index);
+        SIGHT_ASSERT("Child is invalid", child.isValid());
+        const std::string uid = child.data(selector_model::uid).toString().toStdString();
         SIGHT_ASSERT("UID must not be empty.", !uid.empty());
         core::object::sptr obj    = core::id::get_object(uid);
         data::series::sptr series = std::dynamic_pointer_cast<data::series>(obj);
@@ -210,17 +235,16 @@ void selector::on_remove_study_instance_uid(const std::string& _uid)
 
         for(int study_idx = 0 ; study_idx < m_model->rowCount() ; ++study_idx)
         {
-            const QStandardItem* const study_item = m_model->item(study_idx);
-            if(study_item->index().data(selector_model::uid) == QString::fromStdString(_uid))
+            const QModelIndex study_index = m_model->index(study_idx, 0);
+            if(study_index.data(selector_model::uid) == QString::fromStdString(_uid))
             {
-                selection.push_back(study_item->index());
-                for(int series_idx = 0 ; series_idx < study_item->rowCount() ; ++series_idx)
+                selection.push_back(study_index);
+                for(int series_idx = 0 ; series_idx < m_model->rowCount(study_index) ; ++series_idx)
                 {
-                    const QStandardItem* const series_item = study_item->child(series_idx, 0);
-                    selection.push_back(series_item->index());
+                    const QModelIndex series_index = m_model->index(series_idx, 0, study_index);
+                    selection.push_back(series_index);
 
-                    const std::string series_uid =
-                        series_item->index().data(selector_model::uid).toString().toStdString();
+                    const std::string series_uid = series_index.data(selector_model::uid).toString().toStdString();
                     auto series =
                         std::dynamic_pointer_cast<data::series>(core::id::get_object(series_uid));
 
@@ -252,16 +276,15 @@ void selector::on_remove_series_id(const std::string& _id)
 
         for(int study_idx = 0 ; study_idx < m_model->rowCount() ; ++study_idx)
         {
-            const QStandardItem* const study_item = m_model->item(study_idx);
-            for(int series_idx = 0 ; series_idx < study_item->rowCount() ; ++series_idx)
+            const QModelIndex study_index = m_model->index(study_idx, 0);
+            for(int series_idx = 0 ; series_idx < m_model->rowCount(study_index) ; ++series_idx)
             {
-                const QStandardItem* const series_item = study_item->child(series_idx, 0);
-                const std::string series_uid           =
-                    series_item->index().data(selector_model::uid).toString().toStdString();
+                const QModelIndex series_index = m_model->index(series_idx, 0, study_index);
+                const std::string series_uid   = series_index.data(selector_model::uid).toString().toStdString();
 
                 if(series_uid == _id)
                 {
-                    selection.push_back(series_item->index());
+                    selection.push_back(series_index);
                     auto series = std::dynamic_pointer_cast<data::series>(core::id::get_object(series_uid));
 
                     if(series)
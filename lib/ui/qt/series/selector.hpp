@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -63,6 +63,12 @@ public:
      */
     SIGHT_UI_QT_API_QT void add_series(data::series::sptr _series);
 
+    /**
+     * @brief Adds several series at once. The studies are displayed page by page as the tree is scrolled.
+     * @param _series series to add in the tree.
+     */
+    SIGHT_UI_QT_API_QT void add_series(const std::vector<data::series::sptr>& _series);
+
     /**
      * @brief Removes the Series from the tree. After deletion, if the study is empty, it will be removed.
      * @param _series series to remove from the tree.
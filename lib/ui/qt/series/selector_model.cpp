@@ -36,12 +36,14 @@
 #include <boost/math/special_functions/round.hpp>
 
 #include <QFont>
+#include <QIcon>
 #include <QPushButton>
-#include <QStandardItem>
 #include <QString>
 #include <QStringDecoder>
 #include <QTreeView>
 
+#include <algorithm>
+#include <optional>
 #include <regex>
 
 namespace sight::ui::qt::series
@@ -120,7 +122,9 @@ enum class when : std::uint8_t
 struct column_display_information
 {
     std::string header;
-    std::function<QStandardItem* (data::series::csptr, QStringDecoder&, when)> get_info;
+    /// Whether the series cells of the column show the icon of the series
+    bool icon {false};
+    std::function<QString(data::series::csptr, QStringDecoder&, when)> get_info;
 };
 
 //------------------------------------------------------------------------------
@@ -135,11 +139,11 @@ inline static QStringDecoder get_decoder(data::series::csptr _series)
 /* *INDENT-OFF* */
 static const std::map<std::string, column_display_information> COLUMN_MAP {
     {"PatientName", {.header = "Name", .get_info =
-        [](data::series::csptr _series, QStringDecoder& _decoder, when _when)
+        [](data::series::csptr _series, QStringDecoder& _decoder, when _when) -> QString
         {
             if(_when == when::series)
             {
-                return new QStandardItem;
+                return QString();
             }
 
             QString res = _decoder(_series->get_patient_name().c_str());
@@ -151,30 +155,30 @@ static const std::map<std::string, column_display_information> COLUMN_MAP {
                 res = QString::fromStdString(_series->get_patient_id());
             }
 
-            return new QStandardItem(res);
+            return res;
         }
      }
     },
     {"SeriesInstanceUID", {.header = "Name", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
             if(_when == when::study)
             {
-                return new QStandardItem;
+                return QString();
             }
 
             if(std::string series_instance_uid = _series->get_series_instance_uid();
                 !series_instance_uid.empty())
             {
-                return new QStandardItem(QString::fromStdString(series_instance_uid));
+                return QString::fromStdString(series_instance_uid);
             }
 
-            return new QStandardItem(QString::fromStdString(_series->get_id()));
+            return QString::fromStdString(_series->get_id());
         }
      }
     },
     {"PatientName/SeriesInstanceUID", {.header = "Name", .get_info =
-        [](data::series::csptr _series, QStringDecoder& _decoder, when _when)
+        [](data::series::csptr _series, QStringDecoder& _decoder, when _when) -> QString
         {
             if(_when == when::study)
             {
@@ -187,86 +191,83 @@ static const std::map<std::string, column_display_information> COLUMN_MAP {
                     res = QString::fromStdString(_series->get_patient_id());
                 }
 
-                return new QStandardItem(res);
+                return res;
             }
 
             if(std::string series_instance_uid = _series->get_series_instance_uid(); !series_instance_uid.empty())
             {
-                return new QStandardItem(QString::fromStdString(series_instance_uid));
+                return QString::fromStdString(series_instance_uid);
             }
 
-            return new QStandardItem(QString::fromStdString(_series->get_id()));
+            return QString::fromStdString(_series->get_id());
         }
      }
     },
     {"PatientSex", {.header = "Sex", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(QString::fromStdString(_when == when::study ? _series->get_patient_sex() : ""));
+            return QString::fromStdString(_when == when::study ? _series->get_patient_sex() : "");
         }
      }
     },
     {"PatientBirthDate", {.header = "Birthdate", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(
-                QString::fromStdString(_when == when::study ? format_date(_series->get_patient_birth_date()) : ""));
+            return QString::fromStdString(_when == when::study ? format_date(_series->get_patient_birth_date()) : "");
         }
      }
     },
-    {"Icon", {.header = "Icon", .get_info =
-        [](data::series::csptr /*series*/, QStringDecoder& /*_decoder*/, when _when)
+    {"Icon", {.header = "Icon", .icon = true, .get_info =
+        [](data::series::csptr /*series*/, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
             if(_when == when::study)
             {
-                return new QStandardItem;
+                return QString();
             }
 
-            auto* item = new QStandardItem;
-            item->setData(true, selector_model::role::icon);
-            return item;
+            // The icon itself is decorated by the item
+            return QString();
         }
      }
     },
-    {"PatientBirthDate/Icon", {.header = "Birthdate", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+    {"PatientBirthDate/Icon", {.header = "Birthdate", .icon = true, .get_info =
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
             if(_when == when::study)
             {
-                return new QStandardItem(QString::fromStdString(format_date(_series->get_patient_birth_date())));
+                return QString::fromStdString(format_date(_series->get_patient_birth_date()));
             }
 
-            auto* item = new QStandardItem;
-            item->setData(true, selector_model::role::icon);
-            return item;
+            // The icon itself is decorated by the item
+            return QString();
         }
      }
     },
     {"Modality", {.header = "Modality", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(QString::fromStdString(_when == when::series ? _series->get_modality_string() : ""));
+            return QString::fromStdString(_when == when::series ? _series->get_modality_string() : "");
         }
      }
     },
     {"StudyDescription", {.header = "Description", .get_info =
-        [](data::series::csptr _series, QStringDecoder& _decoder, when _when)
+        [](data::series::csptr _series, QStringDecoder& _decoder, when _when) -> QString
         {
             if(_when == when::study)
             {
-                return new QStandardItem(_decoder(_series->get_study_description().c_str()));
+                return _decoder(_series->get_study_description().c_str());
             }
 
-            return new QStandardItem();
+            return QString();
         }
      }
     },
     {"SeriesDescription", {.header = "Description", .get_info =
-        [](data::series::csptr _series, QStringDecoder& _decoder, when _when)
+        [](data::series::csptr _series, QStringDecoder& _decoder, when _when) -> QString
         {
             if(_when == when::study)
             {
-                return new QStandardItem;
+                return QString();
             }
 
             std::string infos(_series->get_sop_class_name());
@@ -288,16 +289,16 @@ static const std::map<std::string, column_display_information> COLUMN_MAP {
                 full_description += ": " + description;
             }
 
-            return new QStandardItem(full_description);
+            return full_description;
         }
      }
     },
     {"StudyDescription/SeriesDescription", {.header = "Description", .get_info =
-        [](data::series::csptr _series, QStringDecoder& _decoder, when _when)
+        [](data::series::csptr _series, QStringDecoder& _decoder, when _when) -> QString
         {
             if(_when == when::study)
             {
-                return new QStandardItem(_decoder(_series->get_description().c_str()));
+                return _decoder(_series->get_description().c_str());
             }
 
             std::string infos(_series->get_sop_class_name());
@@ -319,119 +320,115 @@ static const std::map<std::string, column_display_information> COLUMN_MAP {
                 full_description += ": " + description;
             }
 
-            return new QStandardItem(full_description);
+            return full_description;
         }
      }
     },
     {"StudyDate", {.header = "Date", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(
-                QString::fromStdString(_when == when::study ? format_date(_series->get_study_date()) : ""));
+            return QString::fromStdString(_when == when::study ? format_date(_series->get_study_date()) : "");
         }
      }
     },
     {"SeriesDate", {.header = "Date", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(
-                QString::fromStdString(_when == when::series ? format_date(_series->get_series_date()) : ""));
+            return QString::fromStdString(_when == when::series ? format_date(_series->get_series_date()) : "");
         }
      }
     },
     {"StudyDate/SeriesDate", {.header = "Date", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(QString::fromStdString(
-                format_date(_when == when::study ? _series->get_study_date() : _series->get_series_date())));
+            return QString::fromStdString(
+                format_date(_when == when::study ? _series->get_study_date() : _series->get_series_date()));
         }
      }
     },
     {"StudyTime", {.header = "Time", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(
-                QString::fromStdString(_when == when::study ? format_time(_series->get_study_time()) : ""));
+            return QString::fromStdString(_when == when::study ? format_time(_series->get_study_time()) : "");
         }
      }
     },
     {"SeriesTime", {.header = "Time", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(
-                QString::fromStdString(_when == when::series ? format_time(_series->get_series_time()) : ""));
+            return QString::fromStdString(_when == when::series ? format_time(_series->get_series_time()) : "");
         }
      }
     },
     {"StudyTime/SeriesTime", {.header = "Time", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(QString::fromStdString(
-                format_time(_when == when::study ? _series->get_study_time() : _series->get_series_time())));
+            return QString::fromStdString(
+                format_time(_when == when::study ? _series->get_study_time() : _series->get_series_time()));
         }
      }
     },
     {"PatientAge", {.header = "Patient age", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(QString::fromStdString(_when == when::study ? _series->get_patient_age() : ""));
+            return QString::fromStdString(_when == when::study ? _series->get_patient_age() : "");
         }
      }
     },
     {"BodyPartExamined", {.header = "Body part examined", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(QString::fromStdString(
+            return QString::fromStdString(
                 _when == when::series && _series->get_dicom_type() == data::series::dicom_t::image
                     ? _series->get_body_part_examined()
-                    : ""));
+                    : "");
         }
      }
     },
     {"PatientPositionString", {.header = "Patient position", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(QString::fromStdString(
+            return QString::fromStdString(
                 _when == when::series && _series->get_dicom_type() == data::series::dicom_t::image
                     ? _series->get_patient_position_string()
-                    : ""));
+                    : "");
         }
      }
     },
     {"ContrastBolusAgent", {.header = "Contrast agent", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(QString::fromStdString(
+            return QString::fromStdString(
                 _when == when::series && _series->get_dicom_type() == data::series::dicom_t::image
                     ? _series->get_contrast_bolus_agent()
-                    : ""));
+                    : "");
         }
      }
     },
     {"AcquisitionTime", {.header = "Acquisition time", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(QString::fromStdString(
+            return QString::fromStdString(
                 _when == when::series && _series->get_dicom_type() == data::series::dicom_t::image
                     ? format_time(_series->get_acquisition_time())
-                    : ""));
+                    : "");
         }
      }
     },
     {"ContrastBolusStartTime", {.header = "Contrast/bolus time", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(QString::fromStdString(
+            return QString::fromStdString(
                 _when == when::series && _series->get_dicom_type() == data::series::dicom_t::image
                     ? format_time(_series->get_contrast_bolus_start_time())
-                    : ""));
+                    : "");
         }
      }
     },
     {"PatientID", {.header = "Patient ID", .get_info =
-        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when)
+        [](data::series::csptr _series, QStringDecoder& /*_decoder*/, when _when) -> QString
         {
-            return new QStandardItem(QString::fromStdString(_when == when::study ? _series->get_patient_id() : ""));
+            return QString::fromStdString(_when == when::study ? _series->get_patient_id() : "");
         }
      }
     }
@@ -441,7 +438,7 @@ static const std::map<std::string, column_display_information> COLUMN_MAP {
 //-----------------------------------------------------------------------------
 
 selector_model::selector_model(const std::string& _display_columns, QWidget* _parent, bool _allow_remove) :
-    QStandardItemModel(_parent),
+    QAbstractItemModel(_parent),
     m_remove_allowed(_allow_remove)
 {
     boost::split(m_display_columns, _display_columns, boost::is_any_of(","));
@@ -452,43 +449,248 @@ selector_model::selector_model(const std::string& _display_columns, QWidget* _pa
 
 void selector_model::init()
 {
-    m_study_row_count = 0;
+    m_studies.clear();
     m_items.clear();
+    m_series_items.clear();
+    m_pending.clear();
+    m_pending_order.clear();
 
-    QStringList headers;
+    m_headers.clear();
+    m_icon_columns.clear();
     for(const std::string& display_column : m_display_columns)
     {
         SIGHT_ASSERT("Display column '" << display_column << "' unknown.", COLUMN_MAP.contains(display_column));
-        headers << QString::fromStdString(COLUMN_MAP.at(display_column).header);
+        const auto& column = COLUMN_MAP.at(display_column);
+        m_headers << QString::fromStdString(column.header);
+        m_icon_columns.push_back(column.icon);
     }
 
     if(m_remove_allowed)
     {
-        headers << "Remove";
+        m_headers << "Remove";
     }
-
-    this->setHorizontalHeaderLabels(headers);
 }
 
 //-----------------------------------------------------------------------------
 
 selector_model::item_t selector_model::get_item_type(const QModelIndex& _index)
 {
-    QModelIndex idx     = this->createIndex(_index.row(), 0, _index.internalPointer());
-    QStandardItem* item = this->itemFromIndex(idx);
-    return (selector_model::item_t) item->data(role::item_type).toInt();
+    return static_cast<selector_model::item_t>(_index.data(role::item_type).toInt());
 }
 
 //-----------------------------------------------------------------------------
 
 void selector_model::clear()
 {
-    this->QStandardItemModel::clear();
+    this->beginResetModel();
     this->init();
+    this->endResetModel();
+}
+
+//-----------------------------------------------------------------------------
+
+QModelIndex selector_model::index(int _row, int _column, const QModelIndex& _parent) const
+{
+    if(!this->hasIndex(_row, _column, _parent))
+    {
+        return {};
+    }
+
+    // Series indexes point to their study, study indexes point to nothing
+    return this->createIndex(_row, _column, _parent.isValid() ? this->get_study(_parent) : nullptr);
+}
+
+//-----------------------------------------------------------------------------
+
+QModelIndex selector_model::parent(const QModelIndex& _index) const
+{
+    if(!_index.isValid() || _index.internalPointer() == nullptr)
+    {
+        return {};
+    }
+
+    const auto* const study = static_cast<const study_row_t*>(_index.internalPointer());
+    return this->createIndex(study->row, 0, nullptr);
+}
+
+//-----------------------------------------------------------------------------
+
+int selector_model::rowCount(const QModelIndex& _parent) const
+{
+    if(!_parent.isValid())
+    {
+        return static_cast<int>(m_studies.size());
+    }
+
+    // Only the first column of a study has children, like in a standard item model
+    if(_parent.column() != 0 || _parent.internalPointer() != nullptr)
+    {
+        return 0;
+    }
+
+    return static_cast<int>(this->get_study(_parent)->children.size());
+}
+
+//-----------------------------------------------------------------------------
+
+int selector_model::columnCount(const QModelIndex& /*_parent*/) const
+{
+    return static_cast<int>(m_display_columns.size()) + (m_remove_allowed ? 1 : 0);
+}
+
+//-----------------------------------------------------------------------------
+
+QVariant selector_model::data(const QModelIndex& _index, int _role) const
+{
+    if(!_index.isValid())
+    {
+        return {};
+    }
+
+    const bool is_series = _index.internalPointer() != nullptr;
+    const row_t& row     = this->get_row(_index);
+    const auto column    = static_cast<std::size_t>(_index.column());
+
+    // The last column only holds the remove buttons
+    const bool is_info = column < m_display_columns.size();
+
+    switch(_role)
+    {
+        case role::item_type:
+            return static_cast<int>(is_series ? item_t::series : item_t::study);
+
+        case role::uid:
+            return QString::fromStdString(row.uid);
+
+        case role::icon:
+            return is_series && is_info && m_icon_columns[column] ? QVariant(true) : QVariant();
+
+        case Qt::DisplayRole:
+        case Qt::EditRole:
+        {
+            if(!is_info)
+            {
+                return {};
+            }
+
+            if(row.cells.empty())
+            {
+                row.cells.resize(m_display_columns.size());
+            }
+
+            std::optional<QString>& cell = row.cells[column];
+            if(!cell.has_value())
+            {
+                if(const auto series = row.series.lock(); series)
+                {
+                    auto decoder = get_decoder(series);
+                    cell = COLUMN_MAP.at(m_display_columns[column]).get_info(
+                        series,
+                        decoder,
+                        is_series ? when::series : when::study
+                    );
+                }
+                else
+                {
+                    cell = QString();
+                }
+            }
+
+            return *cell;
+        }
+
+        case Qt::DecorationRole:
+        {
+            if(!is_series || !is_info || !m_icon_columns[column])
+            {
+                return {};
+            }
+
+            if(!row.icon.has_value())
+            {
+                const auto series = row.series.lock();
+                row.icon = series ? this->get_series_icon(*series) : QIcon();
+            }
+
+            return *row.icon;
+        }
+
+        case Qt::FontRole:
+        {
+            if(!row.bold)
+            {
+                return {};
+            }
+
+            QFont font;
+            font.setBold(true);
+            return font;
+        }
+
+        default:
+            return {};
+    }
 }
 
 //-----------------------------------------------------------------------------
 
+QVariant selector_model::headerData(int _section, Qt::Orientation _orientation, int _role) const
+{
+    if(_orientation == Qt::Horizontal && _role == Qt::DisplayRole && _section >= 0 && _section < m_headers.size())
+    {
+        return m_headers[_section];
+    }
+
+    return QAbstractItemModel::headerData(_section, _orientation, _role);
+}
+
+//-----------------------------------------------------------------------------
+
+Qt::ItemFlags selector_model::flags(const QModelIndex& _index) const
+{
+    if(!_index.isValid())
+    {
+        return Qt::ItemIsDropEnabled;
+    }
+
+    return Qt::ItemIsSelectable | Qt::ItemIsEnabled | Qt::ItemIsDragEnabled | Qt::ItemIsDropEnabled;
+}
+
+//-----------------------------------------------------------------------------
+
+selector_model::study_row_t* selector_model::get_study(const QModelIndex& _index) const
+{
+    if(_index.internalPointer() != nullptr)
+    {
+        return static_cast<study_row_t*>(_index.internalPointer());
+    }
+
+    return m_studies[static_cast<std::size_t>(_index.row())].get();
+}
+
+//-----------------------------------------------------------------------------
+
+const selector_model::row_t& selector_model::get_row(const QModelIndex& _index) const
+{
+    const study_row_t* const study = this->get_study(_index);
+    if(_index.internalPointer() != nullptr)
+    {
+        return study->children[static_cast<std::size_t>(_index.row())];
+    }
+
+    return *study;
+}
+
+//-----------------------------------------------------------------------------
+
+int selector_model::find_series_row(const study_row_t& _study, const std::string& _id)
+{
+    const auto itr = std::ranges::find(_study.children, _id, &row_t::uid);
+    return itr != _study.children.end() ? static_cast<int>(itr - _study.children.begin()) : -1;
+}
+
+//------------------------------------------------------------------------------
+
 data::image::spacing_t round_spacing(const data::image::spacing_t& _spacing)
 {
     data::image::spacing_t round_spacing;
@@ -505,164 +707,291 @@ data::image::spacing_t round_spacing(const data::image::spacing_t& _spacing)
 
 void selector_model::add_series(data::series::sptr _series)
 {
-    auto decoder                   = get_decoder(_series);
-    const auto study_instance_uid  = _series->get_study_instance_uid();
-    auto itr                       = m_items.find(study_instance_uid);
-    QStandardItem* study_root_item = nullptr;
+    this->add_series(std::vector<data::series::sptr> {_series});
 
-    if(itr != m_items.end())
-    {
-        study_root_item = itr->second;
-    }
-    else
+    // A single series is shown right away
+    this->fetch_study(_series->get_study_instance_uid());
+}
+
+//------------------------------------------------------------------------------
+
+void selector_model::add_series(const std::vector<data::series::sptr>& _series)
+{
+    for(const auto& series : _series)
     {
-        std::size_t i = 0;
-        for(const std::string& display_column : m_display_columns)
+        const auto study_instance_uid = series->get_study_instance_uid();
+        if(const auto itr = m_items.find(study_instance_uid); itr != m_items.end())
         {
-            setItem(
-                m_study_row_count,
-                static_cast<int>(i),
-                COLUMN_MAP.at(display_column).get_info(_series, decoder, when::study)
-            );
-            i++;
+            this->add_series_row(itr->second, series);
+            continue;
         }
 
-        item(m_study_row_count)->setData(item_t::study, role::item_type);
-        item(m_study_row_count)->setData(QString::fromStdString(study_instance_uid), role::uid);
-
-        // Add a remove button to each studies.
-        if(m_remove_allowed && !m_remove_study_icon.empty())
+        // The rows of new studies are only inserted when a view fetches them
+        auto [pending, inserted] = m_pending.try_emplace(study_instance_uid);
+        if(inserted)
         {
-            this->setItem(m_study_row_count, static_cast<int>(i), new QStandardItem());
+            m_pending_order.push_back(study_instance_uid);
+        }
 
-            auto* const selector = static_cast<QTreeView*>(this->parent());
-            SIGHT_ASSERT("The QTreeView parent must be given to the constructor", selector);
+        pending->second.push_back(series);
+    }
 
-            auto* const remove_button = new QPushButton(QIcon(m_remove_study_icon.string().c_str()), "");
-            selector->setIndexWidget(this->index(m_study_row_count, static_cast<int>(i)), remove_button);
+    // Fill the first page, views fetch the next ones when they scroll
+    if(m_studies.size() < FETCH_SIZE)
+    {
+        this->fetchMore({});
+    }
+}
 
-            // When the remove button is clicked, emit a signal with the study UID.
-            QObject::connect(
-                remove_button,
-                &QPushButton::clicked,
-                this,
-                [study_instance_uid, this]()
-                {
-                    Q_EMIT remove_study_instance_uid(study_instance_uid);
-                });
-        }
+//------------------------------------------------------------------------------
 
-        study_root_item = item(m_study_row_count);
-        m_study_row_count++;
-        m_items[study_instance_uid] = study_root_item;
-    }
+bool selector_model::canFetchMore(const QModelIndex& _parent) const
+{
+    return !_parent.isValid() && !m_pending.empty();
+}
 
-    const std::string& series_id = _series->get_id();
+//------------------------------------------------------------------------------
 
-    const int nb_row = study_root_item->rowCount();
+void selector_model::fetchMore(const QModelIndex& _parent)
+{
+    if(_parent.isValid())
+    {
+        return;
+    }
 
-    QStandardItem* series_icon = nullptr;
-    std::size_t i              = 0;
-    for(const std::string& display_column : m_display_columns)
+    std::vector<std::unique_ptr<study_row_t> > studies;
+    while(studies.size() < FETCH_SIZE && !m_pending_order.empty())
     {
-        QStandardItem* item = COLUMN_MAP.at(display_column).get_info(_series, decoder, when::series);
-        study_root_item->setChild(nb_row, static_cast<int>(i), item);
-        if(item->data(role::icon).toBool())
+        const auto study_instance_uid = m_pending_order.front();
+        m_pending_order.pop_front();
+
+        // Studies fetched out of order or removed meanwhile are skipped
+        if(auto study = this->take_pending_study(study_instance_uid); study)
         {
-            series_icon = item;
+            studies.push_back(std::move(study));
         }
+    }
+
+    this->append_studies(std::move(studies));
+}
+
+//------------------------------------------------------------------------------
 
-        i++;
+void selector_model::fetch_study(const data::dicom_value_t& _study_instance_uid)
+{
+    if(auto study = this->take_pending_study(_study_instance_uid); study)
+    {
+        std::vector<std::unique_ptr<study_row_t> > studies;
+        studies.push_back(std::move(study));
+        this->append_studies(std::move(studies));
     }
+}
 
-    study_root_item->child(nb_row)->setData(item_t::series, role::item_type);
-    study_root_item->child(nb_row)->setData(QString::fromStdString(series_id), role::uid);
+//------------------------------------------------------------------------------
 
-    // Add a remove button to each series.
-    if(m_remove_allowed && !m_remove_series_icon.empty())
+std::unique_ptr<selector_model::study_row_t> selector_model::take_pending_study(
+    const data::dicom_value_t& _study_instance_uid
+)
+{
+    const auto pending = m_pending.find(_study_instance_uid);
+    if(pending == m_pending.end())
     {
-        auto* const remove_item = new QStandardItem();
-        study_root_item->setChild(nb_row, static_cast<int>(i), remove_item);
+        return nullptr;
+    }
 
-        auto* const selector = static_cast<QTreeView*>(this->parent());
-        SIGHT_ASSERT("The QTreeView parent must be given to the constructor", selector);
+    const std::vector<data::series::sptr> series = std::move(pending->second);
+    m_pending.erase(pending);
 
-        auto* const remove_button = new QPushButton(QIcon(m_remove_series_icon.string().c_str()), "");
-        selector->setIndexWidget(this->indexFromItem(remove_item), remove_button);
+    if(series.empty())
+    {
+        return nullptr;
+    }
 
-        // When the remove button is clicked, emit a signal with the study UID.
-        QObject::connect(
-            remove_button,
-            &QPushButton::clicked,
-            this,
-            [series_id, this]()
-            {
-                Q_EMIT remove_series_id(series_id);
-            });
+    // The study is described by its first series
+    auto study = std::make_unique<study_row_t>();
+    study->series = series.front();
+    study->uid    = _study_instance_uid;
+
+    study->children.reserve(series.size());
+    for(const auto& s : series)
+    {
+        study->children.push_back(this->create_series_row(s));
+    }
+
+    return study;
+}
+
+//------------------------------------------------------------------------------
+
+void selector_model::append_studies(std::vector<std::unique_ptr<study_row_t> > _studies)
+{
+    if(_studies.empty())
+    {
+        return;
+    }
+
+    const int first = static_cast<int>(m_studies.size());
+    const int last  = first + static_cast<int>(_studies.size()) - 1;
+
+    // The whole page is inserted at once, so that the views are notified only once
+    this->beginInsertRows({}, first, last);
+    for(auto& study : _studies)
+    {
+        study->row          = static_cast<int>(m_studies.size());
+        m_items[study->uid] = study.get();
+        for(const auto& series : study->children)
+        {
+            m_series_items[series.uid] = study.get();
+        }
+
+        m_studies.push_back(std::move(study));
     }
 
-    if(m_insert)
+    this->endInsertRows();
+
+    // Buttons can only be placed once the rows are in the model
+    if(!m_remove_allowed)
     {
-        const int nb_columns = study_root_item->columnCount();
-        for(int j = 0 ; j < nb_columns ; ++j)
+        return;
+    }
+
+    for(int row = first ; row <= last ; ++row)
+    {
+        const QModelIndex study_index = this->index(row, 0);
+        const study_row_t& study      = *m_studies[static_cast<std::size_t>(row)];
+
+        if(!m_remove_study_icon.empty())
         {
-            QStandardItem* item = study_root_item->child(nb_row, j);
-            if(item == nullptr)
+            this->add_remove_button(study_index, study.uid, item_t::study);
+        }
+
+        if(!m_remove_series_icon.empty())
+        {
+            for(std::size_t i = 0 ; i < study.children.size() ; ++i)
             {
-                study_root_item->setChild(nb_row, j, new QStandardItem());
-                item = study_root_item->child(nb_row, j);
+                this->add_remove_button(
+                    this->index(static_cast<int>(i), 0, study_index),
+                    study.children[i].uid,
+                    item_t::series
+                );
             }
-
-            QFont f = item->font();
-            f.setBold(true);
-            item->setFont(f);
         }
     }
+}
 
-    if(series_icon != nullptr)
+//------------------------------------------------------------------------------
+
+selector_model::row_t selector_model::create_series_row(const data::series::sptr& _series) const
+{
+    row_t row;
+    row.series = _series;
+    row.uid    = _series->get_id();
+    row.bold   = m_insert;
+    return row;
+}
+
+//------------------------------------------------------------------------------
+
+void selector_model::add_series_row(study_row_t* _study, const data::series::sptr& _series)
+{
+    const QModelIndex study_index = this->createIndex(_study->row, 0, nullptr);
+    const int row                 = static_cast<int>(_study->children.size());
+
+    this->beginInsertRows(study_index, row, row);
+    _study->children.push_back(this->create_series_row(_series));
+    m_series_items[_study->children.back().uid] = _study;
+    this->endInsertRows();
+
+    if(m_remove_allowed && !m_remove_series_icon.empty())
     {
-        this->add_series_icon(_series, series_icon);
+        this->add_remove_button(this->index(row, 0, study_index), _study->children.back().uid, item_t::series);
     }
 }
 
+//------------------------------------------------------------------------------
+
+void selector_model::add_remove_button(const QModelIndex& _index, const std::string& _uid, item_t _type)
+{
+    auto* const selector = static_cast<QTreeView*>(this->parent());
+    SIGHT_ASSERT("The QTreeView parent must be given to the constructor", selector);
+
+    const auto& icon          = _type == item_t::study ? m_remove_study_icon : m_remove_series_icon;
+    auto* const remove_button = new QPushButton(QIcon(icon.string().c_str()), "");
+    selector->setIndexWidget(this->get_index(_index, this->columnCount() - 1), remove_button);
+
+    // When the remove button is clicked, emit a signal with the study UID or the series ID.
+    QObject::connect(
+        remove_button,
+        &QPushButton::clicked,
+        this,
+        [_uid, _type, this]()
+        {
+            if(_type == item_t::study)
+            {
+                Q_EMIT remove_study_instance_uid(_uid);
+            }
+            else
+            {
+                Q_EMIT remove_series_id(_uid);
+            }
+        });
+}
+
 //-----------------------------------------------------------------------------
 
-void selector_model::add_series_icon(data::series::sptr _series, QStandardItem* _item)
+QIcon selector_model::get_series_icon(const data::series& _series) const
 {
-    auto iter = m_series_icons.find(_series->get_classname());
-    if(iter != m_series_icons.end())
+    std::string icon_path;
+
+    if(auto iter = m_series_icons.find(_series.get_classname()); iter != m_series_icons.end())
     {
-        _item->setIcon(QIcon(QString::fromStdString(iter->second)));
+        icon_path = iter->second;
     }
-    else
+    else if(const auto& type = _series.get_dicom_type(); type == data::series::dicom_t::image)
     {
-        std::filesystem::path icon_path;
+        icon_path = core::runtime::get_module_resource_file_path("sight::module::ui::icons", "image_series.svg")
+                    .string();
+    }
+    else if(type == data::series::dicom_t::model)
+    {
+        icon_path = core::runtime::get_module_resource_file_path("sight::module::ui::icons", "model_series.svg")
+                    .string();
+    }
 
-        if(const auto& type = _series->get_dicom_type(); type == data::series::dicom_t::image)
-        {
-            icon_path = core::runtime::get_module_resource_file_path("sight::module::ui::icons", "image_series.svg");
-        }
-        else if(type == data::series::dicom_t::model)
-        {
-            icon_path = core::runtime::get_module_resource_file_path("sight::module::ui::icons", "model_series.svg");
-        }
+    if(icon_path.empty())
+    {
+        return {};
+    }
 
-        if(!icon_path.empty())
-        {
-            _item->setIcon(QIcon(QString::fromStdString(icon_path.string())));
-        }
+    // Icons are shared by all the series of the same kind
+    auto [icon, inserted] = m_icons.try_emplace(icon_path);
+    if(inserted)
+    {
+        icon->second = QIcon(QString::fromStdString(icon_path));
     }
+
+    return icon->second;
 }
 
 //-----------------------------------------------------------------------------
 
 void selector_model::remove_series(data::series::sptr _series)
 {
-    QStandardItem* series_item = this->find_series_item(_series);
+    // A series that was never displayed is simply forgotten
+    if(const auto pending = m_pending.find(_series->get_study_instance_uid()); pending != m_pending.end())
+    {
+        std::erase(pending->second, _series);
+        if(pending->second.empty())
+        {
+            m_pending.erase(pending);
+        }
 
-    if(series_item != nullptr)
+        return;
+    }
+
+    if(const auto itr = m_series_items.find(_series->get_id()); itr != m_series_items.end())
     {
-        this->remove_series_item(series_item);
+        this->remove_series_row(itr->second, find_series_row(*itr->second, _series->get_id()));
     }
 }
 
@@ -678,110 +1007,111 @@ QModelIndex selector_model::get_index(const QModelIndex& _index, int _column)
 
 void selector_model::removeRows(const QModelIndexList _indexes)
 {
-    QList<QStandardItem*> series_items;
-    QList<QStandardItem*> study_items;
+    // The rows move while they are removed, so they are identified by their UID
+    std::vector<std::string> series_ids;
+    std::vector<data::dicom_value_t> study_uids;
 
-    for(QModelIndex index : _indexes)
+    for(const QModelIndex& index : _indexes)
     {
         SIGHT_ASSERT("Index must be in the first column.", index.column() == 0);
-        QStandardItem* item = this->itemFromIndex(index);
-        if(item->data(role::item_type) == item_t::study)
+        if(index.internalPointer() == nullptr)
         {
-            study_items.append(item);
+            study_uids.push_back(this->get_study(index)->uid);
         }
-        else if(item->data(role::item_type) == item_t::series)
+        else
         {
-            series_items.append(item);
+            series_ids.push_back(this->get_row(index).uid);
         }
     }
 
-    // Remove series items from selector
-    for(QStandardItem* item : series_items)
+    // Remove series rows from selector
+    for(const std::string& id : series_ids)
     {
-        QStandardItem* study_item = item->parent();
+        const auto itr = m_series_items.find(id);
 
-        // Remove series item if it is not included in a study which will be remove.
-        if(std::find(study_items.begin(), study_items.end(), study_item) == study_items.end())
+        // Remove series row if it is not included in a study which will be removed.
+        if(itr != m_series_items.end() && std::ranges::find(study_uids, itr->second->uid) == study_uids.end())
         {
-            this->remove_series_item(item);
+            this->remove_series_row(itr->second, find_series_row(*itr->second, id));
         }
     }
 
-    // Remove study items from selector
-    for(QStandardItem* item : study_items)
+    // Remove study rows from selector
+    for(const data::dicom_value_t& uid : study_uids)
     {
-        this->remove_study_item(item);
+        if(const auto itr = m_items.find(uid); itr != m_items.end())
+        {
+            this->remove_study_row(itr->second);
+        }
     }
 }
 
 //-----------------------------------------------------------------------------
 
-bool selector_model::remove_study_item(QStandardItem* _item)
+void selector_model::remove_study_row(study_row_t* _study)
 {
-    bool is_removed = false;
-    SIGHT_ASSERT("Index must represent a study.", _item->data(role::item_type) == item_t::study);
-    QString uid                      = _item->data(role::uid).toString();
-    data::dicom_value_t instance_uid = uid.toStdString();
+    const int row = _study->row;
+
+    this->beginRemoveRows({}, row, row);
+
+    for(const row_t& series : _study->children)
+    {
+        m_series_items.erase(series.uid);
+    }
+
+    m_items.erase(_study->uid);
+    m_studies.erase(m_studies.begin() + row);
 
-    is_removed = this->QStandardItemModel::removeRow(_item->row());
-    SIGHT_ASSERT("Remove can not be done!", is_removed);
-    m_items.erase(instance_uid);
-    --m_study_row_count;
+    for(std::size_t i = static_cast<std::size_t>(row) ; i < m_studies.size() ; ++i)
+    {
+        m_studies[i]->row = static_cast<int>(i);
+    }
 
-    return is_removed;
+    this->endRemoveRows();
 }
 
 //-----------------------------------------------------------------------------
 
-bool selector_model::remove_series_item(QStandardItem* _item)
+void selector_model::remove_series_row(study_row_t* _study, int _row)
 {
-    bool is_removed = false;
+    SIGHT_ASSERT("Series row must exist in the study", _row >= 0 && _row < int(_study->children.size()));
 
-    SIGHT_ASSERT("Index must represent series", _item->data(role::item_type) == item_t::series);
-    QStandardItem* parent = _item->parent();
-    is_removed = this->QStandardItemModel::removeRow(_item->row(), this->indexFromItem(parent));
-    SIGHT_ASSERT("Remove can not be done!", is_removed);
-    if(parent != nullptr && parent->rowCount() == 0)
+    this->beginRemoveRows(this->createIndex(_study->row, 0, nullptr), _row, _row);
+    m_series_items.erase(_study->children[static_cast<std::size_t>(_row)].uid);
+    _study->children.erase(_study->children.begin() + _row);
+    this->endRemoveRows();
+
+    if(_study->children.empty())
     {
-        this->remove_study_item(parent);
+        this->remove_study_row(_study);
     }
-
-    return is_removed;
 }
 
 //-----------------------------------------------------------------------------
 
-QStandardItem* selector_model::find_series_item(data::series::sptr _series)
+QModelIndex selector_model::find_series_item(data::series::sptr _series)
 {
-    QStandardItem* series_item = nullptr;
-    QStandardItem* study_item  = this->find_study_item(_series);
+    // The study of the series may not have been fetched yet
+    this->fetch_study(_series->get_study_instance_uid());
 
-    if(study_item != nullptr)
+    const auto itr = m_series_items.find(_series->get_id());
+    if(itr == m_series_items.end())
     {
-        int nb_row = study_item->rowCount();
-        for(int row = 0 ; row < nb_row ; ++row)
-        {
-            QStandardItem* child  = study_item->child(row, 0);
-            std::string series_id = child->data(role::uid).toString().toStdString();
-            if(series_id == _series->get_id())
-            {
-                series_item = child;
-                break;
-            }
-        }
+        return {};
     }
 
-    return series_item;
+    return this->createIndex(find_series_row(*itr->second, _series->get_id()), 0, itr->second);
 }
 
 //-----------------------------------------------------------------------------
 
-QStandardItem* selector_model::find_study_item(data::series::sptr _series)
+QModelIndex selector_model::find_study_item(data::series::sptr _series)
 {
-    data::dicom_value_t study_instance_uid = _series->get_study_instance_uid();
+    const data::dicom_value_t study_instance_uid = _series->get_study_instance_uid();
+    this->fetch_study(study_instance_uid);
 
-    QStandardItem* study_item = m_items[study_instance_uid];
-    return study_item;
+    const auto itr = m_items.find(study_instance_uid);
+    return itr != m_items.end() ? this->createIndex(itr->second->row, 0, nullptr) : QModelIndex();
 }
 
 //-----------------------------------------------------------------------------
@@ -789,6 +1119,16 @@ QStandardItem* selector_model::find_study_item(data::series::sptr _series)
 void selector_model::set_series_icons(const series_icon_t& _series_icons)
 {
     m_series_icons = _series_icons;
+    m_icons.clear();
+
+    // Icons already displayed are looked up again
+    for(const auto& study : m_studies)
+    {
+        for(const row_t& series : study->children)
+        {
+            series.icon.reset();
+        }
+    }
 }
 
 } // namespace sight::ui::qt::series
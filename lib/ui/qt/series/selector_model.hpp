@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -26,19 +26,29 @@
 
 #include <data/series.hpp>
 
+#include <QAbstractItemModel>
+#include <QIcon>
 #include <QPointer>
-#include <QStandardItem>
-#include <QStandardItemModel>
+#include <QStringList>
 
+#include <deque>
 #include <filesystem>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace sight::ui::qt::series
 {
 
 /**
  * @brief This class represents the selector Model.
+ *
+ * The model is a two levels tree of studies and series. Rows only hold the series they represent, and cells are
+ * formatted when a view displays them. Studies and series are indexed by their UID. Series added in batch are kept
+ * aside until a view fetches them, one page of studies at a time.
  */
-class SIGHT_UI_QT_CLASS_API_QT selector_model : public QStandardItemModel
+class SIGHT_UI_QT_CLASS_API_QT selector_model : public QAbstractItemModel
 {
 Q_OBJECT
 
@@ -62,7 +72,8 @@ public:
     /// Defines the map associating icons to series (map\<series classname, icon path\>)
     using series_icon_t = std::map<std::string, std::string>;
 
-    using QStandardItemModel::removeRows;
+    using QAbstractItemModel::removeRows;
+    using QObject::parent;
 
     /// Initializes the model.
     SIGHT_UI_QT_API_QT selector_model(
@@ -80,6 +91,18 @@ public:
      */
     SIGHT_UI_QT_API_QT void add_series(data::series::sptr _series);
 
+    /**
+     * @brief Adds several series at once. The studies that are not displayed yet are only inserted when a view
+     * fetches them, or when they are looked up.
+     */
+    SIGHT_UI_QT_API_QT void add_series(const std::vector<data::series::sptr>& _series);
+
+    /// Returns whether studies are waiting to be fetched, only the root has pending rows.
+    SIGHT_UI_QT_API_QT bool canFetchMore(const QModelIndex& _parent) const override;
+
+    /// Inserts the next page of pending studies.
+    SIGHT_UI_QT_API_QT void fetchMore(const QModelIndex& _parent) override;
+
     /**
      * @brief Removes the Series from the tree. After deletion, if the study is empty, it will be removed.
      * @param _series series to remove from the tree.
@@ -89,11 +112,30 @@ public:
     /// Clears all items in the model.
     SIGHT_UI_QT_API_QT void clear();
 
+    /// Returns the index of a study row, or of a series row when the parent is a study.
+    SIGHT_UI_QT_API_QT QModelIndex index(int _row, int _column, const QModelIndex& _parent = {}) const override;
+
+    /// Returns the study of a series index, an invalid index for a study.
+    SIGHT_UI_QT_API_QT QModelIndex parent(const QModelIndex& _index) const override;
+
+    /// Returns the number of studies, or of series in a study.
+    SIGHT_UI_QT_API_QT int rowCount(const QModelIndex& _parent = {}) const override;
+
+    /// Returns the number of displayed columns, with the remove buttons column if they are allowed.
+    SIGHT_UI_QT_API_QT int columnCount(const QModelIndex& _parent = {}) const override;
+
+    /// Returns the data of a cell, its text is formatted the first time it is requested.
+    SIGHT_UI_QT_API_QT QVariant data(const QModelIndex& _index, int _role = Qt::DisplayRole) const override;
+
+    /// Returns the column headers.
+    SIGHT_UI_QT_API_QT QVariant headerData(
+        int _section,
+        Qt::Orientation _orientation,
+        int _role = Qt::DisplayRole
+    ) const override;
+
     /// Returns item flags with non editable flag
-    Qt::ItemFlags flags(const QModelIndex& _index) const override
-    {
-        return QStandardItemModel::flags(_index) & ~Qt::ItemIsEditable;
-    }
+    SIGHT_UI_QT_API_QT Qt::ItemFlags flags(const QModelIndex& _index) const override;
 
     /// Returns the type of the item (SERIES or STUDY) associated to the ITEM_TYPE role.
     SIGHT_UI_QT_API_QT item_t get_item_type(const QModelIndex& _index);
@@ -108,11 +150,11 @@ public:
     /// Removes the rows given by the indexes.
     SIGHT_UI_QT_API_QT void removeRows(const QModelIndexList _indexes);
 
-    /// Returns the series item representing the series.
-    SIGHT_UI_QT_API_QT QStandardItem* find_series_item(data::series::sptr _series);
+    /// Returns the index of the row representing the series, invalid if the series is not in the model.
+    SIGHT_UI_QT_API_QT QModelIndex find_series_item(data::series::sptr _series);
 
-    /// Returns the item representing the study.
-    SIGHT_UI_QT_API_QT QStandardItem* find_study_item(data::series::sptr _series);
+    /// Returns the index of the row representing the study of the series, invalid if it is not in the model.
+    SIGHT_UI_QT_API_QT QModelIndex find_study_item(data::series::sptr _series);
 
     /**
      * @brief Sets the specific icons for series in selector.
@@ -148,35 +190,95 @@ Q_SIGNALS:
 
 private:
 
-    using study_uid_item_map_type = std::map<data::dicom_value_t, QStandardItem*>;
+    /// Row of a series, or of a study formatted with its first series
+    struct row_t
+    {
+        data::series::cwptr series;
+
+        /// Study instance UID or series ID
+        std::string uid;
 
-    /**
-     * @brief Returns the informations contained in the data container as a string, all items are separated by the
-     * separator.
-     */
-    template<typename T>
-    QStandardItem* get_info(T _data, QString _separator);
+        /// Whether the row was added in insert mode
+        bool bold {false};
+
+        /// Cells, formatted when they are first displayed
+        mutable std::vector<std::optional<QString> > cells;
+        mutable std::optional<QIcon> icon;
+    };
+
+    struct study_row_t : row_t
+    {
+        /// Position of the study in the model
+        int row {0};
+        std::vector<row_t> children;
+    };
 
-    /// Removes the study item and all the series associated.
-    bool remove_study_item(QStandardItem* _item);
+    /// Number of studies inserted by each fetch
+    static constexpr std::size_t FETCH_SIZE = 256;
 
-    /// Removes the series item and the parent study if it is the last series in the study.
-    bool remove_series_item(QStandardItem* _item);
+    /// Returns the study of an index, or the study containing the series of an index.
+    study_row_t* get_study(const QModelIndex& _index) const;
 
-    /// Adds the icon corresponding to the type of series.
-    void add_series_icon(data::series::sptr _series, QStandardItem* _item);
+    /// Returns the row of an index.
+    const row_t& get_row(const QModelIndex& _index) const;
+
+    /// Returns the position of a series in its study, -1 if it is not found.
+    static int find_series_row(const study_row_t& _study, const std::string& _id);
+
+    /// Removes the study row and all the series associated.
+    void remove_study_row(study_row_t* _study);
+
+    /// Removes the series row and the parent study if it is the last series in the study.
+    void remove_series_row(study_row_t* _study, int _row);
+
+    /// Returns the icon corresponding to the type of series.
+    QIcon get_series_icon(const data::series& _series) const;
+
+    /// Inserts a pending study in the model.
+    void fetch_study(const data::dicom_value_t& _study_instance_uid);
+
+    /// Builds the rows of a pending study, without inserting it in the model, null if the study is not pending.
+    std::unique_ptr<study_row_t> take_pending_study(const data::dicom_value_t& _study_instance_uid);
+
+    /// Inserts built studies at the end of the model, notifying the views once.
+    void append_studies(std::vector<std::unique_ptr<study_row_t> > _studies);
+
+    /// Creates the row of a series.
+    row_t create_series_row(const data::series::sptr& _series) const;
+
+    /// Appends the row of a series to a study in the model.
+    void add_series_row(study_row_t* _study, const data::series::sptr& _series);
+
+    /// Places a remove button on the last cell of the row of the given index.
+    void add_remove_button(const QModelIndex& _index, const std::string& _uid, item_t _type);
 
     /// Initializes model. Sets headers of the selector.
     void init();
 
-    /// Defines the number of studies rows in the tree.
-    int m_study_row_count {0};
+    /// Stores the studies in the order of the rows.
+    std::vector<std::unique_ptr<study_row_t> > m_studies;
 
     /**
-     * @brief Stores a map to register the association of study Instance UID  and study root item.
+     * @brief Stores a map to register the association of study Instance UID and study row.
      * It is used to associate the series to its study in the tree.
      */
-    study_uid_item_map_type m_items;
+    std::unordered_map<data::dicom_value_t, study_row_t*> m_items;
+
+    /// Associates the series ID and the study containing it.
+    std::unordered_map<std::string, study_row_t*> m_series_items;
+
+    /// Stores the series of the studies that were not fetched yet, and the order in which they were added.
+    std::unordered_map<data::dicom_value_t, std::vector<data::series::sptr> > m_pending;
+    std::deque<data::dicom_value_t> m_pending_order;
+
+    /// Headers of the columns.
+    QStringList m_headers;
+
+    /// Whether the series cells of each column show the icon of the series.
+    std::vector<bool> m_icon_columns;
+
+    /// Caches the icons by path.
+    mutable std::map<std::string, QIcon> m_icons;
 
     /// Defines if the selector is in insert mode (adding new series, forbid selection of existing series).
     bool m_insert {false};
@@ -197,31 +299,6 @@ private:
     std::vector<std::string> m_display_columns;
 };
 
-//------------------------------------------------------------------------------
-
-template<typename T>
-QStandardItem* selector_model::get_info(T _data, QString _separator)
-{
-    QString data_str;
-    if(!_data.empty())
-    {
-        typename T::iterator itr = _data.begin();
-        std::ostringstream str;
-        str << *itr++;
-        data_str = QString::fromStdString(str.str());
-
-        for( ; itr != _data.end() ; ++itr)
-        {
-            str.str("");
-            str << *itr;
-            data_str.append(_separator + QString::fromStdString(str.str()));
-        }
-    }
-
-    QStandardItem* item = new QStandardItem(data_str);
-    return item;
-}
-
 //-----------------------------------------------------------------------------
 
 inline void selector_model::set_insert_mode(bool _insert)
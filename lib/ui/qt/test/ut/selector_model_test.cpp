@@ -0,0 +1,303 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+
+#include "selector_model_test.hpp"
+
+#include <core/profiling.hpp>
+
+#include <data/image_series.hpp>
+#include <data/model_series.hpp>
+
+#include <ui/qt/series/selector_model.hpp>
+
+#include <QAbstractItemModelTester>
+
+#include <array>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::ui::qt::ut::selector_model_test);
+
+namespace sight::ui::qt::ut
+{
+
+static const std::string COLUMNS =
+    "PatientName/SeriesInstanceUID,Modality,StudyDescription/SeriesDescription,StudyDate/SeriesDate";
+
+//------------------------------------------------------------------------------
+
+static data::series::sptr make_series(const std::string& _study_uid, std::size_t _index)
+{
+    data::series::sptr series = _index % 2 == 0
+                                ? data::series::sptr(std::make_shared<data::image_series>())
+                                : data::series::sptr(std::make_shared<data::model_series>());
+    series->set_study_instance_uid(_study_uid);
+    series->set_series_instance_uid(_study_uid + "." + std::to_string(_index));
+    series->set_patient_name("Doe^John");
+    series->set_study_description("Study " + _study_uid);
+    series->set_series_description("Series " + std::to_string(_index));
+    series->set_modality("CT");
+    series->set_study_date("20250101");
+    series->set_series_date("20250102");
+    return series;
+}
+
+//------------------------------------------------------------------------------
+
+void selector_model_test::setUp()
+{
+    // Set up context before running a test.
+    static std::string arg1 = "selector_model_test";
+#if defined(__linux)
+    static std::string arg2 = "-platform";
+    static std::string arg3 = "offscreen";
+    static std::array argv  = {arg1.data(), arg2.data(), arg3.data(), static_cast<char*>(nullptr)};
+#else
+    static std::array argv = {arg1.data(), static_cast<char*>(nullptr)};
+#endif
+    static int argc = int(argv.size() - 1);
+
+    m_app = std::make_unique<QApplication>(argc, argv.data());
+}
+
+//------------------------------------------------------------------------------
+
+void selector_model_test::tearDown()
+{
+    // Clean up after the test run.
+    m_app.reset();
+}
+
+//------------------------------------------------------------------------------
+
+void selector_model_test::index_test()
+{
+    series::selector_model model(COLUMNS);
+
+    // Checks the consistency of the model after each change
+    QAbstractItemModelTester tester(&model, QAbstractItemModelTester::FailureReportingMode::Warning);
+
+    const auto first  = make_series("1.2.3", 0);
+    const auto second = make_series("1.2.3", 1);
+    const auto third  = make_series("4.5.6", 2);
+
+    model.add_series(first);
+    model.add_series(second);
+    model.add_series(third);
+    CPPUNIT_ASSERT_EQUAL(2, model.rowCount());
+    CPPUNIT_ASSERT_EQUAL(4, model.columnCount());
+
+    const QModelIndex study = model.find_study_item(first);
+    CPPUNIT_ASSERT(study.isValid());
+    CPPUNIT_ASSERT(study == model.find_study_item(second));
+    CPPUNIT_ASSERT_EQUAL(2, model.rowCount(study));
+    CPPUNIT_ASSERT(model.find_study_item(third) != study);
+    CPPUNIT_ASSERT_EQUAL(series::selector_model::study, model.get_item_type(study));
+
+    const QModelIndex series_index = model.find_series_item(second);
+    CPPUNIT_ASSERT(series_index.isValid());
+    CPPUNIT_ASSERT(study == series_index.parent());
+    CPPUNIT_ASSERT_EQUAL(series::selector_model::series, model.get_item_type(model.get_index(series_index, 2)));
+    CPPUNIT_ASSERT_EQUAL(
+        second->get_id(),
+        series_index.data(series::selector_model::uid).toString().toStdString()
+    );
+
+    // The study disappears with its last series, and so do the indexes
+    model.remove_series(third);
+    CPPUNIT_ASSERT_EQUAL(1, model.rowCount());
+    CPPUNIT_ASSERT(!model.find_series_item(third).isValid());
+    CPPUNIT_ASSERT(!model.find_study_item(third).isValid());
+
+    model.remove_series(first);
+    CPPUNIT_ASSERT_EQUAL(1, model.rowCount(model.find_study_item(second)));
+    CPPUNIT_ASSERT(!model.find_series_item(first).isValid());
+    CPPUNIT_ASSERT(model.find_series_item(second) == model.index(0, 0, model.find_study_item(second)));
+
+    model.clear();
+    CPPUNIT_ASSERT_EQUAL(0, model.rowCount());
+    CPPUNIT_ASSERT(!model.find_series_item(second).isValid());
+}
+
+//------------------------------------------------------------------------------
+
+void selector_model_test::lazy_test()
+{
+    series::selector_model model(COLUMNS);
+
+    const auto series = make_series("1.2.3", 0);
+    model.add_series(series);
+
+    // Cells are formatted when they are first displayed
+    series->set_series_description("Edited");
+
+    const QModelIndex study_index = model.index(0, 0);
+    CPPUNIT_ASSERT_EQUAL(std::string("Doe^John"), model.data(study_index).toString().toStdString());
+
+    const QModelIndex description_index = model.index(0, 2, study_index);
+    CPPUNIT_ASSERT(model.data(description_index).toString().endsWith(": Edited"));
+    CPPUNIT_ASSERT_EQUAL(
+        std::string("01/02/2025"),
+        model.data(model.index(0, 3, study_index)).toString().toStdString()
+    );
+
+    // Once formatted, the cell keeps its text
+    series->set_series_description("Edited again");
+    CPPUNIT_ASSERT(model.data(description_index).toString().endsWith(": Edited"));
+}
+
+//------------------------------------------------------------------------------
+
+void selector_model_test::fetch_test()
+{
+    static constexpr std::size_t s_STUDIES = 1000;
+
+    series::selector_model model(COLUMNS);
+
+    std::vector<data::series::sptr> all_series;
+    for(std::size_t i = 0 ; i < s_STUDIES ; ++i)
+    {
+        all_series.push_back(make_series(std::to_string(i), 2 * i));
+        all_series.push_back(make_series(std::to_string(i), 2 * i + 1));
+    }
+
+    model.add_series(all_series);
+
+    // Only the first page is built
+    CPPUNIT_ASSERT(model.rowCount() > 0);
+    CPPUNIT_ASSERT(model.rowCount() < int(s_STUDIES));
+    CPPUNIT_ASSERT(model.canFetchMore({}));
+    CPPUNIT_ASSERT(!model.canFetchMore(model.index(0, 0)));
+
+    // Looking up a series that was not fetched yet builds its study
+    const int rows         = model.rowCount();
+    const QModelIndex last = model.find_series_item(all_series.back());
+    CPPUNIT_ASSERT(last.isValid());
+    CPPUNIT_ASSERT_EQUAL(rows + 1, model.rowCount());
+    CPPUNIT_ASSERT_EQUAL(2, model.rowCount(last.parent()));
+
+    // Removing a series that was not fetched yet
+    model.remove_series(all_series[all_series.size() - 4]);
+
+    while(model.canFetchMore({}))
+    {
+        model.fetchMore({});
+    }
+
+    CPPUNIT_ASSERT_EQUAL(int(s_STUDIES), model.rowCount());
+    CPPUNIT_ASSERT(!model.find_series_item(all_series[all_series.size() - 4]).isValid());
+    CPPUNIT_ASSERT_EQUAL(1, model.rowCount(model.find_study_item(all_series[all_series.size() - 3])));
+
+    for(int row = 0 ; row < model.rowCount() ; ++row)
+    {
+        CPPUNIT_ASSERT(model.rowCount(model.index(row, 0)) > 0);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void selector_model_test::remove_rows_test()
+{
+    series::selector_model model(COLUMNS);
+    QAbstractItemModelTester tester(&model, QAbstractItemModelTester::FailureReportingMode::Warning);
+
+    std::vector<data::series::sptr> all_series;
+    for(std::size_t i = 0 ; i < 4 ; ++i)
+    {
+        all_series.push_back(make_series(std::to_string(i), 2 * i));
+        all_series.push_back(make_series(std::to_string(i), 2 * i + 1));
+    }
+
+    model.add_series(all_series);
+    CPPUNIT_ASSERT_EQUAL(4, model.rowCount());
+
+    const QPersistentModelIndex last_study  = model.find_study_item(all_series.back());
+    const QPersistentModelIndex last_series = model.find_series_item(all_series.back());
+
+    // Remove a whole study, with one of its series selected as well, and a series of another study
+    model.removeRows(
+        {
+            model.find_study_item(all_series[0]),
+            model.find_series_item(all_series[1]),
+            model.find_series_item(all_series[2])
+        });
+
+    CPPUNIT_ASSERT_EQUAL(3, model.rowCount());
+    CPPUNIT_ASSERT(!model.find_study_item(all_series[0]).isValid());
+    CPPUNIT_ASSERT(!model.find_series_item(all_series[1]).isValid());
+    CPPUNIT_ASSERT(!model.find_series_item(all_series[2]).isValid());
+    CPPUNIT_ASSERT_EQUAL(1, model.rowCount(model.find_study_item(all_series[3])));
+
+    // The indexes of the next rows follow their rows
+    CPPUNIT_ASSERT_EQUAL(2, last_study.row());
+    CPPUNIT_ASSERT(last_study == model.find_study_item(all_series.back()));
+    CPPUNIT_ASSERT(last_series == model.find_series_item(all_series.back()));
+    CPPUNIT_ASSERT(last_series.parent() == last_study);
+
+    // Removing the last series of a study removes the study
+    model.removeRows({model.find_series_item(all_series[3])});
+    CPPUNIT_ASSERT_EQUAL(2, model.rowCount());
+    CPPUNIT_ASSERT_EQUAL(1, last_study.row());
+}
+
+//------------------------------------------------------------------------------
+
+void selector_model_test::benchmark_insertion()
+{
+    static constexpr std::size_t s_SERIES           = 50000;
+    static constexpr std::size_t s_SERIES_PER_STUDY = 10;
+
+    std::vector<data::series::sptr> all_series;
+    all_series.reserve(s_SERIES);
+    for(std::size_t i = 0 ; i < s_SERIES ; ++i)
+    {
+        all_series.push_back(make_series(std::to_string(i / s_SERIES_PER_STUDY), i));
+    }
+
+    series::selector_model model(COLUMNS);
+
+    {
+        FW_PROFILE("Selector model, insert every series");
+        model.add_series(all_series);
+    }
+
+    {
+        FW_PROFILE("Selector model, fetch every study");
+        while(model.canFetchMore({}))
+        {
+            model.fetchMore({});
+        }
+    }
+
+    {
+        FW_PROFILE("Selector model, look every series up");
+        for(const auto& series : all_series)
+        {
+            CPPUNIT_ASSERT(model.find_series_item(series).isValid());
+        }
+    }
+
+    CPPUNIT_ASSERT_EQUAL(int(s_SERIES / s_SERIES_PER_STUDY), model.rowCount());
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::ui::qt::ut
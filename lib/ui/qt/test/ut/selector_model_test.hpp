@@ -0,0 +1,63 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+
+#pragma once
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <QApplication>
+
+#include <memory>
+
+namespace sight::ui::qt::ut
+{
+
+class selector_model_test : public CPPUNIT_NS::TestFixture
+{
+private:
+
+    CPPUNIT_TEST_SUITE(selector_model_test);
+    CPPUNIT_TEST(index_test);
+    CPPUNIT_TEST(lazy_test);
+    CPPUNIT_TEST(fetch_test);
+    CPPUNIT_TEST(remove_rows_test);
+    CPPUNIT_TEST(benchmark_insertion);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // interface
+    void setUp() override;
+    void tearDown() override;
+
+    static void index_test();
+    static void lazy_test();
+    static void fetch_test();
+    static void remove_rows_test();
+    static void benchmark_insertion();
+
+private:
+
+    std::unique_ptr<QApplication> m_app;
+};
+
+} // namespace sight::ui::qt::ut
@@ -69,6 +69,15 @@ void synchronizer::configuring()
     m_legacy_auto_sync = cfg.get<bool>(config_key::LEGACY_AUTO_SYNCH, m_legacy_auto_sync);
 
     m_tolerance = cfg.get<core::clock::type>(config_key::TOLERANCE, m_tolerance);
+
+    const auto mode_name = cfg.get<std::string>(config_key::MODE, "closest");
+    SIGHT_ASSERT(
+        "Synchronization mode must be 'closest' or 'interpolated', not '" << mode_name << "'",
+        mode_name == "closest" || mode_name == "interpolated"
+    );
+    m_mode = mode_name == "interpolated" ? mode::interpolated : mode::closest;
+
+    m_extrapolation = cfg.get<core::clock::type>(config_key::EXTRAPOLATION, m_extrapolation);
 }
 
 //-----------------------------------------------------------------------------
@@ -339,6 +348,9 @@ void synchronizer::synchronize()
         }
     }
 
+    // Frames can not be interpolated, so they give the synchronization timestamp and matrices are interpolated at it
+    const core::clock::type frame_synchronization_timestamp = synchronization_timestamp;
+
     std::vector<std::size_t> matrix_tl_to_synch_index;
     for(std::size_t i = 0 ; i < matrix_tl_populated_timestamp.size() ; i++)
     {
@@ -349,6 +361,11 @@ void synchronizer::synchronize()
         }
     }
 
+    if(m_mode == mode::interpolated && !frame_tl_to_synch_index.empty())
+    {
+        synchronization_timestamp = frame_synchronization_timestamp;
+    }
+
     //step 3: get the matrix + frame and populate the output
 
     if(m_last_time_stamp != synchronization_timestamp)
@@ -534,9 +551,18 @@ void synchronizer::copy_matrix_from_tl_to_output(
     core::clock::type _synchronization_timestamp
 )
 {
-    const auto matrix_tl = m_matrix_tl_s[_matrix_tl_index].lock();
-    CSPTR(data::matrix_tl::buffer_t) buffer =
-        matrix_tl->get_closest_buffer(_synchronization_timestamp - m_matrix_tl_delay[_matrix_tl_index]);
+    const auto matrix_tl              = m_matrix_tl_s[_matrix_tl_index].lock();
+    const core::clock::type timestamp = _synchronization_timestamp - m_matrix_tl_delay[_matrix_tl_index];
+    CSPTR(data::matrix_tl::buffer_t) buffer;
+    if(m_mode == mode::interpolated)
+    {
+        buffer = matrix_tl->get_interpolated_buffer(timestamp, m_extrapolation);
+    }
+
+    if(!buffer)
+    {
+        buffer = matrix_tl->get_closest_buffer(timestamp);
+    }
 
     if(buffer)
     {
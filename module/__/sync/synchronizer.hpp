@@ -96,6 +96,8 @@ namespace sight::module::sync
             <key uid="matrix4" tl="0" index2"/>
         </inout>
         <tolerance>500</tolerance>
+        <mode>interpolated</mode>
+        <extrapolation>10</extrapolation>
     </service>
    @endcode
  *
@@ -129,6 +131,13 @@ namespace sight::module::sync
  * should not be set to "true" in new configurations (default: false).
  * - \b tolerance : defines the maximum distance between two frames (default: 500).
  *      If a timeline exceeds this tolerance it will not be synchronized (default: true).
+ * - \b mode : defines how matrices are picked in their timelines (default: closest).
+ *    - closest: the matrices the closest to the synchronization timestamp are used.
+ *    - interpolated: the matrices are interpolated at the synchronization timestamp. When frames are synchronized, the
+ *      synchronization timestamp is the one of the frames, since they can not be interpolated. This removes the
+ *      jitter between frames and matrices acquired at different rates.
+ * - \b extrapolation : in interpolated mode, defines how far in milliseconds the matrices can be extrapolated after
+ *      the last one of their timeline (default: 0). If the matrix can not be extrapolated, the closest one is used.
  */
 class synchronizer final : public service::synchronizer
 {
@@ -181,6 +190,15 @@ public:
         static inline const std::string MATRIX_INOUT      = "matrix";
         static inline const std::string TOLERANCE         = "tolerance";
         static inline const std::string LEGACY_AUTO_SYNCH = "legacyAutoSync";
+        static inline const std::string MODE              = "mode";
+        static inline const std::string EXTRAPOLATION     = "extrapolation";
+    };
+
+    /// Defines how matrices are picked in their timelines
+    enum class mode : std::uint8_t
+    {
+        closest,
+        interpolated
     };
 
     /// Internal wrapper used for out variable association with TLs
@@ -390,6 +408,12 @@ private:
     /// Tolerance to take into account matrix
     core::clock::type m_tolerance {500.};
 
+    /// Whether matrices are interpolated or picked at the closest timestamp
+    mode m_mode {mode::closest};
+
+    /// Maximum extrapolation of matrices after the end of their timeline, in interpolated mode
+    core::clock::type m_extrapolation {0.};
+
     core::clock::type m_last_time_stamp {0.};
 
     bool m_locked {false};
@@ -2116,4 +2116,84 @@ void synchronizer_test::single_image_series_tl_population()
 
 //------------------------------------------------------------------------------
 
+void synchronizer_test::interpolated_synchronisation()
+{
+    std::stringstream config_string;
+    config_string
+    << "<in group=\"frame_tl\">"
+       "    <key uid=\"frameTL1\" />"
+       "</in>"
+       "<inout group=\"frames\">"
+       "    <key uid=\"frame1\" />"
+       "</inout>"
+       "<in group=\"matrix_tl\">"
+       "    <key uid=\"matrixTL1\" />"
+       "</in>"
+       "<inout group=\"matrix\">"
+       "    <key uid=\"matrix1\" />"
+       "</inout>"
+       "<tolerance>50</tolerance>"
+       "<mode>interpolated</mode>"
+       "<extrapolation>5</extrapolation>";
+
+    synchronizer_tester tester(config_string);
+
+    tester.frame_tl_1 = std::make_shared<data::frame_tl>();
+    tester.frame_tl_1->init_pool_size(
+        tester.frame_size[0],
+        tester.frame_size[1],
+        core::type::UINT8,
+        sight::data::frame_tl::pixel_format::gray_scale
+    );
+    tester.matrix_tl_1 = std::make_shared<data::matrix_tl>();
+    tester.matrix_tl_1->init_pool_size(1);
+    tester.frame1 = std::make_shared<data::image>();
+    tester.frame1->resize(tester.frame_size, core::type::UINT8, data::image::pixel_format_t::gray_scale);
+    tester.matrix1 = std::make_shared<data::matrix4>();
+
+    tester.srv->set_input(tester.frame_tl_1, "frame_tl", true, false, 0);
+    tester.srv->set_input(tester.matrix_tl_1, "matrix_tl", true, false, 0);
+    tester.srv->set_inout(tester.frame1, "frames", false, false, 0);
+    tester.srv->set_inout(tester.matrix1, "matrix", false, false, 0);
+    tester.srv->start().wait();
+
+    core::clock::type last_timestamp_synch = 0;
+    auto slot_synchronization_done         =
+        sight::core::com::new_slot(
+            [&last_timestamp_synch](core::clock::type _timestamp)
+        {
+            last_timestamp_synch = _timestamp;
+        });
+    slot_synchronization_done->set_worker(sight::core::thread::get_default_worker());
+    auto synch_done_connection = tester.srv->signal("synchronization_done")->connect(slot_synchronization_done);
+
+    // The frame gives the synchronization timestamp, the matrix is interpolated between the two surrounding ones
+    synchronizer_tester::add_matrix_to_matrix_tl(tester.matrix_tl_1, 10);
+    synchronizer_tester::add_matrix_to_matrix_tl(tester.matrix_tl_1, 20);
+    tester.add_frame_to_frame_tl(tester.frame_tl_1, 14);
+    tester.srv->slot("request_sync")->run();
+    tester.srv->slot("try_sync")->run();
+    SIGHT_TEST_FAIL_WAIT(last_timestamp_synch == 14);
+    synchronizer_tester::check_frame(tester.frame1, 14);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(14., (*tester.matrix1)(0, 0), 1e-5);
+
+    // The matrix is extrapolated a little after the end of its timeline
+    tester.add_frame_to_frame_tl(tester.frame_tl_1, 22);
+    tester.srv->slot("request_sync")->run();
+    tester.srv->slot("try_sync")->run();
+    SIGHT_TEST_FAIL_WAIT(last_timestamp_synch == 22);
+    synchronizer_tester::check_frame(tester.frame1, 22);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(22., (*tester.matrix1)(0, 0), 1e-5);
+
+    // But not further than the extrapolation limit, the closest matrix is used instead
+    tester.add_frame_to_frame_tl(tester.frame_tl_1, 40);
+    tester.srv->slot("request_sync")->run();
+    tester.srv->slot("try_sync")->run();
+    SIGHT_TEST_FAIL_WAIT(last_timestamp_synch == 40);
+    synchronizer_tester::check_frame(tester.frame1, 40);
+    synchronizer_tester::check_matrix(tester.matrix1, 20.);
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace sight::module::sync::ut
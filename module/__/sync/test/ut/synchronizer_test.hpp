@@ -101,6 +101,7 @@ CPPUNIT_TEST(delay_test);
 CPPUNIT_TEST(tolerance_test);
 CPPUNIT_TEST(image_series_time_tagging_test);
 CPPUNIT_TEST(single_image_series_tl_population);
+CPPUNIT_TEST(interpolated_synchronisation);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -170,6 +171,7 @@ public:
     /// Test with an ImageSeries and matrices to ensure timestamp data is written in the ImageSeries
     /// assuming a more complex context
     static void single_image_series_tl_population();
+    static void interpolated_synchronisation();
 };
 
 } // namespace sight::module::sync::ut
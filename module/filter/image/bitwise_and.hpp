@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2018-2024 IRCAD France
+ * Copyright (C) 2018-2025 IRCAD France
  * Copyright (C) 2018-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -32,6 +32,9 @@ namespace sight::module::filter::image
 /**
  * @brief Implements the AND bitwise operator pixel-wise between two images.
  *
+ * The mask is considered as binary: the pixels of the image are kept where the mask is not null and set to 0 elsewhere.
+ * The mask must be of an integer type.
+ *
  * @section XML XML Configuration
  * @code{.xml}
        <service uid="..." type="sight::module::filter::image::bitwise_and">
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -20,20 +20,16 @@
  *
  ***********************************************************************/
 
-#include <io/itk/itk.hpp>
+#include "images_substract.hpp"
 
 #include <core/com/signal.hxx>
-
 #include <core/spy_log.hpp>
 
-#include <ui/__/dialog/message.hpp>
+#include <filter/image/pixelwise.hpp>
 
-// Services tools
 #include <service/macros.hpp>
 
-#include "images_substract.hpp"
-
-#include <itkSubtractImageFilter.h>
+#include <ui/__/dialog/message.hpp>
 
 namespace sight::module::filter::image
 {
@@ -67,14 +63,12 @@ void images_substract::stopping()
 
 void images_substract::updating()
 {
-    core::type requested_type = core::type::INT16;
-
     const auto image1 = m_image1.lock();
     const auto image2 = m_image2.lock();
     auto image_result = m_result.lock();
 
-    // Test if the both images have the same type and it is signed short.
-    const bool is_same_type = (image1->type() == image2->type() && image1->type() == requested_type);
+    // Test if the both images have the same type.
+    const bool is_same_type = (image1->type() == image2->type());
 
     if(is_same_type)
     {
@@ -82,28 +76,11 @@ void images_substract::updating()
         const bool is_same_size = (image1->size() == image2->size());
         if(is_same_size)
         {
-            using image_t = itk::Image<std::int16_t, 3>;
-
-            image_t::Pointer itk_image1 = io::itk::move_to_itk<image_t>(image1.get_shared());
-            SIGHT_ASSERT("Unable to convert data::image to itkImage", itk_image1);
-
-            image_t::Pointer itk_image2 = io::itk::move_to_itk<image_t>(image2.get_shared());
-            SIGHT_ASSERT("Unable to convert data::image to itkImage", itk_image2);
-
-            image_t::Pointer output;
-
-            //Create filter
-            using subtract_image_filter_t = itk::SubtractImageFilter<image_t, image_t, image_t>;
-            subtract_image_filter_t::Pointer filter;
-            filter = subtract_image_filter_t::New();
-            assert(filter);
-
-            filter->SetInput1(itk_image1);
-            filter->SetInput2(itk_image2);
-            filter->Update();
-            output = filter->GetOutput();
-            assert(output->GetSource());
-            io::itk::move_from_itk<image_t>(output, image_result.get_shared(), true);
+            sight::filter::image::pixelwise::subtract(
+                image1.get_shared(),
+                image2.get_shared(),
+                image_result.get_shared()
+            );
 
             auto sig = image_result->signal<data::object::modified_signal_t>(data::object::MODIFIED_SIG);
             sig->async_emit();
@@ -121,7 +98,7 @@ void images_substract::updating()
     {
         sight::ui::dialog::message::show(
             "Warning",
-            "Both Images must have signed short as type.",
+            "Both images must have the same type.",
             sight::ui::dialog::message::warning
         );
     }
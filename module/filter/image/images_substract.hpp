@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -31,6 +31,8 @@ namespace sight::module::filter::image
 
 /**
  * @brief Compute the substraction of two images.
+ *
+ * Both images must have the same type and the same size. The result has the type of the inputs.
 
  * @section XML XML Configuration
  *
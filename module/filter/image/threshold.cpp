@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -23,11 +23,13 @@
 #include "module/filter/image/threshold.hpp"
 
 #include <core/com/signal.hxx>
-#include <core/tools/dispatcher.hpp>
+#include <core/memory/buffer_allocation_policy.hpp>
 
 #include <data/image.hpp>
 #include <data/image_series.hpp>
 
+#include <filter/image/pixelwise.hpp>
+
 namespace sight::module::filter::image
 {
 
@@ -68,62 +70,8 @@ void threshold::configuring()
 
 //-----------------------------------------------------------------------------
 
-/**
- * Functor to apply a threshold filter.
- *
- * The pixel with the value less than the threshold value will be set to 0, else the value is set to the maximum
- * value of the image pixel type.
- *
- * The functor provides a template method operator(param) to apply the filter
- */
-struct threshold_filter
-{
-    struct parameter
-    {
-        double threshold_value {};   ///< threshold value.
-        data::image::csptr image_in; ///< image source
-        data::image::sptr image_out; ///< image target: contains the result of the filter
-    };
-
-    /**
-     * @brief Applies the filter
-     * @tparam PIXELTYPE image pixel type (uint8, uint16, int8, int16, float, double, ....)
-     */
-    template<class PIXELTYPE>
-    void operator()(parameter& _param)
-    {
-        const auto threshold_value  = static_cast<PIXELTYPE>(_param.threshold_value);
-        data::image::csptr image_in = _param.image_in;
-        data::image::sptr image_out = _param.image_out;
-        SIGHT_ASSERT("Sorry, image must be 3D", image_in->num_dimensions() == 3);
-
-        image_out->copy_information(image_in); // Copy image size, type... without copying the buffer
-        image_out->resize(image_out->size(), image_out->type(), image_out->pixel_format());
-        const auto lockin   = image_in->dump_lock();
-        const auto lock_out = image_out->dump_lock();
-
-        // Get iterators on image buffers
-        auto it1           = image_in->begin<PIXELTYPE>();
-        const auto it1_end = image_in->end<PIXELTYPE>();
-        auto it2           = image_out->begin<PIXELTYPE>();
-        const auto it2_end = image_out->end<PIXELTYPE>();
-
-        const PIXELTYPE max_value = std::numeric_limits<PIXELTYPE>::max();
-
-        // Fill the target buffer considering the threshold
-        for( ; it1 != it1_end && it2 != it2_end ; ++it1, ++it2)
-        {
-            *it2 = (*it1 < threshold_value) ? 0 : max_value;
-        }
-    }
-};
-
-//-----------------------------------------------------------------------------
-
 void threshold::updating()
 {
-    threshold_filter::parameter param; // filter parameters: threshold value, image source, image target
-
     // retrieve the input object
     auto input = m_source.lock();
 
@@ -132,52 +80,40 @@ void threshold::updating()
         std::dynamic_pointer_cast<const data::image_series>(input.get_shared());
     data::image::csptr image_src = std::dynamic_pointer_cast<const data::image>(input.get_shared());
     data::object::sptr output;
+    data::image::sptr image_out;
 
     // Get source/target image
     if(image_series_src)
     {
-        param.image_in = image_series_src;
+        image_src = image_series_src;
         data::image_series::sptr image_series_dest = data::image_series::copy(image_series_src);
         // define the input image series as the reference
         image_series_dest->set_dicom_reference(image_series_src->get_dicom_reference());
 
         // create the output image
-        data::image::sptr image_out = std::make_shared<data::image>();
-        image_series_dest->image::shallow_copy(image_out);
-        param.image_out = image_series_dest;
-        output          = image_series_dest;
+        image_series_dest->image::shallow_copy(std::make_shared<data::image>());
+        image_out = image_series_dest;
+        output    = image_series_dest;
     }
     else if(image_src)
     {
-        param.image_in = image_src;
         // create the output image
-        data::image::sptr image_out = std::make_shared<data::image>();
-        param.image_out = image_out;
-        output          = image_out;
+        image_out = std::make_shared<data::image>();
+        output    = image_out;
     }
     else
     {
         SIGHT_THROW("Wrong type: source type must be an ImageSeries or an image");
     }
 
-    param.threshold_value = m_threshold;
-
-    // get image type
-    core::type type = param.image_in->type();
+    SIGHT_ASSERT("Sorry, image must be 3D", image_src->num_dimensions() == 3);
 
-    /* The dispatcher allows to apply the filter on any type of image.
-     * It invokes the template functor ThresholdFilter using the image type.
-     * - template parameters:
-     *   - core::tools::supported_dispatcher_types defined all the supported type of the functor, here all the type
-     *     supported by core::type(std::int8_t, std::uint8_t, std::int16_t, std::uint16_t, std::int32_t,
-     *     std::uint32_t, std::int64_t, std::uint64_t, float, double)
-     *   - ThresholdFilter: functor struct or class
-     * - parameters:
-     *   - type: core::type of the image
-     *   - param: struct containing the functor parameters (here the input and output images and the threshold value)
-     */
+    // A new output is created at each update, recycle the buffer of the previous outputs once they are released
+    image_out->set_allocation_policy(core::memory::buffer_pool_policy::get_default());
 
-    core::tools::dispatcher<core::tools::supported_dispatcher_types, threshold_filter>::invoke(type, param);
+    // Pixels lower than the threshold are set to 0, the others to the maximum value of the image type. The kernel is
+    // dispatched on the image type and runs vectorised on all the available cores.
+    sight::filter::image::pixelwise::threshold(image_src, image_out, m_threshold);
 
     // register the output image to be accesible by the other service from the XML configuration
     m_target = output;
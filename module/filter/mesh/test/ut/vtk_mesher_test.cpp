@@ -24,6 +24,7 @@
 #include "data/exception.hpp"
 
 #include <core/os/temp_path.hpp>
+#include <core/profiling.hpp>
 #include <core/runtime/runtime.hpp>
 #include <core/tools/random/generator.hpp>
 
@@ -230,4 +231,188 @@ void vtk_mesher_test::no_mesh_generated()
     sight::service::remove(mesher_service);
 }
 
+//------------------------------------------------------------------------------
+
+void vtk_mesher_test::generate_mesh_with_bricks()
+{
+    // Create service
+    auto [mesher_service, image_series] = generate_mesh_service();
+
+    service::config_t config;
+    std::stringstream config_string;
+    config_string
+    << R"(<in key="image_series" uid="image_series"/>)"
+       R"(<out key="model_series" uid="modelSeries"/>)"
+       R"(<properties percent_reduction="0" value="255" brick_size="8"/>)";
+
+    auto model_series = std::make_shared<sight::data::model_series>();
+
+    boost::property_tree::read_xml(config_string, config);
+    mesher_service->set_config(config);
+    mesher_service->set_input(image_series, "image_series");
+    mesher_service->set_inout(model_series, "model_series");
+    mesher_service->configure();
+    mesher_service->start().get();
+
+    // The stitched bricks give the same surface as the whole volume, also when they are reused
+    for(std::size_t i = 1 ; i <= 2 ; ++i)
+    {
+        mesher_service->update().get();
+
+        unsigned int number_points = 147;
+        unsigned int number_cells  = 253;
+        CPPUNIT_ASSERT_EQUAL(i, model_series->get_reconstruction_db().size());
+        CPPUNIT_ASSERT_EQUAL(number_points, model_series->get_reconstruction_db().back()->get_mesh()->num_points());
+        CPPUNIT_ASSERT_EQUAL(number_cells, model_series->get_reconstruction_db().back()->get_mesh()->num_cells());
+    }
+
+    mesher_service->stop().get();
+    sight::service::remove(mesher_service);
+}
+
+//------------------------------------------------------------------------------
+
+void vtk_mesher_test::benchmark_incremental()
+{
+    static constexpr std::size_t s_SIZE = 160;
+
+    // Three labelled balls, as an interactive segmentation would produce
+    auto image_series = std::make_shared<sight::data::image_series>();
+    utest_data::generator::image::generate_image(
+        image_series,
+        {s_SIZE, s_SIZE, s_SIZE},
+        {1., 1., 1.},
+        {0., 0., 0.},
+        {1., 0., 0., 0., 1., 0., 0., 0., 1.},
+        core::type::get<std::int16_t>(),
+        data::image::pixel_format_t::gray_scale
+    );
+
+    const auto label = [](std::size_t _x, std::size_t _y, std::size_t _z)
+                       {
+                           const auto inside = [&](double _cx, double _cy, double _cz, double _radius)
+                                               {
+                                                   const double dx = double(_x) - _cx;
+                                                   const double dy = double(_y) - _cy;
+                                                   const double dz = double(_z) - _cz;
+                                                   return dx * dx + dy * dy + dz * dz < _radius * _radius;
+                                               };
+
+                           if(inside(50., 50., 50., 35.))
+                           {
+                               return 1;
+                           }
+
+                           if(inside(110., 60., 100., 40.))
+                           {
+                               return 2;
+                           }
+
+                           return inside(70., 115., 110., 30.) ? 3 : 0;
+                       };
+
+    {
+        const auto dump_lock = image_series->dump_lock();
+        auto* buffer         = static_cast<std::int16_t*>(image_series->buffer());
+        for(std::size_t z = 0 ; z < s_SIZE ; ++z)
+        {
+            for(std::size_t y = 0 ; y < s_SIZE ; ++y)
+            {
+                for(std::size_t x = 0 ; x < s_SIZE ; ++x)
+                {
+                    buffer[x + (y + z * s_SIZE) * s_SIZE] = std::int16_t(label(x, y, z));
+                }
+            }
+        }
+    }
+
+    const auto make_mesher = [&image_series](int _brick_size, const data::model_series::sptr& _model_series)
+                             {
+                                 sight::service::base::sptr mesher =
+                                     sight::service::add("sight::module::filter::mesh::vtk_mesher");
+
+                                 service::config_t config;
+                                 std::stringstream config_string;
+                                 config_string
+                                 << R"(<in key="image_series" uid="image_series"/>)"
+                                    R"(<out key="model_series" uid="modelSeries"/>)"
+                                    R"(<config mode="replace">)"
+                                    R"(<organ name="first" value="1"/>)"
+                                    R"(<organ name="second" value="2"/>)"
+                                    R"(<organ name="third" value="3"/>)"
+                                    R"(</config>)"
+                                    R"(<properties percent_reduction="0" flying_edges="true" brick_size=")"
+                                 << _brick_size << R"("/>)";
+
+                                 boost::property_tree::read_xml(config_string, config);
+                                 mesher->set_config(config);
+                                 mesher->set_input(image_series, "image_series");
+                                 mesher->set_inout(_model_series, "model_series");
+                                 mesher->configure();
+                                 mesher->start().get();
+                                 return mesher;
+                             };
+
+    auto full_model    = std::make_shared<sight::data::model_series>();
+    auto bricks_model  = std::make_shared<sight::data::model_series>();
+    auto full_mesher   = make_mesher(0, full_model);
+    auto bricks_mesher = make_mesher(32, bricks_model);
+
+    {
+        FW_PROFILE("Meshing of three labels, at once");
+        full_mesher->update().get();
+    }
+
+    {
+        FW_PROFILE("Meshing of three labels, in bricks");
+        bricks_mesher->update().get();
+    }
+
+    // A brush stroke grows the second label a little
+    {
+        const auto dump_lock = image_series->dump_lock();
+        auto* buffer         = static_cast<std::int16_t*>(image_series->buffer());
+        for(std::size_t z = 95 ; z < 105 ; ++z)
+        {
+            for(std::size_t y = 95 ; y < 105 ; ++y)
+            {
+                for(std::size_t x = 140 ; x < 150 ; ++x)
+                {
+                    buffer[x + (y + z * s_SIZE) * s_SIZE] = 2;
+                }
+            }
+        }
+    }
+
+    {
+        FW_PROFILE("Meshing of three labels after an edit, at once");
+        full_mesher->update().get();
+    }
+
+    {
+        FW_PROFILE("Meshing of three labels after an edit, with the cached bricks");
+        bricks_mesher->update().get();
+    }
+
+    // The incremental meshes match the ones computed from scratch
+    const auto& full_recs   = full_model->get_reconstruction_db();
+    const auto& bricks_recs = bricks_model->get_reconstruction_db();
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), full_recs.size());
+    CPPUNIT_ASSERT_EQUAL(full_recs.size(), bricks_recs.size());
+    for(std::size_t i = 0 ; i < full_recs.size() ; ++i)
+    {
+        CPPUNIT_ASSERT_EQUAL(full_recs[i]->get_organ_name(), bricks_recs[i]->get_organ_name());
+        CPPUNIT_ASSERT_EQUAL(full_recs[i]->get_mesh()->num_points(), bricks_recs[i]->get_mesh()->num_points());
+        CPPUNIT_ASSERT_EQUAL(full_recs[i]->get_mesh()->num_cells(), bricks_recs[i]->get_mesh()->num_cells());
+    }
+
+    for(const auto& mesher : {full_mesher, bricks_mesher})
+    {
+        mesher->stop().get();
+        sight::service::remove(mesher);
+    }
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace sight::module::filter::mesh::ut
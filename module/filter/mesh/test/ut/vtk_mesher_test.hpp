@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2022-2024 IRCAD France
+ * Copyright (C) 2022-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -35,6 +35,8 @@ CPPUNIT_TEST_SUITE(vtk_mesher_test);
 CPPUNIT_TEST(generate_mesh);
 CPPUNIT_TEST(generate_mesh_with_min_reduction);
 CPPUNIT_TEST(no_mesh_generated);
+CPPUNIT_TEST(generate_mesh_with_bricks);
+CPPUNIT_TEST(benchmark_incremental);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -46,6 +48,8 @@ public:
     static void generate_mesh();
     static void generate_mesh_with_min_reduction();
     static void no_mesh_generated();
+    static void generate_mesh_with_bricks();
+    static void benchmark_incremental();
 };
 
 } // namespace sight::module::filter::mesh::ut
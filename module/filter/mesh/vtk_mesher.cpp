@@ -39,6 +39,8 @@
 #include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
 
+#include <vtkAppendPolyData.h>
+#include <vtkCleanPolyData.h>
 #include <vtkCommand.h>
 #include <vtkConnectivityFilter.h>
 #include <vtkDecimatePro.h>
@@ -53,6 +55,11 @@
 #include <vtkThreshold.h>
 #include <vtkWindowedSincPolyDataFilter.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
 namespace sight::module::filter::mesh
 {
 
@@ -101,6 +108,111 @@ private:
 
 //-----------------------------------------------------------------------------
 
+static vtkSmartPointer<vtkPolyDataAlgorithm> make_contour_filter(int _value, bool _flying_edges)
+{
+    if(_flying_edges)
+    {
+        vtkSmartPointer<vtkDiscreteFlyingEdges3D> flying_edges = vtkSmartPointer<vtkDiscreteFlyingEdges3D>::New();
+        flying_edges->ComputeScalarsOn();
+        flying_edges->ComputeNormalsOn();
+
+        // Initialize the contour filter
+        flying_edges->SetValue(0, _value);
+
+        return flying_edges;
+    }
+
+    vtkSmartPointer<vtkDiscreteMarchingCubes> marching_cubes = vtkSmartPointer<vtkDiscreteMarchingCubes>::New();
+    marching_cubes->ComputeScalarsOn();
+    marching_cubes->ComputeNormalsOn();
+
+    // Initialize the contour filter
+    marching_cubes->SetValue(0, _value);
+
+    return marching_cubes;
+}
+
+//-----------------------------------------------------------------------------
+
+/// Copies the voxels of a brick and collects the requested labels it contains
+template<typename T>
+static void scan_brick(
+    const T* _data,
+    const int* _dims,
+    const std::array<int, 6>& _extent,
+    const std::set<int>& _values,
+    std::vector<std::uint8_t>& _voxels,
+    std::set<int>& _labels
+)
+{
+    const std::size_t row_size = std::size_t(_extent[1] - _extent[0] + 1) * sizeof(T);
+    _voxels.resize(row_size * std::size_t(_extent[3] - _extent[2] + 1) * std::size_t(_extent[5] - _extent[4] + 1));
+
+    std::uint8_t* out = _voxels.data();
+    std::optional<T> previous;
+    for(int z = _extent[4] ; z <= _extent[5] ; ++z)
+    {
+        for(int y = _extent[2] ; y <= _extent[3] ; ++y)
+        {
+            const T* row = _data + (std::size_t(z) * std::size_t(_dims[1]) + std::size_t(y)) * std::size_t(_dims[0]);
+            std::memcpy(out, row + _extent[0], row_size);
+            out += row_size;
+
+            for(int x = _extent[0] ; x <= _extent[1] ; ++x)
+            {
+                const T voxel = row[x];
+
+                // Labels come in runs, avoid looking up each voxel
+                if(previous != voxel)
+                {
+                    previous = voxel;
+                    if(_values.contains(static_cast<int>(voxel)))
+                    {
+                        _labels.insert(static_cast<int>(voxel));
+                    }
+                }
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+/// Copies the voxels of a brick into a standalone image, so that bricks can be contoured concurrently
+static vtkSmartPointer<vtkImageData> extract_brick(
+    vtkImageData* _image,
+    const void* _scalars,
+    const int* _dims,
+    const std::array<int, 6>& _extent
+)
+{
+    auto brick = vtkSmartPointer<vtkImageData>::New();
+    brick->SetOrigin(_image->GetOrigin());
+    brick->SetSpacing(_image->GetSpacing());
+    brick->SetDirectionMatrix(_image->GetDirectionMatrix());
+    brick->SetExtent(_extent[0], _extent[1], _extent[2], _extent[3], _extent[4], _extent[5]);
+    brick->AllocateScalars(_image->GetScalarType(), 1);
+
+    const auto scalar_size     = static_cast<std::size_t>(_image->GetScalarSize());
+    const std::size_t row_size = std::size_t(_extent[1] - _extent[0] + 1) * scalar_size;
+    const auto* const source   = static_cast<const char*>(_scalars);
+    auto* destination          = static_cast<char*>(brick->GetScalarPointer());
+    for(int z = _extent[4] ; z <= _extent[5] ; ++z)
+    {
+        for(int y = _extent[2] ; y <= _extent[3] ; ++y)
+        {
+            const std::size_t offset = (std::size_t(z) * std::size_t(_dims[1]) + std::size_t(y)) * std::size_t(_dims[0])
+                                       + std::size_t(_extent[0]);
+            std::memcpy(destination, source + offset * scalar_size, row_size);
+            destination += row_size;
+        }
+    }
+
+    return brick;
+}
+
+//-----------------------------------------------------------------------------
+
 vtk_mesher::vtk_mesher() noexcept :
     filter(m_signals),
     notifier(m_signals),
@@ -195,45 +307,43 @@ void vtk_mesher::updating()
 
 vtkSmartPointer<vtkPolyData> vtk_mesher::reconstruct(vtkSmartPointer<vtkImageData> _image, int _value)
 {
-    // Initialize filters to be used
     vtkNew<error_observer> error_obs;
 
-    vtkSmartPointer<vtkPolyDataAlgorithm> contour_filter;
-
     // Contour filter
-    if(*m_use_flying_edges)
-    {
-        vtkSmartPointer<vtkDiscreteFlyingEdges3D> flying_edges = vtkSmartPointer<vtkDiscreteFlyingEdges3D>::New();
-        flying_edges->ComputeScalarsOn();
-        flying_edges->ComputeNormalsOn();
+    auto contour_filter = make_contour_filter(_value, *m_use_flying_edges);
+    contour_filter->SetInputData(_image);
+    contour_filter->AddObserver(vtkCommand::ErrorEvent, error_obs);
 
-        // Initialize the contour filter
-        flying_edges->SetValue(0, _value);
+    auto contour_timer = vtkSmartPointer<vtkExecutionTimer>::New();
+    contour_timer->SetFilter(contour_filter);
 
-        contour_filter = flying_edges;
-    }
-    else
-    {
-        vtkSmartPointer<vtkDiscreteMarchingCubes> marching_cubes = vtkSmartPointer<vtkDiscreteMarchingCubes>::New();
-        marching_cubes->ComputeScalarsOn();
-        marching_cubes->ComputeNormalsOn();
+    contour_filter->Update();
 
-        // Initialize the contour filter
-        marching_cubes->SetValue(0, _value);
+    SIGHT_INFO(this->get_id() << ": Value: " << _value << "Flying edges: " << std::to_string(*m_use_flying_edges));
+    SIGHT_INFO(this->get_id() << ": Contour timer: " << contour_timer->GetElapsedWallClockTime() << "s");
+
+    if(auto error = error_obs->get_error(); error.has_value())
+    {
+        SIGHT_ERROR(*error);
+        this->notifier::failure(*error);
+        this->async_emit(signals::FAILED);
 
-        contour_filter = marching_cubes;
+        return nullptr;
     }
 
-    contour_filter->SetInputData(_image);
-    contour_filter->AddObserver(vtkCommand::ErrorEvent, error_obs);
+    return this->smooth(contour_filter->GetOutput(), _value);
+}
 
-    auto contour_timer = vtkSmartPointer<vtkExecutionTimer>::New();
-    contour_timer->SetFilter(contour_filter);
+//-----------------------------------------------------------------------------
+
+vtkSmartPointer<vtkPolyData> vtk_mesher::smooth(vtkSmartPointer<vtkPolyData> _contour, int _value)
+{
+    vtkNew<error_observer> error_obs;
 
     // Smooth filter
     auto smooth_filter = vtkSmartPointer<vtkWindowedSincPolyDataFilter>::New();
     smooth_filter->AddObserver(vtkCommand::ErrorEvent, error_obs);
-    smooth_filter->SetInputConnection(contour_filter->GetOutputPort());
+    smooth_filter->SetInputData(_contour);
     smooth_filter->SetNumberOfIterations(static_cast<int>(*m_num_iterations));
     smooth_filter->SetBoundarySmoothing(static_cast<vtkTypeBool>(*m_boundary_smoothing));
     smooth_filter->SetPassBand(*m_pass_band);
@@ -282,8 +392,7 @@ vtkSmartPointer<vtkPolyData> vtk_mesher::reconstruct(vtkSmartPointer<vtkImageDat
 
     vtkSmartPointer<vtkPolyData> poly_data = last_filter->GetOutput();
 
-    SIGHT_INFO(this->get_id() << ": Value: " << _value << "Flying edges: " << std::to_string(*m_use_flying_edges));
-    SIGHT_INFO(this->get_id() << ": Contour timer: " << contour_timer->GetElapsedWallClockTime() << "s");
+    SIGHT_INFO(this->get_id() << ": Value: " << _value);
     SIGHT_INFO(this->get_id() << ": Smooth timer: " << smooth_timer->GetElapsedWallClockTime() << "s");
     SIGHT_INFO(this->get_id() << ": Decimate timer: " << decimate_timer->GetElapsedWallClockTime() << "s");
     SIGHT_INFO(this->get_id() << ": Number of points: " << poly_data->GetNumberOfPoints());
@@ -306,6 +415,213 @@ vtkSmartPointer<vtkPolyData> vtk_mesher::reconstruct(vtkSmartPointer<vtkImageDat
 
 //-----------------------------------------------------------------------------
 
+std::map<int, vtkSmartPointer<vtkPolyData> > vtk_mesher::reconstruct_bricks(
+    vtkSmartPointer<vtkImageData> _image,
+    const std::set<int>& _values
+)
+{
+    FW_PROFILE("bricks");
+
+    const auto brick_size   = static_cast<int>(*m_brick_size);
+    const bool flying_edges = *m_use_flying_edges;
+    const int* dims         = _image->GetDimensions();
+
+    // Bricks can only be reused if they split the same volume in the same way
+    std::ostringstream bricks_key;
+    bricks_key << dims[0] << ' ' << dims[1] << ' ' << dims[2] << ' ' << _image->GetScalarType() << ' '
+    << brick_size << ' ' << flying_edges;
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        bricks_key << ' ' << _image->GetSpacing()[i] << ' ' << _image->GetOrigin()[i];
+    }
+
+    for(std::size_t i = 0 ; i < 9 ; ++i)
+    {
+        bricks_key << ' ' << _image->GetDirectionMatrix()->GetData()[i];
+    }
+
+    if(bricks_key.str() != m_bricks_key)
+    {
+        m_bricks_key = bricks_key.str();
+        m_bricks.clear();
+        m_label_meshes.clear();
+
+        // Neighbouring bricks share a plane of voxels, so that together they contain every cell of the volume
+        for(int z = 0 ; z < std::max(dims[2] - 1, 1) ; z += brick_size)
+        {
+            for(int y = 0 ; y < std::max(dims[1] - 1, 1) ; y += brick_size)
+            {
+                for(int x = 0 ; x < std::max(dims[0] - 1, 1) ; x += brick_size)
+                {
+                    brick_t brick;
+                    brick.extent = {
+                        x, std::min(x + brick_size, dims[0] - 1),
+                        y, std::min(y + brick_size, dims[1] - 1),
+                        z, std::min(z + brick_size, dims[2] - 1)
+                    };
+                    m_bricks.push_back(std::move(brick));
+                }
+            }
+        }
+    }
+
+    // Stitched surfaces can only be reused if they were smoothed and decimated in the same way
+    std::ostringstream label_meshes_key;
+    label_meshes_key << *m_num_iterations << ' ' << *m_pass_band << ' ' << *m_boundary_smoothing << ' '
+    << *m_feature_smoothing << ' ' << *m_feature_angle << ' ' << *m_non_manifold_smoothing << ' ' << *m_reduction
+    << ' ' << *m_quadric_reduction << ' ' << *m_preserve_topology;
+    if(label_meshes_key.str() != m_label_meshes_key)
+    {
+        m_label_meshes_key = label_meshes_key.str();
+        m_label_meshes.clear();
+    }
+
+    // Compare every brick with its voxels from the last update and contour again the ones that changed
+    const void* const scalars = _image->GetScalarPointer();
+    const int scalar_type     = _image->GetScalarType();
+    std::vector<char> modified(m_bricks.size(), 0);
+    std::vector<std::set<int> > touched(m_bricks.size());
+    std::vector<std::optional<std::string> > errors(m_bricks.size());
+    {
+        boost::asio::thread_pool pool;
+        for(std::size_t i = 0 ; i < m_bricks.size() ; ++i)
+        {
+            boost::asio::post(
+                pool,
+                [&, i]
+                {
+                    auto& brick = m_bricks[i];
+                    std::vector<std::uint8_t> voxels;
+                    std::set<int> labels;
+                    switch(scalar_type)
+                    {
+                        vtkTemplateMacro(
+                            scan_brick(static_cast<const VTK_TT*>(scalars), dims, brick.extent, _values, voxels, labels)
+                        );
+
+                        default:
+                            break;
+                    }
+
+                    if(voxels == brick.voxels && labels == brick.labels)
+                    {
+                        return;
+                    }
+
+                    modified[i] = 1;
+                    touched[i]  = brick.labels;
+                    touched[i].insert(labels.begin(), labels.end());
+                    brick.voxels = std::move(voxels);
+                    brick.labels = labels;
+                    brick.meshes.clear();
+
+                    if(labels.empty())
+                    {
+                        return;
+                    }
+
+                    const auto brick_image = extract_brick(_image, scalars, dims, brick.extent);
+                    vtkNew<error_observer> error_obs;
+                    for(const int label : labels)
+                    {
+                        auto contour_filter = make_contour_filter(label, flying_edges);
+                        contour_filter->SetInputData(brick_image);
+                        contour_filter->AddObserver(vtkCommand::ErrorEvent, error_obs);
+                        contour_filter->Update();
+
+                        if(auto error = error_obs->get_error(); error.has_value())
+                        {
+                            // Forget the voxels so that the brick is meshed again next time
+                            errors[i] = error;
+                            brick.voxels.clear();
+                            brick.meshes.clear();
+                            return;
+                        }
+
+                        vtkSmartPointer<vtkPolyData> contour = contour_filter->GetOutput();
+                        if(contour->GetNumberOfCells() > 0)
+                        {
+                            brick.meshes[label] = contour;
+                        }
+                    }
+                });
+        }
+
+        pool.join();
+    }
+
+    if(const auto error = std::ranges::find_if(errors, [](const auto& _e){return _e.has_value();});
+       error != errors.end())
+    {
+        SIGHT_ERROR(**error);
+        this->notifier::failure(**error);
+        this->async_emit(signals::FAILED);
+
+        return {};
+    }
+
+    std::set<int> dirty_labels;
+    for(std::size_t i = 0 ; i < m_bricks.size() ; ++i)
+    {
+        dirty_labels.insert(touched[i].begin(), touched[i].end());
+    }
+
+    // Stitch and smooth again only the labels whose bricks changed
+    std::map<int, vtkSmartPointer<vtkPolyData> > poly_datas;
+    for(const int value : _values)
+    {
+        if(const auto it = m_label_meshes.find(value); it != m_label_meshes.end() && !dirty_labels.contains(value))
+        {
+            poly_datas[value] = it->second;
+            continue;
+        }
+
+        auto append_filter = vtkSmartPointer<vtkAppendPolyData>::New();
+        for(const auto& brick : m_bricks)
+        {
+            if(const auto it = brick.meshes.find(value); it != brick.meshes.end())
+            {
+                append_filter->AddInputData(it->second);
+            }
+        }
+
+        if(append_filter->GetNumberOfInputConnections(0) == 0)
+        {
+            m_label_meshes[value] = nullptr;
+            poly_datas[value]     = nullptr;
+            continue;
+        }
+
+        // Points are generated twice on the planes shared by two bricks, merge them back
+        auto clean_filter = vtkSmartPointer<vtkCleanPolyData>::New();
+        clean_filter->SetInputConnection(append_filter->GetOutputPort());
+        clean_filter->PointMergingOn();
+        clean_filter->SetTolerance(0.);
+        clean_filter->Update();
+
+        vtkSmartPointer<vtkPolyData> poly_data = this->smooth(clean_filter->GetOutput(), value);
+        if(poly_data != nullptr)
+        {
+            m_label_meshes[value] = poly_data;
+        }
+        else
+        {
+            m_label_meshes.erase(value);
+        }
+
+        poly_datas[value] = poly_data;
+    }
+
+    SIGHT_INFO(
+        this->get_id() << ": " << std::ranges::count(modified, 1) << " of " << m_bricks.size()
+        << " bricks meshed again, " << dirty_labels.size() << " labels stitched again."
+    );
+
+    return poly_datas;
+}
+
+//-----------------------------------------------------------------------------
+
 void vtk_mesher::post_reconstruction_jobs(
     vtkSmartPointer<vtkImageData> _image,
     sight::data::model_series::sptr _model_series,
@@ -327,6 +643,27 @@ void vtk_mesher::post_reconstruction_jobs(
 
     const std::size_t num_organs = srv_config.count("organ");
 
+    // With bricks, all the labels are meshed at once since they share the bricks
+    std::map<int, vtkSmartPointer<vtkPolyData> > brick_poly_datas;
+    const bool use_bricks = *m_brick_size > 0 && _image->GetNumberOfScalarComponents() == 1;
+    if(use_bricks)
+    {
+        std::set<int> values;
+        for(const auto& elt : boost::make_iterator_range(srv_config.equal_range("organ")))
+        {
+            values.insert(elt.second.get<int>("<xmlattr>.value"));
+        }
+
+        brick_poly_datas = this->reconstruct_bricks(_image, values);
+    }
+    else
+    {
+        m_bricks.clear();
+        m_bricks_key.clear();
+        m_label_meshes.clear();
+        m_label_meshes_key.clear();
+    }
+
     std::atomic<std::uint64_t> done             = 0;
     static const std::uint64_t s_DONE_INCREMENT = 100 / (num_organs * 2); // 2 increments per organ
     for(const auto& elt : boost::make_iterator_range(srv_config.equal_range("organ")))
@@ -342,7 +679,8 @@ void vtk_mesher::post_reconstruction_jobs(
         const auto selected       = elt.second.get<bool>("<xmlattr>.selected", false);
 
         // Initialize the contour filter
-        vtkSmartPointer<vtkPolyData> poly_data = this->reconstruct(_image, value);
+        vtkSmartPointer<vtkPolyData> poly_data = use_bricks ? brick_poly_datas[value]
+                                                            : this->reconstruct(_image, value);
 
         auto create_mesh = [&](vtkSmartPointer<vtkPolyData> _poly_data)
                            {
@@ -466,7 +804,8 @@ vtk_mesher::connections_t vtk_mesher::auto_connections() const
         {m_num_iterations, data::object::MODIFIED_SIG, service::slots::UPDATE},
         {m_feature_angle, data::object::MODIFIED_SIG, service::slots::UPDATE},
         {m_reduction, data::object::MODIFIED_SIG, service::slots::UPDATE},
-        {m_quadric_reduction, data::object::MODIFIED_SIG, service::slots::UPDATE}
+        {m_quadric_reduction, data::object::MODIFIED_SIG, service::slots::UPDATE},
+        {m_brick_size, data::object::MODIFIED_SIG, service::slots::UPDATE}
     };
 }
 
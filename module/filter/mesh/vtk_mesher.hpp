@@ -37,6 +37,12 @@
 #include <vtkImageData.h>
 #include <vtkPolyData.h>
 
+#include <array>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
 namespace sight::module::filter::mesh
 {
 
@@ -52,6 +58,10 @@ namespace sight::module::filter::mesh
  * The service can either mesh a single value when passed as a property, or it can mesh multiple values if a <config>
  * tag is provided, allowing to specify different settings for each organ.
  *
+ * When \b brick_size is set, the label volume is split into bricks that are contoured in parallel and whose meshes are
+ * kept between updates. The voxels of each brick are kept too, so after an edit only the bricks whose voxels changed
+ * are meshed again, and only the labels they contain are stitched, smoothed and decimated again.
+ *
  * @section Signals Signals
  * - \b completed(): When the mesher succeeded.
  * - \b failed(): When the mesher failed.
@@ -90,6 +100,8 @@ namespace sight::module::filter::mesh
  * - \b quadric_reduction:  Improve decimation quality but increases the time by around 15%. However, it also acts as
  * wonderful smoothing tool and if used with the faster flying_edges mesher, overall, this can provide faster results
  * for the same quality.
+ * - \b brick_size: Edge length in voxels of the bricks used for incremental meshing, 0 meshes the whole volume at once
+ * on every update (default).
  * @subsection Configuration Configuration
  * - \b label : This means that voxels outside the value are converted
  *      to black (bit value of zero), and pixels of the given value are converted to white (a bit value of one).
@@ -144,7 +156,24 @@ protected:
 
 private:
 
+    /// Block of the label volume, with its voxels from the last update and the surface of each label it contains
+    struct brick_t
+    {
+        std::array<int, 6> extent {};
+        std::vector<std::uint8_t> voxels;
+        std::set<int> labels;
+        std::map<int, vtkSmartPointer<vtkPolyData> > meshes;
+    };
+
     vtkSmartPointer<vtkPolyData> reconstruct(vtkSmartPointer<vtkImageData> _image, int _value);
+    vtkSmartPointer<vtkPolyData> smooth(vtkSmartPointer<vtkPolyData> _contour, int _value);
+
+    /// Meshes the given values brick by brick, only the bricks modified since the last call are contoured again
+    std::map<int, vtkSmartPointer<vtkPolyData> > reconstruct_bricks(
+        vtkSmartPointer<vtkImageData> _image,
+        const std::set<int>& _values
+    );
+
     void post_reconstruction_jobs(
         vtkSmartPointer<vtkImageData> _image,
         sight::data::model_series::sptr _model_series,
@@ -158,6 +187,14 @@ private:
     };
     mode_t m_mode {mode_t::ADD};
 
+    /// Bricks of the last meshed volume, and the parameters that must match to reuse them
+    std::vector<brick_t> m_bricks;
+    std::string m_bricks_key;
+
+    /// Stitched and smoothed surface of each label, and the parameters that must match to reuse them
+    std::map<int, vtkSmartPointer<vtkPolyData> > m_label_meshes;
+    std::string m_label_meshes_key;
+
     /// Input image mask
     sight::data::ptr<sight::data::image_series, sight::data::access::in> m_image {this, "image_series"};
     /// Output segmentation
@@ -176,6 +213,7 @@ private:
     data::property<data::real> m_reduction {this, "percent_reduction", 0.};
     data::property<sight::data::real> m_pass_band {this, "pass_band", 0.01};
     data::property<data::real> m_feature_angle {this, "feature_angle", 120.};
+    data::property<data::integer> m_brick_size {this, "brick_size", 0};
 };
 
 } // namespace sight::module::filter::mesh
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2014-2024 IRCAD France
+ * Copyright (C) 2014-2025 IRCAD France
  * Copyright (C) 2014-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -36,7 +36,7 @@
 #include <opencv2/calib3d.hpp>
 #include <opencv2/imgproc.hpp>
 
-#include <thread>
+#include <algorithm>
 
 namespace sight::module::geometry::vision
 {
@@ -45,6 +45,10 @@ static const core::com::slots::key_t RECORD_POINTS_SLOT = "record_points";
 
 static const core::com::signals::key_t CHESSBOARD_DETECTED_SIG = "chessboard_detected";
 static const core::com::signals::key_t CHESSBOARD_FOUND_SIG    = "chessboardFound";
+static const core::com::signals::key_t DETECTION_STATISTICS_SIG = "detection_statistics";
+
+/// Number of processed frames between two statistics reports
+static constexpr std::size_t STATISTICS_PERIOD = 100;
 
 // ----------------------------------------------------------------------------
 
@@ -52,6 +56,7 @@ chess_board_detector::chess_board_detector() noexcept :
     m_sig_chessboard_detected(new_signal<chessboard_detected_signal_t>(CHESSBOARD_DETECTED_SIG)),
     m_sig_chessboard_found(new_signal<chessboard_found_signal_t>(CHESSBOARD_FOUND_SIG))
 {
+    new_signal<detection_statistics_signal_t>(DETECTION_STATISTICS_SIG);
     new_slot(RECORD_POINTS_SLOT, &chess_board_detector::record_points, this);
 }
 
@@ -74,19 +79,35 @@ void chess_board_detector::starting()
 
     m_images.resize(image_group_size);
     m_point_lists.resize(image_group_size);
+    m_rois.resize(image_group_size);
+    m_statistics = {};
+
+    for(std::size_t i = 0 ; i < image_group_size ; ++i)
+    {
+        auto worker = core::thread::worker::make();
+        worker->set_thread_name("chessboard_" + std::to_string(i));
+        m_workers.push_back(worker);
+    }
 }
 
 // ----------------------------------------------------------------------------
 
 void chess_board_detector::updating()
 {
+    if(*m_pipelined)
+    {
+        this->start_pipelined_detection();
+        return;
+    }
+
+    const auto start                   = std::chrono::steady_clock::now();
     const std::size_t image_group_size = m_image.size();
 
-    // Run parallel detections in separate threads.
-    std::vector<std::thread> detection_jobs;
+    // Run parallel detections on the workers.
+    std::vector<std::shared_future<void> > detection_jobs;
     for(std::size_t i = 1 ; i < image_group_size ; ++i)
     {
-        detection_jobs.emplace_back(&chess_board_detector::do_detection, this, i);
+        detection_jobs.push_back(m_workers[i]->post_task<void>([this, i]{this->do_detection(i);}));
     }
 
     // Detection in the first image is done on the service's worker.
@@ -94,7 +115,7 @@ void chess_board_detector::updating()
 
     for(auto& detection_job : detection_jobs)
     {
-        detection_job.join();
+        detection_job.get();
     }
 
     const bool all_detected = (std::count(m_images.begin(), m_images.end(), nullptr) == 0);
@@ -105,14 +126,31 @@ void chess_board_detector::updating()
     {
         m_sig_chessboard_found->async_emit();
     }
+
+    this->update_statistics(all_detected, start);
 }
 
 // ----------------------------------------------------------------------------
 
 void chess_board_detector::stopping()
 {
+    // Waits for the pending detections, their results are dropped since the service is no longer started
+    for(const auto& worker : m_workers)
+    {
+        worker->stop();
+    }
+
+    m_workers.clear();
+
+    if(m_statistics.frames > 0)
+    {
+        this->log_statistics();
+    }
+
     m_images.clear();
     m_point_lists.clear();
+    m_rois.clear();
+    m_detection_in_flight = false;
 }
 
 // ----------------------------------------------------------------------------
@@ -172,7 +210,7 @@ void chess_board_detector::do_detection(std::size_t _image_index)
     {
         const cv::Mat cv_img = io::opencv::image::move_to_cv(img.get_shared());
 
-        m_point_lists[_image_index] =
+        const auto point_list =
             sight::geometry::vision::helper::detect_chessboard(
                 cv_img,
                 std::size_t(*m_width),
@@ -180,34 +218,209 @@ void chess_board_detector::do_detection(std::size_t _image_index)
                 float(*m_scale)
             );
 
-        if(m_point_lists[_image_index] != nullptr)
+        data::image::sptr image;
+        if(point_list != nullptr)
         {
-            m_images[_image_index] = std::make_shared<data::image>();
-            m_images[_image_index]->deep_copy(img.get_shared());
+            image = std::make_shared<data::image>();
+            image->deep_copy(img.get_shared());
         }
-        else
+
+        this->publish_detection(_image_index, image, point_list);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void chess_board_detector::start_pipelined_detection()
+{
+    if(m_image.empty())
+    {
+        return;
+    }
+
+    if(m_detection_in_flight.exchange(true))
+    {
+        ++m_statistics.skipped;
+        return;
+    }
+
+    const auto start                   = std::chrono::steady_clock::now();
+    const std::size_t image_group_size = m_image.size();
+
+    // The detection outlives the update, it works on a copy of the images
+    std::vector<data::image::sptr> frames(image_group_size);
+    for(std::size_t i = 0 ; i < image_group_size ; ++i)
+    {
+        const auto img = m_image[i].lock();
+        SIGHT_ASSERT("Missing 'image' input.", img);
+
+        if(data::helper::medical_image::check_image_validity(img.get_shared()))
         {
-            m_images[_image_index] = nullptr;
+            frames[i] = std::make_shared<data::image>();
+            frames[i]->deep_copy(img.get_shared());
         }
+    }
 
-        const bool output_detection = (m_detection.size() == m_image.size());
-        if(output_detection)
-        {
-            auto out_pl = m_detection[_image_index].lock();
+    struct pipeline_t
+    {
+        std::vector<data::image::sptr> frames;
+        std::vector<data::point_list::sptr> point_lists;
+        std::atomic_size_t remaining;
+    };
 
-            if(m_point_lists[_image_index] != nullptr)
-            {
-                out_pl->deep_copy(m_point_lists[_image_index]);
-            }
-            else
+    auto pipeline = std::make_shared<pipeline_t>();
+    pipeline->frames = std::move(frames);
+    pipeline->point_lists.resize(image_group_size);
+    pipeline->remaining = image_group_size;
+
+    const auto width       = std::size_t(*m_width);
+    const auto height      = std::size_t(*m_height);
+    const auto coarse_size = static_cast<int>(*m_coarse_size);
+
+    // Use a "weak" this, the results may be received after the service is destroyed.
+    auto weak_this = this->weak_from_this();
+    auto worker    = this->worker();
+
+    for(std::size_t i = 0 ; i < image_group_size ; ++i)
+    {
+        m_workers[i]->post(
+            [this, i, pipeline, width, height, coarse_size, start, weak_this, worker]
             {
-                out_pl->get_points().clear();
-            }
+                if(auto& frame = pipeline->frames[i]; frame)
+                {
+                    // Each worker only accesses the search area of its own image
+                    pipeline->point_lists[i] = sight::geometry::vision::helper::detect_chessboard(
+                        io::opencv::image::move_to_cv(frame),
+                        width,
+                        height,
+                        m_rois[i],
+                        coarse_size
+                    );
+                }
+
+                if(--pipeline->remaining == 0)
+                {
+                    worker->post(
+                        [weak_this, pipeline, start]
+                    {
+                        if(auto shared_this = dynamic_pointer_cast<chess_board_detector>(weak_this.lock());
+                           shared_this && shared_this->started())
+                        {
+                            shared_this->complete_pipelined_detection(
+                                pipeline->frames,
+                                pipeline->point_lists,
+                                start
+                            );
+                        }
+                    });
+                }
+            });
+    }
+}
+
+// ----------------------------------------------------------------------------
 
-            auto sig = out_pl->signal<data::point_list::modified_signal_t>(data::point_list::MODIFIED_SIG);
-            sig->async_emit();
+void chess_board_detector::complete_pipelined_detection(
+    const std::vector<data::image::sptr>& _frames,
+    const std::vector<data::point_list::sptr>& _point_lists,
+    std::chrono::steady_clock::time_point _start
+)
+{
+    for(std::size_t i = 0 ; i < _frames.size() ; ++i)
+    {
+        // Invalid images are ignored, like in the synchronous mode
+        if(_frames[i])
+        {
+            this->publish_detection(i, _point_lists[i] ? _frames[i] : nullptr, _point_lists[i]);
         }
     }
+
+    m_detection_in_flight = false;
+
+    const bool all_detected = (std::count(m_images.begin(), m_images.end(), nullptr) == 0);
+
+    m_sig_chessboard_detected->async_emit(all_detected);
+
+    if(all_detected)
+    {
+        m_sig_chessboard_found->async_emit();
+    }
+
+    this->update_statistics(all_detected, _start);
+}
+
+// ----------------------------------------------------------------------------
+
+void chess_board_detector::publish_detection(
+    std::size_t _image_index,
+    const data::image::sptr& _image,
+    const data::point_list::sptr& _point_list
+)
+{
+    m_point_lists[_image_index] = _point_list;
+    m_images[_image_index]      = _image;
+
+    const bool output_detection = (m_detection.size() == m_image.size());
+    if(output_detection)
+    {
+        auto out_pl = m_detection[_image_index].lock();
+
+        if(_point_list != nullptr)
+        {
+            out_pl->deep_copy(_point_list);
+        }
+        else
+        {
+            out_pl->get_points().clear();
+        }
+
+        auto sig = out_pl->signal<data::point_list::modified_signal_t>(data::point_list::MODIFIED_SIG);
+        sig->async_emit();
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void chess_board_detector::update_statistics(bool _detected, std::chrono::steady_clock::time_point _start)
+{
+    const double latency =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _start).count();
+
+    ++m_statistics.frames;
+    m_statistics.total_latency += latency;
+    m_statistics.max_latency    = std::max(m_statistics.max_latency, latency);
+
+    if(_detected)
+    {
+        ++m_statistics.detected;
+    }
+
+    if(m_statistics.frames % STATISTICS_PERIOD == 0)
+    {
+        this->log_statistics();
+
+        const auto frames = static_cast<double>(m_statistics.frames);
+        auto sig          = this->signal<detection_statistics_signal_t>(DETECTION_STATISTICS_SIG);
+        sig->async_emit(
+            m_statistics.total_latency / frames,
+            static_cast<double>(m_statistics.detected) / frames
+        );
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+void chess_board_detector::log_statistics() const
+{
+    const auto frames = static_cast<double>(m_statistics.frames);
+
+    SIGHT_INFO(
+        "Chessboard detection of '" << this->get_id() << "': frames=" << m_statistics.frames
+        << " skipped=" << m_statistics.skipped
+        << " success_rate=" << static_cast<double>(m_statistics.detected) / frames
+        << " mean_latency_ms=" << m_statistics.total_latency / frames
+        << " max_latency_ms=" << m_statistics.max_latency
+    );
 }
 
 // ----------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2014-2024 IRCAD France
+ * Copyright (C) 2014-2025 IRCAD France
  * Copyright (C) 2014-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -22,6 +22,9 @@
 
 #pragma once
 
+#include <core/thread/worker.hpp>
+
+#include <data/boolean.hpp>
 #include <data/calibration_info.hpp>
 #include <data/image.hpp>
 #include <data/integer.hpp>
@@ -30,6 +33,11 @@
 
 #include <service/controller.hpp>
 
+#include <opencv2/core/types.hpp>
+
+#include <atomic>
+#include <chrono>
+
 namespace sight::module::geometry::vision
 {
 
@@ -39,9 +47,19 @@ namespace sight::module::geometry::vision
  * Every update triggers detection on the current input images. The 'recordPoints' slot must be called to store
  * the chessboard positions in the CalibrationInfo structure after a successful detection.
  *
+ * Each image of the group is processed on its own worker thread, created when the service starts. By default, the
+ * update waits for all the detections. In pipelined mode, the update only copies the images and returns, the results
+ * are published once all the detections are done. Frames received meanwhile are skipped, so a live video is never
+ * delayed by the detection. The pipelined mode also searches the chessboard around its location in the previous frame,
+ * on an image downscaled to the coarse size, before refining the corners in the full scale image.
+ *
+ * The detection latency and success rate are logged every 100 processed frames and when the service stops.
+ *
  * @section Signals Signals
  * - \b chessboard_detected(bool): Emitted after trying to detect a chessboard. Sends whether it was detected or not.
  * - \b chessboardFound(): Emitted if a chessboard pattern was recognized in the image.
+ * - \b detection_statistics(double, double): Emitted every 100 processed frames. Sends the mean detection latency in
+ *      milliseconds and the ratio of frames where the chessboard was detected in all images.
  *
  * @section Slots Slots
  * - \b record_points(): Request to store the current image in the calibration data, if the chessboard is detected.
@@ -73,6 +91,11 @@ namespace sight::module::geometry::vision
  * @subsection Configuration Configuration:
  * - \b board : preference keys to retrieve the number of squares of the board in width and height as well
  *              as the scaling factor to be applied to the input image.
+ * @subsection Properties Properties
+ * - \b board_width, board_height: number of squares of the board.
+ * - \b board_scale: scale applied to the images before running the detection, ignored in pipelined mode.
+ * - \b pipelined (default: false): runs the detection asynchronously and skips the frames received meanwhile.
+ * - \b coarse_size (default: 640): largest side, in pixels, of the downscaled image searched in pipelined mode.
  */
 class chess_board_detector final : public service::controller
 {
@@ -86,6 +109,9 @@ public:
     /// Signal type sent after a successful detection.
     using chessboard_found_signal_t = core::com::signal<void ()>;
 
+    /// Signal type sent with the mean detection latency in milliseconds and the detection success rate.
+    using detection_statistics_signal_t = core::com::signal<void (double, double)>;
+
     /// Constructor
     chess_board_detector() noexcept;
 
@@ -117,6 +143,29 @@ private:
     /// Runs the detection for the given input index.
     void do_detection(std::size_t _image_index);
 
+    /// Copies the input images and runs the detections on the workers, unless the previous ones are not done yet.
+    void start_pipelined_detection();
+
+    /// Publishes the results of the pipelined detections, called on the service worker.
+    void complete_pipelined_detection(
+        const std::vector<data::image::sptr>& _frames,
+        const std::vector<data::point_list::sptr>& _point_lists,
+        std::chrono::steady_clock::time_point _start
+    );
+
+    /// Stores the detection result for the given input index and updates the optional output.
+    void publish_detection(
+        std::size_t _image_index,
+        const data::image::sptr& _image,
+        const data::point_list::sptr& _point_list
+    );
+
+    /// Updates the statistics and emits them regularly.
+    void update_statistics(bool _detected, std::chrono::steady_clock::time_point _start);
+
+    /// Logs the statistics.
+    void log_statistics() const;
+
     /// Signal emitted after detection.
     chessboard_detected_signal_t::sptr m_sig_chessboard_detected;
 
@@ -129,6 +178,25 @@ private:
     /// Last images on which a chessboard was detected. Null if detection failed.
     std::vector<data::image::sptr> m_images;
 
+    /// Workers running the detections, one per image.
+    std::vector<core::thread::worker::sptr> m_workers;
+
+    /// Areas where the chessboard is searched first in pipelined mode, one per image.
+    std::vector<cv::Rect> m_rois;
+
+    /// True while pipelined detections are running.
+    std::atomic_bool m_detection_in_flight {false};
+
+    /// Detection statistics, only accessed on the service worker.
+    struct
+    {
+        std::size_t frames {0};
+        std::size_t detected {0};
+        std::size_t skipped {0};
+        double total_latency {0.};
+        double max_latency {0.};
+    } m_statistics;
+
     static constexpr std::string_view IMAGE_INPUT     = "image";
     static constexpr std::string_view CALINFO_INOUT   = "calInfo";
     static constexpr std::string_view DETECTION_INOUT = "detection";
@@ -145,6 +213,12 @@ private:
 
     /// Scale applied to the images before running the detection algorithm.
     sight::data::property<sight::data::real> m_scale {this, "board_scale", 1.};
+
+    /// Runs the detection asynchronously, skipping the frames received while it is running.
+    sight::data::property<sight::data::boolean> m_pipelined {this, "pipelined", false};
+
+    /// Largest side of the downscaled image searched in pipelined mode.
+    sight::data::property<sight::data::integer> m_coarse_size {this, "coarse_size", 640};
 };
 
 } //namespace sight::module::geometry::vision
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2018-2024 IRCAD France
+ * Copyright (C) 2018-2025 IRCAD France
  * Copyright (C) 2018-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -22,7 +22,6 @@
 
 #include "distortion.hpp"
 
-#include <io/opencv/camera.hpp>
 #include <io/opencv/image.hpp>
 
 #include <core/com/signal.hxx>
@@ -35,7 +34,6 @@
 
 #include <ui/__/dialog/message.hpp>
 
-#include <opencv2/calib3d.hpp>
 #include <opencv2/imgproc.hpp>
 
 namespace sight::module::geometry::vision
@@ -98,6 +96,7 @@ void distortion::stopping()
 {
     m_calibration_mismatch = false;
     m_prev_image_size      = {0, 0, 0};
+    m_maps.reset();
 }
 
 //------------------------------------------------------------------------------
@@ -180,7 +179,7 @@ void distortion::remap()
     auto output_image = m_output.lock();
     SIGHT_ASSERT("No '" << IMAGE_INOUT << "' found.", output_image);
 
-    if(!input_image || !output_image || m_calibration_mismatch)
+    if(!input_image || !output_image || m_calibration_mismatch || !m_maps)
     {
         return;
     }
@@ -275,7 +274,7 @@ void distortion::remap()
 #else
         FW_PROFILE_AVG("cv::remap", 5);
 
-        cv::remap(img, undistorted_image, m_map_x, m_map_y, cv::INTER_LINEAR, cv::BORDER_CONSTANT);
+        sight::geometry::vision::remap_cache::remap(img, undistorted_image, *m_maps);
 
         const auto out_dump_lock = output_image->dump_lock();
         if(output_image.get_shared() == input_image.get_shared())
@@ -330,90 +329,42 @@ void distortion::calibrate()
     const auto camera = m_camera.lock();
     SIGHT_ASSERT("Object 'camera' is not found.", camera);
 
-    cv::Mat intrinsics;
-    cv::Mat dist_coefs;
-    cv::Size size;
-
-    std::tie(intrinsics, size, dist_coefs) = io::opencv::camera::copy_to_cv(camera.get_shared());
-
-    std::vector<cv::Mat> xy_maps(2);
-
-    if(m_distort)
-    {
-        cv::Mat pixel_locations_src      = cv::Mat(size, CV_32FC2);
-        cv::Mat fractional_locations_dst = cv::Mat(size, CV_32FC2);
-
-        for(int i = 0 ; i < size.height ; i++)
-        {
-            for(int j = 0 ; j < size.width ; j++)
-            {
-                pixel_locations_src.at<cv::Point2f>(i, j) = cv::Point2f(float(j), float(i));
-            }
-
-            cv::undistortPoints(
-                pixel_locations_src.row(i),
-                fractional_locations_dst.row(i),
-                intrinsics,
-                dist_coefs
-            );
-        }
-
-        cv::Mat pixel_locations = cv::Mat(size, CV_32FC2);
-
-        // Output from undistortPoints is normalized point coordinates
-        const auto fx = static_cast<float>(intrinsics.at<double>(0, 0));
-        const auto fy = static_cast<float>(intrinsics.at<double>(1, 1));
-        const auto cx = static_cast<float>(intrinsics.at<double>(0, 2));
-        const auto cy = static_cast<float>(intrinsics.at<double>(1, 2));
-
-        for(int i = 0 ; i < size.height ; i++)
-        {
-            for(int j = 0 ; j < size.width ; j++)
-            {
-                const float x = fractional_locations_dst.at<cv::Point2f>(i, j).x * fx + cx;
-                const float y = fractional_locations_dst.at<cv::Point2f>(i, j).y * fy + cy;
-                pixel_locations.at<cv::Point2f>(i, j) = cv::Point2f(x, y);
-            }
-        }
-
-        cv::split(pixel_locations, xy_maps);
-    }
-    else
+    m_maps.reset();
+    if(camera->get_width() == 0 || camera->get_height() == 0)
     {
-        cv::initUndistortRectifyMap(
-            intrinsics,
-            dist_coefs,
-            cv::Mat(),
-            intrinsics,
-            size,
-            CV_32FC1,
-            xy_maps[0],
-            xy_maps[1]
-        );
+        SIGHT_WARN("Unable to compute the distortion map: camera '" + camera->get_id() + "' has no resolution.");
+        return;
     }
 
+    // Tables of the former calibration are released, the ones of the current calibration may already be computed
+    auto& cache = sight::geometry::vision::remap_cache::get();
+    cache.invalidate(*camera);
+    m_maps = cache.get_maps(
+        *camera,
+        m_distort
+        ? sight::geometry::vision::remap_cache::direction::distort
+        : sight::geometry::vision::remap_cache::direction::undistort
+    );
+
     auto map = m_map.lock();
 
     if(map)
     {
         cv::Mat cv_map;
-        cv::merge(xy_maps, cv_map);
+        cv::merge(std::vector<cv::Mat> {m_maps->x, m_maps->y}, cv_map);
 
         io::opencv::image::copy_from_cv(*map, cv_map);
 
         auto sig_modified = map->signal<data::image::modified_signal_t>(data::image::MODIFIED_SIG);
         sig_modified->async_emit();
     }
+#if OPENCV_CUDA_SUPPORT
     else
     {
-#if OPENCV_CUDA_SUPPORT
-        m_map_x = cv::cuda::GpuMat(xyMaps[0]);
-        m_map_y = cv::cuda::GpuMat(xyMaps[1]);
-#else
-        m_map_x = xy_maps[0];
-        m_map_y = xy_maps[1];
-#endif // OPENCV_CUDA_SUPPORT
+        m_map_x = cv::cuda::GpuMat(m_maps->x);
+        m_map_y = cv::cuda::GpuMat(m_maps->y);
     }
+#endif // OPENCV_CUDA_SUPPORT
 }
 
 //------------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2018-2024 IRCAD France
+ * Copyright (C) 2018-2025 IRCAD France
  * Copyright (C) 2018-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -25,6 +25,8 @@
 #include <data/camera.hpp>
 #include <data/image.hpp>
 
+#include <geometry/vision/remap_cache.hpp>
+
 #include <service/filter.hpp>
 
 #ifdef OPENCV_CUDA_SUPPORT
@@ -136,12 +138,12 @@ private:
     /// This is used to reset m_calibrationMismatch when the image resolution changes
     data::image::size_t m_prev_image_size {0, 0, 0};
 
+    /// Remap tables, shared with the other services using the same camera calibration
+    sight::geometry::vision::remap_cache::maps_csptr m_maps;
+
 #if OPENCV_CUDA_SUPPORT
     cv::cuda::GpuMat m_map_x;
     cv::cuda::GpuMat m_map_y;
-#else
-    cv::Mat m_map_x;
-    cv::Mat m_map_y;
 #endif // OPENCV_CUDA_SUPPORT
 
     static constexpr std::string_view CAMERA_INPUT = "camera";
@@ -58,6 +58,7 @@ void open_cv_extrinsic::starting()
 
 void open_cv_extrinsic::stopping()
 {
+    m_calibration.reset();
 }
 
 //------------------------------------------------------------------------------
@@ -73,78 +74,21 @@ void open_cv_extrinsic::updating()
     SIGHT_WARN_IF("Calibration info is empty.", cal_info1->get_point_list_container().empty());
     if(!cal_info1->get_point_list_container().empty())
     {
-        std::vector<std::vector<cv::Point3f> > object_points;
+        m_calibration.set_board(std::size_t(*m_width), std::size_t(*m_height), m_square_size.value());
+        m_calibration.set_outlier_factor(m_outlier_factor.value());
 
-        std::vector<cv::Point3f> points;
-        for(unsigned int y = 0 ; y < static_cast<unsigned int>(*m_height - 1) ; ++y)
-        {
-            for(unsigned int x = 0 ; x < static_cast<unsigned int>(*m_width - 1) ; ++x)
-            {
-                points.emplace_back(
-                    static_cast<float>(x * m_square_size.value()),
-                    static_cast<float>(y * m_square_size.value()),
-                    0.F
-
-                );
-            }
-        }
-
-        std::vector<std::vector<cv::Point2f> > image_points1;
-        std::vector<std::vector<cv::Point2f> > image_points2;
-        {
-            const auto pt_lists1 = cal_info1->get_point_list_container();
-            const auto pt_lists2 = cal_info2->get_point_list_container();
-
-            SIGHT_ERROR_IF("The two calibrationInfo do not have the same size", pt_lists1.size() != pt_lists2.size());
-
-            auto itr1     = pt_lists1.begin();
-            auto itr2     = pt_lists2.begin();
-            auto itr_end1 = pt_lists1.end();
-            auto itr_end2 = pt_lists2.end();
-
-            for( ; itr1 != itr_end1 && itr2 != itr_end2 ; ++itr1, ++itr2)
-            {
-                const data::point_list::csptr& pt_list1 = *itr1;
-                const data::point_list::csptr& pt_list2 = *itr2;
-                std::vector<cv::Point2f> img_point1;
-                std::vector<cv::Point2f> img_point2;
-
-                for(data::point::csptr point : pt_list1->get_points())
-                {
-                    SIGHT_ASSERT("point is null", point);
-                    img_point1.emplace_back(
-                        static_cast<float>((*point)[0]),
-                        static_cast<float>((*point)[1])
-
-                    );
-                }
-
-                for(data::point::csptr point : pt_list2->get_points())
-                {
-                    SIGHT_ASSERT("point is null", point);
-                    img_point2.emplace_back(
-                        static_cast<float>((*point)[0]),
-                        static_cast<float>((*point)[1])
-
-                    );
-                }
-
-                image_points1.push_back(img_point1);
-                image_points2.push_back(img_point2);
-                object_points.push_back(points);
-            }
-        }
+        // Only the new views are read
+        m_calibration.update_views(
+            cal_info1->get_point_list_container(),
+            cal_info2->get_point_list_container()
+        );
 
         // Set the cameras
         cv::Mat camera_matrix1 = cv::Mat::eye(3, 3, CV_64F);
         cv::Mat camera_matrix2 = cv::Mat::eye(3, 3, CV_64F);
 
-        std::vector<float> distortion_coefficients1(5);
-        std::vector<float> distortion_coefficients2(5);
-        cv::Mat rotation_matrix;
-        cv::Mat translation_vector;
-        cv::Mat essential_matrix;
-        cv::Mat fundamental_matrix;
+        cv::Mat distortion_coefficients1 = cv::Mat::zeros(1, 5, CV_64F);
+        cv::Mat distortion_coefficients2 = cv::Mat::zeros(1, 5, CV_64F);
 
         const auto cam_series = m_camera_set.lock();
 
@@ -171,32 +115,28 @@ void open_cv_extrinsic::updating()
             camera_matrix2.at<double>(1, 1) = cam2->get_fy();
             camera_matrix2.at<double>(0, 2) = cam2->get_cx();
             camera_matrix2.at<double>(1, 2) = cam2->get_cy();
-            for(std::size_t i = 0 ; i < 5 ; ++i)
+            for(int i = 0 ; i < 5 ; ++i)
             {
-                distortion_coefficients1[i] = static_cast<float>(cam1->get_distortion_coefficient()[i]);
-                distortion_coefficients2[i] = static_cast<float>(cam2->get_distortion_coefficient()[i]);
+                distortion_coefficients1.at<double>(i) = cam1->get_distortion_coefficient()[std::size_t(i)];
+                distortion_coefficients2.at<double>(i) = cam2->get_distortion_coefficient()[std::size_t(i)];
             }
         }
-        double err = cv::stereoCalibrate(
-            object_points,
-            image_points1,
-            image_points2,
+
+        const auto result = m_calibration.calibrate(
             camera_matrix1,
             distortion_coefficients1,
             camera_matrix2,
             distortion_coefficients2,
-            imgsize,
-            rotation_matrix,
-            translation_vector,
-            essential_matrix,
-            fundamental_matrix,
-            cv::CALIB_FIX_INTRINSIC,
-            cv::TermCriteria(
-                cv::TermCriteria::MAX_ITER + cv::TermCriteria::EPS,
-                100,
-                1e-5
-            )
+            imgsize
         );
+        SIGHT_DEBUG(
+            "Calibration error :" << result.error << " (" << result.rejected << " rejected views, "
+            << (result.warm_start ? "warm" : "cold") << " start)"
+        );
+
+        const double err                  = result.error;
+        const cv::Mat& rotation_matrix    = result.rotation;
+        const cv::Mat& translation_vector = result.translation;
 
         data::matrix4::sptr matrix = std::make_shared<data::matrix4>();
         cv::Mat cv4x4              = cv::Mat::eye(4, 4, CV_64F);
@@ -29,6 +29,7 @@
 #include <data/real.hpp>
 
 #include <geometry/vision/calibrator.hpp>
+#include <geometry/vision/incremental_calibration.hpp>
 
 namespace sight::module::geometry::vision
 {
@@ -62,6 +63,13 @@ namespace sight::module::geometry::vision
  * - \b camIndex (optional, default: 1): index of the camera in \b camera_set used to compute extrinsic matrix
  *      (from camera[0] to camera[index]).
  * - \b board : preference key to retrieve the number of square in 2 dimensions of the chessboard.
+ * @subsection Properties Properties:
+ * - \b board_width, board_height : number of squares of the chessboard.
+ * - \b board_square_size : Square size of the chessboard.
+ * - \b outlier_factor (default: 0) : pairs of views whose reprojection error is above the median error multiplied by
+ *      this factor are not used in the calibration. 0 disables the rejection.
+ *
+ * The views are cached between two updates, and the previous calibration is used as initial guess of the next one.
  */
 class open_cv_extrinsic final : public sight::geometry::vision::calibrator
 {
@@ -100,6 +108,9 @@ private:
     /// Index of the camera in camera_set used to compute extrinsic matrix (from camera[0] to camera[index]).
     std::size_t m_cam_index {1};
 
+    /// Views and previous solution, reused by the next calibration
+    sight::geometry::vision::incremental_stereo_calibration m_calibration;
+
     data::ptr<data::calibration_info, data::access::in> m_calibration_info1 {this, "calibrationInfo1"};
     data::ptr<data::calibration_info, data::access::in> m_calibration_info2 {this, "calibrationInfo2"};
     data::ptr<data::camera_set, data::access::inout> m_camera_set {this, "camera_set"};
@@ -113,6 +124,9 @@ private:
 
     /// Square size of the chessboard.
     sight::data::property<sight::data::real> m_square_size {this, "board_square_size", 20.};
+
+    /// Outlier rejection factor, 0 disables the rejection.
+    sight::data::property<sight::data::real> m_outlier_factor {this, "outlier_factor", 0.};
 };
 
 } // namespace sight::module::geometry::vision
@@ -52,6 +52,7 @@ void open_cv_intrinsic::starting()
 
 void open_cv_intrinsic::stopping()
 {
+    m_calibration.reset();
 }
 
 //--------------------------------------------------------------------- ---------
@@ -65,71 +66,42 @@ void open_cv_intrinsic::updating()
 
     if(!cal_info->get_point_list_container().empty())
     {
-        std::vector<std::vector<cv::Point3f> > object_points;
+        m_calibration.set_board(std::size_t(*m_width), std::size_t(*m_height), m_square_size.value());
+        m_calibration.set_outlier_factor(m_outlier_factor.value());
 
-        std::vector<cv::Point3f> points;
-        for(unsigned int y = 0 ; y < static_cast<unsigned int>(*m_height - 1) ; ++y)
-        {
-            for(unsigned int x = 0 ; x < static_cast<unsigned int>(*m_width - 1) ; ++x)
-            {
-                points.emplace_back(
-                    static_cast<float>(x * m_square_size.value()),
-                    static_cast<float>(y * m_square_size.value()),
-                    0.F
-                );
-            }
-        }
-
-        std::vector<std::vector<cv::Point2f> > image_points;
-
-        for(const data::point_list::csptr& capture : cal_info->get_point_list_container())
-        {
-            std::vector<cv::Point2f> dst;
-
-            for(data::point::csptr point : capture->get_points())
-            {
-                SIGHT_ASSERT("point is null", point);
-                dst.emplace_back(
-                    static_cast<float>((*point)[0]),
-                    static_cast<float>((*point)[1])
-
-                );
-            }
-
-            image_points.push_back(dst);
-            object_points.push_back(points);
-        }
+        // Only the new views are read
+        m_calibration.update_views(cal_info->get_point_list_container());
 
         data::image::csptr img = cal_info->get_image_container().front();
-
-        cv::Mat camera_matrix;
-        std::vector<float> dist_coeffs;
-        std::vector<cv::Mat> rvecs;
-        std::vector<cv::Mat> tvecs;
         cv::Size2i imgsize(static_cast<int>(img->size()[0]), static_cast<int>(img->size()[1]));
 
+        const auto result = m_calibration.calibrate(imgsize);
+        SIGHT_DEBUG(
+            "Calibration error :" << result.error << " (" << result.rejected << " rejected views, "
+            << (result.warm_start ? "warm" : "cold") << " start)"
+        );
+
         const auto pose_camera = m_pose_vector.lock();
         if(pose_camera)
         {
             pose_camera->clear();
 
-            for(std::size_t index = 0 ; index < rvecs.size() ; ++index)
+            for(const auto& view : m_calibration.views())
             {
-                data::matrix4::sptr mat_3d = std::make_shared<data::matrix4>();
-
-                io::opencv::matrix::copy_from_cv(rvecs.at(index), tvecs.at(index), mat_3d);
-
-                pose_camera->push_back(mat_3d);
-                auto sig = pose_camera->signal<data::vector::added_signal_t>(
-                    data::vector::ADDED_OBJECTS_SIG
-                );
-                sig->async_emit(pose_camera->get_content());
+                if(view.inlier)
+                {
+                    data::matrix4::sptr mat_3d = std::make_shared<data::matrix4>();
+                    io::opencv::matrix::copy_from_cv(view.rvec, view.tvec, mat_3d);
+                    pose_camera->push_back(mat_3d);
+                }
             }
+
+            auto sig = pose_camera->signal<data::vector::added_signal_t>(data::vector::ADDED_OBJECTS_SIG);
+            sig->async_emit(pose_camera->get_content());
         }
 
-        const double err =
-            cv::calibrateCamera(object_points, image_points, imgsize, camera_matrix, dist_coeffs, rvecs, tvecs);
-        SIGHT_DEBUG("Calibration error :" << err);
+        const cv::Mat& camera_matrix = result.camera_matrix;
+        const cv::Mat& dist_coeffs   = result.dist_coeffs;
 
         const auto cam = m_camera.lock();
 
@@ -139,8 +111,14 @@ void open_cv_intrinsic::updating()
         cam->set_fy(camera_matrix.at<double>(1, 1));
         cam->set_width(img->size()[0]);
         cam->set_height(img->size()[1]);
-        cam->set_distortion_coefficient(dist_coeffs[0], dist_coeffs[1], dist_coeffs[2], dist_coeffs[3], dist_coeffs[4]);
-        cam->set_calibration_error(err);
+        cam->set_distortion_coefficient(
+            dist_coeffs.at<double>(0),
+            dist_coeffs.at<double>(1),
+            dist_coeffs.at<double>(2),
+            dist_coeffs.at<double>(3),
+            dist_coeffs.at<double>(4)
+        );
+        cam->set_calibration_error(result.error);
 
         cam->set_is_calibrated(true);
 
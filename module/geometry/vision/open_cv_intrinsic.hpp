@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2014-2024 IRCAD France
+ * Copyright (C) 2014-2025 IRCAD France
  * Copyright (C) 2014-2019 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -29,6 +29,7 @@
 #include <data/vector.hpp>
 
 #include <geometry/vision/calibrator.hpp>
+#include <geometry/vision/incremental_calibration.hpp>
 
 namespace sight::module::geometry::vision
 {
@@ -58,6 +59,10 @@ namespace sight::module::geometry::vision
  * - \b board_width : width of the chessboard.
  * - \b board_height : height of the chessboard.
  * - \b board_square_size : Square size of the chessboard.
+ * - \b outlier_factor (default: 0) : views whose reprojection error is above the median error multiplied by this
+ *      factor are not used in the calibration. 0 disables the rejection.
+ *
+ * The views are cached between two updates, and the previous calibration is used as initial guess of the next one.
  */
 class open_cv_intrinsic : public sight::geometry::vision::calibrator
 {
@@ -87,6 +92,9 @@ protected:
 
 private:
 
+    /// Views and previous solution, reused by the next calibration
+    sight::geometry::vision::incremental_calibration m_calibration;
+
     data::ptr<data::calibration_info, data::access::in> m_calibration_info {this, "calibrationInfo"};
     data::ptr<data::camera, data::access::inout> m_camera {this, "camera"};
     data::ptr<data::vector, data::access::inout> m_pose_vector {this, "poseVector"};
@@ -99,6 +107,9 @@ private:
 
     /// Square size of the chessboard.
     sight::data::property<sight::data::real> m_square_size {this, "board_square_size", 20.};
+
+    /// Outlier rejection factor, 0 disables the rejection.
+    sight::data::property<sight::data::real> m_outlier_factor {this, "outlier_factor", 0.};
 };
 
 } // namespace sight::module::geometry::vision
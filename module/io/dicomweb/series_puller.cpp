@@ -24,6 +24,7 @@
 
 #include <core/com/signal.hxx>
 #include <core/com/slots.hxx>
+#include <core/os/temp_path.hpp>
 #include <core/tools/system.hpp>
 
 #include <data/dicom_series.hpp>
@@ -31,6 +32,7 @@
 #include <io/http/exceptions/base.hpp>
 #include <io/http/helper/series.hpp>
 #include <io/http/request.hpp>
+#include <io/http/retriever.hpp>
 
 #include <service/extension/config.hpp>
 #include <service/op.hpp>
@@ -39,6 +41,7 @@
 #include <ui/__/dialog/progress.hpp>
 #include <ui/__/preferences.hpp>
 
+#include <algorithm>
 #include <filesystem>
 
 namespace sight::module::io::dicomweb
@@ -204,91 +207,60 @@ void series_puller::pull_series()
         // Pull series
         if(!pull_series_vector.empty())
         {
-            /// GET
-            const instance_uid_container_t& series_instances_ui_ds =
-                sight::io::http::helper::series::to_series_instance_uid_container(pull_series_vector);
-            for(const std::string& series_instances_uid : series_instances_ui_ds)
+            /// Url PACS
+            const std::string pacs_server("http://" + *m_server_hostname + ":" + std::to_string(*m_server_port));
+
+            // Instances are retrieved concurrently, on a few kept alive connections
+            sight::io::http::retriever retriever(
+                {.max_connections = static_cast<std::size_t>(std::max(std::int64_t(1), *m_max_connections))});
+
+            for(const auto& series : pull_series_vector)
             {
-                // Find Series according to SeriesInstanceUID
-                QJsonObject query;
-                query.insert("SeriesInstanceUID", series_instances_uid.c_str());
-
-                QJsonObject body;
-                body.insert("Level", "Series");
-                body.insert("Query", query);
-                body.insert("Limit", 0);
-
-                /// Url PACS
-                const std::string pacs_server("http://" + *m_server_hostname + ":" + std::to_string(*m_server_port));
-
-                /// Orthanc "/tools/find" route. POST a JSON to get all Series corresponding to the SeriesInstanceUID.
-                sight::io::http::request::sptr request = sight::io::http::request::New(
-                    pacs_server + "/tools/find"
-                );
-                QByteArray series_answer;
+                const std::string& series_instance_uid = series->get_series_instance_uid();
+
+                // All the instances of a series are written in a dedicated folder
+                m_path = core::os::temp_file::unique_path().parent_path() / series_instance_uid;
+
+                std::vector<sight::io::http::request::sptr> requests;
+
+                if(!m_wado_root->empty())
+                {
+                    /// WADO-RS series route, all instances are sent in a single "multipart/related" response.
+                    auto request = sight::io::http::request::New(
+                        pacs_server + *m_wado_root + "/studies/" + series->get_study_instance_uid() + "/series/"
+                        + series_instance_uid
+                    );
+                    request->add_header("Accept", R"(multipart/related; type="application/dicom")");
+                    requests.push_back(request);
+                }
+                else
+                {
+                    for(const auto& instance_url : this->instance_urls(pacs_server, series_instance_uid))
+                    {
+                        requests.push_back(sight::io::http::request::New(instance_url));
+                    }
+                }
+
                 try
                 {
-                    series_answer = m_client_qt.post(request, QJsonDocument(body).toJson());
+                    retriever.get_files(requests, m_path);
+
+                    const auto& statistics = retriever.get_statistics();
+                    SIGHT_INFO(
+                        "Series '" << series_instance_uid << "' pulled: " << statistics.parts << " instances, "
+                        << statistics.bytes << " bytes in " << statistics.elapsed.count() << " s, on "
+                        << statistics.connections << " connections."
+                    );
                 }
-                catch(sight::io::http::exceptions::host_not_found& exception)
+                catch(sight::io::http::exceptions::content_not_found& exception)
                 {
                     std::stringstream ss;
-                    ss << "Host not found:\n"
-                    << " Please check your configuration: \n"
-                    << "Pacs host name: " << *m_server_hostname << "\n"
-                    << "Pacs port: " << *m_server_port << "\n";
+                    ss << "Content not found:  \n"
+                    << "Unable download the DICOM instance. \n";
 
                     sight::module::io::dicomweb::series_puller::display_error_message(ss.str());
                     SIGHT_WARN(exception.what());
                 }
-
-                QJsonDocument json_response    = QJsonDocument::fromJson(series_answer);
-                const QJsonArray& series_array = json_response.array();
-
-                const auto series_array_size = series_array.count();
-                for(auto i = 0 ; i < series_array_size ; ++i)
-                {
-                    const std::string& series_uid = series_array.at(i).toString().toStdString();
-
-                    /// GET all Instances by Series.
-                    const std::string& instances_url(std::string(pacs_server) + "/series/" + series_uid);
-                    const QByteArray& instances_answer =
-                        m_client_qt.get(sight::io::http::request::New(instances_url));
-                    json_response = QJsonDocument::fromJson(instances_answer);
-                    const QJsonObject& json_obj       = json_response.object();
-                    const QJsonArray& instances_array = json_obj["Instances"].toArray();
-
-                    const auto instances_array_size = instances_array.count();
-                    for(auto j = 0 ; j < instances_array_size ; ++j)
-                    {
-                        const std::string& instance_uid = instances_array.at(j).toString().toStdString();
-
-                        /// GET DICOM Instance file.
-                        const std::string instance_url(pacs_server + "/instances/" + instance_uid + "/file");
-
-                        try
-                        {
-                            m_path = m_client_qt.get_file(sight::io::http::request::New(instance_url));
-                        }
-                        catch(sight::io::http::exceptions::content_not_found& exception)
-                        {
-                            std::stringstream ss;
-                            ss << "Content not found:  \n"
-                            << "Unable download the DICOM instance. \n";
-
-                            sight::module::io::dicomweb::series_puller::display_error_message(ss.str());
-                            SIGHT_WARN(exception.what());
-                        }
-
-                        // Create dicom folder
-                        std::filesystem::path instance_path = m_path.parent_path() / series_instances_uid;
-                        QDir().mkpath(instance_path.string().c_str());
-                        // Move dicom file to the created dicom folder
-                        instance_path /= m_path.filename();
-                        QFile::rename(m_path.string().c_str(), instance_path.string().c_str());
-                        m_path = m_path.parent_path() / series_instances_uid;
-                    }
-                }
             }
         }
 
@@ -313,6 +285,71 @@ void series_puller::pull_series()
 
 //------------------------------------------------------------------------------
 
+std::vector<std::string> series_puller::instance_urls(
+    const std::string& _pacs_server,
+    const std::string& _series_instance_uid
+)
+{
+    std::vector<std::string> urls;
+
+    // Find Series according to SeriesInstanceUID
+    QJsonObject query;
+    query.insert("SeriesInstanceUID", _series_instance_uid.c_str());
+
+    QJsonObject body;
+    body.insert("Level", "Series");
+    body.insert("Query", query);
+    body.insert("Limit", 0);
+
+    /// Orthanc "/tools/find" route. POST a JSON to get all Series corresponding to the SeriesInstanceUID.
+    sight::io::http::request::sptr request = sight::io::http::request::New(_pacs_server + "/tools/find");
+    QByteArray series_answer;
+    try
+    {
+        series_answer = m_client_qt.post(request, QJsonDocument(body).toJson());
+    }
+    catch(sight::io::http::exceptions::host_not_found& exception)
+    {
+        std::stringstream ss;
+        ss << "Host not found:\n"
+        << " Please check your configuration: \n"
+        << "Pacs host name: " << *m_server_hostname << "\n"
+        << "Pacs port: " << *m_server_port << "\n";
+
+        sight::module::io::dicomweb::series_puller::display_error_message(ss.str());
+        SIGHT_WARN(exception.what());
+    }
+
+    QJsonDocument json_response    = QJsonDocument::fromJson(series_answer);
+    const QJsonArray& series_array = json_response.array();
+
+    const auto series_array_size = series_array.count();
+    for(auto i = 0 ; i < series_array_size ; ++i)
+    {
+        const std::string& series_uid = series_array.at(i).toString().toStdString();
+
+        /// GET all Instances by Series.
+        const std::string& instances_url(_pacs_server + "/series/" + series_uid);
+        const QByteArray& instances_answer = m_client_qt.get(sight::io::http::request::New(instances_url));
+        json_response = QJsonDocument::fromJson(instances_answer);
+        const QJsonObject& json_obj       = json_response.object();
+        const QJsonArray& instances_array = json_obj["Instances"].toArray();
+
+        const auto instances_array_size = instances_array.count();
+        for(auto j = 0 ; j < instances_array_size ; ++j)
+        {
+            const std::string& instance_uid = instances_array.at(j).toString().toStdString();
+
+            /// DICOM Instance file.
+            urls.push_back(_pacs_server + "/instances/" + instance_uid + "/file");
+        }
+    }
+
+    return urls;
+}
+
+//------------------------------------------------------------------------------
+
 void series_puller::read_local_series(dicom_series_container_t _selected_series)
 {
     const auto dest_series_set = m_series_set.lock();
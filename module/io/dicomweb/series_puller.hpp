@@ -70,6 +70,9 @@ namespace sight::module::io::dicomweb
  * @subsection Properties Properties
  * - \b host_name : Need hostname string (default value is "127.0.0.1").
  * - \b port : Need the value of port (default value is 8042).
+ * - \b max_connections : Maximum number of concurrent connections used to retrieve the instances (default value is 8).
+ * - \b wado_root : Root of the WADO-RS routes on the server, i.e. "/dicom-web". If set, each series is retrieved with
+ *   a single WADO-RS request instead of one request per instance (default value is empty).
  */
 
 class series_puller : public service::controller
@@ -112,6 +115,13 @@ private:
     /// Pull the Series from the Pacs.
     void pull_series();
 
+    /**
+     * @brief Lists the urls of the DICOM files of a series, using Orthanc routes.
+     * @param[in] _pacs_server url of the server
+     * @param[in] _series_instance_uid SeriesInstanceUID of the series
+     */
+    std::vector<std::string> instance_urls(const std::string& _pacs_server, const std::string& _series_instance_uid);
+
     /**
      * @brief Read local series.
      * @param[in] _selected_series Series to read
@@ -165,6 +175,8 @@ private:
 
     sight::data::property<sight::data::string> m_server_hostname {this, "host_name", std::string("localhost")};
     sight::data::property<sight::data::integer> m_server_port {this, "port", 4242};
+    sight::data::property<sight::data::integer> m_max_connections {this, "max_connections", 8};
+    sight::data::property<sight::data::string> m_wado_root {this, "wado_root", std::string("")};
 
     sight::data::ptr<sight::data::vector, sight::data::access::in> m_selected_series {this, "selected_series"};
     sight::data::ptr<sight::data::series_set, sight::data::access::inout> m_series_set {this, "series_set"};
@@ -34,6 +34,7 @@
 
 #include <service/extension/config.hpp>
 
+#include <algorithm>
 #include <sstream>
 
 namespace sight::module::io::dimse
@@ -47,6 +48,8 @@ static const core::com::slots::key_t REMOVE_SERIES_SLOT = "removeSeries";
 
 static const std::string DICOM_READER_CONFIG = "dicomReader";
 static const std::string READER_CONFIG       = "readerConfig";
+static const std::string ASSOCIATIONS_CONFIG = "associations";
+static const std::string WRITER_THREADS      = "writerThreads";
 
 series_puller::series_puller() noexcept :
     service::notifier(m_signals)
@@ -73,7 +76,9 @@ void series_puller::configuring()
     m_dicom_reader_implementation = config.get(DICOM_READER_CONFIG, m_dicom_reader_implementation);
     SIGHT_ERROR_IF("'" + DICOM_READER_CONFIG + "' attribute not set", m_dicom_reader_implementation.empty())
 
-    m_reader_config = config.get(READER_CONFIG, m_reader_config);
+    m_reader_config  = config.get(READER_CONFIG, m_reader_config);
+    m_associations   = std::max(std::size_t(1), config.get(ASSOCIATIONS_CONFIG, m_associations));
+    m_writer_threads = config.get(WRITER_THREADS, m_writer_threads);
 }
 
 //------------------------------------------------------------------------------
@@ -208,8 +213,10 @@ void series_puller::pull_series()
                 pacs_config->get_pacs_host_name(),
                 pacs_config->get_pacs_application_port(),
                 pacs_config->get_pacs_application_title(),
-                pacs_config->get_move_application_title()
+                pacs_config->get_move_application_title(),
+                m_slot_store_instance
             );
+            series_enquirer->set_writer_threads(m_writer_threads);
             series_enquirer->connect();
         }
         catch(const sight::io::dimse::exceptions::base& e)
@@ -224,43 +231,51 @@ void series_puller::pull_series()
         try
         {
             using sight::io::dimse::helper::series;
-            if(pacs_config->get_retrieve_method() == sight::io::dimse::data::pacs_configuration::retrieve_method::get)
+            using retrieve_method_t = sight::io::dimse::data::pacs_configuration::retrieve_method;
+
+            auto retrieve_method = pacs_config->get_retrieve_method();
+            if(retrieve_method != retrieve_method_t::get && retrieve_method != retrieve_method_t::move)
             {
-                series_enquirer->pull_series_using_get_retrieve_method(
-                    series::to_series_instance_uid_container(
-                        pull_series_vector
-                    )
-                );
+                SIGHT_ERROR("Unknown retrieve method, 'get' will be used");
+                retrieve_method = retrieve_method_t::get;
             }
-            else if(pacs_config->get_retrieve_method()
-                    == sight::io::dimse::data::pacs_configuration::retrieve_method::move)
+
+            std::shared_ptr<sight::io::dimse::series_retriever> series_retriever;
+            if(retrieve_method == retrieve_method_t::move)
             {
-                auto series_retriever = std::make_shared<sight::io::dimse::series_retriever>();
+                series_retriever = std::make_shared<sight::io::dimse::series_retriever>();
                 series_retriever->initialize(
                     pacs_config->get_move_application_title(),
                     pacs_config->get_move_application_port(),
                     1,
                     m_slot_store_instance
                 );
+                series_retriever->set_writer_threads(m_writer_threads);
 
                 // Start series retriever in a worker.
                 worker->post([series_retriever](auto&& ...){series_retriever->start();});
+            }
 
-                // Pull Selected Series.
-                series_enquirer->pull_series_using_move_retrieve_method(
-                    series::to_series_instance_uid_container(
-                        pull_series_vector
-                    )
-                );
+            // Pull Selected Series, on several associations if required.
+            const auto& series_instance_uids = series::to_series_instance_uid_container(pull_series_vector);
+            if(m_associations > 1)
+            {
+                series_enquirer->pull_series(series_instance_uids, retrieve_method, m_associations);
+            }
+            else if(retrieve_method == retrieve_method_t::move)
+            {
+                series_enquirer->pull_series_using_move_retrieve_method(series_instance_uids);
             }
             else
             {
-                SIGHT_ERROR("Unknown retrieve method, 'get' will be used");
-                series_enquirer->pull_series_using_get_retrieve_method(
-                    series::to_series_instance_uid_container(
-                        pull_series_vector
-                    )
-                );
+                series_enquirer->pull_series_using_get_retrieve_method(series_instance_uids);
+            }
+
+            if(series_retriever)
+            {
+                // Wait for the last instances to be written.
+                series_retriever->get_writer()->wait();
+                series_retriever->get_writer()->log_statistics();
             }
         }
         catch(const sight::io::dimse::exceptions::base& e)
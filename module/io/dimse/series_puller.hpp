@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -53,7 +53,8 @@ namespace sight::module::io::dimse
         <in key="pacsConfig" uid="..." />
         <in key="selectedSeries" uid="..." />
         <inout key="seriesSet" uid="..." />
-        <config dicomReader="sight::module::io::dicom::series_set_reader" readerConfig="config" />
+        <config dicomReader="sight::module::io::dicom::series_set_reader" readerConfig="config" associations="4"
+                writerThreads="2" />
     </service>
    @endcode
  *
@@ -67,6 +68,10 @@ namespace sight::module::io::dimse
  * @subsection Configuration Configuration:
  * - \b dicomReader (mandatory, string): reader type to use.
  * - \b readerConfig (optional, string, default=""): configuration for the DICOM Reader.
+ * - \b associations (optional, unsigned int, default=1): number of associations opened with the PACS, the series are
+ *      pulled in parallel on these associations.
+ * - \b writerThreads (optional, unsigned int, default=0): number of threads writing the received instances while the
+ *      next ones are received, 0 means they are written by the receiving thread.
  */
 class series_puller final : public service::controller,
                             public service::has_services,
@@ -146,6 +151,12 @@ private:
     /// Contains the optional configuration to set to reader implementation.
     std::string m_reader_config;
 
+    /// Defines the number of associations used to pull the series.
+    std::size_t m_associations {1};
+
+    /// Defines the number of threads writing the received instances.
+    std::size_t m_writer_threads {0};
+
     /// Contains the DICOM reader.
     sight::io::service::reader::sptr m_dicom_reader {nullptr};
 
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -23,6 +23,7 @@
 #include "client_listener.hpp"
 
 #include <core/com/signal.hxx>
+#include <core/memory/buffer_allocation_policy.hpp>
 #include <core/tools/failed.hpp>
 
 #include <data/frame_tl.hpp>
@@ -34,6 +35,7 @@
 #include <ui/__/dialog/message.hpp>
 #include <ui/__/preferences.hpp>
 
+#include <cstring>
 #include <functional>
 #include <string>
 
@@ -101,6 +103,9 @@ void client_listener::run_client()
         const auto hostname = preferences.delimited_get<std::string>(m_hostname_config);
 
         m_client.connect(hostname, port);
+
+        // Tell Sight servers that compressed images can be sent to this client
+        m_client.send_capabilities();
         m_sig_connected->async_emit();
     }
     catch(core::exception& ex)
@@ -123,34 +128,62 @@ void client_listener::run_client()
     }
 
     // 2. Receive messages
+    // Images that are not pushed in a timeline are decoded in buffers recycled from the pool
+    m_client.set_image_allocation_policy(core::memory::buffer_pool_policy::get_default());
+
     try
     {
         while(m_client.is_connected())
         {
-            std::string device_name;
-            data::object::sptr receive_object = m_client.receive_object(device_name);
-            if(receive_object)
+            const ::igtl::MessageHeader::Pointer header = m_client.receive_header();
+            if(header.IsNull())
+            {
+                continue;
+            }
+
+            const std::string device_name = header->GetDeviceName();
+            const auto& iter              = std::find(m_device_names.begin(), m_device_names.end(), device_name);
+
+            if(iter == m_device_names.end())
+            {
+                // Consume the body of the message to stay in sync with the stream
+                m_client.receive_body(header);
+                continue;
+            }
+
+            const auto index_receive_object = static_cast<std::size_t>(std::distance(m_device_names.begin(), iter));
+
+            // The objects are not locked while the messages are received, which blocks until the whole body is read
+            bool is_a_frame_tl  = false;
+            bool is_a_matrix_tl = false;
+            {
+                const auto obj = m_objects[index_receive_object].lock();
+                is_a_frame_tl  = obj->is_a("data::frame_tl");
+                is_a_matrix_tl = obj->is_a("data::matrix_tl");
+            }
+
+            if(is_a_frame_tl)
             {
-                const auto& iter = std::find(m_device_names.begin(), m_device_names.end(), device_name);
+                this->receive_frame(header, index_receive_object);
+                continue;
+            }
 
-                if(iter != m_device_names.end())
+            double timestamp                   = 0.;
+            data::object::sptr receive_object = m_client.receive_object(header, timestamp);
+            if(receive_object)
+            {
+                if(is_a_matrix_tl)
                 {
-                    const auto index_receive_object = std::distance(m_device_names.begin(), iter);
-                    const auto obj                  = m_objects[static_cast<std::size_t>(index_receive_object)].lock();
-
-                    const bool is_a_timeline = obj->is_a("data::matrix_tl") || obj->is_a("data::frame_tl");
-                    if(is_a_timeline)
-                    {
-                        this->manage_timeline(receive_object, static_cast<std::size_t>(index_receive_object));
-                    }
-                    else
-                    {
-                        obj->shallow_copy(receive_object);
-
-                        data::object::modified_signal_t::sptr sig;
-                        sig = obj->signal<data::object::modified_signal_t>(data::object::MODIFIED_SIG);
-                        sig->async_emit();
-                    }
+                    this->manage_timeline(receive_object, index_receive_object);
+                }
+                else
+                {
+                    const auto obj = m_objects[index_receive_object].lock();
+                    obj->shallow_copy(receive_object);
+
+                    data::object::modified_signal_t::sptr sig;
+                    sig = obj->signal<data::object::modified_signal_t>(data::object::MODIFIED_SIG);
+                    sig->async_emit();
                 }
             }
         }
@@ -208,9 +241,8 @@ void client_listener::manage_timeline(data::object::sptr _obj, std::size_t _inde
 {
     core::clock::type timestamp = core::clock::get_time_in_milli_sec();
 
-    const auto data     = m_objects[_index].lock();
-    const auto mat_tl   = std::dynamic_pointer_cast<data::matrix_tl>(data.get_shared());
-    const auto frame_tl = std::dynamic_pointer_cast<data::frame_tl>(data.get_shared());
+    const auto data   = m_objects[_index].lock();
+    const auto mat_tl = std::dynamic_pointer_cast<data::matrix_tl>(data.get_shared());
 
     //MatrixTL
     if(mat_tl)
@@ -234,60 +266,102 @@ void client_listener::manage_timeline(data::object::sptr _obj, std::size_t _inde
         auto sig = mat_tl->signal<data::timeline::signals::pushed_t>(data::timeline::signals::PUSHED);
         sig->async_emit(timestamp);
     }
-    //FrameTL
-    else if(frame_tl)
-    {
-        data::image::sptr im = std::dynamic_pointer_cast<data::image>(_obj);
+}
 
-        if(!m_tl_initialized)
-        {
-            const auto frame_pixel_format =
-                [](data::image::pixel_format_t _image_pixel_format)
-                {
-                    switch(_image_pixel_format)
-                    {
-                        case data::image::pixel_format_t::bgr:
-                            return data::frame_tl::pixel_format::bgr;
+//-----------------------------------------------------------------------------
 
-                        case data::image::pixel_format_t::rgb:
-                            return data::frame_tl::pixel_format::rgb;
+void client_listener::receive_frame(const ::igtl::MessageHeader::Pointer& _header, std::size_t _index)
+{
+    const core::clock::type timestamp = core::clock::get_time_in_milli_sec();
 
-                        case data::image::pixel_format_t::rgba:
-                            return data::frame_tl::pixel_format::rgba;
+    const auto frame_pixel_format =
+        [](data::image::pixel_format_t _image_pixel_format)
+        {
+            switch(_image_pixel_format)
+            {
+                case data::image::pixel_format_t::bgr:
+                    return data::frame_tl::pixel_format::bgr;
 
-                        case data::image::pixel_format_t::bgra:
-                            return data::frame_tl::pixel_format::bgra;
+                case data::image::pixel_format_t::rgb:
+                    return data::frame_tl::pixel_format::rgb;
 
-                        case data::image::pixel_format_t::gray_scale:
-                            return data::frame_tl::pixel_format::gray_scale;
+                case data::image::pixel_format_t::rgba:
+                    return data::frame_tl::pixel_format::rgba;
 
-                        default:
-                            return data::frame_tl::pixel_format::undefined;
-                    }
-                }(im->pixel_format());
+                case data::image::pixel_format_t::bgra:
+                    return data::frame_tl::pixel_format::bgra;
 
-            frame_tl->set_maximum_size(10);
-            frame_tl->init_pool_size(im->size()[0], im->size()[1], im->type(), frame_pixel_format);
-            m_tl_initialized = true;
-        }
+                case data::image::pixel_format_t::gray_scale:
+                    return data::frame_tl::pixel_format::gray_scale;
 
-        SPTR(data::frame_tl::buffer_t) buffer = frame_tl->create_buffer(timestamp);
+                default:
+                    return data::frame_tl::pixel_format::undefined;
+            }
+        };
 
-        auto* dest_buffer = reinterpret_cast<std::uint8_t*>(buffer->add_element(0));
+    // The timeline is only locked to take a buffer from its pool, the pixels are written in the buffer while it is not
+    // pushed yet, so the socket is read without holding the lock
+    SPTR(data::frame_tl::buffer_t) buffer;
+    const auto allocate_frame =
+        [&](const sight::io::igtl::client::image_info& _info) -> void*
+        {
+            const auto data     = m_objects[_index].lock();
+            const auto frame_tl = std::dynamic_pointer_cast<data::frame_tl>(data.get_shared());
+            const auto format   = frame_pixel_format(_info.pixel_format);
+            if(!m_tl_initialized
+               || frame_tl->get_width() != _info.size[0]
+               || frame_tl->get_height() != _info.size[1]
+               || frame_tl->type() != _info.type
+               || frame_tl->pixel_format() != format)
+            {
+                frame_tl->set_maximum_size(10);
+                frame_tl->init_pool_size(_info.size[0], _info.size[1], _info.type, format);
+                m_tl_initialized = true;
+            }
 
-        const auto dump_lock = im->dump_lock();
-        auto itr             = im->begin<std::uint8_t>();
-        const auto end       = im->end<std::uint8_t>();
+            buffer = frame_tl->create_buffer(timestamp);
+            return buffer->add_element(0);
+        };
 
-        std::copy(itr, end, dest_buffer);
+    if(std::string(_header->GetDeviceType()) == "IMAGE")
+    {
+        // The pixels are received directly in the buffer of the timeline, sized from the image header
+        m_client.receive_image(_header, allocate_frame);
+    }
+    else
+    {
+        // Compressed images are decoded first, then copied in the buffer of the timeline
+        double image_timestamp = 0.;
+        const auto image       = std::dynamic_pointer_cast<data::image>(
+            m_client.receive_object(_header, image_timestamp)
+        );
+        if(!image)
+        {
+            return;
+        }
 
-        frame_tl->push_object(buffer);
+        const auto lock = image->dump_lock();
+        sight::io::igtl::client::image_info info;
+        info.size          = image->size();
+        info.type          = image->type();
+        info.pixel_format  = image->pixel_format();
+        info.size_in_bytes = image->size_in_bytes();
+        std::memcpy(allocate_frame(info), image->buffer(), info.size_in_bytes);
+    }
 
-        data::timeline::signals::pushed_t::sptr sig;
-        sig = frame_tl->signal<data::timeline::signals::pushed_t>
-                  (data::timeline::signals::PUSHED);
-        sig->async_emit(timestamp);
+    if(!buffer)
+    {
+        return;
     }
+
+    const auto data     = m_objects[_index].lock();
+    const auto frame_tl = std::dynamic_pointer_cast<data::frame_tl>(data.get_shared());
+    frame_tl->push_object(buffer);
+
+    data::timeline::signals::pushed_t::sptr sig;
+    sig = frame_tl->signal<data::timeline::signals::pushed_t>
+              (data::timeline::signals::PUSHED);
+    sig->async_emit(timestamp);
 }
 
 //-----------------------------------------------------------------------------
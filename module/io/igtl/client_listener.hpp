@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -91,10 +91,17 @@ private:
 
     /**
      * @brief method called when the current object is a timeline
-     * @note Currently only data::matrix_tl and data::frame_tl are managed
+     * @note Currently only data::matrix_tl is managed, images are received in data::frame_tl by receive_frame()
      */
     void manage_timeline(data::object::sptr _obj, std::size_t _index);
 
+    /**
+     * @brief receives an image into a new buffer of the data::frame_tl at _index
+     * The body of IMAGE messages is received directly in the buffer, compressed images are decoded then copied.
+     * The timeline pool is (re)initialized when the size, type or format of the received frames changes.
+     */
+    void receive_frame(const ::igtl::MessageHeader::Pointer& _header, std::size_t _index);
+
     /// client socket
     sight::io::igtl::client m_client;
 
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -77,6 +77,8 @@ void client_sender::configuring()
     {
         throw core::tools::failed("Server element not found");
     }
+
+    this->configure_compression(config);
 }
 
 //-----------------------------------------------------------------------------
@@ -91,6 +93,7 @@ void client_sender::starting()
             const auto port     = preferences.delimited_get<std::uint16_t>(m_port_config);
             const auto hostname = preferences.delimited_get<std::string>(m_hostname_config);
 
+            m_client.set_image_compression(m_image_compression);
             m_client.connect(hostname, port);
             m_sig_connected->async_emit();
         }
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -40,6 +40,7 @@ namespace sight::module::io::igtl
  *           <key uid="..." deviceName="device01" />
  *           <key uid="..." deviceName="device02" />
  *      </in>
+ *      <compression codec="zstd" level="1" bandwidth="100" lossy="false" />
  * </service>
  * @endcode
  * @subsection Input Input:
@@ -48,6 +49,11 @@ namespace sight::module::io::igtl
  * @subsection Configuration Configuration:
  * - \b deviceName : filter by device Name in Message
  * - \b server : server URL. Need hostname and port in this format addr:port (default value is 127.0.0.1:4242).
+ * - \b compression (optional): compresses the images sent to a Sight server which announced it can decode them.
+ *   - \b codec (optional, raw/zstd/jpeg, default=zstd): codec of the images.
+ *   - \b level (optional, default=1 for zstd, 90 for jpeg): zstd level (-7 to 22) or JPEG quality (1 to 100).
+ *   - \b bandwidth (optional): target bandwidth in Mbit/s, the codec and its level are then adapted to it.
+ *   - \b lossy (optional, default=false): allows the adaptation to switch to JPEG when zstd does not fit.
  * @note : hostname and port of this service can be a value or a nameKey from preference settings
    (for example <server>%HOSTNAME%:%PORT%</server>)
  */
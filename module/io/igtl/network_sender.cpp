@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2020-2023 IRCAD France
+ * Copyright (C) 2020-2025 IRCAD France
  * Copyright (C) 2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -23,6 +23,7 @@
 #include "network_sender.hpp"
 
 #include <core/com/signal.hxx>
+#include <core/tools/failed.hpp>
 
 #include <data/object.hpp>
 
@@ -74,6 +75,55 @@ service::connections_t network_sender::auto_connections() const
     return connections;
 }
 
+//-----------------------------------------------------------------------------
+
+void network_sender::configure_compression(const config_t& _config)
+{
+    const auto compression_config = _config.get_child_optional("compression");
+    if(!compression_config)
+    {
+        m_image_compression.reset();
+        return;
+    }
+
+    using sight::io::igtl::image_codec;
+
+    sight::io::igtl::image_compression compression;
+
+    const auto codec = compression_config->get<std::string>("<xmlattr>.codec", "zstd");
+    if(codec == "raw")
+    {
+        compression.encoding = {.codec = image_codec::raw, .level = 0};
+    }
+    else if(codec == "zstd")
+    {
+        compression.encoding = {.codec = image_codec::zstd, .level = 1};
+    }
+    else if(codec == "jpeg")
+    {
+        compression.encoding = {.codec = image_codec::jpeg, .level = 90};
+    }
+    else
+    {
+        SIGHT_THROW_EXCEPTION(core::tools::failed("Unknown image compression codec '" + codec + "'"));
+    }
+
+    compression.encoding.level = compression_config->get<int>("<xmlattr>.level", compression.encoding.level);
+    compression.lossy          = compression_config->get<bool>("<xmlattr>.lossy", false);
+
+    if(const auto bandwidth = compression_config->get_optional<double>("<xmlattr>.bandwidth"); bandwidth)
+    {
+        SIGHT_THROW_EXCEPTION_IF(
+            core::tools::failed("The image compression bandwidth must be positive"),
+            *bandwidth <= 0.
+        );
+        // Mbit/s to bytes per second.
+        compression.bandwidth = *bandwidth * 1e6 / 8.;
+    }
+
+    m_image_compression = compression;
+}
+
 // ----------------------------------------------------------------------------
 
 } // namespace sight::module::io::igtl.
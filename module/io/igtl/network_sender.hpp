@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2020-2024 IRCAD France
+ * Copyright (C) 2020-2025 IRCAD France
  * Copyright (C) 2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -24,8 +24,12 @@
 
 #include <data/object.hpp>
 
+#include <io/igtl/image_compression.hpp>
+
 #include <service/controller.hpp>
 
+#include <optional>
+
 namespace sight::module::io::igtl
 {
 
@@ -71,6 +75,22 @@ protected:
      */
     virtual void send_object(const data::object::csptr& _obj, std::size_t _index) = 0;
 
+    /**
+     * @brief Reads the optional image compression of the configuration.
+     *
+     * @code{.xml}
+     * <compression codec="zstd" level="1" bandwidth="100" lossy="false" />
+     * @endcode
+     * - \b codec (optional, raw/zstd/jpeg, default=zstd): codec of the images sent to the Sight peers.
+     * - \b level (optional, default=1 for zstd and 90 for jpeg): zstd level (-7 to 22) or JPEG quality (1 to 100).
+     * - \b bandwidth (optional): target bandwidth of each peer in Mbit/s, the codec and its level are then adapted.
+     * - \b lossy (optional, default=false): allows the adaptation to use JPEG when zstd does not fit.
+     */
+    void configure_compression(const config_t& _config);
+
+    /// Compression of the sent images, unset when there is no compression element in the configuration
+    std::optional<sight::io::igtl::image_compression> m_image_compression;
+
     /// Defines the signal emitted when service is connected.
     using connected_signal_t = core::com::signal<void ()>;
     connected_signal_t::sptr m_sig_connected;
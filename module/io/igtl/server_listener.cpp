@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -76,6 +76,8 @@ void server_listener::starting()
         ui::preferences preferences;
         const auto port = preferences.delimited_get<std::uint16_t>(m_port_config);
 
+        // Tell the Sight clients that they can send compressed images
+        m_server->set_advertise_capabilities(true);
         m_server->start(port);
 
         m_server_future = std::async(std::launch::async, [this](auto&& ...){m_server->run_server();});
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -54,6 +54,7 @@ namespace sight::module::io::igtl
  * @subsection Input Input:
  * - \b objects [sight::data::object]: specified objects to listen.
  * They must have an attribute 'deviceName' to know the device-name used for this specific data.
+ * @note The server announces to the connected clients that it can decode compressed images, see client_sender.
  **/
 class server_listener : public module::io::igtl::network_listener
 {
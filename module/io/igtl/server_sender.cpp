@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -70,6 +70,8 @@ void server_sender::configuring()
         const std::string device_name = attr.get("deviceName", "Sight");
         m_device_names.push_back(device_name);
     }
+
+    this->configure_compression(config);
 }
 
 //-----------------------------------------------------------------------------
@@ -81,6 +83,7 @@ void server_sender::starting()
         ui::preferences preferences;
         const auto port = preferences.delimited_get<std::uint16_t>(m_port_config);
 
+        m_server->set_image_compression(m_image_compression);
         m_server->start(port);
 
         m_server_future = std::async(std::launch::async, [this](auto&& ...){m_server->run_server();});
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2024 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -47,10 +47,17 @@ namespace sight::module::io::igtl
  *           <key uid="..." deviceName="device01" />
  *           <key uid="..." deviceName="device02" />
  *      </in>
+ *      <compression codec="zstd" level="1" bandwidth="100" lossy="false" />
  * </service>
  * @endcode
  * @subsection Configuration Configuration:
  * - \b port : defines the port where the objects will be sent
+ * - \b compression (optional): compresses the images sent to the Sight clients which announced they can decode them.
+ *   The codec is adapted separately for each client.
+ *   - \b codec (optional, raw/zstd/jpeg, default=zstd): codec of the images.
+ *   - \b level (optional, default=1 for zstd, 90 for jpeg): zstd level (-7 to 22) or JPEG quality (1 to 100).
+ *   - \b bandwidth (optional): target bandwidth of each client in Mbit/s, the codec and its level are then adapted.
+ *   - \b lossy (optional, default=false): allows the adaptation to switch to JPEG when zstd does not fit.
  * @subsection Input Input:
  * - \b objects [sight::data::object]: specified objects to send.
  * They must have an attribute 'deviceName' to know the device-name used for this specific data.
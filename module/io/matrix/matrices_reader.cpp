@@ -34,14 +34,13 @@
 
 #include <service/macros.hpp>
 
+#include <io/__/writer/matrix_timeline_writer.hpp>
+
 #include <ui/__/dialog/location.hpp>
 #include <ui/__/dialog/message.hpp>
 
-#include <boost/tokenizer.hpp>
-
 #include <cmath>
 #include <filesystem>
-#include <fstream>
 
 namespace sight::module::io::matrix
 {
@@ -50,6 +49,7 @@ static const core::com::slots::key_t START_READING    = "start_reading";
 static const core::com::slots::key_t STOP_READING     = "stop_reading";
 static const core::com::slots::key_t PAUSE            = "pause";
 static const core::com::slots::key_t TOGGLE_LOOP_MODE = "toggle_loop_mode";
+static const core::com::slots::key_t SEEK             = "seek";
 
 static const core::com::slots::key_t READ_NEXT     = "readNext";
 static const core::com::slots::key_t READ_PREVIOUS = "readPrevious";
@@ -64,6 +64,7 @@ matrices_reader::matrices_reader() noexcept :
     new_slot(STOP_READING, &matrices_reader::stop_reading, this);
     new_slot(PAUSE, &matrices_reader::pause, this);
     new_slot(TOGGLE_LOOP_MODE, &matrices_reader::toggle_loop_mode, this);
+    new_slot(SEEK, &matrices_reader::seek, this);
 
     new_slot(READ_NEXT, &matrices_reader::read_next, this);
     new_slot(READ_PREVIOUS, &matrices_reader::read_previous, this);
@@ -72,14 +73,8 @@ matrices_reader::matrices_reader() noexcept :
 
 //------------------------------------------------------------------------------
 
-matrices_reader::~matrices_reader() noexcept
-{
-    if(nullptr != m_filestream)
-    {
-        m_filestream->close();
-        delete m_filestream;
-    }
-}
+matrices_reader::~matrices_reader() noexcept =
+    default;
 
 //------------------------------------------------------------------------------
 
@@ -131,6 +126,10 @@ void matrices_reader::open_location_dialog()
     dialog_file.set_option(ui::dialog::location::read);
     dialog_file.set_type(ui::dialog::location::single_file);
     dialog_file.add_filter(".csv file", "*.csv");
+    dialog_file.add_filter(
+        "Binary matrix timeline",
+        "*" + std::string(sight::io::writer::matrix_timeline_writer::EXTENSION)
+    );
 
     auto result = std::dynamic_pointer_cast<core::location::single_file>(dialog_file.show());
     if(result)
@@ -138,13 +137,6 @@ void matrices_reader::open_location_dialog()
         default_directory->set_folder(result->get_file().parent_path());
         dialog_file.save_default_location(default_directory);
         this->set_file(result->get_file());
-
-        if(nullptr != m_filestream)
-        {
-            m_filestream->close();
-        }
-
-        m_filestream = new std::ifstream(this->get_file().string());
     }
     else
     {
@@ -205,7 +197,7 @@ void matrices_reader::read_next()
         const std::int64_t shift   = static_cast<std::int64_t>(m_step_changed) - static_cast<std::int64_t>(m_step);
         const std::int64_t shifted = static_cast<std::int64_t>(m_ts_matrices_count) + shift;
 
-        if(shifted < static_cast<std::int64_t>(m_ts_matrices.size()))
+        if(m_reader && shifted < static_cast<std::int64_t>(m_reader->size()))
         {
             // Update matrix position index
             m_ts_matrices_count = static_cast<std::size_t>(shifted);
@@ -257,66 +249,22 @@ void matrices_reader::start_reading()
 
     if(this->has_location_defined())
     {
-        if(nullptr == m_filestream)
+        try
         {
-            std::string file = this->get_file().string();
-
-            m_filestream = new std::ifstream(file);
-        }
+            // Only the timestamps are read here, the matrices are parsed when they are pushed in the timeline
+            m_reader = std::make_unique<sight::io::reader::matrix_timeline_reader>(this->get_file());
 
-        if(m_filestream->is_open())
-        {
-            std::string line;
-            while(std::getline(*m_filestream, line))
+            if(m_reader->matrix_count() > 0)
             {
-                // parse the cvs file with tokenizer
-                const boost::char_separator<char> sep(", ;");
-                const boost::tokenizer<boost::char_separator<char> > tok {line, sep};
-
-                // nb of 4x4 matrices = nb of elements - 1 (timestamp) / 16.
-                const auto nb_of_elements = std::distance(tok.begin(), tok.end());
-                if(nb_of_elements < 17)
-                {
-                    SIGHT_WARN("Too few elements(" << nb_of_elements << ") to convert this csv line into matrices");
-                    continue;
-                }
-
-                const auto nb_of_matrices = static_cast<unsigned int>((nb_of_elements - 1) / 16);
-
                 const auto matrix_tl = m_matrix_tl.lock();
-                matrix_tl->init_pool_size(nb_of_matrices);
-
-                time_stamped_matrices current_ts_mat;
-
-                boost::tokenizer<boost::char_separator<char> >::iterator iter = tok.begin();
-                current_ts_mat.timestamp = std::stod(iter.current_token());
-
-                ++iter;
-
-                for(unsigned int m = 0 ; m < nb_of_matrices ; ++m)
-                {
-                    std::array<float, 16> mat {};
-                    for(float& i : mat)
-                    {
-                        i = std::stof(iter.current_token());
-
-                        if(iter != tok.end())
-                        {
-                            ++iter;
-                        }
-                    }
-
-                    current_ts_mat.matrices.push_back(mat);
-                }
-
-                m_ts_matrices.push_back(current_ts_mat);
+                matrix_tl->init_pool_size(static_cast<unsigned int>(m_reader->matrix_count()));
             }
-
-            m_filestream->close();
         }
-        else
+        catch(const std::exception& e)
         {
-            SIGHT_ERROR("The csv file '" + this->get_file().string() + "' can not be openned.");
+            m_reader.reset();
+            SIGHT_ERROR("The file '" + this->get_file().string() + "' can not be opened: " + e.what());
+            return;
         }
 
         if(m_one_shot)
@@ -335,12 +283,11 @@ void matrices_reader::start_reading()
             if(m_use_timelapse)
             {
                 m_timer->set_one_shot(true);
-                if(m_ts_matrices.size() >= 2)
+                if(m_reader->size() >= 2)
                 {
                     duration =
                         std::chrono::milliseconds(
-                            static_cast<std::uint64_t>(m_ts_matrices[1].timestamp
-                                                       - m_ts_matrices[0].timestamp)
+                            static_cast<std::uint64_t>(m_reader->timestamp(1) - m_reader->timestamp(0))
                         );
                 }
                 else
@@ -379,17 +326,8 @@ void matrices_reader::stop_reading()
         m_timer.reset();
     }
 
-    if(nullptr != m_filestream)
-    {
-        m_filestream->close();
-        delete m_filestream;
-        m_filestream = nullptr;
-    }
-
-    if(!m_ts_matrices.empty())
-    {
-        m_ts_matrices.clear();
-    }
+    m_reader.reset();
+    m_matrices.clear();
 
     m_ts_matrices_count = 0;
 
@@ -416,12 +354,19 @@ void matrices_reader::pause()
 
 void matrices_reader::read_matrices()
 {
-    if(!m_is_paused && m_ts_matrices_count < m_ts_matrices.size())
+    if(!m_reader)
+    {
+        return;
+    }
+
+    const std::size_t nb_rows = m_reader->size();
+
+    if(!m_is_paused && m_ts_matrices_count < nb_rows)
     {
         const auto t_start   = core::clock::get_time_in_milli_sec();
         const auto matrix_tl = m_matrix_tl.lock();
 
-        time_stamped_matrices current_matrices = m_ts_matrices[m_ts_matrices_count];
+        const double file_timestamp = m_reader->read(m_ts_matrices_count, m_matrices);
 
         core::clock::type timestamp = NAN;
 
@@ -431,7 +376,7 @@ void matrices_reader::read_matrices()
         }
         else
         {
-            timestamp = current_matrices.timestamp;
+            timestamp = file_timestamp;
         }
 
         // Push matrix in timeline
@@ -440,28 +385,27 @@ void matrices_reader::read_matrices()
         matrix_tl->push_object(matrix_buf);
 
         SIGHT_DEBUG("Reading matrix index " << m_ts_matrices_count << " with timestamp " << timestamp);
-        for(unsigned int i = 0 ; i < current_matrices.matrices.size() ; ++i)
+        for(unsigned int i = 0 ; i < m_matrices.size() ; ++i)
         {
-            matrix_buf->set_element(current_matrices.matrices[i], i);
+            matrix_buf->set_element(m_matrices[i], i);
         }
 
-        if(m_use_timelapse && (m_ts_matrices_count + m_step) < m_ts_matrices.size())
+        if(m_use_timelapse && (m_ts_matrices_count + m_step) < nb_rows)
         {
-            const auto elapsed_time          = core::clock::get_time_in_milli_sec() - t_start;
-            const std::size_t current_matrix = m_ts_matrices_count;
-            const double current_time        = m_ts_matrices[current_matrix].timestamp + elapsed_time;
-            double next_duration             = m_ts_matrices[m_ts_matrices_count + m_step].timestamp - current_time;
+            const auto elapsed_time   = core::clock::get_time_in_milli_sec() - t_start;
+            const double current_time = file_timestamp + elapsed_time;
+            double next_duration      = m_reader->timestamp(m_ts_matrices_count + m_step) - current_time;
 
             // If the next matrix delay is already passed, drop the matrices and check the next one.
-            while(next_duration < elapsed_time && (m_ts_matrices_count + m_step) < m_ts_matrices.size())
+            while(next_duration < elapsed_time && (m_ts_matrices_count + m_step) < nb_rows)
             {
-                next_duration        = m_ts_matrices[m_ts_matrices_count + m_step].timestamp - current_time;
+                next_duration        = m_reader->timestamp(m_ts_matrices_count + m_step) - current_time;
                 m_ts_matrices_count += m_step;
                 SIGHT_DEBUG("Skipping a matrix");
             }
 
             // If it is the last matrix array: stop the timer or loop
-            if((m_ts_matrices_count + m_step) == m_ts_matrices.size())
+            if((m_ts_matrices_count + m_step) == nb_rows)
             {
                 m_timer->stop();
                 if(m_loop_matrix)
@@ -475,8 +419,7 @@ void matrices_reader::read_matrices()
             }
             else
             {
-                next_duration = m_ts_matrices[m_ts_matrices_count + m_step].timestamp
-                                - current_time;
+                next_duration = m_reader->timestamp(m_ts_matrices_count + m_step) - current_time;
                 core::thread::timer::time_duration_t duration =
                     std::chrono::milliseconds(static_cast<std::int64_t>(next_duration));
                 m_timer->stop();
@@ -511,4 +454,24 @@ void matrices_reader::toggle_loop_mode()
 
 //------------------------------------------------------------------------------
 
+void matrices_reader::seek(core::clock::type _timestamp)
+{
+    if(!m_reader)
+    {
+        SIGHT_WARN("The reading has not started, seeking is not possible.");
+        return;
+    }
+
+    m_ts_matrices_count = m_reader->lower_bound(_timestamp);
+
+    // Push the matrices at once in one-shot mode, otherwise the next tick of the timer reads them
+    if(m_one_shot && m_timer)
+    {
+        m_timer->stop();
+        m_timer->start();
+    }
+}
+
+//------------------------------------------------------------------------------
+
 } // namespace sight::module::io::matrix
@@ -26,19 +26,24 @@
 
 #include <data/matrix_tl.hpp>
 
+#include <io/__/reader/matrix_timeline_reader.hpp>
 #include <io/__/service/reader.hpp>
 
 #include <array>
+#include <memory>
 
 namespace sight::module::io::matrix
 {
 
 /**
- * @brief This service reads a csv file and extract matrices from it to push it into a matrix_tl.
+ * @brief This service reads a csv or a binary file and extract matrices from it to push it into a matrix_tl.
  *
  * This service can be used in two ways, first one is full-automatic by setting the framerate (oneShot off),
  * the second one is one-per-one using readNext and/or readPrevious slots.
  *
+ * The file is memory-mapped and only indexed when the reading starts, the matrices are parsed one row at a time while
+ * they are pushed in the timeline. Binary files, written by matrix_writer, do not even need to be indexed.
+ *
  * @note Each line of csv file should be written like:
  * timestamp;matrix1-value1;...;matrix1-value16;...;matrixN-value1;...;matrixN-value16;
  * Each line should contain exactly the same number of matrices.
@@ -53,6 +58,8 @@ namespace sight::module::io::matrix
  * slots on oneShot mode (supported key: "step")
  * - \b toggle_loop_mode() : changes the loop mode. If active, the reader loops over the file,
  * if false, it reads the file once only
+ * - \b seek(core::clock::type timestamp) : continue the reading from the first matrices which timestamp is not before
+ * the given one
  *
  * @section XML XML Configuration
  *
@@ -102,17 +109,6 @@ public:
     /// Return file type (io::service::FILE)
     sight::io::service::path_type_t get_path_type() const override;
 
-    /**
-     * @brief The TimeStampedMatrices structure handle a list of matrices and the associated timestamp.
-     */
-    struct time_stamped_matrices
-    {
-        ///timestamp
-        core::clock::type timestamp {};
-        ///vector of matrices (std::array<float, 16>).
-        std::vector<std::array<float, 16> > matrices;
-    };
-
 protected:
 
     /// Does nothing
@@ -149,14 +145,19 @@ private:
     /// SLOT: toggle the loop mode
     void toggle_loop_mode();
 
+    /// SLOT: continue the reading from the given timestamp
+    void seek(core::clock::type _timestamp);
+
     /// Read matrices (this function is set to the worker)
     void read_matrices();
 
     bool m_is_playing {false}; ///<flag if the service is playing.
 
-    std::ifstream* m_filestream {nullptr}; ///< input filestream
+    /// Index of the file being read, the matrices are parsed on demand
+    std::unique_ptr<sight::io::reader::matrix_timeline_reader> m_reader;
 
-    std::vector<time_stamped_matrices> m_ts_matrices; ///< vector of TimeStampedMatrices read from csv file.
+    /// Matrices of the current row, kept to reuse their allocation
+    std::vector<std::array<float, 16> > m_matrices;
 
     core::thread::timer::sptr m_timer; ///< Timer to call readMatrices at constant framerate
 
@@ -83,6 +83,13 @@ void matrix_writer::configuring()
     if(const auto& config_child = config.get_child_optional("config"); config_child)
     {
         m_interactive = config_child->get<bool>("<xmlattr>.interactive", true);
+
+        const auto format = config_child->get<std::string>("<xmlattr>.format", "csv");
+        SIGHT_ASSERT(
+            "Format '" << format << "' is not supported, use 'csv' or 'binary'.",
+            format == "csv" || format == "binary"
+        );
+        m_binary = format == "binary";
     }
 }
 
@@ -103,7 +110,17 @@ void matrix_writer::open_location_dialog()
     dialog_file.set_default_location(default_directory);
     dialog_file.set_option(ui::dialog::location::write);
     dialog_file.set_type(ui::dialog::location::single_file);
-    dialog_file.add_filter(".csv file", "*.csv");
+    if(m_binary)
+    {
+        dialog_file.add_filter(
+            "Binary matrix timeline",
+            "*" + std::string(sight::io::writer::matrix_timeline_writer::EXTENSION)
+        );
+    }
+    else
+    {
+        dialog_file.add_filter(".csv file", "*.csv");
+    }
 
     auto result = std::dynamic_pointer_cast<core::location::single_file>(dialog_file.show());
     if(result)
@@ -180,20 +197,37 @@ void matrix_writer::write(core::clock::type _timestamp)
         if(const auto& buffer = std::dynamic_pointer_cast<const data::matrix_tl::buffer_t>(object); buffer)
         {
             _timestamp = object->get_timestamp();
-            const auto time = static_cast<std::size_t>(_timestamp);
-            m_filestream << time << ";";
 
-            for(unsigned int i = 0 ; i < number_of_mat ; ++i)
+            if(m_binary)
             {
-                const std::array<float, 16>& values = buffer->get_element(i);
-
-                for(unsigned int v = 0 ; v < 16 ; ++v)
+                if(m_binary_writer)
                 {
-                    m_filestream << values[v] << ";";
+                    m_matrices.resize(number_of_mat);
+                    for(unsigned int i = 0 ; i < number_of_mat ; ++i)
+                    {
+                        m_matrices[i] = buffer->get_element(i);
+                    }
+
+                    m_binary_writer->write(_timestamp, m_matrices);
                 }
             }
+            else
+            {
+                const auto time = static_cast<std::size_t>(_timestamp);
+                m_filestream << time << ";";
 
-            m_filestream << std::endl;
+                for(unsigned int i = 0 ; i < number_of_mat ; ++i)
+                {
+                    const std::array<float, 16>& values = buffer->get_element(i);
+
+                    for(unsigned int v = 0 ; v < 16 ; ++v)
+                    {
+                        m_filestream << values[v] << ";";
+                    }
+                }
+
+                m_filestream << std::endl;
+            }
         }
     }
 
@@ -235,7 +269,22 @@ void matrix_writer::start_record()
 
         try
         {
-            if(!m_filestream.is_open())
+            if(m_binary)
+            {
+                if(!m_binary_writer)
+                {
+                    const auto& locked   = m_data.lock();
+                    const auto matrix_tl = std::dynamic_pointer_cast<const data::matrix_tl>(locked.get_shared());
+                    SIGHT_THROW_IF("The data is not a '" + data::matrix_tl::classname() + "'.", !matrix_tl);
+
+                    m_binary_writer = std::make_unique<sight::io::writer::matrix_timeline_writer>(
+                        this->get_file(),
+                        matrix_tl->get_max_element_num(),
+                        open_mode == std::ofstream::app
+                    );
+                }
+            }
+            else if(!m_filestream.is_open())
             {
                 m_filestream.open(this->get_file().string(), std::ofstream::out | open_mode);
                 m_filestream.precision(7);
@@ -243,7 +292,7 @@ void matrix_writer::start_record()
             }
 
             // Check if the file is open and in good state
-            m_is_recording = m_filestream.good();
+            m_is_recording = m_binary || m_filestream.good();
 
             SIGHT_ERROR_IF(
                 "The file " + this->get_file().string()
@@ -290,6 +339,8 @@ void matrix_writer::stop_record()
             m_filestream.close();
         }
 
+        m_binary_writer.reset();
+
         m_is_recording = false;
     }
     catch(const std::exception& e)
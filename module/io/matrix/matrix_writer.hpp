@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2017-2024 IRCAD France
+ * Copyright (C) 2017-2025 IRCAD France
  * Copyright (C) 2017-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -25,15 +25,22 @@
 #include <data/matrix_tl.hpp>
 
 #include <io/__/service/writer.hpp>
+#include <io/__/writer/matrix_timeline_writer.hpp>
 
+#include <array>
 #include <fstream>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace sight::module::io::matrix
 {
 
 /**
- * @brief This service allows the user to save the timeline matrices in a csv file.
+ * @brief This service allows the user to save the timeline matrices in a csv or a binary file.
+ *
+ * The binary format stores the raw values, it is faster to write and matrices_reader reloads it instantly, whatever
+ * its size. The csv format remains the default, to be read by other programs.
  *
  * @note The method 'updating' allows to save the timeline matrix with the current timestamp. If you want to save all
  * the
@@ -51,7 +58,7 @@ namespace sight::module::io::matrix
    <service type="sight::module::io::matrix::matrix_writer">
        <in key="data" uid="..." auto_connect="true" />
        <windowTitle>Select the file to save the matrix timeline to</windowTitle>
-       <config interactive="true" />
+       <config interactive="true" format="csv" />
    </service>
    @endcode
  * @subsection Input Input
@@ -63,6 +70,7 @@ namespace sight::module::io::matrix
  *   - \b interactive: if true, the service will display a dialog box to select the file to save. If false, no dialog
  *                     box will be shown. In this case, for practical reasons, the recording will start when setting a
  *                     baseFolder.
+ *   - \b format (optional, csv/binary, default: csv): format of the file, binary files use the '.tlm' extension.
  */
 class matrix_writer : public sight::io::service::writer
 {
@@ -122,9 +130,18 @@ private:
     /// flag if the service is in "interactive" mode. IE if a dialog box is displayed to select the file.
     bool m_interactive {true};
 
+    /// If true, the matrices are written in a binary file instead of a csv one
+    bool m_binary {false};
+
     /// File stream to write the matrices
     std::ofstream m_filestream;
 
+    /// Writer of the binary file
+    std::unique_ptr<sight::io::writer::matrix_timeline_writer> m_binary_writer;
+
+    /// Matrices of the current row, kept to reuse their allocation
+    std::vector<std::array<float, 16> > m_matrices;
+
     /// Mutex to protect concurrent access on the file stream and service state
     std::recursive_mutex m_mutex;
 };
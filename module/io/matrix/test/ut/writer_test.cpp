@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -30,6 +30,7 @@
 
 #include <data/matrix_tl.hpp>
 
+#include <io/__/reader/matrix_timeline_reader.hpp>
 #include <io/__/service/writer.hpp>
 
 #include <service/op.hpp>
@@ -199,4 +200,66 @@ void writer_test::base_folder_test()
     CPPUNIT_ASSERT_EQUAL(EXPECTED, actual);
 }
 
+//------------------------------------------------------------------------------
+
+void writer_test::binary_test()
+{
+    // Create a temporary directory
+    core::os::temp_dir tmp_dir;
+
+    // Create the service
+    auto matrix_writer = service::add("sight::module::io::matrix::matrix_writer");
+    CPPUNIT_ASSERT_MESSAGE("Failed to create service 'sight::module::io::matrix::matrix_writer'", matrix_writer);
+    matrix_writer->set_input(SOURCE_TL, "data");
+
+    // Create the service configuration
+    service::config_t config;
+    config.add("file", "matrices.tlm");
+
+    boost::property_tree::ptree config_child;
+    config_child.put("<xmlattr>.interactive", false);
+    config_child.put("<xmlattr>.format", "binary");
+    config.add_child("config", config_child);
+
+    // Start the service
+    CPPUNIT_ASSERT_NO_THROW(matrix_writer->set_config(config));
+    CPPUNIT_ASSERT_NO_THROW(matrix_writer->configure());
+    CPPUNIT_ASSERT_NO_THROW(matrix_writer->start().wait());
+
+    matrix_writer->slot("set_base_folder")->run(tmp_dir.string());
+
+    matrix_writer->slot("start_record")->run();
+    matrix_writer->slot("write")->run(core::clock::type(1));
+    matrix_writer->slot("write")->run(core::clock::type(2));
+    matrix_writer->slot("write")->run(core::clock::type(3));
+    matrix_writer->slot("stop_record")->run();
+
+    // Stop the service
+    CPPUNIT_ASSERT_NO_THROW(matrix_writer->stop().wait());
+    service::remove(matrix_writer);
+
+    CPPUNIT_ASSERT_EQUAL(
+        false,
+        std::dynamic_pointer_cast<sight::io::service::writer>(matrix_writer)->has_failed()
+    );
+
+    // Check the result with the reader used by matrices_reader
+    const sight::io::reader::matrix_timeline_reader reader(tmp_dir / "matrices.tlm");
+    CPPUNIT_ASSERT(reader.format() == sight::io::reader::matrix_timeline_reader::format_t::binary);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), reader.size());
+    CPPUNIT_ASSERT_EQUAL(std::size_t(4), reader.matrix_count());
+
+    std::vector<sight::io::reader::matrix_timeline_reader::matrix_t> matrices;
+    for(std::size_t i = 0 ; i < reader.size() ; ++i)
+    {
+        const auto expected = SOURCE_TL->get_closest_buffer(core::clock::type(i + 1));
+        CPPUNIT_ASSERT_EQUAL(double(i + 1), reader.read(i, matrices));
+
+        for(unsigned int m = 0 ; m < 4 ; ++m)
+        {
+            CPPUNIT_ASSERT(expected->get_element(m) == matrices[m]);
+        }
+    }
+}
+
 } // namespace sight::module::io::matrix::ut
@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2023 IRCAD France
+ * Copyright (C) 2023-2025 IRCAD France
  *
  * This file is part of Sight.
  *
@@ -34,6 +34,7 @@ class writer_test : public CPPUNIT_NS::TestFixture
 CPPUNIT_TEST_SUITE(writer_test);
 CPPUNIT_TEST(basic_test);
 CPPUNIT_TEST(base_folder_test);
+CPPUNIT_TEST(binary_test);
 CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -44,6 +45,7 @@ public:
 
     static void basic_test();
     static void base_folder_test();
+    static void binary_test();
 };
 
 } // namespace sight::module::io::matrix::ut
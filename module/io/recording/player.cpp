@@ -0,0 +1,483 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "player.hpp"
+
+#include "timeline_record.hpp"
+
+#include <core/com/signal.hpp>
+#include <core/com/signal.hxx>
+#include <core/com/signals.hpp>
+#include <core/com/slot.hpp>
+#include <core/com/slot.hxx>
+#include <core/com/slots.hpp>
+#include <core/com/slots.hxx>
+#include <core/location/single_file.hpp>
+#include <core/location/single_folder.hpp>
+
+#include <service/macros.hpp>
+
+#include <io/__/writer/recording_writer.hpp>
+
+#include <ui/__/dialog/location.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+namespace sight::module::io::recording
+{
+
+static const core::com::slots::key_t START_PLAYING    = "start_playing";
+static const core::com::slots::key_t STOP_PLAYING     = "stop_playing";
+static const core::com::slots::key_t PAUSE            = "pause";
+static const core::com::slots::key_t SET_POSITION     = "set_position";
+static const core::com::slots::key_t TOGGLE_LOOP_MODE = "toggle_loop_mode";
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+
+template<typename TIMELINE>
+void push_record(TIMELINE& _tl, std::span<const std::uint8_t> _data, core::clock::type _timestamp)
+{
+    const auto buffer = _tl.create_buffer(_timestamp);
+    timeline_record::decode(_data, *buffer);
+    _tl.push_object(buffer);
+
+    auto sig = _tl.template signal<data::timeline::signals::pushed_t>(data::timeline::signals::PUSHED);
+    sig->async_emit(_timestamp);
+}
+
+//------------------------------------------------------------------------------
+
+template<typename TIMELINE>
+void clear_timeline(TIMELINE& _tl)
+{
+    _tl.clear_timeline();
+
+    auto sig = _tl.template signal<data::timeline::signals::cleared_t>(data::timeline::signals::CLEARED);
+    sig->async_emit();
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+player::player() noexcept :
+    reader("Choose a recording to play")
+{
+    new_signal<signals::position_t>(signals::POSITION_MODIFIED);
+    new_signal<signals::duration_t>(signals::DURATION_MODIFIED);
+
+    new_slot(START_PLAYING, &player::start_playing, this);
+    new_slot(STOP_PLAYING, &player::stop_playing, this);
+    new_slot(PAUSE, &player::pause, this);
+    new_slot(SET_POSITION, &player::set_position, this);
+    new_slot(TOGGLE_LOOP_MODE, &player::toggle_loop_mode, this);
+}
+
+//------------------------------------------------------------------------------
+
+player::~player() noexcept =
+    default;
+
+//------------------------------------------------------------------------------
+
+sight::io::service::path_type_t player::get_path_type() const
+{
+    return sight::io::service::file;
+}
+
+//------------------------------------------------------------------------------
+
+void player::configuring()
+{
+    sight::io::service::reader::configuring();
+
+    const service::config_t config = this->get_config();
+
+    m_fps = config.get<unsigned int>("fps", m_fps);
+    SIGHT_ASSERT("Fps setting is set to " << m_fps << " but should be > 0.", m_fps > 0);
+
+    m_create_new_ts = config.get<bool>("createTimestamp", m_create_new_ts);
+    m_loop          = config.get<bool>("loop", m_loop);
+}
+
+//------------------------------------------------------------------------------
+
+void player::starting()
+{
+    m_worker = core::thread::worker::make();
+}
+
+//------------------------------------------------------------------------------
+
+void player::stopping()
+{
+    this->stop_playing();
+    m_worker->stop();
+}
+
+//------------------------------------------------------------------------------
+
+void player::updating()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void player::open_location_dialog()
+{
+    static auto default_directory = std::make_shared<core::location::single_folder>();
+
+    sight::ui::dialog::location dialog_file;
+    dialog_file.set_title(*m_window_title);
+    dialog_file.set_default_location(default_directory);
+    dialog_file.set_option(ui::dialog::location::read);
+    dialog_file.set_type(ui::dialog::location::single_file);
+    dialog_file.add_filter("Sight recording", "*" + std::string(sight::io::writer::recording_writer::EXTENSION));
+
+    auto result = std::dynamic_pointer_cast<core::location::single_file>(dialog_file.show());
+    if(result)
+    {
+        default_directory->set_folder(result->get_file().parent_path());
+        dialog_file.save_default_location(default_directory);
+        this->set_file(result->get_file());
+    }
+    else
+    {
+        this->clear_locations();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void player::start_playing()
+{
+    std::unique_lock lock(m_mutex);
+
+    if(m_timer)
+    {
+        this->stop_playing();
+    }
+
+    if(!this->has_location_defined())
+    {
+        this->open_location_dialog();
+    }
+
+    if(!this->has_location_defined())
+    {
+        return;
+    }
+
+    try
+    {
+        // Only the block headers are read here, the records are read when they are pushed in the timelines
+        m_reader = std::make_unique<sight::io::reader::recording_reader>(this->get_file());
+    }
+    catch(const std::exception& e)
+    {
+        m_reader.reset();
+        SIGHT_ERROR("The file '" + this->get_file().string() + "' can not be opened: " + e.what());
+        return;
+    }
+
+    if(!this->init_targets())
+    {
+        SIGHT_WARN("The file '" + this->get_file().string() + "' does not contain any stream to play.");
+        m_reader.reset();
+        return;
+    }
+
+    m_is_paused   = false;
+    m_origin      = m_begin;
+    m_origin_time = core::clock::get_time_in_milli_sec();
+
+    auto sig = this->signal<signals::duration_t>(signals::DURATION_MODIFIED);
+    sig->async_emit(static_cast<std::int64_t>(m_end - m_begin));
+
+    m_timer = m_worker->create_timer();
+    m_timer->set_function([this](auto&& ...){play();});
+    m_timer->set_duration(std::chrono::milliseconds(1000 / m_fps));
+    m_timer->start();
+}
+
+//------------------------------------------------------------------------------
+
+void player::stop_playing()
+{
+    std::unique_lock lock(m_mutex);
+
+    if(m_timer)
+    {
+        if(m_timer->is_running())
+        {
+            m_timer->stop();
+        }
+
+        m_timer.reset();
+    }
+
+    if(m_reader)
+    {
+        this->clear_timelines();
+    }
+
+    m_targets.clear();
+    m_reader.reset();
+}
+
+//------------------------------------------------------------------------------
+
+void player::pause()
+{
+    std::unique_lock lock(m_mutex);
+
+    if(m_is_paused)
+    {
+        m_origin_time = core::clock::get_time_in_milli_sec();
+    }
+    else
+    {
+        m_origin = this->position();
+    }
+
+    m_is_paused = !m_is_paused;
+}
+
+//------------------------------------------------------------------------------
+
+void player::set_position(std::int64_t _position)
+{
+    std::unique_lock lock(m_mutex);
+
+    if(!m_reader)
+    {
+        return;
+    }
+
+    m_origin      = std::clamp(m_begin + static_cast<core::clock::type>(_position), m_begin, m_end);
+    m_origin_time = core::clock::get_time_in_milli_sec();
+
+    // The timelines are cleared so that their timestamps remain ordered when moving backward
+    this->clear_timelines();
+    for(auto& target : m_targets)
+    {
+        target.next = m_reader->lower_bound(target.stream, m_origin);
+    }
+
+    if(m_timer && !m_timer->is_running())
+    {
+        m_timer->start();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void player::toggle_loop_mode()
+{
+    std::unique_lock lock(m_mutex);
+    m_loop = !m_loop;
+}
+
+//------------------------------------------------------------------------------
+
+core::clock::type player::position() const
+{
+    if(m_is_paused)
+    {
+        return m_origin;
+    }
+
+    return m_origin + (core::clock::get_time_in_milli_sec() - m_origin_time);
+}
+
+//------------------------------------------------------------------------------
+
+void player::play()
+{
+    std::unique_lock lock(m_mutex);
+
+    if(!m_reader || m_is_paused)
+    {
+        return;
+    }
+
+    const core::clock::type position = std::min(this->position(), m_end);
+
+    bool finished = true;
+    for(auto& target : m_targets)
+    {
+        const std::size_t size = m_reader->size(target.stream);
+
+        // Number of records which are due at this position
+        std::size_t due = m_reader->lower_bound(target.stream, position);
+        if(due < size && m_reader->timestamp(target.stream, due) <= position)
+        {
+            ++due;
+        }
+
+        // Only the latest due record is pushed, the others are already outdated
+        if(due > target.next)
+        {
+            try
+            {
+                this->push(target, m_reader->read(target.stream, due - 1));
+            }
+            catch(const std::exception& e)
+            {
+                SIGHT_ERROR("The record " << (due - 1) << " can not be read: " << e.what());
+            }
+
+            target.next = due;
+        }
+
+        finished = finished && target.next >= size;
+    }
+
+    auto sig = this->signal<signals::position_t>(signals::POSITION_MODIFIED);
+    sig->async_emit(static_cast<std::int64_t>(position - m_begin));
+
+    if(finished)
+    {
+        if(m_loop)
+        {
+            this->set_position(0);
+        }
+        else
+        {
+            m_timer->stop();
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+bool player::init_targets()
+{
+    m_targets.clear();
+    m_begin = std::numeric_limits<core::clock::type>::max();
+    m_end   = std::numeric_limits<core::clock::type>::lowest();
+
+    const auto& streams = m_reader->streams();
+    for(std::uint32_t stream = 0 ; stream < streams.size() ; ++stream)
+    {
+        const auto size      = m_reader->size(stream);
+        const auto& name     = streams[stream].name;
+        const auto separator = name.rfind('/');
+        if(size == 0 || separator == std::string::npos)
+        {
+            continue;
+        }
+
+        const std::string group = name.substr(0, separator);
+        const auto index        = static_cast<std::size_t>(std::strtoul(name.c_str() + separator + 1, nullptr, 10));
+        const auto& metadata    = streams[stream].metadata;
+
+        bool initialized = false;
+        timeline_t type  = timeline_t::frame;
+        if(group == "frame_tl" && index < m_frame_tls.size())
+        {
+            if(auto tl = m_frame_tls[index].lock(); tl)
+            {
+                initialized = timeline_record::init(*tl, metadata);
+            }
+        }
+        else if(group == "matrix_tl" && index < m_matrix_tls.size())
+        {
+            type = timeline_t::matrix;
+            if(auto tl = m_matrix_tls[index].lock(); tl)
+            {
+                initialized = timeline_record::init(*tl, metadata);
+            }
+        }
+        else if(group == "raw_buffer_tl" && index < m_raw_buffer_tls.size())
+        {
+            type = timeline_t::raw_buffer;
+            if(auto tl = m_raw_buffer_tls[index].lock(); tl)
+            {
+                initialized = timeline_record::init(*tl, metadata, m_reader->read(stream, 0).data.size());
+            }
+        }
+
+        SIGHT_WARN_IF("The stream '" << name << "' has no matching timeline and will not be played.", !initialized);
+        if(initialized)
+        {
+            m_targets.push_back({.type = type, .index = index, .stream = stream});
+            m_begin = std::min(m_begin, m_reader->timestamp(stream, 0));
+            m_end   = std::max(m_end, m_reader->timestamp(stream, size - 1));
+        }
+    }
+
+    return !m_targets.empty();
+}
+
+//------------------------------------------------------------------------------
+
+void player::push(const target_t& _target, const sight::io::reader::recording_reader::record_t& _record)
+{
+    const core::clock::type timestamp = m_create_new_ts ? core::clock::get_time_in_milli_sec() : _record.timestamp;
+
+    switch(_target.type)
+    {
+        case timeline_t::frame:
+            push_record(*m_frame_tls[_target.index].lock(), _record.data, timestamp);
+            break;
+
+        case timeline_t::matrix:
+            push_record(*m_matrix_tls[_target.index].lock(), _record.data, timestamp);
+            break;
+
+        case timeline_t::raw_buffer:
+            push_record(*m_raw_buffer_tls[_target.index].lock(), _record.data, timestamp);
+            break;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void player::clear_timelines()
+{
+    for(const auto& target : m_targets)
+    {
+        switch(target.type)
+        {
+            case timeline_t::frame:
+                clear_timeline(*m_frame_tls[target.index].lock());
+                break;
+
+            case timeline_t::matrix:
+                clear_timeline(*m_matrix_tls[target.index].lock());
+                break;
+
+            case timeline_t::raw_buffer:
+                clear_timeline(*m_raw_buffer_tls[target.index].lock());
+                break;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::module::io::recording
@@ -0,0 +1,207 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <core/thread/timer.hpp>
+
+#include <data/frame_tl.hpp>
+#include <data/matrix_tl.hpp>
+#include <data/raw_buffer_tl.hpp>
+
+#include <io/__/reader/recording_reader.hpp>
+#include <io/__/service/reader.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace sight::module::io::recording
+{
+
+/**
+ * @brief Replays a '.srec' file written by the recorder in frame, matrix and raw buffer timelines.
+ *
+ * The file is memory-mapped, only its index is read when the playing starts. Each stream is pushed in the timeline of
+ * the same group and index it was recorded from, at the pace given by the recorded timestamps, so that the timelines
+ * can be synchronized again, for instance by sight::module::sync::synchronizer. When the player is late, the records
+ * which are already outdated are skipped.
+ *
+ * @section Signals Signals
+ * - \b position_modified(std::int64_t) : emitted when the position in the recording is modified, in milliseconds.
+ * - \b duration_modified(std::int64_t) : emitted when the playing starts, with the duration of the recording.
+ *
+ * @section Slots Slots
+ * - \b start_playing() : start playing, a file dialog is shown if no file is defined yet
+ * - \b stop_playing() : stop playing and clear the timelines
+ * - \b pause() : pause or resume playing
+ * - \b set_position(std::int64_t) : move to the given position in the recording, in milliseconds
+ * - \b toggle_loop_mode() : toggle the loop mode
+ *
+ * @section XML XML Configuration
+ *
+ * @code{.xml}
+   <service type="sight::module::io::recording::player">
+       <inout group="frame_tl">
+           <key uid="..." />
+       </inout>
+       <inout group="matrix_tl">
+           <key uid="..." />
+       </inout>
+       <windowTitle>Select the recording to play</windowTitle>
+       <fps>100</fps>
+       <createTimestamp>false</createTimestamp>
+       <loop>false</loop>
+   </service>
+   @endcode
+ * @subsection In-Out In-Out
+ * - \b frame_tl [sight::data::frame_tl] (optional): timelines in which the recorded frames are pushed.
+ * - \b matrix_tl [sight::data::matrix_tl] (optional): timelines in which the recorded matrices are pushed.
+ * - \b raw_buffer_tl [sight::data::raw_buffer_tl] (optional): timelines in which the recorded buffers are pushed.
+ *
+ * @subsection Configuration Configuration
+ * - \b windowTitle: allow overriding the default title of the modal file selection window. \see io::reader
+ * - \b fps (optional, default: 100): frequency at which the player checks for the records to push.
+ * - \b createTimestamp (optional, default: false): push the records with the current time instead of their recorded
+ *   timestamp.
+ * - \b loop (optional, default: false): restart from the beginning at the end of the recording.
+ */
+class player : public sight::io::service::reader
+{
+public:
+
+    SIGHT_DECLARE_SERVICE(player, sight::io::service::reader);
+
+    struct signals
+    {
+        using position_t = core::com::signal<void (std::int64_t)>;
+        using duration_t = core::com::signal<void (std::int64_t)>;
+
+        static inline const core::com::signals::key_t POSITION_MODIFIED = "position_modified";
+        static inline const core::com::signals::key_t DURATION_MODIFIED = "duration_modified";
+    };
+
+    /// Constructor.
+    player() noexcept;
+
+    /// Destructor.
+    ~player() noexcept override;
+
+    /// Displays a location dialog allowing to select the file to read.
+    void open_location_dialog() override;
+
+    /// Returns file type (io::service::file)
+    sight::io::service::path_type_t get_path_type() const override;
+
+protected:
+
+    /// Configures the service.
+    void configuring() override;
+
+    /// Creates the worker of the timer.
+    void starting() override;
+
+    /// Stops playing.
+    void stopping() override;
+
+    /// Does nothing.
+    void updating() override;
+
+private:
+
+    /// Kind of timeline a stream is replayed in
+    enum class timeline_t
+    {
+        frame,
+        matrix,
+        raw_buffer
+    };
+
+    /// Stream of the file replayed in a timeline of the service
+    struct target_t
+    {
+        timeline_t type;
+        std::size_t index;
+        std::uint32_t stream;
+        std::size_t next {0};
+    };
+
+    /// SLOT: starts playing
+    void start_playing();
+
+    /// SLOT: stops playing
+    void stop_playing();
+
+    /// SLOT: pauses or resumes playing
+    void pause();
+
+    /// SLOT: moves to the given position in milliseconds
+    void set_position(std::int64_t _position);
+
+    /// SLOT: toggles the loop mode
+    void toggle_loop_mode();
+
+    /// Pushes the due records in the timelines, called by the timer
+    void play();
+
+    /// Finds the timeline of each stream and initializes it, returns false if no stream can be replayed
+    bool init_targets();
+
+    /// Pushes a record in the timeline of a target
+    void push(const target_t& _target, const sight::io::reader::recording_reader::record_t& _record);
+
+    /// Clears the timelines of the targets
+    void clear_timelines();
+
+    /// Returns the position in the recording, as a timestamp of the recording
+    [[nodiscard]] core::clock::type position() const;
+
+    /// Index of the file being played
+    std::unique_ptr<sight::io::reader::recording_reader> m_reader;
+
+    /// Streams of the file which have a timeline
+    std::vector<target_t> m_targets;
+
+    /// First and last timestamps of the recording
+    core::clock::type m_begin {0.};
+    core::clock::type m_end {0.};
+
+    /// Position when the playing was started, resumed or moved, and time at which it happened
+    core::clock::type m_origin {0.};
+    core::clock::type m_origin_time {0.};
+
+    core::thread::timer::sptr m_timer;
+    core::thread::worker::sptr m_worker;
+
+    unsigned int m_fps {100};
+    bool m_create_new_ts {false};
+    bool m_loop {false};
+    bool m_is_paused {false};
+
+    /// Protects the playing state, which is shared between the slots and the timer
+    mutable std::recursive_mutex m_mutex;
+
+    data::ptr_vector<data::frame_tl, data::access::inout> m_frame_tls {this, "frame_tl"};
+    data::ptr_vector<data::matrix_tl, data::access::inout> m_matrix_tls {this, "matrix_tl"};
+    data::ptr_vector<data::raw_buffer_tl, data::access::inout> m_raw_buffer_tls {this, "raw_buffer_tl"};
+};
+
+} // namespace sight::module::io::recording
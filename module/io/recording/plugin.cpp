@@ -0,0 +1,44 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "module/io/recording/plugin.hpp"
+
+namespace sight::module::io::recording
+{
+
+SIGHT_REGISTER_PLUGIN("sight::module::io::recording::plugin");
+
+plugin::~plugin() noexcept =
+    default;
+
+//------------------------------------------------------------------------------
+
+void plugin::start()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void plugin::stop() noexcept
+{
+}
+
+} // namespace sight::module::io::recording
@@ -0,0 +1,289 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "recorder.hpp"
+
+#include "timeline_record.hpp"
+
+#include <core/com/slot.hpp>
+#include <core/com/slot.hxx>
+#include <core/com/slots.hpp>
+#include <core/com/slots.hxx>
+#include <core/location/single_file.hpp>
+#include <core/location/single_folder.hpp>
+
+#include <service/macros.hpp>
+
+#include <ui/__/dialog/location.hpp>
+
+#include <algorithm>
+#include <filesystem>
+
+namespace sight::module::io::recording
+{
+
+static const core::com::slots::key_t START_RECORD = "start_record";
+static const core::com::slots::key_t STOP_RECORD  = "stop_record";
+static const core::com::slots::key_t RECORD       = "record";
+
+//------------------------------------------------------------------------------
+
+recorder::recorder() noexcept :
+    writer("Choose a file to save the recording")
+{
+    new_slot(START_RECORD, &recorder::start_record, this);
+    new_slot(STOP_RECORD, &recorder::stop_record, this);
+    new_slot(RECORD, static_cast<void (recorder::*)(core::clock::type)>(&recorder::record), this);
+}
+
+//------------------------------------------------------------------------------
+
+recorder::~recorder() noexcept
+{
+    this->stop_record();
+}
+
+//------------------------------------------------------------------------------
+
+sight::io::service::path_type_t recorder::get_path_type() const
+{
+    return sight::io::service::file;
+}
+
+//------------------------------------------------------------------------------
+
+void recorder::configuring()
+{
+    sight::io::service::writer::configuring();
+}
+
+//------------------------------------------------------------------------------
+
+void recorder::starting()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void recorder::stopping()
+{
+    this->stop_record();
+}
+
+//------------------------------------------------------------------------------
+
+void recorder::updating()
+{
+    this->start_record();
+}
+
+//------------------------------------------------------------------------------
+
+void recorder::open_location_dialog()
+{
+    static auto default_directory = std::make_shared<core::location::single_folder>();
+
+    sight::ui::dialog::location dialog_file;
+    dialog_file.set_title(*m_window_title);
+    dialog_file.set_default_location(default_directory);
+    dialog_file.set_option(ui::dialog::location::write);
+    dialog_file.set_type(ui::dialog::location::single_file);
+    dialog_file.add_filter("Sight recording", "*" + std::string(sight::io::writer::recording_writer::EXTENSION));
+
+    auto result = std::dynamic_pointer_cast<core::location::single_file>(dialog_file.show());
+    if(result)
+    {
+        default_directory->set_folder(result->get_file().parent_path());
+        dialog_file.save_default_location(default_directory);
+        this->set_file(result->get_file());
+    }
+    else
+    {
+        this->clear_locations();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void recorder::start_record()
+{
+    std::unique_lock lock(m_mutex);
+
+    if(m_writer)
+    {
+        return;
+    }
+
+    if(!this->has_location_defined())
+    {
+        this->open_location_dialog();
+    }
+
+    if(!this->has_location_defined())
+    {
+        SIGHT_WARN("The output location has not been defined. The recording will not start.");
+        return;
+    }
+
+    try
+    {
+        const std::filesystem::path dirname = this->get_file().parent_path();
+        if(!dirname.empty() && !std::filesystem::exists(dirname))
+        {
+            std::filesystem::create_directories(dirname);
+        }
+
+        sight::io::writer::recording_writer::options options;
+        options.compression_level = static_cast<int>(std::clamp<std::int64_t>(*m_compression, 0, 9));
+
+        m_writer = std::make_unique<sight::io::writer::recording_writer>(this->get_file(), options);
+    }
+    catch(const std::exception& e)
+    {
+        m_writer.reset();
+        SIGHT_ERROR("The file " + this->get_file().string() + " can't be opened. " + e.what());
+        return;
+    }
+
+    // Streams are declared again in the new file
+    m_frame_streams.assign(m_frame_tls.size(), {});
+    m_matrix_streams.assign(m_matrix_tls.size(), {});
+    m_raw_streams.assign(m_raw_buffer_tls.size(), {});
+}
+
+//------------------------------------------------------------------------------
+
+void recorder::stop_record()
+{
+    std::unique_lock lock(m_mutex);
+
+    if(!m_writer)
+    {
+        return;
+    }
+
+    try
+    {
+        m_writer->close();
+    }
+    catch(const std::exception& e)
+    {
+        SIGHT_ERROR("The file " + this->get_file().string() + " can't be closed. " + e.what());
+    }
+
+    m_writer.reset();
+}
+
+//------------------------------------------------------------------------------
+
+void recorder::record(core::clock::type _timestamp)
+{
+    std::unique_lock lock(m_mutex);
+
+    m_write_failed = true;
+
+    if(!m_writer)
+    {
+        return;
+    }
+
+    try
+    {
+        for(std::size_t i = 0 ; i < m_frame_tls.size() && i < m_frame_streams.size() ; ++i)
+        {
+            if(const auto tl = m_frame_tls[i].lock(); tl)
+            {
+                this->record(*tl, timeline_record::name("frame_tl", i), m_frame_streams[i], _timestamp);
+            }
+        }
+
+        for(std::size_t i = 0 ; i < m_matrix_tls.size() && i < m_matrix_streams.size() ; ++i)
+        {
+            if(const auto tl = m_matrix_tls[i].lock(); tl)
+            {
+                this->record(*tl, timeline_record::name("matrix_tl", i), m_matrix_streams[i], _timestamp);
+            }
+        }
+
+        for(std::size_t i = 0 ; i < m_raw_buffer_tls.size() && i < m_raw_streams.size() ; ++i)
+        {
+            if(const auto tl = m_raw_buffer_tls[i].lock(); tl)
+            {
+                this->record(*tl, timeline_record::name("raw_buffer_tl", i), m_raw_streams[i], _timestamp);
+            }
+        }
+    }
+    catch(const std::exception& e)
+    {
+        SIGHT_ERROR("The recording in " + this->get_file().string() + " failed. " + e.what());
+        return;
+    }
+
+    m_write_failed = false;
+}
+
+//------------------------------------------------------------------------------
+
+template<typename TIMELINE>
+void recorder::record(
+    const TIMELINE& _tl,
+    const std::string& _name,
+    stream_t& _stream,
+    core::clock::type _timestamp
+)
+{
+    // Every timeline of the service is connected to this slot, only the one which pushed this timestamp has a buffer
+    const auto object = _tl.get_object(_timestamp);
+    if(!object || (_stream.id && object->get_timestamp() <= _stream.last_timestamp))
+    {
+        return;
+    }
+
+    const auto buffer = std::dynamic_pointer_cast<const timeline_record::buffer_t<TIMELINE> >(object);
+    if(!buffer)
+    {
+        return;
+    }
+
+    if(!_stream.id)
+    {
+        _stream.id = m_writer->add_stream(_name, timeline_record::metadata(_tl));
+    }
+
+    timeline_record::encode(*buffer, m_record);
+    m_writer->write(*_stream.id, object->get_timestamp(), m_record);
+    _stream.last_timestamp = object->get_timestamp();
+}
+
+//------------------------------------------------------------------------------
+
+service::connections_t recorder::auto_connections() const
+{
+    return {
+        {"frame_tl", data::timeline::signals::PUSHED, RECORD},
+        {"matrix_tl", data::timeline::signals::PUSHED, RECORD},
+        {"raw_buffer_tl", data::timeline::signals::PUSHED, RECORD}
+    };
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::module::io::recording
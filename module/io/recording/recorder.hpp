@@ -0,0 +1,155 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <data/frame_tl.hpp>
+#include <data/integer.hpp>
+#include <data/matrix_tl.hpp>
+#include <data/raw_buffer_tl.hpp>
+
+#include <io/__/service/writer.hpp>
+#include <io/__/writer/recording_writer.hpp>
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace sight::module::io::recording
+{
+
+/**
+ * @brief Records frame, matrix and raw buffer timelines in a single '.srec' file.
+ *
+ * Each timeline is stored in its own stream, named after its group and its index in the group (e.g. "frame_tl/0").
+ * The records are grouped in chunks, optionally compressed, and indexed by timestamp so that the player can seek
+ * in the file without reading it. A buffer is recorded each time it is pushed in its timeline.
+ *
+ * @section Slots Slots
+ * - \b start_record() : start recording, a file dialog is shown if no file is defined yet
+ * - \b stop_record() : stop recording and close the file
+ * - \b record(core::clock::type) : record the buffers of the given timestamp
+ *
+ * @section XML XML Configuration
+ *
+ * @code{.xml}
+   <service type="sight::module::io::recording::recorder">
+       <in group="frame_tl" auto_connect="true">
+           <key uid="..." />
+       </in>
+       <in group="matrix_tl" auto_connect="true">
+           <key uid="..." />
+       </in>
+       <windowTitle>Select the recording file</windowTitle>
+       <properties compression="1" />
+   </service>
+   @endcode
+ * @subsection Input Input
+ * - \b frame_tl [sight::data::frame_tl] (optional): frame timelines to record.
+ * - \b matrix_tl [sight::data::matrix_tl] (optional): matrix timelines to record.
+ * - \b raw_buffer_tl [sight::data::raw_buffer_tl] (optional): raw buffer timelines to record.
+ *
+ * @subsection Configuration Configuration
+ * - \b windowTitle: allow overriding the default title of the modal file selection window. \see io::writer
+ *
+ * @subsection Properties Properties
+ * - \b compression (optional, default: 0): zlib compression level of the chunks, from 0 (no compression) to 9.
+ */
+class recorder : public sight::io::service::writer
+{
+public:
+
+    SIGHT_DECLARE_SERVICE(recorder, sight::io::service::writer);
+
+    /// Constructor.
+    recorder() noexcept;
+
+    /// Destructor, closes the file.
+    ~recorder() noexcept override;
+
+    /// Connects the 'object_pushed' signal of the timelines to the 'record' slot.
+    service::connections_t auto_connections() const override;
+
+    /// Displays a location dialog allowing to select the file to save.
+    void open_location_dialog() override;
+
+    /// Returns file type (io::service::file)
+    sight::io::service::path_type_t get_path_type() const override;
+
+protected:
+
+    /// Configures the window title.
+    void configuring() override;
+
+    /// Does nothing.
+    void starting() override;
+
+    /// Stops recording.
+    void stopping() override;
+
+    /// Starts recording.
+    void updating() override;
+
+private:
+
+    /// Stream of a timeline, declared in the file when its first buffer is recorded
+    struct stream_t
+    {
+        std::optional<std::uint32_t> id;
+        core::clock::type last_timestamp {0.};
+    };
+
+    /// SLOT: starts recording
+    void start_record();
+
+    /// SLOT: stops recording
+    void stop_record();
+
+    /// SLOT: records the buffers of the given timestamp
+    void record(core::clock::type _timestamp);
+
+    /// Records the buffer of a timeline, if any, at the given timestamp
+    template<typename TIMELINE>
+    void record(const TIMELINE& _tl, const std::string& _name, stream_t& _stream, core::clock::type _timestamp);
+
+    /// Writer of the file, valid while recording
+    std::unique_ptr<sight::io::writer::recording_writer> m_writer;
+
+    /// Streams of the frame, matrix and raw buffer timelines
+    std::vector<stream_t> m_frame_streams;
+    std::vector<stream_t> m_matrix_streams;
+    std::vector<stream_t> m_raw_streams;
+
+    /// Record being written, kept to reuse its allocation
+    std::vector<std::uint8_t> m_record;
+
+    /// Protects the writer, the slots can be called from the workers of the different timelines
+    std::mutex m_mutex;
+
+    data::ptr_vector<data::frame_tl, data::access::in> m_frame_tls {this, "frame_tl"};
+    data::ptr_vector<data::matrix_tl, data::access::in> m_matrix_tls {this, "matrix_tl"};
+    data::ptr_vector<data::raw_buffer_tl, data::access::in> m_raw_buffer_tls {this, "raw_buffer_tl"};
+
+    sight::data::property<sight::data::integer> m_compression {this, "compression", 0};
+};
+
+} // namespace sight::module::io::recording
@@ -0,0 +1,171 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "recording_test.hpp"
+
+#include <core/com/slot_base.hpp>
+#include <core/com/slot_base.hxx>
+#include <core/os/temp_path.hpp>
+
+#include <data/frame_tl.hpp>
+#include <data/matrix_tl.hpp>
+
+#include <io/__/reader/recording_reader.hpp>
+#include <io/__/service/reader.hpp>
+#include <io/__/service/writer.hpp>
+
+#include <service/op.hpp>
+
+#include <utest/wait.hpp>
+
+#include <algorithm>
+
+// Registers the fixture into the 'registry'
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::module::io::recording::ut::recording_test);
+
+namespace sight::module::io::recording::ut
+{
+
+static constexpr std::size_t WIDTH  = 16;
+static constexpr std::size_t HEIGHT = 8;
+
+//------------------------------------------------------------------------------
+
+void recording_test::setUp()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void recording_test::tearDown()
+{
+}
+
+//------------------------------------------------------------------------------
+
+void recording_test::record_play_test()
+{
+    core::os::temp_dir tmp_dir;
+    const auto file = tmp_dir / "recording.srec";
+
+    auto frame_tl = std::make_shared<data::frame_tl>();
+    frame_tl->init_pool_size(WIDTH, HEIGHT, core::type::UINT8, data::frame_tl::pixel_format::gray_scale);
+    auto matrix_tl = std::make_shared<data::matrix_tl>();
+    matrix_tl->init_pool_size(2);
+
+    // Record ten frames and ten matrices, pushed at different timestamps
+    {
+        auto recorder = service::add("sight::module::io::recording::recorder");
+        CPPUNIT_ASSERT_MESSAGE("Failed to create service 'sight::module::io::recording::recorder'", recorder);
+        recorder->set_input(frame_tl, "frame_tl", false, false, 0);
+        recorder->set_input(matrix_tl, "matrix_tl", false, false, 0);
+
+        service::config_t config;
+        config.add("file", "recording.srec");
+        config.add("properties.<xmlattr>.compression", 1);
+        CPPUNIT_ASSERT_NO_THROW(recorder->set_config(config));
+        CPPUNIT_ASSERT_NO_THROW(recorder->configure());
+        CPPUNIT_ASSERT_NO_THROW(recorder->start().wait());
+        recorder->slot("set_base_folder")->run(tmp_dir.string());
+        CPPUNIT_ASSERT_NO_THROW(recorder->update().wait());
+
+        for(int i = 0 ; i < 10 ; ++i)
+        {
+            const auto frame_ts = core::clock::type(100 + (i * 20));
+            auto frame          = frame_tl->create_buffer(frame_ts);
+            std::fill_n(frame->add_element(0), WIDTH * HEIGHT, std::uint8_t(i));
+            frame_tl->push_object(frame);
+            recorder->slot("record")->run(frame_ts);
+
+            const auto matrix_ts = frame_ts + 10;
+            auto matrix          = matrix_tl->create_buffer(matrix_ts);
+            std::array<float, 16> values {};
+            values[0] = float(i);
+            matrix->set_element(values, 1);
+            matrix_tl->push_object(matrix);
+            recorder->slot("record")->run(matrix_ts);
+        }
+
+        CPPUNIT_ASSERT_NO_THROW(recorder->stop().wait());
+        CPPUNIT_ASSERT(!std::dynamic_pointer_cast<sight::io::service::writer>(recorder)->has_failed());
+        service::remove(recorder);
+    }
+
+    // Each timeline has its own stream, indexed by timestamp
+    {
+        sight::io::reader::recording_reader reader(file);
+        CPPUNIT_ASSERT_EQUAL(std::size_t(2), reader.streams().size());
+        CPPUNIT_ASSERT_EQUAL(std::string("frame_tl/0"), reader.streams()[0].name);
+        CPPUNIT_ASSERT_EQUAL(std::string("matrix_tl/0"), reader.streams()[1].name);
+        CPPUNIT_ASSERT_EQUAL(std::size_t(10), reader.size(0));
+        CPPUNIT_ASSERT_EQUAL(std::size_t(10), reader.size(1));
+        CPPUNIT_ASSERT_EQUAL(std::size_t(5), reader.lower_bound(1, 200.));
+    }
+
+    // Replay the recording in new timelines, which are initialized from the file
+    auto played_frame_tl  = std::make_shared<data::frame_tl>();
+    auto played_matrix_tl = std::make_shared<data::matrix_tl>();
+
+    auto player = service::add("sight::module::io::recording::player");
+    CPPUNIT_ASSERT_MESSAGE("Failed to create service 'sight::module::io::recording::player'", player);
+    player->set_inout(played_frame_tl, "frame_tl", false, false, 0);
+    player->set_inout(played_matrix_tl, "matrix_tl", false, false, 0);
+
+    service::config_t config;
+    config.add("fps", 200);
+    CPPUNIT_ASSERT_NO_THROW(player->set_config(config));
+    CPPUNIT_ASSERT_NO_THROW(player->configure());
+    CPPUNIT_ASSERT_NO_THROW(player->start().wait());
+    std::dynamic_pointer_cast<sight::io::service::reader>(player)->set_file(file);
+
+    player->slot("start_playing")->run();
+
+    CPPUNIT_ASSERT_EQUAL(WIDTH, played_frame_tl->get_width());
+    CPPUNIT_ASSERT_EQUAL(HEIGHT, played_frame_tl->get_height());
+    CPPUNIT_ASSERT_EQUAL(2U, played_matrix_tl->get_max_element_num());
+
+    // The last records are pushed with their recorded timestamps once the recording is over
+    SIGHT_TEST_WAIT(played_matrix_tl->get_newer_timestamp() == 290., 5000);
+    CPPUNIT_ASSERT_EQUAL(280., played_frame_tl->get_newer_timestamp());
+
+    const auto frame = played_frame_tl->get_closest_buffer(280.);
+    CPPUNIT_ASSERT(frame);
+    CPPUNIT_ASSERT_EQUAL(std::uint8_t(9), frame->get_element(0));
+
+    const auto matrix = played_matrix_tl->get_closest_buffer(290.);
+    CPPUNIT_ASSERT(matrix);
+    CPPUNIT_ASSERT(!matrix->is_present(0));
+    CPPUNIT_ASSERT(matrix->is_present(1));
+    CPPUNIT_ASSERT_EQUAL(9.F, matrix->get_element(1)[0]);
+
+    // Moving in the recording pushes the records of the new position again
+    player->slot("set_position")->run(std::int64_t(0));
+    SIGHT_TEST_WAIT(played_frame_tl->get_newer_timestamp() == 280., 5000);
+    CPPUNIT_ASSERT_EQUAL(280., played_frame_tl->get_newer_timestamp());
+
+    player->slot("stop_playing")->run();
+    CPPUNIT_ASSERT_NO_THROW(player->stop().wait());
+    service::remove(player);
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::module::io::recording::ut
@@ -0,0 +1,202 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <core/type.hpp>
+
+#include <data/frame_tl.hpp>
+#include <data/matrix_tl.hpp>
+#include <data/raw_buffer_tl.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Conversions between the timeline buffers and the records of io::writer::recording_writer, shared by the recorder and
+ * the player.
+ *
+ * The metadata of a stream is the type of its timeline followed by the parameters of init_pool_size(), separated by
+ * spaces. The record of a frame_tl or matrix_tl buffer is its presence mask followed by its raw content, the record of
+ * a raw_buffer_tl buffer is its raw content.
+ */
+namespace sight::module::io::recording::timeline_record
+{
+
+/// Type of the buffers of a timeline
+template<typename TIMELINE>
+struct buffer
+{
+    using type = typename TIMELINE::buffer_t;
+};
+
+template<>
+struct buffer<data::raw_buffer_tl>
+{
+    using type = data::timeline::raw_buffer;
+};
+
+template<typename TIMELINE>
+using buffer_t = typename buffer<TIMELINE>::type;
+
+//------------------------------------------------------------------------------
+
+inline std::string name(const std::string& _group, std::size_t _index)
+{
+    return _group + "/" + std::to_string(_index);
+}
+
+//------------------------------------------------------------------------------
+
+inline std::string metadata(const data::frame_tl& _tl)
+{
+    std::ostringstream stream;
+    stream << "frame_tl " << _tl.get_width() << " " << _tl.get_height() << " " << _tl.type().name() << " "
+    << static_cast<int>(_tl.pixel_format()) << " " << _tl.get_max_element_num();
+    return stream.str();
+}
+
+//------------------------------------------------------------------------------
+
+inline std::string metadata(const data::matrix_tl& _tl)
+{
+    return "matrix_tl " + std::to_string(_tl.get_max_element_num());
+}
+
+//------------------------------------------------------------------------------
+
+inline std::string metadata(const data::raw_buffer_tl& /*_tl*/)
+{
+    return "raw_buffer_tl";
+}
+
+//------------------------------------------------------------------------------
+
+/// Initializes a timeline from the metadata of its stream, returns false if the metadata do not match the timeline
+inline bool init(data::frame_tl& _tl, const std::string& _metadata)
+{
+    std::istringstream stream(_metadata);
+    std::string type;
+    std::size_t width        = 0;
+    std::size_t height       = 0;
+    std::string pixel_type;
+    int format               = 0;
+    unsigned int max_element = 0;
+    if(!(stream >> type >> width >> height >> pixel_type >> format >> max_element) || type != "frame_tl")
+    {
+        return false;
+    }
+
+    _tl.init_pool_size(
+        width,
+        height,
+        core::type(pixel_type),
+        static_cast<enum data::frame_tl::pixel_format>(format),
+        max_element
+    );
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+inline bool init(data::matrix_tl& _tl, const std::string& _metadata)
+{
+    std::istringstream stream(_metadata);
+    std::string type;
+    unsigned int max_element = 0;
+    if(!(stream >> type >> max_element) || type != "matrix_tl")
+    {
+        return false;
+    }
+
+    _tl.init_pool_size(max_element);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+/// A raw buffer timeline is initialized with the size of its first record
+inline bool init(data::raw_buffer_tl& _tl, const std::string& _metadata, std::size_t _record_size)
+{
+    if(_metadata != "raw_buffer_tl" || _record_size == 0)
+    {
+        return false;
+    }
+
+    _tl.init_pool_size(_record_size);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+template<typename T>
+void encode(const data::timeline::generic_object<T>& _buffer, std::vector<std::uint8_t>& _record)
+{
+    const std::uint64_t mask = _buffer.get_mask();
+    _record.resize(sizeof(mask) + _buffer.size());
+    std::memcpy(_record.data(), &mask, sizeof(mask));
+    std::memcpy(_record.data() + sizeof(mask), &_buffer.get_element(0), _buffer.size());
+}
+
+//------------------------------------------------------------------------------
+
+inline void encode(const data::timeline::raw_buffer& _buffer, std::vector<std::uint8_t>& _record)
+{
+    _record.assign(_buffer.buffer(), _buffer.buffer() + _buffer.size());
+}
+
+//------------------------------------------------------------------------------
+
+template<typename T>
+void decode(std::span<const std::uint8_t> _record, data::timeline::generic_object<T>& _buffer)
+{
+    std::uint64_t mask = 0;
+    if(_record.size() < sizeof(mask))
+    {
+        return;
+    }
+
+    std::memcpy(&mask, _record.data(), sizeof(mask));
+    const auto values       = _record.subspan(sizeof(mask));
+    const auto element_size = _buffer.get_element_size();
+
+    for(unsigned int i = 0 ; i < _buffer.get_max_element_num() ; ++i)
+    {
+        if((mask & (std::uint64_t(1) << i)) != 0 && (i + 1) * element_size <= values.size())
+        {
+            std::memcpy(static_cast<void*>(_buffer.add_element(i)), values.data() + (i * element_size), element_size);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+inline void decode(std::span<const std::uint8_t> _record, data::timeline::raw_buffer& _buffer)
+{
+    std::memcpy(_buffer.buffer(), _record.data(), std::min(_record.size(), _buffer.size()));
+}
+
+} // namespace sight::module::io::recording::timeline_record
@@ -33,7 +33,6 @@
 #include <ui/__/dialog/message.hpp>
 #include <ui/__/preferences.hpp>
 
-#include <opencv2/imgcodecs.hpp>
 #include <opencv2/imgproc.hpp>
 
 #include <chrono>
@@ -41,8 +40,6 @@
 #include <filesystem>
 #include <regex>
 
-// cspell:ignore imread
-
 namespace sight::module::io::video
 {
 
@@ -96,6 +93,11 @@ void frame_grabber::configuring()
     m_step = config.get<std::uint64_t>("step", m_step);
     SIGHT_ASSERT("Step value is set to " << m_step << " but should be > 0.", m_step > 0);
     m_step_changed = m_step;
+
+    m_prefetch       = config.get<std::size_t>("prefetch", m_prefetch);
+    m_cache_size     = config.get<std::size_t>("cacheSize", m_cache_size);
+    m_decode_threads = config.get<std::size_t>("decodeThreads", m_decode_threads);
+    SIGHT_ASSERT("Decode threads is set to " << m_decode_threads << " but should be > 0.", m_decode_threads > 0);
 }
 
 // -----------------------------------------------------------------------------
@@ -199,6 +201,16 @@ void frame_grabber::stop_camera()
         m_video_capture.release();
     }
 
+    if(m_image_sequence)
+    {
+        const auto stats = m_image_sequence->get_statistics();
+        SIGHT_INFO(
+            "Image set played at " << stats.fps << " fps, " << stats.cache_hits << " of " << stats.images
+            << " images were read from the cache."
+        );
+        m_image_sequence.reset();
+    }
+
     m_image_to_read.clear();
     m_image_timestamps.clear();
     m_image_count = 0;
@@ -444,8 +456,16 @@ void frame_grabber::read_images(const std::filesystem::path& _folder, const std:
             }
         }
 
+        m_image_sequence = std::make_unique<image_sequence>(
+            m_image_to_read,
+            m_decode_threads,
+            m_prefetch,
+            m_cache_size
+        );
+
+        // The first image gives the format of the timeline, the next ones are decoded meanwhile
         const std::string file = m_image_to_read.front().string();
-        const cv::Mat image    = cv::imread(file, cv::IMREAD_UNCHANGED);
+        const cv::Mat image    = m_image_sequence->get(0, m_step).image;
 
         const int width  = image.size().width;
         const int height = image.size().height;
@@ -702,6 +722,31 @@ void frame_grabber::grab_video()
 
 // -----------------------------------------------------------------------------
 
+image_sequence::frame frame_grabber::allocate_frame(data::frame_tl& _frame_tl, std::size_t _index) const
+{
+    // The timestamp of the buffers can not be changed once they are created, so they can not be allocated ahead when
+    // the timestamps are created when pushing the images
+    if(m_create_new_ts || _frame_tl.get_width() == 0 || _frame_tl.get_height() == 0)
+    {
+        return {};
+    }
+
+    const int depth = _frame_tl.type() == core::type::UINT16 ? CV_16U : CV_8U;
+    const int type  = CV_MAKETYPE(depth, static_cast<int>(_frame_tl.num_components()));
+
+    SPTR(data::frame_tl::buffer_t) buffer = _frame_tl.create_buffer(m_image_timestamps[_index]);
+    cv::Mat image(
+        static_cast<int>(_frame_tl.get_height()),
+        static_cast<int>(_frame_tl.get_width()),
+        type,
+        buffer->add_element(0)
+    );
+
+    return {.image = image, .owner = buffer};
+}
+
+// -----------------------------------------------------------------------------
+
 void frame_grabber::grab_image()
 {
     const double t0 = core::clock::get_time_in_milli_sec();
@@ -714,9 +759,12 @@ void frame_grabber::grab_image()
     {
         const auto frame_tl = m_frame.lock();
 
-        const std::filesystem::path image_path = m_image_to_read[m_image_count];
-
-        const cv::Mat image         = cv::imread(image_path.string(), cv::IMREAD_UNCHANGED);
+        // The image is usually already decoded, in RGB(A) order, by the workers of the sequence, in a buffer of the
+        // timeline
+        auto [image, owner] = m_image_sequence->get(
+            m_image_count,
+            m_step,
+            [this, &frame_tl](std::size_t _index){return this->allocate_frame(*frame_tl, _index);});
         core::clock::type timestamp = NAN;
 
         //create a new timestamp
@@ -730,7 +778,12 @@ void frame_grabber::grab_image()
             timestamp = m_image_timestamps[m_image_count];
         }
 
-        this->update_zoom(image);
+        if(m_zoom_center.has_value())
+        {
+            // The decoded image is shared with the cache
+            image = image.clone();
+            this->update_zoom(image);
+        }
 
         SIGHT_DEBUG("Reading image index " << m_image_count << " with timestamp " << timestamp);
 
@@ -742,30 +795,29 @@ void frame_grabber::grab_image()
             const auto sig_position = this->signal<position_modified_signal_t>(POSITION_MODIFIED_SIG);
             sig_position->async_emit(static_cast<std::int64_t>(m_image_count) * 30);
 
-            // Get the buffer of the timeline to fill
-            SPTR(data::frame_tl::buffer_t) buffer_out = frame_tl->create_buffer(timestamp);
-            std::uint8_t* frame_buff_out = buffer_out->add_element(0);
-
-            // Create an openCV mat that aliases the buffer created from the output timeline
-            cv::Mat img_out(image.size(), image.type(), (void*) frame_buff_out, cv::Mat::AUTO_STEP);
-
-            if(image.type() == CV_8UC3)
-            {
-                // convert the readded image from BGR to RGB
-                cv::cvtColor(image, img_out, cv::COLOR_BGR2RGB);
-            }
-            else if(image.type() == CV_8UC4)
-            {
-                // convert the readded image from BGRA to RGBA
-                cv::cvtColor(image, img_out, cv::COLOR_BGRA2RGBA);
-            }
-            else
+            // Push the buffer the image was decoded in, unless the zoom made a new image
+            auto buffer_out = std::static_pointer_cast<data::frame_tl::buffer_t>(owner);
+            if(!buffer_out || m_zoom_center.has_value() || buffer_out->get_timestamp() != timestamp)
             {
+                // Get the buffer of the timeline to fill
+                buffer_out = frame_tl->create_buffer(timestamp);
+                std::uint8_t* frame_buff_out = buffer_out->add_element(0);
+
+                // Create an openCV mat that aliases the buffer created from the output timeline
+                cv::Mat img_out(image.size(), image.type(), (void*) frame_buff_out, cv::Mat::AUTO_STEP);
                 image.copyTo(img_out);
             }
 
             frame_tl->push_object(buffer_out);
 
+            if(const auto stats = m_image_sequence->get_statistics(); stats.images % 100 == 0)
+            {
+                SIGHT_INFO(
+                    "Image set playing at " << stats.fps << " fps, " << stats.cache_hits << " of " << stats.images
+                    << " images read from the cache."
+                );
+            }
+
             const auto sig =
                 frame_tl->signal<data::timeline::signals::pushed_t>(data::timeline::signals::PUSHED);
             sig->async_emit(timestamp);
@@ -0,0 +1,246 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "image_sequence.hpp"
+
+#include <core/clock.hpp>
+#include <core/spy_log.hpp>
+
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+// cspell:ignore imdecode
+
+namespace sight::module::io::video
+{
+
+//------------------------------------------------------------------------------
+
+image_sequence::image_sequence(
+    std::vector<std::filesystem::path> _files,
+    std::size_t _workers,
+    std::size_t _prefetch,
+    std::size_t _cache_size
+) :
+    m_files(std::move(_files)),
+    m_prefetch(_prefetch),
+    m_cache_size(std::max(_cache_size, _prefetch + 1))
+{
+    for(std::size_t i = 0 ; i < std::max<std::size_t>(_workers, 1) ; ++i)
+    {
+        auto worker = core::thread::worker::make();
+        worker->set_thread_name("image_decoder_" + std::to_string(i));
+        m_workers.push_back(worker);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+image_sequence::~image_sequence()
+{
+    {
+        std::unique_lock lock(m_mutex);
+        m_stopping = true;
+    }
+
+    for(const auto& worker : m_workers)
+    {
+        worker->stop();
+    }
+}
+
+//------------------------------------------------------------------------------
+
+image_sequence::frame image_sequence::get(std::size_t _index, std::size_t _step, const allocator_t& _allocator)
+{
+    SIGHT_ASSERT("Image index " << _index << " is out of range.", _index < m_files.size());
+
+    std::unique_lock lock(m_mutex);
+
+    const double now = core::clock::get_time_in_milli_sec();
+    if(m_images++ == 0)
+    {
+        m_first_request = now;
+    }
+
+    m_last_request = now;
+
+    auto it = m_cache.find(_index);
+    if(it == m_cache.end())
+    {
+        // Not prefetched, e.g. after a seek: decode it right away rather than waiting behind the workers' queues
+        lock.unlock();
+        frame image = _allocator ? _allocator(_index) : frame {};
+        decode(m_files[_index], image);
+        lock.lock();
+
+        it = m_cache.try_emplace(_index).first;
+        if(!it->second.ready)
+        {
+            it->second.decoded = std::move(image);
+            it->second.ready   = true;
+            m_lru.push_front(_index);
+            it->second.lru = m_lru.begin();
+        }
+    }
+    else
+    {
+        ++m_cache_hits;
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lru);
+    }
+
+    // Decode the next images while this one is pushed
+    for(std::size_t i = 1 ; i <= m_prefetch ; ++i)
+    {
+        const std::size_t next = _index + (i * std::max<std::size_t>(_step, 1));
+        if(next >= m_files.size())
+        {
+            break;
+        }
+
+        if(m_cache.find(next) == m_cache.end())
+        {
+            // The buffers are allocated on this thread, only the decoding is done by the workers
+            this->decode_async(next, _allocator ? _allocator(next) : frame {});
+        }
+    }
+
+    entry& requested = m_cache[_index];
+    m_decoded.wait(lock, [&requested]{return requested.ready;});
+    frame image = requested.decoded;
+
+    this->evict();
+
+    return image;
+}
+
+//------------------------------------------------------------------------------
+
+image_sequence::statistics image_sequence::get_statistics() const
+{
+    std::unique_lock lock(m_mutex);
+
+    statistics stats;
+    stats.images     = m_images;
+    stats.cache_hits = m_cache_hits;
+    if(m_images > 1 && m_last_request > m_first_request)
+    {
+        stats.fps = static_cast<double>(m_images - 1) * 1000. / (m_last_request - m_first_request);
+    }
+
+    return stats;
+}
+
+//------------------------------------------------------------------------------
+
+void image_sequence::decode(const std::filesystem::path& _file, frame& _frame)
+{
+    std::ifstream stream(_file, std::ios::binary);
+    const std::vector<uchar> encoded {std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+
+    // Decoding in the given image does not reallocate it if it has the size and the type of the decoded image
+    const auto* const allocated = _frame.image.data;
+    cv::Mat& image              = _frame.image;
+    if(encoded.empty() || cv::imdecode(encoded, cv::IMREAD_UNCHANGED, &image).empty())
+    {
+        image.release();
+    }
+
+    if(image.data != allocated)
+    {
+        _frame.owner.reset();
+    }
+
+    // Convert in place, so that the image can be pushed as is in the timeline
+    if(image.type() == CV_8UC3)
+    {
+        cv::cvtColor(image, image, cv::COLOR_BGR2RGB);
+    }
+    else if(image.type() == CV_8UC4)
+    {
+        cv::cvtColor(image, image, cv::COLOR_BGRA2RGBA);
+    }
+
+    SIGHT_WARN_IF("The image '" << _file.string() << "' can not be read.", image.empty());
+}
+
+//------------------------------------------------------------------------------
+
+void image_sequence::decode_async(std::size_t _index, frame _frame)
+{
+    // The entry is created now, so the image is not decoded twice and is not evicted until it is decoded
+    auto& new_entry = m_cache[_index];
+    m_lru.push_front(_index);
+    new_entry.lru = m_lru.begin();
+
+    const auto& worker = m_workers[m_next_worker];
+    m_next_worker = (m_next_worker + 1) % m_workers.size();
+
+    // The task owns the frame, so its buffer outlives the decoding even if the entry is dropped meanwhile
+    worker->post(
+        [this, _index, image = std::move(_frame)]() mutable
+        {
+            {
+                std::unique_lock lock(m_mutex);
+                if(m_stopping)
+                {
+                    return;
+                }
+            }
+
+            decode(m_files[_index], image);
+
+            {
+                std::unique_lock lock(m_mutex);
+                auto& decoded   = m_cache[_index];
+                decoded.decoded = std::move(image);
+                decoded.ready   = true;
+            }
+
+            m_decoded.notify_all();
+        });
+}
+
+//------------------------------------------------------------------------------
+
+void image_sequence::evict()
+{
+    auto it = m_lru.end();
+    while(m_cache.size() > m_cache_size && it != m_lru.begin())
+    {
+        --it;
+
+        // Images being decoded are kept, they will be requested soon
+        if(auto cached = m_cache.find(*it); cached != m_cache.end() && cached->second.ready)
+        {
+            m_cache.erase(cached);
+            it = m_lru.erase(it);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::module::io::video
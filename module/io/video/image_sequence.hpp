@@ -0,0 +1,164 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <core/thread/worker.hpp>
+
+#include <opencv2/core.hpp>
+
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace sight::module::io::video
+{
+
+/**
+ * @brief Decodes the images of a sequence ahead of their playback, and keeps the last decoded images in a cache.
+ *
+ * When an image is requested, the next ones, at the playback step, are decoded in parallel on a pool of workers, so
+ * that the decoding time does not limit the playback rate. The decoded images are kept in a least recently used cache,
+ * so that moving back and forth in the sequence does not decode them again.
+ *
+ * The images are decoded in RGB(A) order. They are decoded directly in the buffers given by the allocator passed to
+ * get(), typically the buffers of a frame timeline, so that they can be pushed without any copy.
+ */
+class image_sequence final
+{
+public:
+
+    /// Decoded image, with the object owning its pixels when they were allocated by an allocator_t
+    struct frame
+    {
+        cv::Mat image;
+        std::shared_ptr<void> owner;
+    };
+
+    /**
+     * @brief Allocates the buffer an image is decoded in, on the thread calling get().
+     *
+     * It returns an image header on the buffer, with the expected size and type of the image, and the owner of the
+     * buffer. An empty frame lets the sequence allocate the image itself. If the image does not match the expected
+     * size and type, it is decoded in a new image without owner.
+     */
+    using allocator_t = std::function<frame(std::size_t _index)>;
+
+    /// Playback statistics since the creation of the sequence
+    struct statistics
+    {
+        /// Number of images requested
+        std::size_t images {0};
+
+        /// Number of images which were already decoded, or being decoded, when requested
+        std::size_t cache_hits {0};
+
+        /// Average rate at which the images were requested
+        double fps {0.};
+    };
+
+    /**
+     * @brief Creates the decoding workers.
+     * @param _files paths of the images, in playback order
+     * @param _workers number of decoding workers
+     * @param _prefetch number of images decoded ahead of the requested one
+     * @param _cache_size maximum number of decoded images kept in memory, at least _prefetch + 1
+     */
+    image_sequence(
+        std::vector<std::filesystem::path> _files,
+        std::size_t _workers,
+        std::size_t _prefetch,
+        std::size_t _cache_size
+    );
+
+    /// Waits for the pending decodings and stops the workers.
+    ~image_sequence();
+
+    image_sequence(const image_sequence&)            = delete;
+    image_sequence& operator=(const image_sequence&) = delete;
+
+    /// Returns the number of images in the sequence
+    [[nodiscard]] std::size_t size() const
+    {
+        return m_files.size();
+    }
+
+    /**
+     * @brief Returns a decoded image, and starts decoding the next ones.
+     * @param _index index of the image, waits for its decoding if it is not in the cache yet
+     * @param _step step between the images which are decoded ahead
+     * @param _allocator allocates the buffers of the requested image, if it is not decoded yet, and of the next ones
+     * @return the decoded image, empty if the file can not be read, shared with the cache: it must not be modified
+     */
+    frame get(std::size_t _index, std::size_t _step = 1, const allocator_t& _allocator = nullptr);
+
+    /// Returns the playback statistics
+    [[nodiscard]] statistics get_statistics() const;
+
+private:
+
+    struct entry
+    {
+        frame decoded;
+        bool ready {false};
+        std::list<std::size_t>::iterator lru;
+    };
+
+    /// Reads an image file in the given frame and converts it to RGB(A) order
+    static void decode(const std::filesystem::path& _file, frame& _frame);
+
+    /// Decodes an image on a worker in the given frame and stores it in its cache entry
+    void decode_async(std::size_t _index, frame _frame);
+
+    /// Removes the least recently used images that are decoded, until the cache fits its maximum size
+    void evict();
+
+    const std::vector<std::filesystem::path> m_files;
+    const std::size_t m_prefetch;
+    const std::size_t m_cache_size;
+
+    std::vector<core::thread::worker::sptr> m_workers;
+    std::size_t m_next_worker {0};
+
+    /// Decoded images and images being decoded, by index
+    std::unordered_map<std::size_t, entry> m_cache;
+
+    /// Indices of the cached images, the most recently used first
+    std::list<std::size_t> m_lru;
+
+    std::size_t m_images {0};
+    std::size_t m_cache_hits {0};
+    double m_first_request {0.};
+    double m_last_request {0.};
+
+    /// Set when the sequence is destroyed, the pending decodings are then skipped
+    bool m_stopping {false};
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_decoded;
+};
+
+} // namespace sight::module::io::video
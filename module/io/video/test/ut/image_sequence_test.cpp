@@ -0,0 +1,265 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#include "image_sequence_test.hpp"
+
+#include "../../image_sequence.hpp"
+
+#include <opencv2/imgcodecs.hpp>
+
+#include <map>
+
+CPPUNIT_TEST_SUITE_REGISTRATION(sight::module::io::video::ut::image_sequence_test);
+
+namespace sight::module::io::video::ut
+{
+
+static constexpr std::size_t IMAGE_COUNT = 10;
+static constexpr int IMAGE_SIZE          = 4;
+
+//------------------------------------------------------------------------------
+
+static void check_image(const cv::Mat& _image, std::size_t _index)
+{
+    CPPUNIT_ASSERT_EQUAL(IMAGE_SIZE, _image.cols);
+    CPPUNIT_ASSERT_EQUAL(IMAGE_SIZE, _image.rows);
+    CPPUNIT_ASSERT_EQUAL(CV_8UC3, _image.type());
+
+    // The images are written in BGR order and must be decoded in RGB order
+    const auto pixel = _image.at<cv::Vec3b>(IMAGE_SIZE - 1, IMAGE_SIZE - 1);
+    CPPUNIT_ASSERT_EQUAL(std::uint8_t(255), pixel[0]);
+    CPPUNIT_ASSERT_EQUAL(std::uint8_t(0), pixel[1]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<std::uint8_t>(_index), pixel[2]);
+}
+
+//------------------------------------------------------------------------------
+
+/// Returns an allocator recording the indices of the images, in the order they are allocated
+static image_sequence::allocator_t recording_allocator(std::vector<std::size_t>& _allocated)
+{
+    return [&_allocated](std::size_t _index)
+           {
+               _allocated.push_back(_index);
+               return image_sequence::frame {};
+           };
+}
+
+//------------------------------------------------------------------------------
+
+void image_sequence_test::setUp()
+{
+    m_tmp_dir = std::make_unique<core::os::temp_dir>();
+
+    for(std::size_t i = 0 ; i < IMAGE_COUNT ; ++i)
+    {
+        const auto file = m_tmp_dir->path() / ("img_" + std::to_string(i) + ".png");
+        const cv::Mat image(IMAGE_SIZE, IMAGE_SIZE, CV_8UC3, cv::Scalar(static_cast<double>(i), 0., 255.));
+        CPPUNIT_ASSERT(cv::imwrite(file.string(), image));
+        m_files.push_back(file);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void image_sequence_test::tearDown()
+{
+    m_files.clear();
+    m_tmp_dir.reset();
+}
+
+//------------------------------------------------------------------------------
+
+void image_sequence_test::prefetch_test()
+{
+    image_sequence sequence(m_files, 2, 3, 16);
+    std::vector<std::size_t> allocated;
+    const auto allocator = recording_allocator(allocated);
+
+    // The requested image is decoded first, then the next ones at the playback step
+    check_image(sequence.get(0, 2, allocator).image, 0);
+    CPPUNIT_ASSERT(allocated == std::vector<std::size_t>({0, 2, 4, 6}));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), sequence.get_statistics().cache_hits);
+
+    // Only the image which is not decoded yet is added to the queue
+    check_image(sequence.get(2, 2, allocator).image, 2);
+    CPPUNIT_ASSERT(allocated == std::vector<std::size_t>({0, 2, 4, 6, 8}));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(1), sequence.get_statistics().cache_hits);
+
+    for(std::size_t i = 4 ; i < IMAGE_COUNT ; i += 2)
+    {
+        check_image(sequence.get(i, 2, allocator).image, i);
+    }
+
+    CPPUNIT_ASSERT(allocated == std::vector<std::size_t>({0, 2, 4, 6, 8}));
+
+    const auto stats = sequence.get_statistics();
+    CPPUNIT_ASSERT_EQUAL(IMAGE_COUNT / 2, stats.images);
+    CPPUNIT_ASSERT_EQUAL(IMAGE_COUNT / 2 - 1, stats.cache_hits);
+}
+
+//------------------------------------------------------------------------------
+
+void image_sequence_test::seek_test()
+{
+    image_sequence sequence(m_files, 2, 2, 16);
+    std::vector<std::size_t> allocated;
+    const auto allocator = recording_allocator(allocated);
+
+    check_image(sequence.get(0, 1, allocator).image, 0);
+    CPPUNIT_ASSERT(allocated == std::vector<std::size_t>({0, 1, 2}));
+
+    // Seeking to an image which is not decoded yet decodes it right away, and the ones following it ahead
+    check_image(sequence.get(7, 1, allocator).image, 7);
+    CPPUNIT_ASSERT(allocated == std::vector<std::size_t>({0, 1, 2, 7, 8, 9}));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(0), sequence.get_statistics().cache_hits);
+
+    // The playback then resumes from the cache
+    check_image(sequence.get(8, 1, allocator).image, 8);
+    check_image(sequence.get(9, 1, allocator).image, 9);
+    CPPUNIT_ASSERT(allocated == std::vector<std::size_t>({0, 1, 2, 7, 8, 9}));
+    CPPUNIT_ASSERT_EQUAL(std::size_t(2), sequence.get_statistics().cache_hits);
+
+    // Seeking back to an image decoded ahead is a hit as well
+    check_image(sequence.get(2, 1, allocator).image, 2);
+    CPPUNIT_ASSERT_EQUAL(std::size_t(3), sequence.get_statistics().cache_hits);
+}
+
+//------------------------------------------------------------------------------
+
+void image_sequence_test::backward_step_test()
+{
+    {
+        image_sequence sequence(m_files, 2, 2, 16);
+        std::vector<std::size_t> allocated;
+        const auto allocator = recording_allocator(allocated);
+
+        for(std::size_t i = 0 ; i < 4 ; ++i)
+        {
+            check_image(sequence.get(i, 1, allocator).image, i);
+        }
+
+        const std::size_t decoded = allocated.size();
+        CPPUNIT_ASSERT_EQUAL(std::size_t(3), sequence.get_statistics().cache_hits);
+
+        // Stepping back reads the images from the cache, without decoding them again
+        for(std::size_t i = 3 ; i-- > 0 ; )
+        {
+            check_image(sequence.get(i, 1, allocator).image, i);
+        }
+
+        CPPUNIT_ASSERT_EQUAL(decoded, allocated.size());
+        CPPUNIT_ASSERT_EQUAL(std::size_t(6), sequence.get_statistics().cache_hits);
+    }
+
+    {
+        // The least recently used images are evicted from a small cache, they are then decoded again
+        image_sequence sequence(m_files, 1, 1, 2);
+        std::vector<std::size_t> allocated;
+        const auto allocator = recording_allocator(allocated);
+
+        for(std::size_t i = 0 ; i < IMAGE_COUNT ; ++i)
+        {
+            check_image(sequence.get(i, 1, allocator).image, i);
+        }
+
+        const std::size_t hits = sequence.get_statistics().cache_hits;
+
+        allocated.clear();
+        check_image(sequence.get(0, 1, allocator).image, 0);
+        CPPUNIT_ASSERT_EQUAL(std::size_t(0), allocated.front());
+        CPPUNIT_ASSERT_EQUAL(hits, sequence.get_statistics().cache_hits);
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void image_sequence_test::allocator_test()
+{
+    image_sequence sequence(m_files, 2, 2, 16);
+
+    // Buffers allocated by the caller, as the frame grabber does with the buffers of the timeline
+    std::map<std::size_t, std::shared_ptr<std::vector<std::uint8_t> > > buffers;
+    const auto allocator =
+        [&buffers](std::size_t _index)
+        {
+            auto buffer = std::make_shared<std::vector<std::uint8_t> >(std::size_t(IMAGE_SIZE * IMAGE_SIZE * 3));
+            buffers[_index] = buffer;
+            return image_sequence::frame {
+                .image = cv::Mat(IMAGE_SIZE, IMAGE_SIZE, CV_8UC3, buffer->data()),
+                .owner = buffer
+            };
+        };
+
+    // The images are decoded in the given buffers, the requested one and the ones decoded ahead
+    for(std::size_t i = 0 ; i < 3 ; ++i)
+    {
+        const auto decoded = sequence.get(i, 1, allocator);
+        check_image(decoded.image, i);
+        CPPUNIT_ASSERT(buffers[i]->data() == decoded.image.data);
+        CPPUNIT_ASSERT(buffers[i] == decoded.owner);
+    }
+
+    // When the given buffer does not match the image, it is decoded in a new image without owner
+    const auto too_small =
+        [](std::size_t)
+        {
+            auto buffer = std::make_shared<std::vector<std::uint8_t> >(std::size_t(3));
+            return image_sequence::frame {.image = cv::Mat(1, 1, CV_8UC3, buffer->data()), .owner = buffer};
+        };
+
+    const auto decoded = sequence.get(IMAGE_COUNT - 1, 1, too_small);
+    check_image(decoded.image, IMAGE_COUNT - 1);
+    CPPUNIT_ASSERT(decoded.owner == nullptr);
+}
+
+//------------------------------------------------------------------------------
+
+void image_sequence_test::shutdown_test()
+{
+    std::vector<std::weak_ptr<void> > owners;
+    const auto allocator =
+        [&owners](std::size_t)
+        {
+            auto buffer = std::make_shared<std::vector<std::uint8_t> >(std::size_t(IMAGE_SIZE * IMAGE_SIZE * 3));
+            owners.emplace_back(buffer);
+            return image_sequence::frame {
+                .image = cv::Mat(IMAGE_SIZE, IMAGE_SIZE, CV_8UC3, buffer->data()),
+                .owner = buffer
+            };
+        };
+
+    // Destroy the sequence while a single worker is still decoding the images ahead
+    auto sequence = std::make_unique<image_sequence>(m_files, 1, IMAGE_COUNT - 1, IMAGE_COUNT);
+    check_image(sequence->get(0, 1, allocator).image, 0);
+    CPPUNIT_ASSERT_EQUAL(IMAGE_COUNT, owners.size());
+
+    sequence.reset();
+
+    // The pending decodings are skipped, and all the buffers are released
+    for(const auto& owner : owners)
+    {
+        CPPUNIT_ASSERT(owner.expired());
+    }
+}
+
+//------------------------------------------------------------------------------
+
+} // namespace sight::module::io::video::ut
@@ -0,0 +1,66 @@
+/************************************************************************
+ *
+ * Copyright (C) 2025 IRCAD France
+ *
+ * This file is part of Sight.
+ *
+ * Sight is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sight is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with Sight. If not, see <https://www.gnu.org/licenses/>.
+ *
+ ***********************************************************************/
+
+#pragma once
+
+#include <core/os/temp_path.hpp>
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace sight::module::io::video::ut
+{
+
+/**
+ * @brief Test the decoding ahead and the cache of the image sequence read by the frame grabber.
+ */
+class image_sequence_test : public CPPUNIT_NS::TestFixture
+{
+CPPUNIT_TEST_SUITE(image_sequence_test);
+CPPUNIT_TEST(prefetch_test);
+CPPUNIT_TEST(seek_test);
+CPPUNIT_TEST(backward_step_test);
+CPPUNIT_TEST(allocator_test);
+CPPUNIT_TEST(shutdown_test);
+CPPUNIT_TEST_SUITE_END();
+
+public:
+
+    // interface
+    void setUp() override;
+    void tearDown() override;
+
+    void prefetch_test();
+    void seek_test();
+    void backward_step_test();
+    void allocator_test();
+    void shutdown_test();
+
+private:
+
+    std::unique_ptr<core::os::temp_dir> m_tmp_dir;
+    std::vector<std::filesystem::path> m_files;
+};
+
+} // namespace sight::module::io::video::ut
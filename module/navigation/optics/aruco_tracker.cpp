@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2014-2024 IRCAD France
+ * Copyright (C) 2014-2025 IRCAD France
  * Copyright (C) 2014-2021 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -51,12 +51,15 @@ const core::com::signals::key_t aruco_tracker::MARKER_DETECTED_SIG = "marker_det
 
 const core::com::slots::key_t aruco_tracker::SET_PARAMETER_SLOT = "set_parameter";
 
+static const core::com::slots::key_t RESET_CAMERA_SLOT = "reset_camera";
+
 //-----------------------------------------------------------------------------
 
 aruco_tracker::aruco_tracker() noexcept :
     m_sig_detection_done(new_signal<detection_done_signal_t>(DETECTION_DONE_SIG))
 {
     new_signal<marker_detected_signal_t>(MARKER_DETECTED_SIG);
+    new_slot(RESET_CAMERA_SLOT, &aruco_tracker::reset_camera, this);
 
     // Initialize detector parameters
     m_detector_params = cv::makePtr<cv::aruco::DetectorParameters>();
@@ -88,7 +91,9 @@ service::connections_t aruco_tracker::auto_connections() const
 {
     return {
         {FRAME_INOUT, data::object::MODIFIED_SIG, service::slots::UPDATE},
-        {FRAME_INOUT, data::image::BUFFER_MODIFIED_SIG, service::slots::UPDATE}
+        {FRAME_INOUT, data::image::BUFFER_MODIFIED_SIG, service::slots::UPDATE},
+        {CAMERA_INPUT, data::camera::MODIFIED_SIG, RESET_CAMERA_SLOT},
+        {CAMERA_INPUT, data::camera::INTRINSIC_CALIBRATED_SIG, RESET_CAMERA_SLOT}
     };
 }
 
@@ -135,6 +140,18 @@ void aruco_tracker::stopping()
 {
     m_is_initialized = false;
     m_is_tracking    = false;
+    m_undistort_maps.reset();
+}
+
+//-----------------------------------------------------------------------------
+
+void aruco_tracker::reset_camera()
+{
+    m_is_initialized = false;
+    m_undistort_maps.reset();
+
+    const auto camera = m_camera.lock();
+    sight::geometry::vision::remap_cache::get().invalidate(*camera);
 }
 
 //-----------------------------------------------------------------------------
@@ -209,7 +226,24 @@ void aruco_tracker::tracking(core::clock::type& _timestamp)
             const auto ar_cam = m_camera.lock();
             if(ar_cam->get_is_calibrated())
             {
-                cv::undistort(grey, undistort_grey, m_camera_params.intrinsic, m_camera_params.distorsion);
+                if(grey.size() == m_camera_params.size)
+                {
+                    // Recomputing the undistortion tables at each frame is far more expensive than the remap itself
+                    if(!m_undistort_maps)
+                    {
+                        m_undistort_maps = sight::geometry::vision::remap_cache::get().get_maps(
+                            *ar_cam,
+                            sight::geometry::vision::remap_cache::direction::undistort
+                        );
+                    }
+
+                    sight::geometry::vision::remap_cache::remap(grey, undistort_grey, *m_undistort_maps);
+                }
+                else
+                {
+                    // The calibration resolution does not match the frame, the tables can not be used
+                    cv::undistort(grey, undistort_grey, m_camera_params.intrinsic, m_camera_params.distorsion);
+                }
             }
             else
             {
@@ -29,6 +29,8 @@
 #include <data/marker_map.hpp>
 #include <data/real.hpp>
 
+#include <geometry/vision/remap_cache.hpp>
+
 #include <service/tracker.hpp>
 
 #include <ui/__/parameter.hpp>
@@ -174,9 +176,15 @@ private:
     /// Slot called when a boolean value is changed
     void on_property_set(std::string_view _key) override;
 
+    /// Slot: reads the camera parameters again on the next frame, when the calibration is modified
+    void reset_camera();
+
     /// Camera parameters
     camera m_camera_params;
 
+    /// Undistortion tables, shared with the other services using the same camera calibration
+    sight::geometry::vision::remap_cache::maps_csptr m_undistort_maps;
+
     /// Marker vector [[0,1,2],[4,5,6]]
     marker_id_vector_t m_markers;
 
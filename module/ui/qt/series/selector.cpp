@@ -1,6 +1,6 @@
 /************************************************************************
  *
- * Copyright (C) 2009-2023 IRCAD France
+ * Copyright (C) 2009-2025 IRCAD France
  * Copyright (C) 2012-2020 IHU Strasbourg
  *
  * This file is part of Sight.
@@ -216,11 +216,7 @@ void selector::updating()
     const auto series_set = m_series_set.lock();
 
     m_selector_widget->clear();
-
-    for(const auto& series : *series_set)
-    {
-        m_selector_widget->add_series(series);
-    }
+    m_selector_widget->add_series(std::vector<data::series::sptr>(series_set->cbegin(), series_set->cend()));
 }
 
 //------------------------------------------------------------------------------
@@ -294,10 +290,7 @@ void selector::on_remove_series(QVector<data::series::sptr> _selection)
 
 void selector::add_series(data::series_set::container_t _added_series)
 {
-    for(const auto& series : _added_series)
-    {
-        m_selector_widget->add_series(series);
-    }
+    m_selector_widget->add_series(std::vector<data::series::sptr>(_added_series.cbegin(), _added_series.cend()));
 }
 
 //------------------------------------------------------------------------------